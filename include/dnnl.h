@@ -261,10 +261,53 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_output_scales(
 ///      responsibility to set proper values. The following formula must hold:
 ///
 ///      \f[count = \prod\limits_{d \in mask} output.dims[d]\f]
+///
+/// @note
+///      To defer the scales to execution time, set @p count to 1 and the only
+///      scale to #DNNL_RUNTIME_F32_VAL. The actual scales must then be passed
+///      to the primitive as a one-dimensional f32 memory with the
+///      #DNNL_ARG_ATTR_OUTPUT_SCALES argument index. The memory must hold
+///      the number of elements implied by @p mask (a single element is
+///      allowed when @p mask is 0). Only some implementations support
+///      run-time scales; primitive descriptor creation fails for the rest.
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_output_scales(
         dnnl_primitive_attr_t attr, dnnl_dim_t count, int mask,
         const float *scales);
 
+/// Returns @p count, correspondence zero point @p mask, and a pointer to a
+/// constant int32_t array of @p zero_points for given @p attr and memory
+/// argument (index), previously set by dnnl_primitive_attr_set_zero_points.
+///
+/// @warning
+///      The @p zero_points array points to the internal @p attr field, so the
+///      user should not modify or destroy @p zero_points.
+///
+/// @warning
+///      The lifetime of @p zero_points is the same as that of the @p attr to
+///      which it belongs, so it is illegal to use @p zero_points after @p attr
+///      is destroyed.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_zero_points(
+        const_dnnl_primitive_attr_t attr, int arg, dnnl_dim_t *count,
+        int *mask, const int32_t **zero_points);
+
+/// Sets zero points for primitive operations for given memory argument @p
+/// arg (#DNNL_ARG_SRC, #DNNL_ARG_WEIGHTS, or #DNNL_ARG_DST). The zero point
+/// is subtracted from the source and weights values and added to the
+/// destination values.
+///
+/// Only a common zero point is supported, so @p count must be 1 and @p mask
+/// must be 0. Set the only zero point to #DNNL_RUNTIME_S32_VAL to defer it to
+/// execution time. The actual value must then be passed to the primitive as a
+/// one-element s32 memory with the (#DNNL_ARG_ATTR_ZERO_POINTS | @p arg)
+/// argument index.
+///
+/// @note
+///      Zero points are supported by the matmul primitive only; primitive
+///      descriptor creation fails for the rest.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_zero_points(
+        dnnl_primitive_attr_t attr, int arg, dnnl_dim_t count, int mask,
+        const int32_t *zero_points);
+
 /// Returns @p post_ops for given @p attr.
 ///
 /// @warning
@@ -652,10 +695,13 @@ dnnl_status_t DNNL_API dnnl_sum_primitive_desc_create(
 /// @{
 
 /// Initializes a binary descriptor @p binary_desc, @p alg_kind (possible
-/// values are #dnnl_binary_add and #dnnl_binary_mul), and memory descriptors.
+/// values are #dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max,
+/// #dnnl_binary_min, #dnnl_binary_sub and #dnnl_binary_div), and memory
+/// descriptors.
 ///
 /// @note Memory descriptor @p dst_desc can have @p format_kind set to
-///       #dnnl_format_kind_any.
+///       #dnnl_format_kind_any. Otherwise it must match @p src0_desc in
+///       everything except the data type.
 ///
 /// @note Both memory descriptors must have the same number of dimensions.
 ///       Element broadcasting is supported for memory descriptor @p src1_desc
@@ -675,6 +721,131 @@ dnnl_status_t DNNL_API dnnl_binary_desc_init(dnnl_binary_desc_t *binary_desc,
 
 /// @}
 
+/// @addtogroup c_api_matmul Matrix multiplication
+/// A primitive to perform matrix-matrix multiplication. The batched mode
+/// is supported with 3D tensors.
+///
+///  @sa @ref dev_guide_matmul in developer guide
+///  @sa @ref cpp_api_matmul in @ref cpp_api
+/// @{
+
+/// Initializes a matrix multiplication descriptor @p matmul_desc using the
+/// memory descriptors @p src_desc, @p weights_desc, @p bias_desc, and @p
+/// dst_desc. In order to create a matrix multiplication without bias, @p
+/// bias_desc should either be @c NULL or point to a descriptor with memory
+/// format kind equal to #dnnl_format_kind_undef.
+///
+/// @note Memory descriptors can be initialized with #dnnl_format_tag_any or
+///       with format_kind set to #dnnl_format_kind_any.
+///
+/// @note All memory descriptors must have the same number of dimensions,
+///       either 2 (M x K by K x N) or 3 (MB x M x K by MB x K x N). The batch
+///       dimension of either the source or the weights may be 1, in which
+///       case the matrix is broadcast across the batch. Each dimension of
+///       the bias must be either 1 or equal to the corresponding dimension
+///       of the destination.
+///
+/// Inputs:
+///  - src (#dnnl_query_src_md, 0)
+///  - weights (#dnnl_query_weights_md, 0)
+///  - bias (#dnnl_query_weights_md, 1), if created with bias
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_matmul_desc_init(dnnl_matmul_desc_t *matmul_desc,
+        const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *weights_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_desc);
+
+/// @}
+
+/// @addtogroup c_api_reduction Reduction
+/// A primitive to reduce a tensor over an arbitrary set of its dimensions.
+///
+///  @sa @ref dev_guide_reduction in developer guide
+///  @sa @ref cpp_api_reduction in @ref cpp_api
+/// @{
+
+/// Initializes a reduction descriptor @p reduction_desc using @p alg_kind
+/// (possible values are #dnnl_reduction_max, #dnnl_reduction_min,
+/// #dnnl_reduction_sum, #dnnl_reduction_mul, #dnnl_reduction_mean,
+/// #dnnl_reduction_norm_lp_max, #dnnl_reduction_norm_lp_sum,
+/// #dnnl_reduction_norm_lp_power_p_max, and
+/// #dnnl_reduction_norm_lp_power_p_sum), memory descriptors, the power @p p,
+/// and the epsilon @p eps. The last two are used by the lp norm algorithms
+/// only.
+///
+/// @note The destination must have the same number of dimensions as the
+///       source. Every destination dimension must be either equal to the
+///       source one or 1, in which case the dimension is reduced.
+///
+/// @note Destination memory descriptor may be initialized with
+///       #dnnl_format_tag_any value of @p format_kind.
+///
+/// Inputs:
+///  - src (#dnnl_query_src_md, 0)
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_reduction_desc_init(
+        dnnl_reduction_desc_t *reduction_desc, dnnl_alg_kind_t alg_kind,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc,
+        float p, float eps);
+
+/// @}
+
+/// @addtogroup c_api_resampling Resampling
+/// A primitive to compute resampling operation on 1D, 2D or 3D data tensor
+/// using nearest neighbor or linear (bilinear, trilinear) interpolation.
+///
+///  @sa @ref dev_guide_resampling in developer guide
+///  @sa @ref cpp_api_resampling in @ref cpp_api
+/// @{
+
+/// Initializes a resampling descriptor @p resampling_desc for forward
+/// propagation using @p prop_kind (possible values are
+/// #dnnl_forward_training and #dnnl_forward_inference), @p alg_kind
+/// (possible values are #dnnl_resampling_nearest and
+/// #dnnl_resampling_linear), spatial scaling @p factors, and memory
+/// descriptors.
+///
+/// @note The @p factors may be NULL, in which case they are computed from
+///       the source and destination spatial dimensions. The @p dst_desc may
+///       be NULL, in which case its dimensions are computed from the source
+///       dimensions and the @p factors and its format is
+///       #dnnl_format_tag_any. They cannot both be NULL.
+///
+/// Inputs:
+///  - src (#dnnl_query_src_md, 0)
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_resampling_forward_desc_init(
+        dnnl_resampling_desc_t *resampling_desc, dnnl_prop_kind_t prop_kind,
+        dnnl_alg_kind_t alg_kind, const float *factors,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc);
+
+/// Initializes a resampling descriptor @p resampling_desc for backward
+/// propagation using @p alg_kind (possible values are
+/// #dnnl_resampling_nearest and #dnnl_resampling_linear), spatial scaling
+/// @p factors, and memory descriptors.
+///
+/// @note The @p factors may be NULL, in which case they are computed from
+///       the source and destination spatial dimensions.
+///
+/// Inputs:
+///  - diff_dst (#dnnl_query_diff_dst_md, 0)
+///
+/// Outputs:
+///  - diff_src (#dnnl_query_diff_src_md, 0)
+dnnl_status_t DNNL_API dnnl_resampling_backward_desc_init(
+        dnnl_resampling_desc_t *resampling_desc, dnnl_alg_kind_t alg_kind,
+        const float *factors, const dnnl_memory_desc_t *diff_src_desc,
+        const dnnl_memory_desc_t *diff_dst_desc);
+
+/// @}
+
 /// @addtogroup c_api_convolution Convolution
 /// The convolution primitive computes a forward, backward, or weight update for
 /// a batched convolution operation on 1D, 2D, or 3D spatial data with bias.
@@ -1101,6 +1272,42 @@ dnnl_status_t DNNL_API dnnl_softmax_backward_desc_init(
 
 /// @}
 
+/// @addtogroup c_api_logsoftmax LogSoftmax
+/// A primitive to perform logsoftmax.
+///
+/// @sa @ref dev_guide_logsoftmax in developer guide
+/// @sa @ref cpp_api_logsoftmax in @ref cpp_api
+/// @{
+
+/// Initializes a @p logsoftmax_desc for forward propagation using @p
+/// prop_kind (possible values are #dnnl_forward_training and
+/// #dnnl_forward_inference) and memory descriptor @p data_desc.
+///
+/// Inputs:
+///  - src (#dnnl_query_src_md, 0)
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_logsoftmax_forward_desc_init(
+        dnnl_logsoftmax_desc_t *logsoftmax_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *data_desc, int logsoftmax_axis);
+
+/// Initializes a @p logsoftmax_desc for backward propagation using memory
+/// descriptors @p diff_desc and @p data_desc.
+///
+/// Inputs:
+///  - dst (#dnnl_query_dst_md, 0)
+///  - diff_dst (#dnnl_query_diff_dst_md, 0)
+///
+/// Outputs:
+///  - diff_src (#dnnl_query_diff_src_md, 0)
+dnnl_status_t DNNL_API dnnl_logsoftmax_backward_desc_init(
+        dnnl_logsoftmax_desc_t *logsoftmax_desc,
+        const dnnl_memory_desc_t *diff_desc,
+        const dnnl_memory_desc_t *data_desc, int logsoftmax_axis);
+
+/// @}
+
 /// @addtogroup c_api_pooling Pooling
 /// A primitive to perform max or average pooling.
 ///
@@ -1664,6 +1871,109 @@ dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
         const dnnl_memory_desc_t *dst_iter_desc,
         const dnnl_memory_desc_t *dst_iter_c_desc, unsigned flags);
 
+/// Initializes an LSTM (with or without peephole) descriptor @p rnn_desc for
+/// forward propagation using @p prop_kind, @p direction, and memory
+/// descriptors.
+/// @note If @p prop_kind equals #dnnl_forward_training, you must query a
+/// workspace memory descriptor before creating the primitive.
+///
+/// @p src_iter_desc, @p src_iter_c_desc, @p weights_peephole_desc,
+/// @p bias_desc, @p dst_iter_desc, and @p dst_iter_c_desc are allowed to
+/// either be @c NULL or point to a zero memory descriptor, which would
+/// indicate that the RNN primitive should not use them and will default to
+/// zero values.
+///
+/// The peephole weights have the {L, D, 3, DIC} shape and hold the peephole
+/// coefficients of the input, forget, and output gates, in this order.
+///
+/// @note All memory descriptors except @p src_iter_desc are allowed to be
+///       initialized with #dnnl_format_kind_any value of @p format_kind.
+///
+/// Parameters:
+///  - flags (unused for now)
+///
+/// Inputs:
+///  - src_layer (#dnnl_query_src_md, 0)
+///  - src_iter (#dnnl_query_src_md, 1), if used
+///  - src_iter_c (#dnnl_query_src_md, 2), if used
+///  - weights_layer (#dnnl_query_weights_md, 0)
+///  - weights_iter (#dnnl_query_weights_md, 1)
+///  - bias (#dnnl_query_weights_md, 2), if used
+///  - weights_peephole (#dnnl_query_weights_md, 3), if used
+///
+/// Outputs:
+///  - dst_layer (#dnnl_query_dst_md, 0)
+///  - dst_iter (#dnnl_query_dst_md, 1), if used
+///  - dst_iter_c (#dnnl_query_dst_md, 2), if used
+///  - workspace (#dnnl_query_workspace_md, 0),
+///      if @p prop_kind equals #dnnl_forward_training
+dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v2(dnnl_rnn_desc_t *rnn_desc,
+        dnnl_prop_kind_t prop_kind, dnnl_rnn_direction_t direction,
+        const dnnl_memory_desc_t *src_layer_desc,
+        const dnnl_memory_desc_t *src_iter_desc,
+        const dnnl_memory_desc_t *src_iter_c_desc,
+        const dnnl_memory_desc_t *weights_layer_desc,
+        const dnnl_memory_desc_t *weights_iter_desc,
+        const dnnl_memory_desc_t *weights_peephole_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_layer_desc,
+        const dnnl_memory_desc_t *dst_iter_desc,
+        const dnnl_memory_desc_t *dst_iter_c_desc, unsigned flags);
+
+/// Initializes an LSTM (with or without peephole and with or without
+/// projection) descriptor @p rnn_desc for forward propagation using
+/// @p prop_kind, @p direction, and memory descriptors.
+/// @note If @p prop_kind equals #dnnl_forward_training, you must query a
+/// workspace memory descriptor before creating the primitive.
+///
+/// @p src_iter_desc, @p src_iter_c_desc, @p weights_peephole_desc,
+/// @p weights_projection_desc, @p bias_desc, @p dst_iter_desc, and
+/// @p dst_iter_c_desc are allowed to either be @c NULL or point to a zero
+/// memory descriptor, which would indicate that the RNN primitive should not
+/// use them and will default to zero values.
+///
+/// The projection weights have the {L, D, DIC, DHC} shape and map the DIC
+/// wide output of the cell to the DHC wide hidden state. With projection the
+/// hidden state parts of @p src_iter_desc, @p dst_iter_desc, and
+/// @p dst_layer_desc have DHC channels, while the cell state keeps DIC
+/// channels.
+///
+/// @note All memory descriptors except @p src_iter_desc are allowed to be
+///       initialized with #dnnl_format_kind_any value of @p format_kind.
+///
+/// Parameters:
+///  - flags (unused for now)
+///
+/// Inputs:
+///  - src_layer (#dnnl_query_src_md, 0)
+///  - src_iter (#dnnl_query_src_md, 1), if used
+///  - src_iter_c (#dnnl_query_src_md, 2), if used
+///  - weights_layer (#dnnl_query_weights_md, 0)
+///  - weights_iter (#dnnl_query_weights_md, 1)
+///  - bias (#dnnl_query_weights_md, 2), if used
+///  - weights_peephole (#dnnl_query_weights_md, 3), if used
+///  - weights_projection (#dnnl_query_weights_md, 4), if used
+///
+/// Outputs:
+///  - dst_layer (#dnnl_query_dst_md, 0)
+///  - dst_iter (#dnnl_query_dst_md, 1), if used
+///  - dst_iter_c (#dnnl_query_dst_md, 2), if used
+///  - workspace (#dnnl_query_workspace_md, 0),
+///      if @p prop_kind equals #dnnl_forward_training
+dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v3(dnnl_rnn_desc_t *rnn_desc,
+        dnnl_prop_kind_t prop_kind, dnnl_rnn_direction_t direction,
+        const dnnl_memory_desc_t *src_layer_desc,
+        const dnnl_memory_desc_t *src_iter_desc,
+        const dnnl_memory_desc_t *src_iter_c_desc,
+        const dnnl_memory_desc_t *weights_layer_desc,
+        const dnnl_memory_desc_t *weights_iter_desc,
+        const dnnl_memory_desc_t *weights_peephole_desc,
+        const dnnl_memory_desc_t *weights_projection_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_layer_desc,
+        const dnnl_memory_desc_t *dst_iter_desc,
+        const dnnl_memory_desc_t *dst_iter_c_desc, unsigned flags);
+
 /// Initializes an LSTM descriptor @p rnn_desc for backward propagation
 /// using @p prop_kind, @p direction, and memory descriptors.
 ///
@@ -249,6 +249,14 @@ public:
         rnn = dnnl_rnn,
         /// A binary primitive.
         binary = dnnl_binary,
+        /// A matmul (matrix multiplication) primitive.
+        matmul = dnnl_matmul,
+        /// A reduction primitive.
+        reduction = dnnl_reduction,
+        /// A resampling primitive.
+        resampling = dnnl_resampling,
+        /// A logsoftmax primitive.
+        logsoftmax = dnnl_logsoftmax,
     };
 
     primitive(const_dnnl_primitive_desc_t c_pd);
@@ -361,6 +369,18 @@ enum class algorithm {
     eltwise_exp = dnnl_eltwise_exp,
     /// Eltwise: gelu
     eltwise_gelu = dnnl_eltwise_gelu,
+    /// Eltwise: ReLU (dst for backward)
+    eltwise_relu_use_dst_for_bwd = dnnl_eltwise_relu_use_dst_for_bwd,
+    /// Eltwise: hyperbolic tangent non-linearity (tanh) (dst for backward)
+    eltwise_tanh_use_dst_for_bwd = dnnl_eltwise_tanh_use_dst_for_bwd,
+    /// Eltwise: parametric exponential linear unit (elu) (dst for backward)
+    eltwise_elu_use_dst_for_bwd = dnnl_eltwise_elu_use_dst_for_bwd,
+    /// Eltwise: square root (dst for backward)
+    eltwise_sqrt_use_dst_for_bwd = dnnl_eltwise_sqrt_use_dst_for_bwd,
+    /// Eltwise: logistic (dst for backward)
+    eltwise_logistic_use_dst_for_bwd = dnnl_eltwise_logistic_use_dst_for_bwd,
+    /// Eltwise: exp (dst for backward)
+    eltwise_exp_use_dst_for_bwd = dnnl_eltwise_exp_use_dst_for_bwd,
     /// Local response normalization (LRN) across multiple channels
     lrn_across_channels = dnnl_lrn_across_channels,
     /// LRN within a single channel
@@ -392,6 +412,36 @@ enum class algorithm {
     binary_add = dnnl_binary_add,
     /// Binary mul
     binary_mul = dnnl_binary_mul,
+    /// Binary max
+    binary_max = dnnl_binary_max,
+    /// Binary min
+    binary_min = dnnl_binary_min,
+    /// Binary sub
+    binary_sub = dnnl_binary_sub,
+    /// Binary div
+    binary_div = dnnl_binary_div,
+    /// Reduction using max
+    reduction_max = dnnl_reduction_max,
+    /// Reduction using min
+    reduction_min = dnnl_reduction_min,
+    /// Reduction using sum
+    reduction_sum = dnnl_reduction_sum,
+    /// Reduction using mul
+    reduction_mul = dnnl_reduction_mul,
+    /// Reduction using mean
+    reduction_mean = dnnl_reduction_mean,
+    /// Reduction using lp norm: root_p(max(sum |x|^p, eps))
+    reduction_norm_lp_max = dnnl_reduction_norm_lp_max,
+    /// Reduction using lp norm: root_p(sum |x|^p + eps)
+    reduction_norm_lp_sum = dnnl_reduction_norm_lp_sum,
+    /// Reduction using lp norm without the final root: max(sum |x|^p, eps)
+    reduction_norm_lp_power_p_max = dnnl_reduction_norm_lp_power_p_max,
+    /// Reduction using lp norm without the final root: sum |x|^p + eps
+    reduction_norm_lp_power_p_sum = dnnl_reduction_norm_lp_power_p_sum,
+    /// Nearest neighbor resampling
+    resampling_nearest = dnnl_resampling_nearest,
+    /// Linear (bilinear, trilinear) resampling
+    resampling_linear = dnnl_resampling_linear,
 };
 
 inline dnnl_alg_kind_t convert_to_c(algorithm aalgorithm) {
@@ -442,7 +492,14 @@ inline dnnl_normalization_flags_t convert_to_c(normalization_flags aflag) {
     return static_cast<dnnl_normalization_flags_t>(aflag);
 }
 
-enum class rnn_flags : unsigned { undef = dnnl_rnn_flags_undef };
+/// RNN cell flags.
+enum class rnn_flags : unsigned {
+    /// Undefined RNN flags
+    undef = dnnl_rnn_flags_undef,
+    /// Stateful execution: the hidden and cell states stay resident in the
+    /// primitive between executions. See #dnnl_rnn_flags_stateful.
+    stateful = dnnl_rnn_flags_stateful,
+};
 
 inline dnnl_rnn_flags_t convert_to_c(rnn_flags aflag) {
     return static_cast<dnnl_rnn_flags_t>(aflag);
@@ -572,6 +629,14 @@ enum class query {
     rnn_d = dnnl_query_rnn_d,
     /// binary descriptor
     binary_d = dnnl_query_binary_d,
+    /// matmul descriptor
+    matmul_d = dnnl_query_matmul_d,
+    /// reduction descriptor
+    reduction_d = dnnl_query_reduction_d,
+    /// resampling descriptor
+    resampling_d = dnnl_query_resampling_d,
+    /// logsoftmax descriptor
+    logsoftmax_d = dnnl_query_logsoftmax_d,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -766,12 +831,51 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
     ///       - 2D dimensional data the order of dimensions is always: (n, c)
     ///       - 4D dimensional data the order is always: (n, c, h, w)
     ///       - 5D dimensional weights the order is always: (g, oc, ic, kh, kw)
+    ///
+    /// @note
+    ///      Pass a single #DNNL_RUNTIME_F32_VAL in @p scales to provide the
+    ///      actual scales at execution time with the
+    ///      #DNNL_ARG_ATTR_OUTPUT_SCALES argument.
     void set_output_scales(int mask, const std::vector<float> &scales) {
         error::wrap_c_api(dnnl_primitive_attr_set_output_scales(get(),
                                   (dnnl_dim_t)scales.size(), mask, &scales[0]),
                 "could not set int output scales");
     }
 
+    /// Gets correspondence zero point @p mask and a constant int32_t vector
+    /// of @p zero_points for memory argument @p arg previously set by
+    /// set_zero_points.
+    void get_zero_points(
+            int arg, int &mask, std::vector<int32_t> &zero_points) const {
+        dnnl_dim_t count;
+        int c_mask;
+        const int32_t *c_zero_points;
+        error::wrap_c_api(dnnl_primitive_attr_get_zero_points(get(), arg,
+                                  &count, &c_mask, &c_zero_points),
+                "could not get zero points");
+        zero_points.resize(count);
+
+        mask = c_mask;
+        for (dnnl_dim_t c = 0; c < count; ++c)
+            zero_points[c] = c_zero_points[c];
+    }
+
+    /// Sets @p zero_points for memory argument @p arg (DNNL_ARG_SRC,
+    /// DNNL_ARG_WEIGHTS, or DNNL_ARG_DST). Only a single common zero point
+    /// (@p mask equal to 0) is supported.
+    ///
+    /// @note
+    ///      Pass a single #DNNL_RUNTIME_S32_VAL in @p zero_points to provide
+    ///      the actual value at execution time with the
+    ///      (#DNNL_ARG_ATTR_ZERO_POINTS | @p arg) argument.
+    void set_zero_points(
+            int arg, int mask, const std::vector<int32_t> &zero_points) {
+        error::wrap_c_api(dnnl_primitive_attr_set_zero_points(get(), arg,
+                                  (dnnl_dim_t)zero_points.size(), mask,
+                                  &zero_points[0]),
+                "could not set zero points");
+    }
+
     /// Returns @p post_ops previously set by set_post_ops.
     const post_ops get_post_ops() const {
         post_ops result;
@@ -1288,6 +1392,7 @@ struct memory : public handle<dnnl_memory_t> {
         ldigo = dnnl_ldigo,
         ldgoi = dnnl_ldgoi,
         ldgo = dnnl_ldgo,
+        ldio = dnnl_ldio,
         nCdhw16c = dnnl_nCdhw16c,
         nCdhw4c = dnnl_nCdhw4c,
         nCdhw8c = dnnl_nCdhw8c,
@@ -3490,6 +3595,129 @@ struct softmax_backward : public primitive {
 
 /// @}
 
+/// @addtogroup cpp_api_logsoftmax Logsoftmax
+/// A primitive to perform logsoftmax.
+///
+/// @sa @ref dev_guide_logsoftmax in developer guide
+/// @sa @ref c_api_logsoftmax in @ref c_api
+/// @{
+
+/// Logsoftmax for forward propagation.  Implements descriptor, primitive
+/// descriptor, and primitive.
+struct logsoftmax_forward : public primitive {
+
+    /// Descriptor for logsoftmax forward propagation.
+    struct desc {
+        dnnl_logsoftmax_desc_t data;
+
+        /// Initializes a logsoftmax descriptor for forward propagation using
+        /// @p prop_kind (possible values are #dnnl::forward_training and
+        /// #dnnl::forward_inference) and memory descriptor @p data_desc.
+        desc(prop_kind aprop_kind, const memory::desc &data_desc,
+                int logsoftmax_axis) {
+            error::wrap_c_api(dnnl_logsoftmax_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      &data_desc.data, logsoftmax_axis),
+                    "could not create a logsoftmax forward descriptor");
+        }
+    };
+
+    /// Primitive descriptor for logsoftmax forward propagation.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(
+                const desc &desc, const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, nullptr, e, nullptr, allow_empty) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr, allow_empty) {
+        }
+
+        /// Initializes a primitive descriptor for logsoftmax forward
+        /// propagation from a C primitive descriptor @p pd.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::logsoftmax,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    logsoftmax_forward() = default;
+
+    logsoftmax_forward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// Logsoftmax for backward propagation.  Implements descriptor, primitive
+/// descriptor, and primitive.
+struct logsoftmax_backward : public primitive {
+
+    /// Descriptor for logsoftmax backward propagation.
+    struct desc {
+        dnnl_logsoftmax_desc_t data;
+
+        /// Initializes a logsoftmax descriptor for backward propagation using
+        /// memory descriptors @p diff_desc and @p data_desc.
+        desc(const memory::desc &diff_desc, const memory::desc &data_desc,
+                int logsoftmax_axis) {
+            error::wrap_c_api(
+                    dnnl_logsoftmax_backward_desc_init(&data, &diff_desc.data,
+                            &data_desc.data, logsoftmax_axis),
+                    "could not init a backward logsoftmax descriptor");
+        }
+    };
+
+    /// Primitive descriptor for logsoftmax backward propagation.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e,
+                const logsoftmax_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, nullptr, e, hint_fwd_pd.get(), allow_empty) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e,
+                const logsoftmax_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, &attr, e, hint_fwd_pd.get(), allow_empty) {}
+
+        /// Initializes a primitive descriptor for logsoftmax backward
+        /// propagation from a C primitive descriptor @p pd.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::logsoftmax,
+                    dnnl::prop_kind::backward_data) {}
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+
+        /// Queries diff source memory descriptor.
+        memory::desc diff_src_desc() const {
+            return query_md(query::diff_src_md, 0);
+        }
+
+        /// Queries diff destination memory descriptor.
+        memory::desc diff_dst_desc() const {
+            return query_md(query::diff_dst_md, 0);
+        }
+    };
+
+    logsoftmax_backward() = default;
+
+    logsoftmax_backward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
 /// @addtogroup cpp_api_batch_normalization Batch normalization
 /// A primitive to perform batch normalization.
 ///
@@ -4589,6 +4817,70 @@ struct lstm_forward : public primitive {
                             dnnl::convert_to_c(flags)),
                     "could not create an LSTM forward descriptor");
         }
+
+        /// Initializes an LSTM descriptor with peephole connections for
+        /// forward propagation using @p prop_kind, @p direction, and memory
+        /// descriptors.
+        ///
+        /// The peephole weights have the {L, D, 3, DIC} shape. The rest of
+        /// the parameters have the same meaning as for the LSTM descriptor
+        /// without peephole connections.
+        desc(prop_kind aprop_kind, rnn_direction direction,
+                const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &src_iter_c_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &weights_peephole_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc,
+                const memory::desc &dst_iter_c_desc,
+                rnn_flags flags = rnn_flags::undef) {
+            error::wrap_c_api(
+                    dnnl_lstm_forward_desc_init_v2(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            dnnl::convert_to_c(direction), &src_layer_desc.data,
+                            &src_iter_desc.data, &src_iter_c_desc.data,
+                            &weights_layer_desc.data, &weights_iter_desc.data,
+                            &weights_peephole_desc.data, &bias_desc.data,
+                            &dst_layer_desc.data, &dst_iter_desc.data,
+                            &dst_iter_c_desc.data, dnnl::convert_to_c(flags)),
+                    "could not create an LSTM forward descriptor");
+        }
+
+        /// Initializes an LSTM descriptor with peephole connections and
+        /// projection for forward propagation using @p prop_kind,
+        /// @p direction, and memory descriptors.
+        ///
+        /// The projection weights have the {L, D, DIC, DHC} shape. Either of
+        /// @p weights_peephole_desc and @p weights_projection_desc is allowed
+        /// to point to a zero memory descriptor.
+        desc(prop_kind aprop_kind, rnn_direction direction,
+                const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &src_iter_c_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &weights_peephole_desc,
+                const memory::desc &weights_projection_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc,
+                const memory::desc &dst_iter_c_desc,
+                rnn_flags flags = rnn_flags::undef) {
+            error::wrap_c_api(
+                    dnnl_lstm_forward_desc_init_v3(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            dnnl::convert_to_c(direction), &src_layer_desc.data,
+                            &src_iter_desc.data, &src_iter_c_desc.data,
+                            &weights_layer_desc.data, &weights_iter_desc.data,
+                            &weights_peephole_desc.data,
+                            &weights_projection_desc.data, &bias_desc.data,
+                            &dst_layer_desc.data, &dst_iter_desc.data,
+                            &dst_iter_c_desc.data, dnnl::convert_to_c(flags)),
+                    "could not create an LSTM forward descriptor");
+        }
     };
 
     /// Primitive descriptor for LSTM forward propagation.
@@ -4648,6 +4940,22 @@ struct lstm_forward : public primitive {
             return query_md(query::weights_md, 2);
         }
 
+        /// Queries peephole weights memory descriptor.
+        ///
+        /// Returns a zero_md if no peephole weights were specified at op_desc
+        /// creation time.
+        memory::desc weights_peephole_desc() const {
+            return query_md(query::weights_md, 3);
+        }
+
+        /// Queries projection weights memory descriptor.
+        ///
+        /// Returns a zero_md if no projection weights were specified at
+        /// op_desc creation time.
+        memory::desc weights_projection_desc() const {
+            return query_md(query::weights_md, 4);
+        }
+
         /// Queries destination layer memory descriptor.
         memory::desc dst_layer_desc() const {
             return query_md(query::dst_md, 0);
@@ -5665,6 +5973,316 @@ struct binary : public primitive {
 
 /// @}
 
+/// @addtogroup cpp_api_matmul Matrix multiplication
+/// A primitive to perform matrix-matrix multiplication. The batched mode
+/// is supported with 3D tensors.
+///
+/// @sa @ref dev_guide_matmul in developer guide
+/// @sa @ref c_api_matmul in @ref c_api
+/// @{
+
+/// Matrix multiplication primitive.
+struct matmul : public primitive {
+
+    /// Descriptor for matmul.
+    struct desc {
+        dnnl_matmul_desc_t data;
+
+        /// Initializes a matmul descriptor using memory descriptors @p src,
+        /// @p weights, and @p dst.
+        desc(const memory::desc &src, const memory::desc &weights,
+                const memory::desc &dst) {
+            error::wrap_c_api(dnnl_matmul_desc_init(&data, &src.data,
+                                      &weights.data, nullptr, &dst.data),
+                    "could not create a matmul descriptor");
+        }
+
+        /// Initializes a matmul descriptor using memory descriptors @p src,
+        /// @p weights, @p bias, and @p dst.
+        desc(const memory::desc &src, const memory::desc &weights,
+                const memory::desc &bias, const memory::desc &dst) {
+            error::wrap_c_api(dnnl_matmul_desc_init(&data, &src.data,
+                                      &weights.data, &bias.data, &dst.data),
+                    "could not create a matmul descriptor");
+        }
+    };
+
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        /// Initializes a primitive descriptor for matmul.
+        primitive_desc(
+                const desc &desc, const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, nullptr, e, nullptr, allow_empty) {}
+
+        /// Initializes a primitive descriptor for matmul with attributes
+        /// defined by @p attr.
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr, allow_empty) {
+        }
+
+        /// Initializes a primitive descriptor for matmul from a C primitive
+        /// descriptor @p pd.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::matmul) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// Queries weights memory descriptor.
+        memory::desc weights_desc() const {
+            return query_md(query::weights_md, 0);
+        }
+
+        /// Queries bias memory descriptor.
+        ///
+        /// Returns a zero_md if no bias was specified at matmul descriptor
+        /// creation time.
+        memory::desc bias_desc() const {
+            return query_md(query::weights_md, 1);
+        }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    matmul() = default;
+
+    matmul(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
+/// @addtogroup cpp_api_reduction Reduction
+/// A primitive to reduce a tensor over an arbitrary set of its dimensions.
+///
+/// @sa @ref dev_guide_reduction in developer guide
+/// @sa @ref c_api_reduction in @ref c_api
+/// @{
+
+/// Reduction primitive.
+struct reduction : public primitive {
+
+    /// Descriptor for reduction.
+    struct desc {
+        dnnl_reduction_desc_t data;
+
+        /// Initializes a reduction descriptor using @p algorithm and memory
+        /// descriptors @p src and @p dst. The dimensions of @p dst equal to
+        /// 1 are reduced. The power @p p and the epsilon @p eps are used by
+        /// the lp norm algorithms only.
+        desc(algorithm aalgorithm, const memory::desc &src,
+                const memory::desc &dst, float p = 0.f, float eps = 0.f) {
+            error::wrap_c_api(
+                    dnnl_reduction_desc_init(&data, convert_to_c(aalgorithm),
+                            &src.data, &dst.data, p, eps),
+                    "could not create a reduction descriptor");
+        }
+    };
+
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        /// Initializes a primitive descriptor for reduction.
+        primitive_desc(
+                const desc &desc, const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, nullptr, e, nullptr, allow_empty) {}
+
+        /// Initializes a primitive descriptor for reduction with attributes
+        /// defined by @p attr.
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr, allow_empty) {
+        }
+
+        /// Initializes a primitive descriptor for reduction from a C
+        /// primitive descriptor @p pd.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::reduction) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    reduction() = default;
+
+    reduction(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
+/// @addtogroup cpp_api_resampling Resampling
+/// A primitive to compute resampling operation on 1D, 2D or 3D data tensor
+/// using nearest neighbor or linear (bilinear, trilinear) interpolation.
+///
+/// @sa @ref dev_guide_resampling in developer guide
+/// @sa @ref c_api_resampling in @ref c_api
+/// @{
+
+/// Resampling for forward propagation.  Implements descriptor, primitive
+/// descriptor, and primitive.
+struct resampling_forward : public primitive {
+
+    /// Descriptor for resampling forward propagation.
+    struct desc {
+        dnnl_resampling_desc_t data;
+
+        /// Initializes a resampling descriptor for forward propagation using
+        /// @p aprop_kind (possible values are #dnnl::forward_training and
+        /// #dnnl::forward_inference), @p aalgorithm, and memory descriptors.
+        /// The scaling factors are computed from the spatial dimensions.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc) {
+            error::wrap_c_api(dnnl_resampling_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      convert_to_c(aalgorithm), nullptr,
+                                      &src_desc.data, &dst_desc.data),
+                    "could not init a forward resampling descriptor");
+        }
+
+        /// Initializes a resampling descriptor for forward propagation using
+        /// @p aprop_kind, @p aalgorithm, spatial scaling @p factors, and the
+        /// source memory descriptor. The destination dimensions are computed
+        /// from the @p factors and its format is
+        /// #dnnl::memory::format_tag::any.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const std::vector<float> &factors,
+                const memory::desc &src_desc) {
+            memory::validate_dims(factors);
+            error::wrap_c_api(dnnl_resampling_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      convert_to_c(aalgorithm), &factors[0],
+                                      &src_desc.data, nullptr),
+                    "could not init a forward resampling descriptor");
+        }
+
+        /// Initializes a resampling descriptor for forward propagation using
+        /// @p aprop_kind, @p aalgorithm, spatial scaling @p factors, and
+        /// memory descriptors.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const std::vector<float> &factors,
+                const memory::desc &src_desc, const memory::desc &dst_desc) {
+            memory::validate_dims(factors);
+            error::wrap_c_api(dnnl_resampling_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      convert_to_c(aalgorithm), &factors[0],
+                                      &src_desc.data, &dst_desc.data),
+                    "could not init a forward resampling descriptor");
+        }
+    };
+
+    /// Primitive descriptor for resampling forward propagation.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(
+                const desc &desc, const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, nullptr, e, nullptr, allow_empty) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e, bool allow_empty = false)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr, allow_empty) {
+        }
+
+        /// Initializes a primitive descriptor for resampling forward
+        /// propagation from a C primitive descriptor @p pd.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::resampling,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    resampling_forward() = default;
+
+    resampling_forward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// Resampling for backward propagation.  Implements descriptor, primitive
+/// descriptor, and primitive.
+struct resampling_backward : public primitive {
+
+    /// Descriptor for resampling backward propagation.
+    struct desc {
+        dnnl_resampling_desc_t data;
+
+        /// Initializes a resampling descriptor for backward propagation using
+        /// @p aalgorithm and memory descriptors. The scaling factors are
+        /// computed from the spatial dimensions.
+        desc(algorithm aalgorithm, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc) {
+            error::wrap_c_api(dnnl_resampling_backward_desc_init(&data,
+                                      convert_to_c(aalgorithm), nullptr,
+                                      &diff_src_desc.data, &diff_dst_desc.data),
+                    "could not init a backward resampling descriptor");
+        }
+
+        /// Initializes a resampling descriptor for backward propagation using
+        /// @p aalgorithm, spatial scaling @p factors, and memory descriptors.
+        desc(algorithm aalgorithm, const std::vector<float> &factors,
+                const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc) {
+            memory::validate_dims(factors);
+            error::wrap_c_api(dnnl_resampling_backward_desc_init(&data,
+                                      convert_to_c(aalgorithm), &factors[0],
+                                      &diff_src_desc.data, &diff_dst_desc.data),
+                    "could not init a backward resampling descriptor");
+        }
+    };
+
+    /// Primitive descriptor for resampling backward propagation.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e,
+                const resampling_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, nullptr, e, hint_fwd_pd.get(), allow_empty) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e,
+                const resampling_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &desc.data, &attr, e, hint_fwd_pd.get(), allow_empty) {}
+
+        /// Initializes a primitive descriptor for resampling backward
+        /// propagation from a C primitive descriptor @p pd.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::resampling,
+                    dnnl::prop_kind::backward_data) {}
+
+        /// Queries diff source memory descriptor.
+        memory::desc diff_src_desc() const {
+            return query_md(query::diff_src_md, 0);
+        }
+
+        /// Queries diff destination memory descriptor.
+        memory::desc diff_dst_desc() const {
+            return query_md(query::diff_dst_md, 0);
+        }
+    };
+
+    resampling_backward() = default;
+
+    resampling_backward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
 /// @} Primitives
 
 /// @} C++ API
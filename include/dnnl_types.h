@@ -429,6 +429,9 @@ typedef enum {
     ///    and output gate.
     ///  - For GRU cells, the gates order is update, reset and output gate.
     dnnl_ldgo = dnnl_abcd,
+    /// 4D LSTM projection tensor in the format (num_layers, num_directions,
+    /// num_channels_in_hidden_state, num_channels_in_recurrent_projection).
+    dnnl_ldio = dnnl_abcd,
 
     // Opaque data types, are not to be used explicitly
 
@@ -647,6 +650,14 @@ typedef enum {
     dnnl_gemm,
     /// A binary primitive.
     dnnl_binary,
+    /// A matrix multiplication primitive with memory descriptors.
+    dnnl_matmul,
+    /// A reduction primitive.
+    dnnl_reduction,
+    /// A resampling primitive.
+    dnnl_resampling,
+    /// A logsoftmax primitive.
+    dnnl_logsoftmax,
 } dnnl_primitive_kind_t;
 
 /// Kinds of algorithms.
@@ -691,6 +702,18 @@ typedef enum {
     dnnl_eltwise_gelu = 0xcf,
     /// Eltwise: swish
     dnnl_eltwise_swish = 0xdf,
+    /// Eltwise: ReLU (dst for backward)
+    dnnl_eltwise_relu_use_dst_for_bwd = 0x100,
+    /// Eltwise: hyperbolic tangent non-linearity (tanh) (dst for backward)
+    dnnl_eltwise_tanh_use_dst_for_bwd = 0x101,
+    /// Eltwise: parametric exponential linear unit (elu) (dst for backward)
+    dnnl_eltwise_elu_use_dst_for_bwd = 0x102,
+    /// Eltwise: square root (dst for backward)
+    dnnl_eltwise_sqrt_use_dst_for_bwd = 0x103,
+    /// Eltwise: logistic (dst for backward)
+    dnnl_eltwise_logistic_use_dst_for_bwd = 0x104,
+    /// Eltwise: exp (dst for backward)
+    dnnl_eltwise_exp_use_dst_for_bwd = 0x105,
     /// Max pooling
     dnnl_pooling_max = 0x1ff,
     /// Average pooling include padding
@@ -720,6 +743,36 @@ typedef enum {
     dnnl_binary_add = 0x1fff0,
     /// Binary mul
     dnnl_binary_mul = 0x1fff1,
+    /// Binary max
+    dnnl_binary_max = 0x1fff2,
+    /// Binary min
+    dnnl_binary_min = 0x1fff3,
+    /// Binary sub
+    dnnl_binary_sub = 0x1fff4,
+    /// Binary div
+    dnnl_binary_div = 0x1fff5,
+    /// Reduction using max
+    dnnl_reduction_max = 0x2fff0,
+    /// Reduction using min
+    dnnl_reduction_min = 0x2fff1,
+    /// Reduction using sum
+    dnnl_reduction_sum = 0x2fff2,
+    /// Reduction using mul
+    dnnl_reduction_mul = 0x2fff3,
+    /// Reduction using mean
+    dnnl_reduction_mean = 0x2fff4,
+    /// Reduction using lp norm: root_p(max(sum |x|^p, eps))
+    dnnl_reduction_norm_lp_max = 0x2fff5,
+    /// Reduction using lp norm: root_p(sum |x|^p + eps)
+    dnnl_reduction_norm_lp_sum = 0x2fff6,
+    /// Reduction using lp norm without the final root: max(sum |x|^p, eps)
+    dnnl_reduction_norm_lp_power_p_max = 0x2fff7,
+    /// Reduction using lp norm without the final root: sum |x|^p + eps
+    dnnl_reduction_norm_lp_power_p_sum = 0x2fff8,
+    /// Nearest neighbor resampling
+    dnnl_resampling_nearest = 0x3fff0,
+    /// Linear (bilinear, trilinear) resampling
+    dnnl_resampling_linear = 0x3fff1,
 } dnnl_alg_kind_t;
 
 /// Flags for batch normalization primitive.
@@ -1025,8 +1078,12 @@ typedef struct {
     /// #dnnl_eltwise_tanh, #dnnl_eltwise_elu, #dnnl_eltwise_square,
     /// #dnnl_eltwise_abs, #dnnl_eltwise_sqrt, #dnnl_eltwise_linear,
     /// #dnnl_eltwise_bounded_relu, #dnnl_eltwise_soft_relu,
-    /// #dnnl_eltwise_swish, #dnnl_eltwise_logistic and
-    /// #dnnl_eltwise_exp.
+    /// #dnnl_eltwise_swish, #dnnl_eltwise_logistic, #dnnl_eltwise_exp,
+    /// #dnnl_eltwise_gelu, #dnnl_eltwise_relu_use_dst_for_bwd,
+    /// #dnnl_eltwise_tanh_use_dst_for_bwd, #dnnl_eltwise_elu_use_dst_for_bwd,
+    /// #dnnl_eltwise_sqrt_use_dst_for_bwd,
+    /// #dnnl_eltwise_logistic_use_dst_for_bwd and
+    /// #dnnl_eltwise_exp_use_dst_for_bwd.
     dnnl_alg_kind_t alg_kind;
     /// Source and destination memory descriptor.
     dnnl_memory_desc_t data_desc;
@@ -1046,13 +1103,20 @@ typedef struct {
     ///  - #dnnl_eltwise_soft_relu: @p alpha and @p beta ignored
     ///  - #dnnl_eltwise_logistic: @p alpha and @p beta ignored
     ///  - #dnnl_eltwise_exp: @p alpha and @p beta ignored
+    ///  - #dnnl_eltwise_gelu: @p alpha and @p beta ignored
+    ///
+    /// The `*_use_dst_for_bwd` algorithms take the same parameters as the
+    /// corresponding base algorithms. On backward propagation they compute
+    /// the gradient from the destination instead of the source, so
+    /// #dnnl_eltwise_relu_use_dst_for_bwd and
+    /// #dnnl_eltwise_elu_use_dst_for_bwd require non-negative @p alpha.
     float alpha, beta;
 } dnnl_eltwise_desc_t;
 
 /// A descriptor of a Softmax operation.
 typedef struct {
     /// The kind of primitive. Used for self-identifying the primitive
-    /// descriptor. Must be #dnnl_softmax.
+    /// descriptor. Must be #dnnl_softmax or #dnnl_logsoftmax.
     dnnl_primitive_kind_t primitive_kind;
     /// The kind of propagation. Possible values: #dnnl_forward_training and
     /// #dnnl_forward_inference.
@@ -1065,6 +1129,10 @@ typedef struct {
     int softmax_axis;
 } dnnl_softmax_desc_t;
 
+/// A descriptor of a LogSoftmax operation. An alias of Softmax structure, but
+/// primitive_kind must be #dnnl_logsoftmax.
+typedef dnnl_softmax_desc_t dnnl_logsoftmax_desc_t;
+
 /// A descriptor of a pooling operation.
 typedef struct {
     /// The kind of primitive. Used for self-identifying the primitive
@@ -1214,7 +1282,22 @@ typedef struct {
 } dnnl_inner_product_desc_t;
 
 /// Flags for RNN cell.
-typedef enum { dnnl_rnn_flags_undef = 0x0 } dnnl_rnn_flags_t;
+typedef enum {
+    /// Undefined RNN flags
+    dnnl_rnn_flags_undef = 0x0,
+    /// Stateful execution
+    ///
+    /// If specified, the hidden and cell states computed by an execution stay
+    /// resident in the primitive and are used as the initial states of the
+    /// next execution, so that a sequence can be fed to the primitive in
+    /// chunks of time steps. The states are reset from the `src_iter` and
+    /// `src_iter_c` memories whenever they are passed to an execution, and
+    /// start from zero otherwise. Supported for forward inference of
+    /// unidirectional left-to-right RNNs only. A stateful primitive is never
+    /// shared through the primitive cache and must not be executed
+    /// concurrently.
+    dnnl_rnn_flags_stateful = 0x1U,
+} dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
 typedef enum {
@@ -1262,9 +1345,14 @@ typedef struct {
     dnnl_memory_desc_t dst_iter_desc;
     /// Destination iter memory descriptor for cell state.
     dnnl_memory_desc_t dst_iter_c_desc;
-    /// Placeholders
-    dnnl_memory_desc_t placeholder_desc;
-    dnnl_memory_desc_t placeholder2_desc;
+    /// Weights peephole memory descriptor.
+    /// This memory descriptor is equal to zero memory descriptor in case of
+    /// non-peephole LSTMs and other non-LSTM RNNs.
+    dnnl_memory_desc_t weights_peephole_desc;
+    /// Weights projection memory descriptor.
+    /// This memory descriptor is equal to zero memory descriptor in case of
+    /// non-projection LSTMs and other non-LSTM RNNs.
+    dnnl_memory_desc_t weights_projection_desc;
 
     /// Source gradient layer memory descriptor.
     dnnl_memory_desc_t diff_src_layer_desc;
@@ -1284,9 +1372,14 @@ typedef struct {
     dnnl_memory_desc_t diff_dst_iter_desc;
     /// Destination gradient iteration memory descriptor for cell state.
     dnnl_memory_desc_t diff_dst_iter_c_desc;
-    /// Placeholders
-    dnnl_memory_desc_t diff_placeholder_desc;
-    dnnl_memory_desc_t diff_placeholder2_desc;
+    /// Weights gradient peephole memory descriptor.
+    /// This memory descriptor is equal to zero memory descriptor in case of
+    /// non-peephole LSTMs and other non-LSTM RNNs.
+    dnnl_memory_desc_t diff_weights_peephole_desc;
+    /// Weights gradient projection memory descriptor.
+    /// This memory descriptor is equal to zero memory descriptor in case of
+    /// non-projection LSTMs and other non-LSTM RNNs.
+    dnnl_memory_desc_t diff_weights_projection_desc;
 
     /// RNN cell flags
     unsigned int flags;
@@ -1304,7 +1397,8 @@ typedef struct {
     /// descriptor. Must be #dnnl_binary.
     dnnl_primitive_kind_t primitive_kind;
     /// The kind of the binary algorithm. Possible values:
-    /// #dnnl_binary_add and #dnnl_binary_mul.
+    /// #dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max,
+    /// #dnnl_binary_min, #dnnl_binary_sub and #dnnl_binary_div.
     dnnl_alg_kind_t alg_kind;
     /// Source memory descriptors.
     dnnl_memory_desc_t src_desc[2];
@@ -1312,6 +1406,77 @@ typedef struct {
     dnnl_memory_desc_t dst_desc;
 } dnnl_binary_desc_t;
 
+/// A descriptor of a matrix multiplication operation.
+///
+/// 2D case:
+///     dst[m, n] = src[m, k] * weights[k, n] + bias[m, n]
+///
+/// 3D case:
+///     dst[mb, m, n] = src[mb, m, k] * weights[mb, k, n] + bias[mb, m, n]
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_matmul.
+    dnnl_primitive_kind_t primitive_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Weights memory descriptor.
+    dnnl_memory_desc_t weights_desc;
+    /// Bias memory descriptor.
+    dnnl_memory_desc_t bias_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// The accumulator data type. Initialized automatically.
+    dnnl_data_type_t accum_data_type;
+} dnnl_matmul_desc_t;
+
+/// A descriptor of a reduction operation.
+///
+/// The dimensions of the destination that are equal to 1 while the
+/// corresponding dimensions of the source are not are reduced.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_reduction.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of reduction algorithm. Possible values:
+    /// #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
+    /// #dnnl_reduction_mul, #dnnl_reduction_mean,
+    /// #dnnl_reduction_norm_lp_max, #dnnl_reduction_norm_lp_sum,
+    /// #dnnl_reduction_norm_lp_power_p_max and
+    /// #dnnl_reduction_norm_lp_power_p_sum.
+    dnnl_alg_kind_t alg_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// The power of the lp norm algorithms.
+    float p;
+    /// The epsilon of the lp norm algorithms.
+    float eps;
+} dnnl_reduction_desc_t;
+
+/// A descriptor of a resampling operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_resampling.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training,
+    /// #dnnl_forward_inference, and #dnnl_backward_data.
+    dnnl_prop_kind_t prop_kind;
+    /// The kind of the resampling algorithm. Possible values:
+    /// #dnnl_resampling_nearest and #dnnl_resampling_linear.
+    dnnl_alg_kind_t alg_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Source gradient memory descriptor.
+    dnnl_memory_desc_t diff_src_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// Destination gradient memory descriptor.
+    dnnl_memory_desc_t diff_dst_desc;
+    /// Resampling factors in each spatial dimension.
+    float factors[DNNL_MAX_NDIMS];
+} dnnl_resampling_desc_t;
+
 /// @}
 
 /// @addtogroup c_api_engine_types Engine
@@ -1382,11 +1547,36 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// @cond DO_NOT_DOCUMENT_THIS
+/// Bit representation of a special quiet NaN that differs from the NaN
+/// produced by math.h
+static const union {
+    unsigned u;
+    float f;
+} DNNL_RUNTIME_F32_VAL_REP = {0x7fc000d0};
+/// @endcond
+
+/// A wildcard value for floating point values that are unknown at primitive
+/// descriptor creation time and are passed at execution time instead, e.g.
+/// output scales provided via #DNNL_ARG_ATTR_OUTPUT_SCALES.
+#define DNNL_RUNTIME_F32_VAL (DNNL_RUNTIME_F32_VAL_REP.f)
+
+/// @cond DO_NOT_DOCUMENT_THIS
+#define DNNL_RUNTIME_S32_VAL_REP INT32_MIN
+/// @endcond
+
+/// A wildcard value for int32_t values that are unknown at primitive
+/// descriptor creation time and are passed at execution time instead, e.g.
+/// zero points provided via #DNNL_ARG_ATTR_ZERO_POINTS.
+#define DNNL_RUNTIME_S32_VAL ((int32_t)DNNL_RUNTIME_S32_VAL_REP)
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
 /// Attributes may contain:
 ///  - output scales (to scale the result prior to storing it to the memory)
+///  - zero points (to shift the quantized inputs and outputs of int8
+///    primitives)
 struct dnnl_primitive_attr;
 
 /// @brief A primitive descriptor attributes handle that controls primitive
@@ -1449,6 +1639,10 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 #define DNNL_ARG_SRC_2 3
 #define DNNL_ARG_SRC_ITER_C DNNL_ARG_SRC_2
 
+#define DNNL_ARG_SRC_3 4
+/// Per-sample sequence lengths of an RNN minibatch (optional).
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_3
+
 #define DNNL_ARG_DST_0 17
 #define DNNL_ARG_DST DNNL_ARG_DST_0
 #define DNNL_ARG_TO DNNL_ARG_DST_0
@@ -1468,6 +1662,12 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 #define DNNL_ARG_WEIGHTS_1 34
 #define DNNL_ARG_WEIGHTS_ITER DNNL_ARG_WEIGHTS_1
 
+#define DNNL_ARG_WEIGHTS_2 35
+#define DNNL_ARG_WEIGHTS_PEEPHOLE DNNL_ARG_WEIGHTS_2
+
+#define DNNL_ARG_WEIGHTS_3 36
+#define DNNL_ARG_WEIGHTS_PROJECTION DNNL_ARG_WEIGHTS_3
+
 #define DNNL_ARG_BIAS 41
 
 #define DNNL_ARG_MEAN 49
@@ -1504,8 +1704,22 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 #define DNNL_ARG_DIFF_WEIGHTS_1 162
 #define DNNL_ARG_DIFF_WEIGHTS_ITER DNNL_ARG_DIFF_WEIGHTS_1
 
+#define DNNL_ARG_DIFF_WEIGHTS_2 163
+#define DNNL_ARG_DIFF_WEIGHTS_PEEPHOLE DNNL_ARG_DIFF_WEIGHTS_2
+
+#define DNNL_ARG_DIFF_WEIGHTS_3 164
+#define DNNL_ARG_DIFF_WEIGHTS_PROJECTION DNNL_ARG_DIFF_WEIGHTS_3
+
 #define DNNL_ARG_DIFF_BIAS 169
 
+/// Output scaling factors provided at execution time.
+#define DNNL_ARG_ATTR_OUTPUT_SCALES 513
+
+/// Zero points provided at execution time. The argument index must be
+/// combined with the index of the tensor the zero points belong to, e.g.
+/// (#DNNL_ARG_ATTR_ZERO_POINTS | #DNNL_ARG_SRC).
+#define DNNL_ARG_ATTR_ZERO_POINTS 8192
+
 #define DNNL_ARG_MULTIPLE_SRC 1024
 #define DNNL_ARG_MULTIPLE_DST 2048
 
@@ -1596,6 +1810,10 @@ typedef enum {
     dnnl_query_rnn_d, ///< rnn descriptor
     dnnl_query_gemm_d, ///< GEMM descriptor
     dnnl_query_binary_d, ///< binary descriptor
+    dnnl_query_matmul_d, ///< matrix multiplication descriptor
+    dnnl_query_reduction_d, ///< reduction descriptor
+    dnnl_query_resampling_d, ///< resampling descriptor
+    dnnl_query_logsoftmax_d, ///< logsoftmax descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
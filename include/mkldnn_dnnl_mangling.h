@@ -663,6 +663,7 @@
 #define mkldnn_rnn_direction2str dnnl_rnn_direction2str
 #define mkldnn_rnn_direction_t dnnl_rnn_direction_t
 #define mkldnn_rnn_flags2str dnnl_rnn_flags2str
+#define mkldnn_rnn_flags_stateful dnnl_rnn_flags_stateful
 #define mkldnn_rnn_flags_t dnnl_rnn_flags_t
 #define mkldnn_rnn_flags_undef dnnl_rnn_flags_undef
 #define mkldnn_rnn_packed_desc_t dnnl_rnn_packed_desc_t
@@ -32,7 +32,8 @@ status_t dnnl_binary_desc_init(binary_desc_t *binary_desc, alg_kind_t alg_kind,
         const memory_desc_t *src0_md, const memory_desc_t *src1_md,
         const memory_desc_t *dst_md) {
     bool args_ok = true && !any_null(binary_desc, src0_md, src1_md, dst_md)
-            && one_of(alg_kind, binary_add, binary_mul);
+            && one_of(alg_kind, binary_add, binary_mul, binary_max, binary_min,
+                    binary_sub, binary_div);
     if (!args_ok) return invalid_arguments;
 
     auto bod = binary_desc_t();
@@ -52,16 +53,17 @@ status_t dnnl_binary_desc_init(binary_desc_t *binary_desc, alg_kind_t alg_kind,
             return invalid_arguments;
     }
 
-    // check dst
+    // check dst: it may differ from src0 in the data type only
     if (dst_md->format_kind == format_kind::blocked) {
-        if (memory_desc_wrapper(dst_md) != memory_desc_wrapper(src0_md))
+        const memory_desc_wrapper dst_d(dst_md), src0_d(src0_md);
+        if (!dst_d.similar_to(src0_d, true, false)
+                || dst_d.offset0() != src0_d.offset0())
             return invalid_arguments;
     } else {
         if (dst_md->ndims != ndims) return invalid_arguments;
         for (int d = 0; d < ndims; ++d) {
             if (dst_md->dims[d] != dims[d]) return invalid_arguments;
         }
-        if (dst_md->data_type != src0_md->data_type) return invalid_arguments;
     }
 
     *binary_desc = bod;
@@ -76,6 +76,18 @@ const alg_kind_t eltwise_soft_relu = dnnl_eltwise_soft_relu;
 const alg_kind_t eltwise_logistic = dnnl_eltwise_logistic;
 const alg_kind_t eltwise_exp = dnnl_eltwise_exp;
 const alg_kind_t eltwise_gelu = dnnl_eltwise_gelu;
+const alg_kind_t eltwise_relu_use_dst_for_bwd
+        = dnnl_eltwise_relu_use_dst_for_bwd;
+const alg_kind_t eltwise_tanh_use_dst_for_bwd
+        = dnnl_eltwise_tanh_use_dst_for_bwd;
+const alg_kind_t eltwise_elu_use_dst_for_bwd
+        = dnnl_eltwise_elu_use_dst_for_bwd;
+const alg_kind_t eltwise_sqrt_use_dst_for_bwd
+        = dnnl_eltwise_sqrt_use_dst_for_bwd;
+const alg_kind_t eltwise_logistic_use_dst_for_bwd
+        = dnnl_eltwise_logistic_use_dst_for_bwd;
+const alg_kind_t eltwise_exp_use_dst_for_bwd
+        = dnnl_eltwise_exp_use_dst_for_bwd;
 const alg_kind_t pooling_max = dnnl_pooling_max;
 const alg_kind_t pooling_avg = dnnl_pooling_avg;
 const alg_kind_t pooling_avg_include_padding = dnnl_pooling_avg_include_padding;
@@ -88,6 +100,23 @@ const alg_kind_t vanilla_gru = dnnl_vanilla_gru;
 const alg_kind_t lbr_gru = dnnl_lbr_gru;
 const alg_kind_t binary_add = dnnl_binary_add;
 const alg_kind_t binary_mul = dnnl_binary_mul;
+const alg_kind_t binary_max = dnnl_binary_max;
+const alg_kind_t binary_min = dnnl_binary_min;
+const alg_kind_t binary_sub = dnnl_binary_sub;
+const alg_kind_t binary_div = dnnl_binary_div;
+const alg_kind_t reduction_max = dnnl_reduction_max;
+const alg_kind_t reduction_min = dnnl_reduction_min;
+const alg_kind_t reduction_sum = dnnl_reduction_sum;
+const alg_kind_t reduction_mul = dnnl_reduction_mul;
+const alg_kind_t reduction_mean = dnnl_reduction_mean;
+const alg_kind_t reduction_norm_lp_max = dnnl_reduction_norm_lp_max;
+const alg_kind_t reduction_norm_lp_sum = dnnl_reduction_norm_lp_sum;
+const alg_kind_t reduction_norm_lp_power_p_max
+        = dnnl_reduction_norm_lp_power_p_max;
+const alg_kind_t reduction_norm_lp_power_p_sum
+        = dnnl_reduction_norm_lp_power_p_sum;
+const alg_kind_t resampling_nearest = dnnl_resampling_nearest;
+const alg_kind_t resampling_linear = dnnl_resampling_linear;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -294,6 +323,7 @@ const format_tag_t ldnc = dnnl_ldnc;
 const format_tag_t ldigo = dnnl_ldigo;
 const format_tag_t ldgoi = dnnl_ldgoi;
 const format_tag_t ldgo = dnnl_ldgo;
+const format_tag_t ldio = dnnl_ldio;
 const format_tag_t nCdhw16c = dnnl_nCdhw16c;
 const format_tag_t nCdhw4c = dnnl_nCdhw4c;
 const format_tag_t nCdhw8c = dnnl_nCdhw8c;
@@ -465,6 +495,10 @@ const primitive_kind_t inner_product = dnnl_inner_product;
 const primitive_kind_t rnn = dnnl_rnn;
 const primitive_kind_t gemm = dnnl_gemm;
 const primitive_kind_t binary = dnnl_binary;
+const primitive_kind_t matmul = dnnl_matmul;
+const primitive_kind_t reduction = dnnl_reduction;
+const primitive_kind_t resampling = dnnl_resampling;
+const primitive_kind_t logsoftmax = dnnl_logsoftmax;
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -504,6 +538,10 @@ const query_t inner_product_d = dnnl_query_inner_product_d;
 const query_t rnn_d = dnnl_query_rnn_d;
 const query_t gemm_d = dnnl_query_gemm_d;
 const query_t binary_d = dnnl_query_binary_d;
+const query_t matmul_d = dnnl_query_matmul_d;
+const query_t reduction_d = dnnl_query_reduction_d;
+const query_t resampling_d = dnnl_query_resampling_d;
+const query_t logsoftmax_d = dnnl_query_logsoftmax_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -528,11 +566,15 @@ using shuffle_desc_t = dnnl_shuffle_desc_t;
 using pooling_desc_t = dnnl_pooling_desc_t;
 using eltwise_desc_t = dnnl_eltwise_desc_t;
 using softmax_desc_t = dnnl_softmax_desc_t;
+using logsoftmax_desc_t = dnnl_logsoftmax_desc_t;
 using lrn_desc_t = dnnl_lrn_desc_t;
 using batch_normalization_desc_t = dnnl_batch_normalization_desc_t;
 using layer_normalization_desc_t = dnnl_layer_normalization_desc_t;
 using inner_product_desc_t = dnnl_inner_product_desc_t;
 using binary_desc_t = dnnl_binary_desc_t;
+using matmul_desc_t = dnnl_matmul_desc_t;
+using reduction_desc_t = dnnl_reduction_desc_t;
+using resampling_desc_t = dnnl_resampling_desc_t;
 
 using rnn_direction_t = dnnl_rnn_direction_t;
 using rnn_desc_t = dnnl_rnn_desc_t;
@@ -568,6 +610,9 @@ struct op_desc_t {
         reorder_desc_t reorder;
         sum_desc_t sum;
         binary_desc_t binary;
+        matmul_desc_t matmul;
+        reduction_desc_t reduction;
+        resampling_desc_t resampling;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type, name) \
@@ -594,6 +639,9 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(reorder_desc_t, reorder);
     DECL_CTOR_AND_CONVERTERS(sum_desc_t, sum);
     DECL_CTOR_AND_CONVERTERS(binary_desc_t, binary);
+    DECL_CTOR_AND_CONVERTERS(matmul_desc_t, matmul);
+    DECL_CTOR_AND_CONVERTERS(reduction_desc_t, reduction);
+    DECL_CTOR_AND_CONVERTERS(resampling_desc_t, resampling);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
@@ -649,9 +697,12 @@ struct layer_normalization_pd_t;
 struct lrn_bwd_pd_t;
 struct lrn_fwd_pd_t;
 struct lrn_pd_t;
+struct matmul_pd_t;
 struct pooling_bwd_pd_t;
 struct pooling_fwd_pd_t;
 struct pooling_pd_t;
+struct reduction_pd_t;
+struct resampling_pd_t;
 struct reorder_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
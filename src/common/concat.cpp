@@ -38,10 +38,10 @@ status_t dnnl_concat_primitive_desc_create(primitive_desc_t **concat_pd,
 
     const primitive_attr_t dummy_attr;
     if (attr == NULL) attr = &dummy_attr;
+    if (!attr->zero_points_.has_default_values()) return unimplemented;
 
     const int ndims = src_mds[0].ndims;
     const dims_t &dims = src_mds[0].dims;
-    const data_type_t dt = src_mds[0].data_type;
 
     int concat_dim_sz = dims[concat_dim];
     for (int i = 1; i < n; ++i) {
@@ -50,7 +50,6 @@ status_t dnnl_concat_primitive_desc_create(primitive_desc_t **concat_pd,
             if (d == concat_dim) continue;
             if (src_mds[i].dims[d] != dims[d]) return invalid_arguments;
         }
-        if (src_mds[i].data_type != dt) return invalid_arguments;
         concat_dim_sz += src_mds[i].dims[concat_dim];
     }
 
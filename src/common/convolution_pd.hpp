@@ -304,6 +304,9 @@ struct convolution_bwd_data_pd_t : public convolution_pd_t {
     virtual int n_outputs() const override { return 1; }
 
     virtual bool support_bias() const { return false; }
+    /* Whether the implementation applies the post-ops of the attributes to
+     * diff_src (used by the deconvolution built on top of it) */
+    virtual bool support_post_ops() const { return false; }
 
 protected:
     memory_desc_t diff_src_md_;
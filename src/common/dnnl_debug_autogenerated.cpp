@@ -381,6 +381,10 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_rnn) return "rnn";
     if (v == dnnl_gemm) return "gemm";
     if (v == dnnl_binary) return "binary";
+    if (v == dnnl_matmul) return "matmul";
+    if (v == dnnl_reduction) return "reduction";
+    if (v == dnnl_resampling) return "resampling";
+    if (v == dnnl_logsoftmax) return "logsoftmax";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -405,6 +409,12 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_eltwise_exp) return "eltwise_exp";
     if (v == dnnl_eltwise_gelu) return "eltwise_gelu";
     if (v == dnnl_eltwise_swish) return "eltwise_swish";
+    if (v == dnnl_eltwise_relu_use_dst_for_bwd) return "eltwise_relu_use_dst_for_bwd";
+    if (v == dnnl_eltwise_tanh_use_dst_for_bwd) return "eltwise_tanh_use_dst_for_bwd";
+    if (v == dnnl_eltwise_elu_use_dst_for_bwd) return "eltwise_elu_use_dst_for_bwd";
+    if (v == dnnl_eltwise_sqrt_use_dst_for_bwd) return "eltwise_sqrt_use_dst_for_bwd";
+    if (v == dnnl_eltwise_logistic_use_dst_for_bwd) return "eltwise_logistic_use_dst_for_bwd";
+    if (v == dnnl_eltwise_exp_use_dst_for_bwd) return "eltwise_exp_use_dst_for_bwd";
     if (v == dnnl_pooling_max) return "pooling_max";
     if (v == dnnl_pooling_avg_include_padding) return "pooling_avg_include_padding";
     if (v == dnnl_pooling_avg_exclude_padding) return "pooling_avg_exclude_padding";
@@ -417,12 +427,30 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_lbr_gru) return "lbr_gru";
     if (v == dnnl_binary_add) return "binary_add";
     if (v == dnnl_binary_mul) return "binary_mul";
+    if (v == dnnl_binary_max) return "binary_max";
+    if (v == dnnl_binary_min) return "binary_min";
+    if (v == dnnl_binary_sub) return "binary_sub";
+    if (v == dnnl_binary_div) return "binary_div";
+    if (v == dnnl_reduction_max) return "reduction_max";
+    if (v == dnnl_reduction_min) return "reduction_min";
+    if (v == dnnl_reduction_sum) return "reduction_sum";
+    if (v == dnnl_reduction_mul) return "reduction_mul";
+    if (v == dnnl_reduction_mean) return "reduction_mean";
+    if (v == dnnl_reduction_norm_lp_max) return "reduction_norm_lp_max";
+    if (v == dnnl_reduction_norm_lp_sum) return "reduction_norm_lp_sum";
+    if (v == dnnl_reduction_norm_lp_power_p_max)
+        return "reduction_norm_lp_power_p_max";
+    if (v == dnnl_reduction_norm_lp_power_p_sum)
+        return "reduction_norm_lp_power_p_sum";
+    if (v == dnnl_resampling_nearest) return "resampling_nearest";
+    if (v == dnnl_resampling_linear) return "resampling_linear";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
 
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
+    if (v == dnnl_rnn_flags_stateful) return "stateful";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
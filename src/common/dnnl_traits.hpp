@@ -114,6 +114,7 @@ PKIND_TRAITS_INST(deconvolution);
 PKIND_TRAITS_INST(shuffle);
 PKIND_TRAITS_INST(eltwise);
 PKIND_TRAITS_INST(softmax);
+PKIND_TRAITS_INST(logsoftmax);
 PKIND_TRAITS_INST(pooling);
 PKIND_TRAITS_INST(lrn);
 PKIND_TRAITS_INST(batch_normalization);
@@ -122,6 +123,9 @@ PKIND_TRAITS_INST(inner_product);
 PKIND_TRAITS_INST(rnn);
 PKIND_TRAITS_INST(gemm);
 PKIND_TRAITS_INST(binary);
+PKIND_TRAITS_INST(matmul);
+PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(resampling);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
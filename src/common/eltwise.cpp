@@ -38,7 +38,14 @@ status_t eltwise_desc_init(eltwise_desc_t *eltwise_desc, prop_kind_t prop_kind,
             && one_of(alg_kind, eltwise_relu, eltwise_tanh, eltwise_elu,
                     eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
                     eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
-                    eltwise_exp, eltwise_gelu, eltwise_swish)
+                    eltwise_exp, eltwise_gelu, eltwise_swish,
+                    eltwise_relu_use_dst_for_bwd, eltwise_tanh_use_dst_for_bwd,
+                    eltwise_elu_use_dst_for_bwd, eltwise_sqrt_use_dst_for_bwd,
+                    eltwise_logistic_use_dst_for_bwd,
+                    eltwise_exp_use_dst_for_bwd)
+            && IMPLICATION(one_of(alg_kind, eltwise_relu_use_dst_for_bwd,
+                                   eltwise_elu_use_dst_for_bwd),
+                    alpha >= 0)
             && IMPLICATION(
                     prop_kind == backward_data, diff_data_desc != nullptr)
             && IMPLICATION(
@@ -75,6 +75,21 @@ struct eltwise_pd_t : public primitive_desc_t {
         return memory_desc_wrapper(desc_.data_desc).has_zero_dim();
     }
 
+    /* backward is computed from dst rather than from src */
+    bool use_dst() const {
+        using namespace alg_kind;
+        return !is_fwd()
+                && utils::one_of(desc_.alg_kind, eltwise_relu_use_dst_for_bwd,
+                        eltwise_tanh_use_dst_for_bwd,
+                        eltwise_elu_use_dst_for_bwd,
+                        eltwise_sqrt_use_dst_for_bwd,
+                        eltwise_logistic_use_dst_for_bwd,
+                        eltwise_exp_use_dst_for_bwd);
+    }
+
+    /* src, or dst if use_dst() */
+    const memory_desc_t *data_md() const { return &data_md_; }
+
 protected:
     eltwise_desc_t desc_;
     const eltwise_fwd_pd_t *hint_fwd_pd_;
@@ -126,16 +141,21 @@ struct eltwise_bwd_pd_t : public eltwise_pd_t {
         , diff_data_md_(desc_.diff_data_desc) {}
 
     virtual arg_usage_t arg_usage(int arg) const override {
-        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_DIFF_DST))
+        if (arg == (use_dst() ? DNNL_ARG_DST : DNNL_ARG_SRC))
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_DIFF_DST) return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
     }
 
     virtual const memory_desc_t *src_md(int index = 0) const override {
-        return index == 0 ? &data_md_ : &glob_zero_md;
+        return index == 0 && !use_dst() ? &data_md_ : &glob_zero_md;
+    }
+    virtual const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 && use_dst() ? &data_md_ : &glob_zero_md;
     }
     virtual const memory_desc_t *diff_dst_md(int index = 0) const override {
         return index == 0 ? &diff_data_md_ : &glob_zero_md;
@@ -145,10 +145,13 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
         dnnl::impl::primitive_hashing::key_t key(
                 pd, this->dnnl_get_max_threads());
 
+        // stateful primitives own their data, so they are never shared
+        const bool use_cache = !pd->is_stateful();
+
         // lock cache
         recursive_mutex_.lock();
         dnnl::impl::primitive_t *p = nullptr;
-        auto primitive_impl = primitive_cache_->get(key);
+        auto primitive_impl = use_cache ? primitive_cache_->get(key) : nullptr;
         if (primitive_impl) {
             // cache hit
             // unlock cache because it's safe to create a wrapper in parallel
@@ -190,7 +193,7 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
         key.op_desc_ = p->pd()->op_desc();
         key.attr_ = p->pd()->attr();
 
-        primitive_cache_->add(key, p->get_primitive_impl());
+        if (use_cache) primitive_cache_->add(key, p->get_primitive_impl());
         recursive_mutex_.unlock();
 
         ms = dnnl::impl::get_msec() - ms;
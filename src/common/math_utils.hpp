@@ -171,6 +171,11 @@ template <typename T, typename A,
 inline U relu_bwd(T s, A alpha) {
     return s > 0 ? (U)1 : (U)alpha;
 }
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U relu_bwd_use_dst(T dd, T d, A alpha) {
+    return d > 0 ? dd : (U)(dd * alpha);
+}
 
 template <typename T, typename U = typename utils::remove_reference<T>::type>
 inline U tanh_fwd(T s) {
@@ -184,6 +189,11 @@ inline U tanh_bwd(T dd, T s) {
     return (U)(dd * (1 - e) * (1 + e));
 }
 
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U tanh_bwd_use_dst(T dd, T d) {
+    return (U)(dd * (1 - d) * (1 + d));
+}
+
 template <typename T, typename A,
         typename U = typename utils::remove_reference<T>::type>
 inline U elu_fwd(T s, A alpha) {
@@ -194,6 +204,11 @@ template <typename T, typename A,
 inline U elu_bwd(T dd, T s, A alpha) {
     return (U)(dd * (s > 0 ? 1 : alpha * ::expf((float)s)));
 }
+template <typename T, typename A,
+        typename U = typename utils::remove_reference<T>::type>
+inline U elu_bwd_use_dst(T dd, T d, A alpha) {
+    return (U)(dd * (d > 0 ? 1 : d + alpha));
+}
 
 template <typename T, typename A,
         typename U = typename utils::remove_reference<T>::type>
@@ -238,6 +253,11 @@ inline U sqrt_bwd(T dd, T s) {
     return s > 0 ? (U)(dd / (2 * ::sqrtf((float)(s)))) : (U)0;
 }
 
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U sqrt_bwd_use_dst(T dd, T d) {
+    return d > 0 ? (U)(dd / (2 * d)) : (U)0;
+}
+
 template <typename T, typename A,
         typename U = typename utils::remove_reference<T>::type>
 inline U linear_fwd(T s, A alpha, A beta) {
@@ -284,10 +304,16 @@ inline U logistic_fwd(T s) {
 
 template <typename T, typename U = typename utils::remove_reference<T>::type>
 inline U logistic_bwd(T dd, T s) {
-    float v = logistic_fwd<T, float>(s);
+    // the derivative is even, and 1 - v does not cancel for v <= 0.5
+    float v = logistic_fwd<float, float>(-::fabsf((float)s));
     return (U)(dd * v * (1 - v));
 }
 
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U logistic_bwd_use_dst(T dd, T d) {
+    return (U)(dd * d * (1 - d));
+}
+
 template <typename T, typename U = typename utils::remove_reference<T>::type>
 inline U exp_fwd(T s) {
     return (U)(::expf((float)s));
@@ -298,6 +324,11 @@ inline U exp_bwd(T dd, T s) {
     return dd * (::expf((float)s));
 }
 
+template <typename T, typename U = typename utils::remove_reference<T>::type>
+inline U exp_bwd_use_dst(T dd, T d) {
+    return (U)(dd * d);
+}
+
 template <typename T, typename U = typename utils::remove_reference<T>::type>
 inline U gelu_fwd(T s) {
     const float sqrt_2_over_pi = 0.797884;
@@ -321,8 +352,12 @@ inline bool eltwise_fwd_preserves_zero(alg_kind_t alg, bool jit_impl = false) {
     using namespace utils;
     const bool preserves_zero = true
             && !one_of(alg, eltwise_linear, eltwise_soft_relu, eltwise_logistic,
-                    eltwise_exp)
-            && IMPLICATION(jit_impl, !one_of(alg, eltwise_elu, eltwise_tanh));
+                    eltwise_exp, eltwise_logistic_use_dst_for_bwd,
+                    eltwise_exp_use_dst_for_bwd)
+            && IMPLICATION(jit_impl,
+                    !one_of(alg, eltwise_elu, eltwise_tanh,
+                            eltwise_elu_use_dst_for_bwd,
+                            eltwise_tanh_use_dst_for_bwd));
     return preserves_zero;
 }
 
@@ -337,6 +372,7 @@ inline float get_bias(const char *bias, size_t offset, data_type_t data_type) {
         CASE(data_type::u8);
         CASE(data_type::s32);
         CASE(data_type::f32);
+        CASE(data_type::bf16);
         default: assert(!"unimplemented");
     }
     return 0; // never happens (should probably be a NaN)
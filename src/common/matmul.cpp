@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::types;
+
+status_t dnnl_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_md, const memory_desc_t *weights_md,
+        const memory_desc_t *bias_md, const memory_desc_t *dst_md) {
+    bool args_ok = !any_null(matmul_desc, src_md, weights_md, dst_md);
+    if (!args_ok) return invalid_arguments;
+
+    auto op_d = matmul_desc_t();
+    op_d.primitive_kind = primitive_kind::matmul;
+
+    op_d.src_desc = *src_md;
+    op_d.weights_desc = *weights_md;
+    op_d.bias_desc = zero_md();
+    op_d.dst_desc = *dst_md;
+
+    const bool with_bias
+            = bias_md && bias_md->format_kind != format_kind::undef;
+    if (with_bias) op_d.bias_desc = *bias_md;
+
+    const int ndims = dst_md->ndims;
+    bool ok = one_of(ndims, 2, 3) && src_md->ndims == ndims
+            && weights_md->ndims == ndims
+            && IMPLICATION(with_bias, bias_md->ndims == ndims);
+    if (!ok) return invalid_arguments;
+
+    const dims_t &dims = dst_md->dims;
+    const int m_idx = ndims - 2, n_idx = ndims - 1;
+
+    // M x K by K x N gives M x N
+    ok = src_md->dims[m_idx] == dims[m_idx]
+            && weights_md->dims[n_idx] == dims[n_idx]
+            && src_md->dims[n_idx] == weights_md->dims[m_idx];
+    if (!ok) return invalid_arguments;
+
+    // the batch of either src or weights can be broadcast
+    if (ndims == 3) {
+        const dim_t src_mb = src_md->dims[0], wei_mb = weights_md->dims[0];
+        ok = one_of(src_mb, 1, dims[0]) && one_of(wei_mb, 1, dims[0])
+                && nstl::max(src_mb, wei_mb) == dims[0];
+        if (!ok) return invalid_arguments;
+    }
+
+    // each bias dimension is either broadcast or matches dst
+    if (with_bias) {
+        for (int d = 0; d < ndims; ++d)
+            if (!one_of(bias_md->dims[d], 1, dims[d]))
+                return invalid_arguments;
+    }
+
+    const data_type_t src_dt = src_md->data_type;
+    op_d.accum_data_type = one_of(src_dt, data_type::s8, data_type::u8)
+            ? data_type::s32
+            : everyone_is(data_type::f16, src_dt, weights_md->data_type,
+                      dst_md->data_type)
+                    ? data_type::f16
+                    : data_type::f32;
+
+    *matmul_desc = op_d;
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
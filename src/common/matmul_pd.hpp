@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef MATMUL_PD_HPP
+#define MATMUL_PD_HPP
+
+#include <assert.h>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct matmul_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::matmul;
+
+    typedef matmul_pd_t base_class;
+    typedef matmul_pd_t hint_class;
+
+    matmul_pd_t(engine_t *engine, const matmul_desc_t *adesc,
+            const primitive_attr_t *attr, const matmul_pd_t *hint_fwd_pd)
+        : primitive_desc_t(engine, attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , weights_md_(desc_.weights_desc)
+        , bias_md_(desc_.bias_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    const matmul_desc_t *desc() const { return &desc_; }
+    virtual const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+    virtual void init_info() override { impl::init_info(this, this->info_); }
+
+    virtual status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::matmul_d:
+                *(const matmul_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    virtual arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_BIAS && with_bias()) return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    virtual const memory_desc_t *src_md(int index = 0) const override {
+        return index == 0 ? &src_md_ : &glob_zero_md;
+    }
+    virtual const memory_desc_t *weights_md(int index = 0) const override {
+        if (index == 0) return &weights_md_;
+        if (index == 1 && with_bias()) return &bias_md_;
+        return &glob_zero_md;
+    }
+    virtual const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    virtual int n_inputs() const override { return 2 + with_bias(); }
+    virtual int n_outputs() const override { return 1; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md_).has_zero_dim()
+                || memory_desc_wrapper(weights_md_).has_zero_dim()
+                || memory_desc_wrapper(dst_md_).has_zero_dim();
+    }
+
+    bool with_bias() const { return bias_md_.ndims != 0; }
+
+    int ndims() const { return dst_md_.ndims; }
+    bool batched() const { return ndims() > 2; }
+
+    dim_t batch() const { return batched() ? dst_md_.dims[0] : 1; }
+    dim_t M() const { return dst_md_.dims[ndims() - 2]; }
+    dim_t N() const { return dst_md_.dims[ndims() - 1]; }
+    dim_t K() const { return src_md_.dims[ndims() - 1]; }
+
+    /** Returns the mask of the bias dimensions that are not broadcast */
+    int bias_mask() const {
+        int mask = 0;
+        if (!with_bias()) return mask;
+        for (int d = 0; d < ndims(); ++d)
+            if (bias_md_.dims[d] != 1) mask |= (1 << d);
+        return mask;
+    }
+
+    /** Returns true if the source (or the weights) matrix is the same for
+     * all the batch entries */
+    bool src_batch_broadcast() const {
+        return batched() && src_md_.dims[0] == 1 && batch() > 1;
+    }
+    bool wei_batch_broadcast() const {
+        return batched() && weights_md_.dims[0] == 1 && batch() > 1;
+    }
+
+protected:
+    matmul_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t weights_md_;
+    memory_desc_t bias_md_;
+    memory_desc_t dst_md_;
+
+    /** Initializes the memory descriptors with format_kind::any to the plain
+     * row-major layout */
+    status_t set_default_params() {
+        using namespace format_tag;
+        const format_tag_t tag = batched() ? abc : ab;
+        for (auto md : {&src_md_, &weights_md_, &dst_md_})
+            if (md->format_kind == format_kind::any)
+                CHECK(memory_desc_init_by_tag(*md, tag));
+        if (with_bias() && bias_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md_, tag));
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -178,6 +178,8 @@ enum {
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
+    key_matmul_dst_in_acc_dt,
+    key_matmul_zp_compensation,
     key_pool_dst_bf16cvt,
     key_pool_src_bf16cvt,
     key_reducer_space,
@@ -188,6 +190,7 @@ enum {
     key_reorder_rnn_weights_quantization,
     key_reorder_rnn_weights_reduction,
     key_reorder_rnn_weights_transposition,
+    key_resampling_dh_table,
     key_rnn_space,
     key_rnn_cell,
     key_rnn_gates,
@@ -34,7 +34,10 @@ status_t scales_t::set(dim_t count, int mask, const float *scales) {
     count_ = count;
     mask_ = mask;
 
-    if (count_ == 1) {
+    if (is_runtime_value(scales[0])) {
+        scales_ = scales_buf_;
+        scales_[0] = scales[0];
+    } else if (count_ == 1) {
         scales_ = scales_buf_;
         utils::array_set(scales_, scales[0], scales_buf_size);
     } else {
@@ -63,7 +66,9 @@ bool primitive_attr_t::has_default_values(
             && IMPLICATION((bool)(~mask & skip_mask_t::rnn_weights_qparams),
                     rnn_weights_qparams_.has_default_values())
             && IMPLICATION((bool)(~mask & skip_mask_t::rnn_tparams),
-                    rnn_tparams_.has_default_values());
+                    rnn_tparams_.has_default_values())
+            && IMPLICATION((bool)(~mask & skip_mask_t::zero_points),
+                    zero_points_.has_default_values());
 }
 
 status_t post_ops_t::append_sum(float scale) {
@@ -165,12 +170,33 @@ status_t dnnl_primitive_attr_get_output_scales(const primitive_attr_t *attr,
 
 status_t dnnl_primitive_attr_set_output_scales(
         primitive_attr_t *attr, dim_t count, int mask, const float *scales) {
-    bool ok = !any_null(attr, scales) && count > 0 && mask >= 0;
+    bool ok = !any_null(attr, scales) && count > 0 && mask >= 0
+            && IMPLICATION(is_runtime_value(scales[0]), count == 1);
     if (!ok) return invalid_arguments;
 
     return attr->output_scales_.set(count, mask, scales);
 }
 
+status_t dnnl_primitive_attr_get_zero_points(const primitive_attr_t *attr,
+        int arg, dim_t *count, int *mask, const int32_t **zero_points) {
+    if (any_null(attr, count, mask, zero_points)) return invalid_arguments;
+    if (!zero_points_t::supported_arg(arg)) return invalid_arguments;
+
+    *count = 1;
+    *mask = 0;
+    *zero_points = attr->zero_points_.get(arg);
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_zero_points(primitive_attr_t *attr, int arg,
+        dim_t count, int mask, const int32_t *zero_points) {
+    bool ok = !any_null(attr, zero_points) && count == 1 && mask == 0;
+    if (!ok) return invalid_arguments;
+
+    return attr->zero_points_.set(arg, zero_points[0]);
+}
+
 status_t dnnl_primitive_attr_get_post_ops(
         const primitive_attr_t *attr, const post_ops_t **post_ops) {
     if (any_null(attr, post_ops)) return invalid_arguments;
@@ -269,7 +295,8 @@ status_t dnnl_primitive_attr_set_rnn_data_qparams(
 
 status_t dnnl_primitive_attr_set_rnn_weights_qparams(
         primitive_attr_t *attr, dim_t count, int mask, const float *scales) {
-    bool ok = !any_null(attr, scales) && count > 0 && mask >= 0;
+    bool ok = !any_null(attr, scales) && count > 0 && mask >= 0
+            && !is_runtime_value(scales[0]);
     if (!ok) return invalid_arguments;
 
     return attr->rnn_weights_qparams_.set(count, mask, scales);
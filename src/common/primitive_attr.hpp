@@ -26,6 +26,17 @@
 namespace dnnl {
 namespace impl {
 
+/** Returns true if @p val is the DNNL_RUNTIME_F32_VAL wildcard.
+ * The wildcard is a NaN, hence the bitwise comparison. */
+inline bool is_runtime_value(float val) {
+    union {
+        float f;
+        unsigned u;
+    } cvt;
+    cvt.f = val;
+    return cvt.u == DNNL_RUNTIME_F32_VAL_REP.u;
+}
+
 struct rnn_data_qparams_t : public c_compatible {
     rnn_data_qparams_t() : scale_(1.), shift_(0.) {}
     bool has_default_values() const { return (scale_ == 1. && shift_ == 0.); }
@@ -130,10 +141,15 @@ struct scales_t : public c_compatible {
     bool operator==(const scales_t &rhs) const {
         bool ret = count_ == rhs.count_ && mask_ == rhs.mask_
                 && !utils::any_null(scales_, rhs.scales_)
-                && utils::array_cmp(scales_, rhs.scales_, count_);
+                && defined() == rhs.defined()
+                && IMPLICATION(defined(),
+                        utils::array_cmp(scales_, rhs.scales_, count_));
         return ret;
     }
 
+    /** Returns false if the scales are passed at execution time */
+    bool defined() const { return !is_runtime_value(scales_[0]); }
+
     bool has_default_values() const {
         for (dim_t c = 0; c < count_; ++c) {
             if (scales_[c] != 1.) return false;
@@ -161,6 +177,65 @@ private:
     }
 };
 
+struct zero_points_t : public c_compatible {
+    zero_points_t()
+        : zero_point_src_(0), zero_point_wei_(0), zero_point_dst_(0) {}
+
+    bool operator==(const zero_points_t &rhs) const {
+        return zero_point_src_ == rhs.zero_point_src_
+                && zero_point_wei_ == rhs.zero_point_wei_
+                && zero_point_dst_ == rhs.zero_point_dst_;
+    }
+
+    /** Returns false if the zero point of @p arg is passed at execution
+     * time */
+    bool defined(int arg) const { return *get(arg) != DNNL_RUNTIME_S32_VAL; }
+    bool defined() const {
+        return defined(DNNL_ARG_SRC) && defined(DNNL_ARG_WEIGHTS)
+                && defined(DNNL_ARG_DST);
+    }
+
+    bool has_default_values(int arg) const { return *get(arg) == 0; }
+    bool has_default_values() const {
+        return has_default_values(DNNL_ARG_SRC)
+                && has_default_values(DNNL_ARG_WEIGHTS)
+                && has_default_values(DNNL_ARG_DST);
+    }
+
+    /** Returns the number of zero points passed at execution time */
+    int runtime_count() const {
+        return !defined(DNNL_ARG_SRC) + !defined(DNNL_ARG_WEIGHTS)
+                + !defined(DNNL_ARG_DST);
+    }
+
+    static bool supported_arg(int arg) {
+        return utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST);
+    }
+
+    const int32_t *get(int arg) const {
+        switch (arg) {
+            case DNNL_ARG_SRC: return &zero_point_src_;
+            case DNNL_ARG_WEIGHTS: return &zero_point_wei_;
+            case DNNL_ARG_DST: return &zero_point_dst_;
+            default: assert(!"unsupported argument"); return nullptr;
+        }
+    }
+
+    status_t set(int arg, int32_t zero_point) {
+        if (!supported_arg(arg)) return status::invalid_arguments;
+        switch (arg) {
+            case DNNL_ARG_SRC: zero_point_src_ = zero_point; break;
+            case DNNL_ARG_WEIGHTS: zero_point_wei_ = zero_point; break;
+            case DNNL_ARG_DST: zero_point_dst_ = zero_point; break;
+        }
+        return status::success;
+    }
+
+private:
+    // only a common zero point per argument is supported
+    int32_t zero_point_src_, zero_point_wei_, zero_point_dst_;
+};
+
 } // namespace impl
 } // namespace dnnl
 
@@ -270,7 +345,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         post_ops = 0x2,
         rnn_data_qparams = 0x4,
         rnn_weights_qparams = 0x8,
-        rnn_tparams = 0x10
+        rnn_tparams = 0x10,
+        zero_points = 0x20
     };
 
     /** Returns true if the attributes have default values.
@@ -284,7 +360,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
                 && rnn_weights_qparams_ == rhs.rnn_weights_qparams_
-                && rnn_tparams_ == rhs.rnn_tparams_;
+                && rnn_tparams_ == rhs.rnn_tparams_
+                && zero_points_ == rhs.zero_points_;
         return ret;
     }
 
@@ -299,6 +376,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::scales_t rnn_weights_qparams_;
     dnnl::impl::rnn_tparams_t rnn_tparams_;
+    dnnl::impl::zero_points_t zero_points_;
 };
 
 inline dnnl_primitive_attr::skip_mask_t operator|(
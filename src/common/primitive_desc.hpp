@@ -69,9 +69,22 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
         using dnnl::impl::types::is_zero_md;
         if (arg == DNNL_ARG_SCRATCHPAD && !is_zero_md(scratchpad_md()))
             return arg_usage_t::output;
+        if (arg == DNNL_ARG_ATTR_OUTPUT_SCALES
+                && !attr()->output_scales_.defined())
+            return arg_usage_t::input;
+        if ((arg & DNNL_ARG_ATTR_ZERO_POINTS)
+                && dnnl::impl::zero_points_t::supported_arg(
+                        arg & ~DNNL_ARG_ATTR_ZERO_POINTS)
+                && !attr()->zero_points_.defined(
+                        arg & ~DNNL_ARG_ATTR_ZERO_POINTS))
+            return arg_usage_t::input;
         return arg_usage_t::unused;
     }
 
+    /** returns true if an input or output may be omitted at execution time,
+     * in which case it is not accounted for by n_inputs() and n_outputs() */
+    virtual bool is_optional_arg(int arg) const { return false; }
+
 #define DECLARE_MD_STUB(stub) \
     virtual const dnnl::impl::memory_desc_t *stub(int idx = 0) const { \
         return &dnnl::impl::glob_zero_md; \
@@ -111,6 +124,10 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
         return scratchpad_registry().size();
     }
 
+    /** returns true if the primitive keeps data between executions, in
+     * which case it is not shared through the primitive cache */
+    virtual bool is_stateful() const { return false; }
+
     virtual int n_inputs() const { return 0; }
     virtual int n_outputs() const { return 0; }
 
@@ -133,8 +150,13 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
         using namespace dnnl::impl;
         using namespace dnnl::impl::status;
         using pd_op_desc_t = typename pkind_traits<pd_t::base_pkind>::desc_type;
-        if (adesc->kind != pd_t::base_pkind) return invalid_arguments;
-        assert(hint_fwd ? hint_fwd->kind() == pd_t::base_pkind : true);
+        // logsoftmax shares the descriptor and the implementations with
+        // softmax
+        const bool is_logsoftmax = pd_t::base_pkind == primitive_kind::softmax
+                && adesc->kind == primitive_kind::logsoftmax;
+        if (adesc->kind != pd_t::base_pkind && !is_logsoftmax)
+            return invalid_arguments;
+        assert(hint_fwd ? hint_fwd->kind() == adesc->kind : true);
         auto hint
                 = reinterpret_cast<const typename pd_t::hint_class *>(hint_fwd);
         auto _pd = new pd_t(engine, (const pd_op_desc_t *)adesc, attr, hint);
@@ -38,12 +38,12 @@ status_t cvt_primtive_args(const primitive_desc_t *pd, int nargs,
             case primitive_desc_t::arg_usage_t::input:
                 if (args.count(arg) != 0) return invalid_arguments;
                 args[arg] = {mem, true};
-                n_inputs++;
+                if (!pd->is_optional_arg(arg)) n_inputs++;
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 if (args.count(arg) != 0) return invalid_arguments;
                 args[arg] = {mem, false};
-                n_outputs++;
+                if (!pd->is_optional_arg(arg)) n_outputs++;
                 break;
             case primitive_desc_t::arg_usage_t::unused: break;
         }
@@ -51,7 +51,13 @@ status_t cvt_primtive_args(const primitive_desc_t *pd, int nargs,
 
     bool scratchpad_required = !types::is_zero_md(pd->scratchpad_md());
 
-    if (n_inputs != pd->n_inputs()) return invalid_arguments;
+    bool runtime_oscales_required = !pd->attr()->output_scales_.defined();
+    int runtime_zero_points = pd->attr()->zero_points_.runtime_count();
+
+    if (n_inputs
+            != pd->n_inputs() + (runtime_oscales_required ? 1 : 0)
+                    + runtime_zero_points)
+        return invalid_arguments;
     if (n_outputs != pd->n_outputs() + (scratchpad_required ? 1 : 0))
         return invalid_arguments;
 
@@ -19,6 +19,7 @@
 #include "utils.hpp"
 
 #include "pooling_pd.hpp"
+#include "resampling_pd.hpp"
 #include "shuffle_pd.hpp"
 
 #include "primitive_hashing.hpp"
@@ -79,6 +80,9 @@ void key_t::init_mds(const primitive_desc_t *pd) {
         case primitive_kind::lrn: {
             break;
         }
+        case primitive_kind::matmul: {
+            break;
+        }
         case primitive_kind::pooling: {
             auto typed_pd = utils::downcast<const pooling_pd_t *>(pd);
             if (!typed_pd->is_fwd()) {
@@ -87,9 +91,20 @@ void key_t::init_mds(const primitive_desc_t *pd) {
             }
             break;
         }
+        case primitive_kind::reduction: {
+            break;
+        }
         case primitive_kind::reorder: {
             break;
         }
+        case primitive_kind::resampling: {
+            auto typed_pd = utils::downcast<const resampling_pd_t *>(pd);
+            if (!typed_pd->is_fwd()) {
+                mds.push_back(*typed_pd->diff_dst_md(0));
+                mds.push_back(*typed_pd->diff_src_md(0));
+            }
+            break;
+        }
         case primitive_kind::rnn: {
             break;
         }
@@ -101,7 +116,8 @@ void key_t::init_mds(const primitive_desc_t *pd) {
             }
             break;
         }
-        case primitive_kind::softmax: {
+        case primitive_kind::softmax:
+        case primitive_kind::logsoftmax: {
             break;
         }
         case primitive_kind::sum: {
@@ -156,12 +172,21 @@ bool key_t::operator==(const key_t &rhs) const {
         case primitive_kind::lrn:
             ret = cast_and_compare<lrn_desc_t>(op_desc_, rhs.op_desc_);
             break;
+        case primitive_kind::matmul:
+            ret = cast_and_compare<matmul_desc_t>(op_desc_, rhs.op_desc_);
+            break;
         case primitive_kind::pooling:
             ret = cast_and_compare<pooling_desc_t>(op_desc_, rhs.op_desc_);
             break;
+        case primitive_kind::reduction:
+            ret = cast_and_compare<reduction_desc_t>(op_desc_, rhs.op_desc_);
+            break;
         case primitive_kind::reorder:
             ret = cast_and_compare<reorder_desc_t>(op_desc_, rhs.op_desc_);
             break;
+        case primitive_kind::resampling:
+            ret = cast_and_compare<resampling_desc_t>(op_desc_, rhs.op_desc_);
+            break;
         case primitive_kind::rnn:
             ret = cast_and_compare<rnn_desc_t>(op_desc_, rhs.op_desc_);
             break;
@@ -169,6 +194,7 @@ bool key_t::operator==(const key_t &rhs) const {
             ret = cast_and_compare<shuffle_desc_t>(op_desc_, rhs.op_desc_);
             break;
         case primitive_kind::softmax:
+        case primitive_kind::logsoftmax:
             ret = cast_and_compare<softmax_desc_t>(op_desc_, rhs.op_desc_);
             break;
         case primitive_kind::sum:
@@ -118,6 +118,9 @@ static inline size_t get_attr_hash(const primitive_attr_t *attr) {
             seed = hash_combine(seed, attr->rnn_weights_qparams_.scales_[i]);
         }
     }
+    // zero_points
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
+        seed = hash_combine(seed, *attr->zero_points_.get(arg));
     // Combined hash for attributes
     return seed;
 }
@@ -398,6 +401,23 @@ size_t get_desc_hash<lrn_desc_t>(const op_desc_t *op_desc) {
     return seed;
 }
 
+template <>
+size_t get_desc_hash<matmul_desc_t>(const op_desc_t *op_desc) {
+    const auto *desc = reinterpret_cast<const matmul_desc_t *>(op_desc);
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc->primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc->src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc->bias_desc));
+    seed = hash_combine(seed, get_md_hash(desc->dst_desc));
+    // Accumulator type
+    seed = hash_combine(seed, static_cast<size_t>(desc->accum_data_type));
+    // Combined hash for matmul op desc
+    return seed;
+}
+
 template <>
 size_t get_desc_hash<pooling_desc_t>(const op_desc_t *op_desc) {
     const auto *desc = reinterpret_cast<const pooling_desc_t *>(op_desc);
@@ -422,6 +442,42 @@ size_t get_desc_hash<pooling_desc_t>(const op_desc_t *op_desc) {
     return seed;
 }
 
+template <>
+size_t get_desc_hash<reduction_desc_t>(const op_desc_t *op_desc) {
+    const auto *desc = reinterpret_cast<const reduction_desc_t *>(op_desc);
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc->primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc->alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc->src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->dst_desc));
+    // P, eps
+    seed = hash_combine(seed, desc->p);
+    seed = hash_combine(seed, desc->eps);
+    // Combined hash for reduction desc
+    return seed;
+}
+
+template <>
+size_t get_desc_hash<resampling_desc_t>(const op_desc_t *op_desc) {
+    const auto *desc = reinterpret_cast<const resampling_desc_t *>(op_desc);
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc->primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc->prop_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc->alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc->src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->diff_src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc->diff_dst_desc));
+    // Factors
+    seed = get_array_hash(seed, desc->factors, DNNL_MAX_NDIMS);
+    // Combined hash for resampling desc
+    return seed;
+}
+
 template <>
 size_t get_desc_hash<reorder_desc_t>(const op_desc_t *op_desc) {
     const auto *desc = reinterpret_cast<const reorder_desc_t *>(op_desc);
@@ -457,8 +513,8 @@ size_t get_desc_hash<rnn_desc_t>(const op_desc_t *op_desc) {
     seed = hash_combine(seed, get_md_hash(desc->dst_layer_desc));
     seed = hash_combine(seed, get_md_hash(desc->dst_iter_desc));
     seed = hash_combine(seed, get_md_hash(desc->dst_iter_c_desc));
-    seed = hash_combine(seed, get_md_hash(desc->placeholder_desc));
-    seed = hash_combine(seed, get_md_hash(desc->placeholder2_desc));
+    seed = hash_combine(seed, get_md_hash(desc->weights_peephole_desc));
+    seed = hash_combine(seed, get_md_hash(desc->weights_projection_desc));
     seed = hash_combine(seed, get_md_hash(desc->diff_src_layer_desc));
     seed = hash_combine(seed, get_md_hash(desc->diff_src_iter_desc));
     seed = hash_combine(seed, get_md_hash(desc->diff_src_iter_c_desc));
@@ -468,8 +524,8 @@ size_t get_desc_hash<rnn_desc_t>(const op_desc_t *op_desc) {
     seed = hash_combine(seed, get_md_hash(desc->diff_dst_layer_desc));
     seed = hash_combine(seed, get_md_hash(desc->diff_dst_iter_desc));
     seed = hash_combine(seed, get_md_hash(desc->diff_dst_iter_c_desc));
-    seed = hash_combine(seed, get_md_hash(desc->diff_placeholder_desc));
-    seed = hash_combine(seed, get_md_hash(desc->diff_placeholder2_desc));
+    seed = hash_combine(seed, get_md_hash(desc->diff_weights_peephole_desc));
+    seed = hash_combine(seed, get_md_hash(desc->diff_weights_projection_desc));
     // Flags
     seed = hash_combine(seed, desc->flags);
     // Activation kind
@@ -599,14 +655,26 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
                 seed = hash_combine(
                         seed, get_desc_hash<lrn_desc_t>(key.op_desc_));
                 break;
+            case primitive_kind::matmul:
+                seed = hash_combine(
+                        seed, get_desc_hash<matmul_desc_t>(key.op_desc_));
+                break;
             case primitive_kind::pooling:
                 seed = hash_combine(
                         seed, get_desc_hash<pooling_desc_t>(key.op_desc_));
                 break;
+            case primitive_kind::reduction:
+                seed = hash_combine(
+                        seed, get_desc_hash<reduction_desc_t>(key.op_desc_));
+                break;
             case primitive_kind::reorder:
                 seed = hash_combine(
                         seed, get_desc_hash<reorder_desc_t>(key.op_desc_));
                 break;
+            case primitive_kind::resampling:
+                seed = hash_combine(
+                        seed, get_desc_hash<resampling_desc_t>(key.op_desc_));
+                break;
             case primitive_kind::rnn:
                 seed = hash_combine(
                         seed, get_desc_hash<rnn_desc_t>(key.op_desc_));
@@ -616,6 +684,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
                         seed, get_desc_hash<shuffle_desc_t>(key.op_desc_));
                 break;
             case primitive_kind::softmax:
+            case primitive_kind::logsoftmax:
                 seed = hash_combine(
                         seed, get_desc_hash<softmax_desc_t>(key.op_desc_));
                 break;
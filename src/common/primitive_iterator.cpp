@@ -22,6 +22,7 @@
 #include "engine.hpp"
 #include "primitive_desc.hpp"
 #include "primitive_iterator.hpp"
+#include "primitive_tuning.hpp"
 #include "type_helpers.hpp"
 
 using namespace dnnl::impl;
@@ -34,10 +35,20 @@ status_t dnnl_primitive_desc_iterator_create(
     const op_desc_t *op_desc = (const op_desc_t *)c_op_desc;
     if (utils::any_null(iterator, op_desc, engine)) return invalid_arguments;
 
+    // zero points are only supported by matmul so far
+    if (attr && !attr->zero_points_.has_default_values()
+            && op_desc->kind != primitive_kind::matmul)
+        return unimplemented;
+
     auto it = new primitive_desc_iterator_t(engine, op_desc, attr, hint_fwd_pd);
     if (it == nullptr) return out_of_memory;
 
-    ++(*it);
+    const int tuned_idx
+            = get_tuned_impl_idx(engine, op_desc, attr, hint_fwd_pd);
+    if (tuned_idx >= 0)
+        it->seek(tuned_idx);
+    else
+        ++(*it);
     if (*it == it->end()) {
         delete it;
         return unimplemented;
@@ -81,8 +92,18 @@ status_t dnnl_primitive_desc_create(primitive_desc_t **primitive_desc,
     if (utils::any_null(primitive_desc, op_desc, engine))
         return invalid_arguments;
 
+    // zero points are only supported by matmul so far
+    if (attr && !attr->zero_points_.has_default_values()
+            && op_desc->kind != primitive_kind::matmul)
+        return unimplemented;
+
     dnnl_primitive_desc_iterator it(engine, op_desc, attr, hint_fwd_pd);
-    ++it;
+    const int tuned_idx
+            = get_tuned_impl_idx(engine, op_desc, attr, hint_fwd_pd);
+    if (tuned_idx >= 0)
+        it.seek(tuned_idx);
+    else
+        ++it;
     if (it == it.end()) return unimplemented;
 
     return safe_ptr_assign<primitive_desc_t>(*primitive_desc, *it);
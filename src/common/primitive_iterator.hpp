@@ -16,6 +16,8 @@
 #ifndef PRIMITIVE_ITERATOR_HPP
 #define PRIMITIVE_ITERATOR_HPP
 
+#include <assert.h>
+
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
@@ -69,6 +71,14 @@ struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
         return *this;
     }
 
+    /** Positions the iterator on the first implementation that succeeds
+     * starting from the given index in the engine implementation list */
+    dnnl::impl::primitive_desc_iterator_t &seek(int idx) {
+        assert(0 <= idx && idx <= last_idx_);
+        idx_ = idx - 1;
+        return ++(*this);
+    }
+
     dnnl::impl::primitive_desc_t *operator*() const {
         if (*this == end() || pd_ == nullptr) return nullptr;
         return pd_->clone();
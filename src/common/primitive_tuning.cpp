@@ -0,0 +1,343 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl.h"
+#include "dnnl_debug.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "memory.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_hashing.hpp"
+#include "primitive_tuning.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// Number of timed executions of every candidate (after one warm-up run)
+const int tuning_iters = 5;
+
+int tuning_flag = 0;
+std::once_flag tuning_flag_once;
+
+std::mutex tuning_table_mutex;
+bool tuning_table_loaded = false;
+std::unordered_map<std::string, std::string> tuning_table;
+
+const char *tuning_table_path() {
+    static char path[1024] = {'\0'};
+    static std::once_flag once;
+    std::call_once(once, [&]() {
+        if (getenv("DNNL_PRIMITIVE_TUNING_TABLE", path, sizeof(path)) <= 0)
+            path[0] = '\0';
+    });
+    return path[0] != '\0' ? path : nullptr;
+}
+
+/* The table is stored as text, one `key<TAB>implementation name` pair per
+ * line. Must be called with tuning_table_mutex held. */
+void load_tuning_table() {
+    if (tuning_table_loaded) return;
+    tuning_table_loaded = true;
+
+    const char *path = tuning_table_path();
+    if (path == nullptr) return;
+
+    FILE *fp = fopen(path, "r");
+    if (fp == nullptr) return;
+
+    char line[4096];
+    while (fgets(line, sizeof(line), fp) != nullptr) {
+        char *tab = strchr(line, '\t');
+        if (tab == nullptr) continue;
+        *tab = '\0';
+        char *name = tab + 1;
+        name[strcspn(name, "\r\n")] = '\0';
+        if (*name != '\0') tuning_table[line] = name;
+    }
+    fclose(fp);
+}
+
+void save_tuning_entry(const std::string &key, const std::string &name) {
+    const char *path = tuning_table_path();
+    if (path == nullptr) return;
+
+    FILE *fp = fopen(path, "a");
+    if (fp == nullptr) return;
+    fprintf(fp, "%s\t%s\n", key.c_str(), name.c_str());
+    fclose(fp);
+}
+
+void append_md(std::string &key, const char *prefix, const memory_desc_t &md) {
+    char fmt_str[256] = {'\0'}, dim_str[256] = {'\0'};
+    dnnl_md2fmt_str(fmt_str, sizeof(fmt_str), &md);
+    dnnl_md2dim_str(dim_str, sizeof(dim_str), &md);
+    key += prefix;
+    key += fmt_str;
+    key += ":";
+    key += dim_str;
+    key += ",";
+}
+
+void append_dims(std::string &key, const char *prefix, const dims_t dims,
+        int ndims) {
+    key += prefix;
+    for (int d = 0; d < ndims; ++d) {
+        key += d ? "x" : "";
+        key += std::to_string(dims[d]);
+    }
+    key += ",";
+}
+
+/* Builds a persistable key describing the problem independently of the
+ * implementation. Returns false if the primitive kind is not tuned. */
+bool make_tuning_key(std::string &key, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd) {
+    if (op_desc->kind != primitive_kind::convolution) return false;
+
+    const auto &cd = *reinterpret_cast<const convolution_desc_t *>(op_desc);
+    const int sp_ndims = nstl::max(cd.src_desc.ndims, cd.diff_src_desc.ndims)
+            - 2;
+
+    key = "convolution,";
+    key += dnnl_prop_kind2str(cd.prop_kind);
+    key += ",";
+    key += dnnl_alg_kind2str(cd.alg_kind);
+    key += ",";
+    append_md(key, "src_", cd.src_desc);
+    append_md(key, "diff_src_", cd.diff_src_desc);
+    append_md(key, "wei_", cd.weights_desc);
+    append_md(key, "diff_wei_", cd.diff_weights_desc);
+    append_md(key, "bia_", cd.bias_desc);
+    append_md(key, "diff_bia_", cd.diff_bias_desc);
+    append_md(key, "dst_", cd.dst_desc);
+    append_md(key, "diff_dst_", cd.diff_dst_desc);
+    append_dims(key, "s", cd.strides, sp_ndims);
+    append_dims(key, "d", cd.dilates, sp_ndims);
+    append_dims(key, "pl", cd.padding[0], sp_ndims);
+    append_dims(key, "pr", cd.padding[1], sp_ndims);
+    key += "attr";
+    key += std::to_string(primitive_hashing::get_attr_hash(attr));
+    key += ",nthr";
+    key += std::to_string(dnnl_get_max_threads());
+    if (hint_fwd_pd) {
+        key += ",hint_";
+        key += hint_fwd_pd->name();
+    }
+    return true;
+}
+
+const memory_desc_t *arg_md(const primitive_desc_t *pd, int arg) {
+    switch (arg) {
+        case DNNL_ARG_SRC: return pd->src_md(0);
+        case DNNL_ARG_WEIGHTS: return pd->weights_md(0);
+        case DNNL_ARG_BIAS: return pd->weights_md(1);
+        case DNNL_ARG_DST: return pd->dst_md(0);
+        case DNNL_ARG_DIFF_SRC: return pd->diff_src_md(0);
+        case DNNL_ARG_DIFF_WEIGHTS: return pd->diff_weights_md(0);
+        case DNNL_ARG_DIFF_BIAS: return pd->diff_weights_md(1);
+        case DNNL_ARG_DIFF_DST: return pd->diff_dst_md(0);
+        case DNNL_ARG_WORKSPACE: return pd->workspace_md(0);
+        case DNNL_ARG_SCRATCHPAD: return pd->scratchpad_md(0);
+        default: return nullptr;
+    }
+}
+
+/* Executes the primitive described by @p pd on zero-filled scratch data and
+ * returns the best time in ms, or a negative value on failure. The timing
+ * stops early once the candidate is twice as slow as @p cutoff_ms. */
+double measure_pd(const primitive_desc_t *pd, double cutoff_ms) {
+    const int args[] = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS,
+            DNNL_ARG_DST, DNNL_ARG_DIFF_SRC, DNNL_ARG_DIFF_WEIGHTS,
+            DNNL_ARG_DIFF_BIAS, DNNL_ARG_DIFF_DST, DNNL_ARG_WORKSPACE,
+            DNNL_ARG_SCRATCHPAD, DNNL_ARG_ATTR_OUTPUT_SCALES};
+
+    double best_ms = -1;
+    primitive_t *p = nullptr;
+    stream_t *stream = nullptr;
+    std::vector<dnnl_exec_arg_t> exec_args;
+
+    auto cleanup = [&]() {
+        for (auto &a : exec_args)
+            dnnl_memory_destroy(a.memory);
+        if (stream) dnnl_stream_destroy(stream);
+        if (p) dnnl_primitive_destroy(p);
+        return best_ms;
+    };
+
+    if (dnnl_primitive_create(&p, pd) != status::success) return cleanup();
+    if (dnnl_stream_create(&stream, pd->engine(), stream_flags::default_flags)
+            != status::success)
+        return cleanup();
+
+    for (int arg : args) {
+        if (pd->arg_usage(arg) == primitive_desc_t::arg_usage_t::unused)
+            continue;
+
+        memory_desc_t md;
+        if (arg == DNNL_ARG_ATTR_OUTPUT_SCALES) {
+            const int mask = pd->attr()->output_scales_.mask_;
+            dims_t count = {1};
+            for (int d = 0; d < pd->dst_md()->ndims; ++d)
+                if (mask & (1 << d)) count[0] *= pd->dst_md()->dims[d];
+            if (dnnl_memory_desc_init_by_tag(
+                        &md, 1, count, data_type::f32, format_tag::x)
+                    != status::success)
+                return cleanup();
+        } else {
+            md = *arg_md(pd, arg);
+        }
+
+        memory_t *mem = nullptr;
+        if (dnnl_memory_create(&mem, &md, pd->engine(), DNNL_MEMORY_ALLOCATE)
+                != status::success)
+            return cleanup();
+        exec_args.push_back({arg, mem});
+
+        void *handle = nullptr;
+        dnnl_memory_get_data_handle(mem, &handle);
+        if (handle) memset(handle, 0, dnnl_memory_desc_get_size(&md));
+    }
+
+    auto execute = [&]() {
+        status_t status = dnnl_primitive_execute(
+                p, stream, (int)exec_args.size(), exec_args.data());
+        if (status == status::success) status = dnnl_stream_wait(stream);
+        return status;
+    };
+
+    if (execute() != status::success) return cleanup();
+
+    for (int i = 0; i < tuning_iters; ++i) {
+        double ms = get_msec();
+        if (execute() != status::success) {
+            best_ms = -1;
+            return cleanup();
+        }
+        ms = get_msec() - ms;
+        if (best_ms < 0 || ms < best_ms) best_ms = ms;
+        if (cutoff_ms > 0 && ms > 2 * cutoff_ms) break;
+    }
+
+    return cleanup();
+}
+
+} // namespace
+
+bool primitive_tuning_enabled() {
+    std::call_once(tuning_flag_once, []() {
+        tuning_flag = getenv_int("DNNL_PRIMITIVE_TUNING", 0);
+    });
+    return tuning_flag != 0;
+}
+
+int get_tuned_impl_idx(engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd) {
+    if (!primitive_tuning_enabled() || engine->kind() != engine_kind::cpu)
+        return -1;
+
+    const primitive_attr_t default_attr;
+    if (attr == nullptr) attr = &default_attr;
+
+    std::string key;
+    if (!make_tuning_key(key, op_desc, attr, hint_fwd_pd)) return -1;
+
+    const auto *impl_list = engine->get_implementation_list();
+
+    std::string tuned_name;
+    {
+        std::lock_guard<std::mutex> lock(tuning_table_mutex);
+        load_tuning_table();
+        auto it = tuning_table.find(key);
+        if (it != tuning_table.end()) tuned_name = it->second;
+    }
+
+    if (!tuned_name.empty()) {
+        for (int idx = 0; impl_list[idx] != nullptr; ++idx) {
+            primitive_desc_t *pd = nullptr;
+            if (impl_list[idx](&pd, op_desc, attr, engine, hint_fwd_pd)
+                    != status::success)
+                continue;
+            const bool found = tuned_name == pd->name();
+            delete pd;
+            if (found) return idx;
+        }
+        // The table entry is stale (e.g. it comes from another build or
+        // machine): tune the problem again
+    }
+
+    // Collect the eligible implementations. Reference ones are only
+    // considered when nothing else is available.
+    std::vector<std::pair<int, primitive_desc_t *>> candidates;
+    bool has_optimized = false;
+    for (int idx = 0; impl_list[idx] != nullptr; ++idx) {
+        primitive_desc_t *pd = nullptr;
+        if (impl_list[idx](&pd, op_desc, attr, engine, hint_fwd_pd)
+                != status::success)
+            continue;
+        candidates.emplace_back(idx, pd);
+        if (strncmp(pd->name(), "ref", 3) != 0) has_optimized = true;
+    }
+
+    int best_idx = -1;
+    double best_ms = -1;
+    std::string best_name;
+    for (auto &c : candidates) {
+        primitive_desc_t *pd = c.second;
+        if (has_optimized && strncmp(pd->name(), "ref", 3) == 0) continue;
+
+        const double ms = measure_pd(pd, best_ms);
+        if (dnnl_verbose()->level >= 2) {
+            printf("dnnl_verbose,tune,%s,%g\n", pd->info(), ms);
+            fflush(0);
+        }
+        if (ms >= 0 && (best_ms < 0 || ms < best_ms)) {
+            best_ms = ms;
+            best_idx = c.first;
+            best_name = pd->name();
+        }
+    }
+
+    for (auto &c : candidates)
+        delete c.second;
+
+    if (best_idx < 0) return -1;
+
+    std::lock_guard<std::mutex> lock(tuning_table_mutex);
+    if (tuning_table.count(key) == 0 || tuning_table[key] != best_name) {
+        tuning_table[key] = best_name;
+        save_tuning_entry(key, best_name);
+    }
+    return best_idx;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef PRIMITIVE_TUNING_HPP
+#define PRIMITIVE_TUNING_HPP
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+/** Returns true if the tuned primitive creation mode is enabled with the
+ * DNNL_PRIMITIVE_TUNING environment variable */
+bool primitive_tuning_enabled();
+
+/** Returns the index of the fastest implementation for the given problem in
+ * the engine implementation list, or -1 if the tuned mode is disabled or does
+ * not apply to the problem.
+ *
+ * On the first request for a problem all the eligible implementations are
+ * created and timed on scratch data. The winner is remembered by name in a
+ * table keyed by the operation descriptor, the attributes and the number of
+ * threads. The table can be persisted across runs with the
+ * DNNL_PRIMITIVE_TUNING_TABLE environment variable. */
+int get_tuned_impl_idx(engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
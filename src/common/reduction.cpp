@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::types;
+
+status_t dnnl_reduction_desc_init(reduction_desc_t *reduction_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_md,
+        const memory_desc_t *dst_md, float p, float eps) {
+    bool args_ok = true && !any_null(reduction_desc, src_md, dst_md)
+            && one_of(alg_kind, reduction_max, reduction_min, reduction_sum,
+                    reduction_mul, reduction_mean, reduction_norm_lp_max,
+                    reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                    reduction_norm_lp_power_p_sum)
+            && src_md->format_kind != format_kind::any;
+    if (!args_ok) return invalid_arguments;
+
+    const bool is_norm = one_of(alg_kind, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
+    if (is_norm && !(p >= 1.f && eps >= 0.f)) return invalid_arguments;
+
+    auto rd = reduction_desc_t();
+    rd.primitive_kind = primitive_kind::reduction;
+    rd.alg_kind = alg_kind;
+
+    rd.src_desc = *src_md;
+    rd.dst_desc = *dst_md;
+    rd.p = p;
+    rd.eps = eps;
+
+    const int ndims = src_md->ndims;
+    const dims_t &dims = src_md->dims;
+
+    // every dst dimension is either kept or reduced to 1
+    if (ndims == 0 || dst_md->ndims != ndims) return invalid_arguments;
+    for (int d = 0; d < ndims; ++d) {
+        if (!one_of(dst_md->dims[d], 1, dims[d])) return invalid_arguments;
+    }
+
+    *reduction_desc = rd;
+    return success;
+}
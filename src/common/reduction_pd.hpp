@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef REDUCTION_PD_HPP
+#define REDUCTION_PD_HPP
+
+#include <assert.h>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct reduction_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::reduction;
+
+    typedef reduction_pd_t base_class;
+    typedef reduction_pd_t hint_class;
+
+    reduction_pd_t(engine_t *engine, const reduction_desc_t *adesc,
+            const primitive_attr_t *attr, const reduction_pd_t *hint_fwd_pd)
+        : primitive_desc_t(engine, attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    const reduction_desc_t *desc() const { return &desc_; }
+    virtual const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+    virtual void init_info() override { impl::init_info(this, this->info_); }
+
+    virtual status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::reduction_d:
+                *(const reduction_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    virtual arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    virtual const memory_desc_t *src_md(int index = 0) const override {
+        return index == 0 ? &src_md_ : &glob_zero_md;
+    }
+    virtual const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    virtual int n_inputs() const override { return 1; }
+    virtual int n_outputs() const override { return 1; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md_).has_zero_dim();
+    }
+
+    int ndims() const { return src_md_.ndims; }
+
+    /** Returns true if dimension @p d is reduced */
+    bool is_reduced(int d) const { return src_md_.dims[d] != dst_md_.dims[d]; }
+
+    /** Returns the number of source points reduced into a single one */
+    dim_t reduce_size() const {
+        dim_t size = 1;
+        for (int d = 0; d < ndims(); ++d)
+            if (is_reduced(d)) size *= src_md_.dims[d];
+        return size;
+    }
+
+    bool is_norm() const {
+        using namespace alg_kind;
+        return utils::one_of(desc_.alg_kind, reduction_norm_lp_max,
+                reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                reduction_norm_lp_power_p_sum);
+    }
+
+protected:
+    reduction_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+
+    /** Initializes dst with format_kind::any to the layout of src. If src
+     * is blocked by a reduced dimension the blocking is dropped. */
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+
+        const memory_desc_wrapper src_d(src_md_);
+        if (!src_d.is_blocking_desc()) return status::unimplemented;
+
+        blocking_desc_t blk = src_d.blocking_desc();
+        for (int iblk = 0; iblk < blk.inner_nblks; ++iblk)
+            if (is_reduced((int)blk.inner_idxs[iblk])) blk.inner_nblks = 0;
+
+        return memory_desc_init_by_blocking_desc(dst_md_, blk);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -68,6 +68,7 @@ status_t dnnl_reorder_primitive_desc_create(primitive_desc_t **reorder_pd,
 
     const primitive_attr_t dummy_attr;
     if (attr == NULL) attr = &dummy_attr;
+    if (!attr->zero_points_.has_default_values()) return unimplemented;
 
     auto e = get_reorder_engine(src_engine, dst_engine);
     for (auto r = e->get_reorder_implementation_list(); *r; ++r) {
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::prop_kind;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::types;
+
+namespace {
+status_t resampling_desc_init(resampling_desc_t *resampling_desc,
+        prop_kind_t prop_kind, alg_kind_t alg_kind, const float *factors,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc) {
+    bool args_ok = true && !any_null(resampling_desc, src_desc)
+            && IMPLICATION(dst_desc == nullptr, factors != nullptr)
+            && one_of(alg_kind, resampling_nearest, resampling_linear)
+            && utils::one_of(src_desc->ndims, 3, 4, 5);
+    if (!args_ok) return invalid_arguments;
+
+    const int ndims = src_desc->ndims;
+
+    auto rd = resampling_desc_t();
+    rd.primitive_kind = primitive_kind::resampling;
+    rd.prop_kind = prop_kind;
+    rd.alg_kind = alg_kind;
+
+    // the destination is deduced from the factors if it is not provided
+    memory_desc_t dst_md;
+    if (dst_desc == nullptr) {
+        dims_t dst_dims;
+        dst_dims[0] = src_desc->dims[0];
+        dst_dims[1] = src_desc->dims[1];
+        for (int i = 2; i < ndims; ++i)
+            dst_dims[i] = (dim_t)(src_desc->dims[i] * factors[i - 2]);
+        status_t status = dnnl_memory_desc_init_by_tag(&dst_md, ndims,
+                dst_dims, src_desc->data_type, format_tag::any);
+        if (status != success) return status;
+        dst_desc = &dst_md;
+    }
+
+    bool consistency = true && dst_desc->ndims == ndims
+            && src_desc->dims[0] == dst_desc->dims[0]
+            && src_desc->dims[1] == dst_desc->dims[1];
+    for (int i = 2; i < ndims; ++i)
+        consistency = consistency && src_desc->dims[i] > 0
+                && dst_desc->dims[i] > 0;
+    if (!consistency) return invalid_arguments;
+
+    for (int i = 2; i < ndims; ++i)
+        rd.factors[i - 2] = factors ? factors[i - 2]
+                                    : (float)dst_desc->dims[i]
+                        / src_desc->dims[i];
+
+    const bool is_fwd = one_of(prop_kind, forward_training, forward_inference);
+
+    rd.diff_src_desc = rd.src_desc = zero_md();
+    rd.diff_dst_desc = rd.dst_desc = zero_md();
+
+    (is_fwd ? rd.src_desc : rd.diff_src_desc) = *src_desc;
+    (is_fwd ? rd.dst_desc : rd.diff_dst_desc) = *dst_desc;
+
+    *resampling_desc = rd;
+    return success;
+}
+} // namespace
+
+status_t dnnl_resampling_forward_desc_init(resampling_desc_t *resampling_desc,
+        prop_kind_t prop_kind, alg_kind_t alg_kind, const float *factors,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc) {
+    if (!one_of(prop_kind, forward_training, forward_inference))
+        return invalid_arguments;
+    return resampling_desc_init(resampling_desc, prop_kind, alg_kind, factors,
+            src_desc, dst_desc);
+}
+
+status_t dnnl_resampling_backward_desc_init(
+        resampling_desc_t *resampling_desc, alg_kind_t alg_kind,
+        const float *factors, const memory_desc_t *diff_src_desc,
+        const memory_desc_t *diff_dst_desc) {
+    return resampling_desc_init(resampling_desc, backward_data, alg_kind,
+            factors, diff_src_desc, diff_dst_desc);
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef RESAMPLING_UTILS_HPP
+#define RESAMPLING_UTILS_HPP
+
+#include "c_types_map.hpp"
+#include "nstl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace resampling_utils {
+
+/* The centers of the output points are mapped to the input space:
+ * x = (y + 0.5) * x_max / y_max - 0.5, where y is an output index and
+ * y_max, x_max are the output and the input sizes of the dimension. */
+inline float linear_map(dim_t y, dim_t y_max, dim_t x_max) {
+    return ((float)y + 0.5f) * x_max / y_max - 0.5f;
+}
+
+/** Returns the input index that is the nearest to the output point @p y */
+inline dim_t nearest_idx(dim_t y, dim_t y_max, dim_t x_max) {
+    const dim_t x = (dim_t)(((float)y + 0.5f) * x_max / y_max);
+    return nstl::min(x, x_max - 1);
+}
+
+/** Two input points and their weights for the output point @p y. The points
+ * are clamped to the borders, in which case they coincide. */
+struct linear_coeffs_t {
+    linear_coeffs_t(dim_t y, dim_t y_max, dim_t x_max) {
+        const float x = nstl::max(linear_map(y, y_max, x_max), 0.f);
+        idx[0] = nstl::min((dim_t)x, x_max - 1);
+        idx[1] = nstl::min(idx[0] + 1, x_max - 1);
+        wei[1] = nstl::min(x - idx[0], 1.f);
+        wei[0] = 1.f - wei[1];
+    }
+
+    dim_t idx[2];
+    float wei[2];
+};
+
+} // namespace resampling_utils
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
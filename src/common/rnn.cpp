@@ -66,6 +66,10 @@ rnn_desc_t zero_rnn_desc() {
     rd.diff_bias_desc = zero_md();
     rd.diff_dst_layer_desc = zero_md();
     rd.diff_dst_iter_desc = zero_md();
+    rd.weights_peephole_desc = zero_md();
+    rd.weights_projection_desc = zero_md();
+    rd.diff_weights_peephole_desc = zero_md();
+    rd.diff_weights_projection_desc = zero_md();
     return rd;
 }
 
@@ -74,8 +78,11 @@ status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
         const memory_desc_t *src_iter_desc,
         const memory_desc_t *src_iter_c_desc,
         const memory_desc_t *weights_layer_desc,
-        const memory_desc_t *weights_iter_desc, const memory_desc_t *bias_desc,
-        const memory_desc_t *dst_layer_desc, const memory_desc_t *dst_iter_desc,
+        const memory_desc_t *weights_iter_desc,
+        const memory_desc_t *weights_peephole_desc,
+        const memory_desc_t *weights_projection_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_layer_desc,
+        const memory_desc_t *dst_iter_desc,
         const memory_desc_t *dst_iter_c_desc) {
     using namespace data_type;
     data_type_t src_layer_dt = src_layer_desc->data_type;
@@ -85,7 +92,6 @@ status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
 
     bool is_forward = !(prop_kind == prop_kind::backward);
     bool is_inference = prop_kind == prop_kind::forward_inference;
-    bool is_lstm = cell_kind == dnnl_vanilla_lstm;
 
     bool cell_state_check
             = IMPLICATION(!is_zero_md(src_iter_c_desc),
@@ -93,6 +99,14 @@ status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
             && IMPLICATION(!is_zero_md(dst_iter_c_desc),
                     one_of(dst_iter_c_desc->data_type, f32, f16));
 
+    // peephole weights are applied to the cell state and are always f32;
+    // projection weights share the data type of the other weights
+    bool extra_weights_check
+            = IMPLICATION(!is_zero_md(weights_peephole_desc),
+                      weights_peephole_desc->data_type == f32)
+            && IMPLICATION(!is_zero_md(weights_projection_desc),
+                    weights_projection_desc->data_type == weights_layer_dt);
+
     bool is_f32 = everyone_is(f32, src_layer_dt, dst_layer_dt, weights_iter_dt,
                           weights_layer_dt)
             && IMPLICATION(
@@ -118,7 +132,7 @@ status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
                     !is_zero_md(dst_iter_desc), dst_iter_desc->data_type == f16)
             && IMPLICATION(!is_zero_md(bias_desc), bias_desc->data_type == f16);
 
-    bool is_u8u8u8 = is_inference && is_lstm && src_layer_dt == u8
+    bool is_u8u8u8 = is_inference && src_layer_dt == u8
             && IMPLICATION(
                     !is_zero_md(src_iter_desc), src_iter_desc->data_type == u8)
             && IMPLICATION(!is_zero_md(src_iter_c_desc),
@@ -131,7 +145,7 @@ status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
             && IMPLICATION(!is_zero_md(bias_desc), bias_desc->data_type == f32);
 
-    bool is_f32u8f32 = is_inference && is_lstm && src_layer_dt == u8
+    bool is_f32u8f32 = is_inference && src_layer_dt == u8
             && IMPLICATION(
                     !is_zero_md(src_iter_desc), src_iter_desc->data_type == f32)
             && IMPLICATION(
@@ -140,7 +154,7 @@ status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
             && IMPLICATION(!is_zero_md(bias_desc), bias_desc->data_type == f32);
 
-    return cell_state_check
+    return cell_state_check && extra_weights_check
                     && (is_f32 || is_bf16 || is_f16 || is_u8u8u8 || is_f32u8f32)
             ? success
             : unimplemented;
@@ -181,11 +195,14 @@ status_t check_data_type_consistency_bwd(dnnl_alg_kind_t cell_kind,
 
 status_t check_dim_consistency(dnnl_alg_kind_t cell_kind,
         rnn_direction_t direction, int L, int D, int T, int N, int G, int SLC,
-        int SIC, int DLC, int DIC, const memory_desc_t *src_layer_desc,
+        int SIC, int DLC, int DIC, int DHC, const memory_desc_t *src_layer_desc,
         const memory_desc_t *src_iter_desc,
         const memory_desc_t *src_iter_c_desc,
         const memory_desc_t *weights_layer_desc,
-        const memory_desc_t *weights_iter_desc, const memory_desc_t *bias_desc,
+        const memory_desc_t *weights_iter_desc,
+        const memory_desc_t *weights_peephole_desc,
+        const memory_desc_t *weights_projection_desc,
+        const memory_desc_t *bias_desc,
         const memory_desc_t *dst_layer_desc, const memory_desc_t *dst_iter_desc,
         const memory_desc_t *dst_iter_c_desc) {
     bool args_ok;
@@ -194,7 +211,11 @@ status_t check_dim_consistency(dnnl_alg_kind_t cell_kind,
     args_ok = true
             && IMPLICATION(utils::one_of(cell_kind, alg_kind::vanilla_gru,
                                    alg_kind::lbr_gru),
-                    DIC == SIC);
+                    DIC == SIC)
+            && IMPLICATION(!is_zero_md(weights_peephole_desc)
+                            || !is_zero_md(weights_projection_desc),
+                    cell_kind == alg_kind::vanilla_lstm)
+            && IMPLICATION(is_zero_md(weights_projection_desc), DHC == DIC);
     if (!args_ok) return invalid_arguments;
     int extra_bias = cell_kind == alg_kind::lbr_gru;
 
@@ -265,7 +286,7 @@ status_t check_dim_consistency(dnnl_alg_kind_t cell_kind,
 
     // * on dlc
     int dlc_multiplier = (direction == dnnl_bidirectional_concat) ? 2 : 1;
-    args_ok = true && DLC == dlc_multiplier * DIC
+    args_ok = true && DLC == dlc_multiplier * DHC
             && DLC == dst_layer_desc->dims[2];
     if (!args_ok) return invalid_arguments;
 
@@ -275,15 +296,35 @@ status_t check_dim_consistency(dnnl_alg_kind_t cell_kind,
             && IMPLICATION(!is_zero_md(bias_desc), DIC == bias_desc->dims[3])
             && IMPLICATION(!is_zero_md(src_iter_c_desc),
                     DIC == src_iter_c_desc->dims[3])
-            && IMPLICATION(
-                    !is_zero_md(dst_iter_desc), DIC == dst_iter_desc->dims[3])
             && IMPLICATION(!is_zero_md(dst_iter_c_desc),
                     DIC == dst_iter_c_desc->dims[3]);
     if (!args_ok) return invalid_arguments;
 
+    // * on dhc (the hidden state width, equal to dic unless projected)
+    args_ok = true
+            && IMPLICATION(
+                    !is_zero_md(dst_iter_desc), DHC == dst_iter_desc->dims[3]);
+    if (!args_ok) return invalid_arguments;
+
+    // * on peephole and projection weights
+    args_ok = true
+            && IMPLICATION(!is_zero_md(weights_peephole_desc),
+                    weights_peephole_desc->ndims == 4
+                            && L == weights_peephole_desc->dims[0]
+                            && D == weights_peephole_desc->dims[1]
+                            && 3 == weights_peephole_desc->dims[2]
+                            && DIC == weights_peephole_desc->dims[3])
+            && IMPLICATION(!is_zero_md(weights_projection_desc),
+                    weights_projection_desc->ndims == 4
+                            && L == weights_projection_desc->dims[0]
+                            && D == weights_projection_desc->dims[1]
+                            && DIC == weights_projection_desc->dims[2]
+                            && DHC == weights_projection_desc->dims[3]);
+    if (!args_ok) return invalid_arguments;
+
     // * unrolling/fusion conditions
     args_ok = true && IMPLICATION(L > 1, (dlc_multiplier * SLC) == DLC)
-            && IMPLICATION(T > 1, SIC == DIC);
+            && IMPLICATION(T > 1, SIC == DHC);
     if (!args_ok) return invalid_arguments;
 
     return success;
@@ -295,8 +336,11 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
         const memory_desc_t *src_iter_desc,
         const memory_desc_t *src_iter_c_desc,
         const memory_desc_t *weights_layer_desc,
-        const memory_desc_t *weights_iter_desc, const memory_desc_t *bias_desc,
-        const memory_desc_t *dst_layer_desc, const memory_desc_t *dst_iter_desc,
+        const memory_desc_t *weights_iter_desc,
+        const memory_desc_t *weights_peephole_desc,
+        const memory_desc_t *weights_projection_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_layer_desc,
+        const memory_desc_t *dst_iter_desc,
         const memory_desc_t *dst_iter_c_desc, unsigned flags,
         dnnl_alg_kind_t activation = dnnl_alg_kind_undef, float alpha = 0.0f,
         float beta = 0.0f) {
@@ -324,6 +368,14 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
                     xnor_md(src_iter_desc, src_iter_c_desc)
                             && xnor_md(dst_iter_desc, dst_iter_c_desc));
 
+    // stateful execution carries the states of a left to right sequence
+    // from one inference call to the next
+    args_ok = args_ok
+            && IMPLICATION(flags & dnnl_rnn_flags_stateful,
+                    prop_kind == dnnl_forward_inference
+                            && direction == dnnl_unidirectional_left2right);
+    if (!args_ok) return invalid_arguments;
+
     //check dimensions consistency
     int L = weights_layer_desc->dims[0];
     int T = src_layer_desc->dims[0];
@@ -337,16 +389,20 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
     int SIC = weights_iter_desc->dims[2];
     int DLC = dst_layer_desc->dims[2];
     int DIC = weights_layer_desc->dims[4];
+    int DHC = is_zero_md(weights_projection_desc)
+            ? DIC
+            : weights_projection_desc->dims[3];
 
     CHECK(check_dim_consistency(cell_kind, direction, L, D, T, N, G, SLC, SIC,
-            DLC, DIC, src_layer_desc, src_iter_desc, src_iter_c_desc,
-            weights_layer_desc, weights_iter_desc, bias_desc, dst_layer_desc,
-            dst_iter_desc, dst_iter_c_desc));
+            DLC, DIC, DHC, src_layer_desc, src_iter_desc, src_iter_c_desc,
+            weights_layer_desc, weights_iter_desc, weights_peephole_desc,
+            weights_projection_desc, bias_desc, dst_layer_desc, dst_iter_desc,
+            dst_iter_c_desc));
 
     CHECK(check_data_type_consistency_fwd(cell_kind, prop_kind, src_layer_desc,
             src_iter_desc, src_iter_c_desc, weights_layer_desc,
-            weights_iter_desc, bias_desc, dst_layer_desc, dst_iter_desc,
-            dst_iter_c_desc));
+            weights_iter_desc, weights_peephole_desc, weights_projection_desc,
+            bias_desc, dst_layer_desc, dst_iter_desc, dst_iter_c_desc));
 
     // Create the descriptor
     dnnl_rnn_desc_t rd = zero_rnn_desc();
@@ -360,6 +416,8 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
     rd.src_iter_c_desc = copy_maybe_null(src_iter_c_desc);
     rd.weights_layer_desc = copy_maybe_null(weights_layer_desc);
     rd.weights_iter_desc = copy_maybe_null(weights_iter_desc);
+    rd.weights_peephole_desc = copy_maybe_null(weights_peephole_desc);
+    rd.weights_projection_desc = copy_maybe_null(weights_projection_desc);
     rd.bias_desc = copy_maybe_null(bias_desc);
     rd.dst_layer_desc = copy_maybe_null(dst_layer_desc);
     rd.dst_iter_desc = copy_maybe_null(dst_iter_desc);
@@ -430,6 +488,9 @@ status_t rnn_common_bwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
             && xnor_md(src_iter_c_desc, src_iter_c_desc)
             && xnor_md(dst_iter_desc, diff_dst_iter_desc)
             && xnor_md(dst_iter_c_desc, diff_dst_iter_c_desc);
+
+    // stateful execution is only defined for inference
+    args_ok = args_ok && !(flags & dnnl_rnn_flags_stateful);
     if (!args_ok) return invalid_arguments;
 
     //check dimensions consistency
@@ -447,22 +508,24 @@ status_t rnn_common_bwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
     int DIC = weights_layer_desc->dims[4];
 
     status_t st = check_dim_consistency(cell_kind, direction, L, D, T, N, G,
-            SLC, SIC, DLC, DIC, src_layer_desc, src_iter_desc, src_iter_c_desc,
-            weights_layer_desc, weights_iter_desc, bias_desc, dst_layer_desc,
+            SLC, SIC, DLC, DIC, DIC, src_layer_desc, src_iter_desc,
+            src_iter_c_desc, weights_layer_desc, weights_iter_desc,
+            &glob_zero_md, &glob_zero_md, bias_desc, dst_layer_desc,
             dst_iter_desc, dst_iter_c_desc);
     if (st != success) return st;
 
     st = check_dim_consistency(cell_kind, direction, L, D, T, N, G, SLC, SIC,
-            DLC, DIC, diff_src_layer_desc, diff_src_iter_desc,
+            DLC, DIC, DIC, diff_src_layer_desc, diff_src_iter_desc,
             diff_src_iter_c_desc, diff_weights_layer_desc,
-            diff_weights_iter_desc, diff_bias_desc, diff_dst_layer_desc,
-            diff_dst_iter_desc, diff_dst_iter_c_desc);
+            diff_weights_iter_desc, &glob_zero_md, &glob_zero_md,
+            diff_bias_desc, diff_dst_layer_desc, diff_dst_iter_desc,
+            diff_dst_iter_c_desc);
     if (st != success) return st;
 
     CHECK(check_data_type_consistency_fwd(cell_kind, prop_kind, src_layer_desc,
             src_iter_desc, src_iter_c_desc, weights_layer_desc,
-            weights_iter_desc, bias_desc, dst_layer_desc, dst_iter_desc,
-            dst_iter_c_desc));
+            weights_iter_desc, &glob_zero_md, &glob_zero_md, bias_desc,
+            dst_layer_desc, dst_iter_desc, dst_iter_c_desc));
 
     CHECK(check_data_type_consistency_bwd(cell_kind, prop_kind,
             diff_src_layer_desc, diff_src_iter_desc, diff_src_iter_c_desc,
@@ -522,9 +585,9 @@ status_t dnnl_vanilla_rnn_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
         float beta) {
     status_t st = rnn_common_fwd_desc_init(rnn_desc, prop_kind,
             dnnl_vanilla_rnn, direction, src_layer_desc, src_iter_desc,
-            &glob_zero_md, weights_layer_desc, weights_iter_desc, bias_desc,
-            dst_layer_desc, dst_iter_desc, &glob_zero_md, flags, activation,
-            alpha, beta);
+            &glob_zero_md, weights_layer_desc, weights_iter_desc,
+            &glob_zero_md, &glob_zero_md, bias_desc, dst_layer_desc,
+            dst_iter_desc, &glob_zero_md, flags, activation, alpha, beta);
     return st;
 }
 
@@ -542,7 +605,51 @@ status_t dnnl_lstm_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 
     status_t st = rnn_common_fwd_desc_init(rnn_desc, prop_kind,
             dnnl_vanilla_lstm, direction, src_layer_desc, src_iter_desc,
-            src_iter_c_desc, weights_layer_desc, weights_iter_desc, bias_desc,
+            src_iter_c_desc, weights_layer_desc, weights_iter_desc,
+            &glob_zero_md, &glob_zero_md, bias_desc, dst_layer_desc,
+            dst_iter_desc, dst_iter_c_desc, flags);
+    return st;
+}
+
+status_t dnnl_lstm_forward_desc_init_v2(dnnl_rnn_desc_t *rnn_desc,
+        dnnl_prop_kind_t prop_kind, dnnl_rnn_direction_t direction,
+        const dnnl_memory_desc_t *src_layer_desc,
+        const dnnl_memory_desc_t *src_iter_desc,
+        const dnnl_memory_desc_t *src_iter_c_desc,
+        const dnnl_memory_desc_t *weights_layer_desc,
+        const dnnl_memory_desc_t *weights_iter_desc,
+        const dnnl_memory_desc_t *weights_peephole_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_layer_desc,
+        const dnnl_memory_desc_t *dst_iter_desc,
+        const dnnl_memory_desc_t *dst_iter_c_desc, unsigned flags) {
+
+    status_t st = rnn_common_fwd_desc_init(rnn_desc, prop_kind,
+            dnnl_vanilla_lstm, direction, src_layer_desc, src_iter_desc,
+            src_iter_c_desc, weights_layer_desc, weights_iter_desc,
+            weights_peephole_desc, &glob_zero_md, bias_desc, dst_layer_desc,
+            dst_iter_desc, dst_iter_c_desc, flags);
+    return st;
+}
+
+status_t dnnl_lstm_forward_desc_init_v3(dnnl_rnn_desc_t *rnn_desc,
+        dnnl_prop_kind_t prop_kind, dnnl_rnn_direction_t direction,
+        const dnnl_memory_desc_t *src_layer_desc,
+        const dnnl_memory_desc_t *src_iter_desc,
+        const dnnl_memory_desc_t *src_iter_c_desc,
+        const dnnl_memory_desc_t *weights_layer_desc,
+        const dnnl_memory_desc_t *weights_iter_desc,
+        const dnnl_memory_desc_t *weights_peephole_desc,
+        const dnnl_memory_desc_t *weights_projection_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_layer_desc,
+        const dnnl_memory_desc_t *dst_iter_desc,
+        const dnnl_memory_desc_t *dst_iter_c_desc, unsigned flags) {
+
+    status_t st = rnn_common_fwd_desc_init(rnn_desc, prop_kind,
+            dnnl_vanilla_lstm, direction, src_layer_desc, src_iter_desc,
+            src_iter_c_desc, weights_layer_desc, weights_iter_desc,
+            weights_peephole_desc, weights_projection_desc, bias_desc,
             dst_layer_desc, dst_iter_desc, dst_iter_c_desc, flags);
     return st;
 }
@@ -558,8 +665,9 @@ status_t dnnl_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
         const dnnl_memory_desc_t *dst_iter_desc, unsigned flags) {
     status_t st = rnn_common_fwd_desc_init(rnn_desc, prop_kind,
             dnnl_vanilla_gru, direction, src_layer_desc, src_iter_desc,
-            &glob_zero_md, weights_layer_desc, weights_iter_desc, bias_desc,
-            dst_layer_desc, dst_iter_desc, &glob_zero_md, flags);
+            &glob_zero_md, weights_layer_desc, weights_iter_desc,
+            &glob_zero_md, &glob_zero_md, bias_desc, dst_layer_desc,
+            dst_iter_desc, &glob_zero_md, flags);
     return st;
 }
 
@@ -574,8 +682,9 @@ status_t dnnl_lbr_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
         const dnnl_memory_desc_t *dst_iter_desc, unsigned flags) {
     status_t st = rnn_common_fwd_desc_init(rnn_desc, prop_kind, dnnl_lbr_gru,
             direction, src_layer_desc, src_iter_desc, &glob_zero_md,
-            weights_layer_desc, weights_iter_desc, bias_desc, dst_layer_desc,
-            dst_iter_desc, &glob_zero_md, flags);
+            weights_layer_desc, weights_iter_desc, &glob_zero_md,
+            &glob_zero_md, bias_desc, dst_layer_desc, dst_iter_desc,
+            &glob_zero_md, flags);
     return st;
 }
 
@@ -42,6 +42,8 @@ struct rnn_pd_t : public primitive_desc_t {
         , src_iter_c_md_(desc_.src_iter_c_desc)
         , weights_layer_md_(desc_.weights_layer_desc)
         , weights_iter_md_(desc_.weights_iter_desc)
+        , weights_peephole_md_(desc_.weights_peephole_desc)
+        , weights_projection_md_(desc_.weights_projection_desc)
         , bias_md_(desc_.bias_desc)
         , dst_layer_md_(desc_.dst_layer_desc)
         , dst_iter_md_(desc_.dst_iter_desc)
@@ -75,6 +77,8 @@ struct rnn_pd_t : public primitive_desc_t {
         if (index == 0) return &weights_layer_md_;
         if (index == 1) return &weights_iter_md_;
         if (index == 2 && with_bias()) return &bias_md_;
+        if (index == 3 && with_peephole()) return &weights_peephole_md_;
+        if (index == 4 && with_projection()) return &weights_projection_md_;
         return &glob_zero_md;
     }
     virtual const memory_desc_t *dst_md(int index = 0) const override {
@@ -112,11 +116,24 @@ struct rnn_pd_t : public primitive_desc_t {
     dim_t DIC() const { return desc_.weights_layer_desc.dims[4]; }
 
     dim_t DLC() const { return desc_.dst_layer_desc.dims[2]; }
+    /* width of the hidden state, differs from DIC only with projection */
+    dim_t DHC() const {
+        return with_projection() ? desc_.weights_projection_desc.dims[3]
+                                 : DIC();
+    }
 
     bool with_bias() const {
         return !memory_desc_wrapper(desc_.bias_desc).is_zero();
     }
 
+    bool with_peephole() const {
+        return !memory_desc_wrapper(desc_.weights_peephole_desc).is_zero();
+    }
+
+    bool with_projection() const {
+        return !memory_desc_wrapper(desc_.weights_projection_desc).is_zero();
+    }
+
     bool with_src_iter() const {
         return !(memory_desc_wrapper(desc_.src_iter_desc).is_zero());
     }
@@ -145,6 +162,10 @@ struct rnn_pd_t : public primitive_desc_t {
 
     dnnl_rnn_direction_t direction() const { return desc_.direction; }
 
+    virtual bool is_stateful() const override {
+        return desc_.flags & dnnl_rnn_flags_stateful;
+    }
+
 protected:
     rnn_desc_t desc_;
     const rnn_fwd_pd_t *hint_fwd_pd_;
@@ -154,6 +175,8 @@ protected:
     memory_desc_t src_iter_c_md_;
     memory_desc_t weights_layer_md_;
     memory_desc_t weights_iter_md_;
+    memory_desc_t weights_peephole_md_;
+    memory_desc_t weights_projection_md_;
     memory_desc_t bias_md_;
     memory_desc_t dst_layer_md_;
     memory_desc_t dst_iter_md_;
@@ -182,6 +205,12 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         if (utils::one_of(arg, DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER))
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_WEIGHTS_PEEPHOLE && with_peephole())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_WEIGHTS_PROJECTION && with_projection())
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_BIAS && with_bias()) return arg_usage_t::input;
 
         if (arg == DNNL_ARG_DST_LAYER) return arg_usage_t::output;
@@ -198,11 +227,21 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         return primitive_desc_t::arg_usage(arg);
     }
 
+    /* the states of a stateful primitive are passed only to reset or to
+     * read them back */
+    virtual bool is_optional_arg(int arg) const override {
+        return is_stateful()
+                && utils::one_of(arg, DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C,
+                        DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C);
+    }
+
     virtual int n_inputs() const override {
-        return 3 + with_bias() + with_src_iter() + with_src_iter_c();
+        return 3 + with_bias() + with_peephole() + with_projection()
+                + (is_stateful() ? 0 : with_src_iter() + with_src_iter_c());
     }
     virtual int n_outputs() const override {
-        return 1 + with_dst_iter() + with_dst_iter_c() + is_training();
+        return 1 + is_training()
+                + (is_stateful() ? 0 : with_dst_iter() + with_dst_iter_c());
     }
 };
 
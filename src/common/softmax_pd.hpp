@@ -32,7 +32,7 @@ struct softmax_pd_t : public primitive_desc_t {
 
     softmax_pd_t(engine_t *engine, const softmax_desc_t *adesc,
             const primitive_attr_t *attr, const softmax_fwd_pd_t *hint_fwd_pd)
-        : primitive_desc_t(engine, attr, base_pkind)
+        : primitive_desc_t(engine, attr, adesc->primitive_kind)
         , desc_(*adesc)
         , hint_fwd_pd_(hint_fwd_pd)
         , data_md_(desc_.data_desc) {}
@@ -49,6 +49,7 @@ struct softmax_pd_t : public primitive_desc_t {
                 *(prop_kind_t *)result = desc()->prop_kind;
                 break;
             case query::softmax_d:
+            case query::logsoftmax_d:
                 *(const softmax_desc_t **)result = desc();
                 break;
             default: return primitive_desc_t::query(what, idx, result);
@@ -86,6 +87,10 @@ struct softmax_pd_t : public primitive_desc_t {
                 prop_kind::forward_inference);
     }
 
+    bool is_logsoftmax() const {
+        return desc_.primitive_kind == primitive_kind::logsoftmax;
+    }
+
     bool has_zero_dim_memory() const {
         return memory_desc_wrapper(data_desc()).has_zero_dim();
     }
@@ -38,6 +38,7 @@ status_t dnnl_sum_primitive_desc_create(primitive_desc_t **sum_pd,
 
     const primitive_attr_t dummy_attr;
     if (attr == NULL) attr = &dummy_attr;
+    if (!attr->zero_points_.has_default_values()) return unimplemented;
 
     const int ndims = src_mds[0].ndims;
     const dims_t &dims = src_mds[0].dims;
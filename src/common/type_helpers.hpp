@@ -284,6 +284,29 @@ inline bool operator==(
     return ret;
 }
 
+inline bool operator==(
+        const reduction_desc_t &lhs, const reduction_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc) && COMPARE_DESC_MEMBERS(p)
+            && COMPARE_DESC_MEMBERS(eps);
+    return ret;
+}
+
+inline bool operator==(
+        const resampling_desc_t &lhs, const resampling_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(diff_src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(diff_dst_desc)
+            && COMPARE_DESC_ARRAY_MEMBERS(factors, DNNL_MAX_NDIMS);
+    return ret;
+}
+
 inline bool operator==(const eltwise_desc_t &lhs, const eltwise_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind) && COMPARE_DESC_MEMBERS(alg_kind)
@@ -345,6 +368,16 @@ inline bool operator==(const lrn_desc_t &lhs, const lrn_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const matmul_desc_t &lhs, const matmul_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(weights_desc)
+            && COMPARE_DESC_MEMBERS(bias_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(accum_data_type);
+    return ret;
+}
+
 inline bool operator==(const pooling_desc_t &lhs, const pooling_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind) && COMPARE_DESC_MEMBERS(alg_kind)
@@ -382,8 +415,8 @@ inline bool operator==(const rnn_desc_t &lhs, const rnn_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(dst_layer_desc)
             && COMPARE_DESC_MEMBERS(dst_iter_desc)
             && COMPARE_DESC_MEMBERS(dst_iter_c_desc)
-            && COMPARE_DESC_MEMBERS(placeholder_desc)
-            && COMPARE_DESC_MEMBERS(placeholder2_desc)
+            && COMPARE_DESC_MEMBERS(weights_peephole_desc)
+            && COMPARE_DESC_MEMBERS(weights_projection_desc)
             && COMPARE_DESC_MEMBERS(diff_src_layer_desc)
             && COMPARE_DESC_MEMBERS(diff_src_iter_desc)
             && COMPARE_DESC_MEMBERS(diff_src_iter_c_desc)
@@ -393,8 +426,8 @@ inline bool operator==(const rnn_desc_t &lhs, const rnn_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(diff_dst_layer_desc)
             && COMPARE_DESC_MEMBERS(diff_dst_iter_desc)
             && COMPARE_DESC_MEMBERS(diff_dst_iter_c_desc)
-            && COMPARE_DESC_MEMBERS(diff_placeholder_desc)
-            && COMPARE_DESC_MEMBERS(diff_placeholder2_desc)
+            && COMPARE_DESC_MEMBERS(diff_weights_peephole_desc)
+            && COMPARE_DESC_MEMBERS(diff_weights_projection_desc)
             && COMPARE_DESC_MEMBERS(flags)
             && COMPARE_DESC_MEMBERS(activation_kind)
             && COMPARE_DESC_MEMBERS(alpha) && COMPARE_DESC_MEMBERS(beta);
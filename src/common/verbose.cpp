@@ -36,8 +36,11 @@
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
+#include "matmul_pd.hpp"
 #include "pooling_pd.hpp"
+#include "reduction_pd.hpp"
 #include "reorder_pd.hpp"
+#include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
@@ -200,7 +203,10 @@ void attr2str(char *str, int len, int written, const primitive_attr_t *attr) {
     const scales_t &os = attr->output_scales_;
     if (!os.has_default_values()) {
         DPRINT(str, len, written, "oscale:%d", os.mask_);
-        if (os.mask_ == 0) DPRINT(str, len, written, ":%g", os.scales_[0]);
+        if (!os.defined())
+            DPRINT(str, len, written, ":runtime");
+        else if (os.mask_ == 0)
+            DPRINT(str, len, written, ":%g", os.scales_[0]);
         DPRINT(str, len, written, ";");
     }
 
@@ -241,6 +247,21 @@ void attr2str(char *str, int len, int written, const primitive_attr_t *attr) {
         DPRINT(str, len, written, "scratchpad_mode:%d;", spm);
     }
 
+    const zero_points_t &zp = attr->zero_points_;
+    if (!zp.has_default_values()) {
+        DPRINT(str, len, written, "zero_points:");
+        const char *arg_names[] = {"src", "wei", "dst"};
+        const int args[] = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
+        for (int i = 0; i < 3; ++i) {
+            if (zp.has_default_values(args[i])) continue;
+            if (zp.defined(args[i]))
+                DPRINT(str, len, written, "%s:%d;", arg_names[i],
+                        *zp.get(args[i]));
+            else
+                DPRINT(str, len, written, "%s:runtime;", arg_names[i]);
+        }
+    }
+
     const rnn_data_qparams_t &rnn_qp = attr->rnn_data_qparams_;
     if (!rnn_qp.has_default_values()) {
         DPRINT(str, len, written, "rnn_data_qparams:%g:%g;", rnn_qp.scale_,
@@ -434,7 +455,7 @@ static void init_info_eltwise(pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
 
     { // data
-        auto md = s->src_md();
+        auto md = s->data_md();
         DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "data_");
         MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
     }
@@ -452,7 +473,7 @@ static void init_info_eltwise(pd_t *s, char *buffer) {
             "alg:%s alpha:%g beta:%g", dnnl_alg_kind2str(s->desc()->alg_kind),
             s->desc()->alpha, s->desc()->beta);
 
-    dnnl_md2dim_str(prb_str, DNNL_VERBOSE_PRB_LEN, s->src_md());
+    dnnl_md2dim_str(prb_str, DNNL_VERBOSE_PRB_LEN, s->data_md());
 
     verbose_templ(buffer, s->engine(), s->kind(), s->name(),
             s->desc()->prop_kind, dat_str, attr_str, aux_str, prb_str);
@@ -800,6 +821,109 @@ static void init_info_binary(pd_t *s, char *buffer) {
             dat_str, attr_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_matmul(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // src
+        auto md = s->src_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "src_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+    }
+    { // wei
+        auto md = s->weights_md(0);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " wei_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+    }
+    if (s->with_bias()) { // bias
+        auto md = s->weights_md(1);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " bia_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "bia_mask:%d",
+                s->bias_mask());
+    }
+    { // dst
+        auto md = s->dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    verbose_templ(buffer, s->engine(), s->kind(), s->name(), prop_kind::undef,
+            dat_str, attr_str, aux_str, prb_str);
+}
+
+template <typename pd_t>
+static void init_info_reduction(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // src
+        auto md = s->src_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "src_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+    }
+    { // dst
+        auto md = s->dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "alg:%s p:%g eps:%g",
+            dnnl_alg_kind2str(s->desc()->alg_kind), s->desc()->p,
+            s->desc()->eps);
+
+    verbose_templ(buffer, s->engine(), s->kind(), s->name(), prop_kind::undef,
+            dat_str, attr_str, aux_str, prb_str);
+}
+
+template <typename pd_t>
+static void init_info_resampling(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    { // src
+        auto md = s->is_fwd() ? s->src_md() : s->diff_src_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "%ssrc_",
+                s->is_fwd() ? "" : "diff_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+    }
+    { // dst
+        auto md = s->is_fwd() ? s->dst_md() : s->diff_dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " %sdst_",
+                s->is_fwd() ? "" : "diff_");
+        MD2STR(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, md);
+
+        DIM2STR(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, md);
+    }
+
+    attr2str(attr_str, DNNL_VERBOSE_ATTR_LEN, attr_written, s->attr());
+
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "alg:%s",
+            dnnl_alg_kind2str(s->desc()->alg_kind));
+
+    verbose_templ(buffer, s->engine(), s->kind(), s->name(),
+            s->desc()->prop_kind, dat_str, attr_str, aux_str, prb_str);
+}
+
 #undef DPRINT
 
 #else // !defined(DISABLE_VERBOSE)
@@ -820,8 +944,11 @@ DEFINE_STUB(gemm);
 DEFINE_STUB(iprod);
 DEFINE_STUB(lnorm);
 DEFINE_STUB(lrn);
+DEFINE_STUB(matmul);
 DEFINE_STUB(mem);
 DEFINE_STUB(pool);
+DEFINE_STUB(reduction);
+DEFINE_STUB(resampling);
 DEFINE_STUB(rnn);
 DEFINE_STUB(shuffle);
 DEFINE_STUB(softmax);
@@ -860,12 +987,21 @@ void init_info(layer_normalization_pd_t *s, char *b) {
 void init_info(lrn_pd_t *s, char *b) {
     init_info_lrn(s, b);
 }
+void init_info(matmul_pd_t *s, char *b) {
+    init_info_matmul(s, b);
+}
 void init_info(pooling_pd_t *s, char *b) {
     init_info_pool(s, b);
 }
+void init_info(reduction_pd_t *s, char *b) {
+    init_info_reduction(s, b);
+}
 void init_info(reorder_pd_t *s, char *b) {
     init_info_mem(s, b);
 }
+void init_info(resampling_pd_t *s, char *b) {
+    init_info_resampling(s, b);
+}
 void init_info(rnn_pd_t *s, char *b) {
     init_info_rnn(s, b);
 }
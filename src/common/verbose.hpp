@@ -52,8 +52,11 @@ void init_info(gemm_pd_t *s, char *buffer);
 void init_info(inner_product_pd_t *s, char *buffer);
 void init_info(layer_normalization_pd_t *s, char *buffer);
 void init_info(lrn_pd_t *s, char *buffer);
+void init_info(matmul_pd_t *s, char *buffer);
 void init_info(pooling_pd_t *s, char *buffer);
+void init_info(reduction_pd_t *s, char *buffer);
 void init_info(reorder_pd_t *s, char *buffer);
+void init_info(resampling_pd_t *s, char *buffer);
 void init_info(rnn_pd_t *s, char *buffer);
 void init_info(shuffle_pd_t *s, char *buffer);
 void init_info(softmax_pd_t *s, char *buffer);
@@ -29,6 +29,22 @@ namespace cpu {
 
 struct cpu_binary_pd_t : public binary_pd_t {
     using binary_pd_t::binary_pd_t;
+
+protected:
+    /* The common output scale is applied to the result of the operation,
+     * then sum and eltwise post-ops follow in the order of appending. */
+    bool attr_ok() const {
+        using sm = primitive_attr_t::skip_mask_t;
+        const auto &p = attr()->post_ops_;
+
+        bool ok = attr()->has_default_values(sm::oscale | sm::post_ops)
+                && attr()->output_scales_.mask_ == 0;
+        for (int idx = 0; idx < p.len_; ++idx)
+            ok = ok
+                    && (p.entry_[idx].is_sum(false)
+                            || p.entry_[idx].is_eltwise(false));
+        return ok;
+    }
 };
 } // namespace cpu
 } // namespace impl
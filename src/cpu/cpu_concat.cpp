@@ -16,6 +16,7 @@
 
 #include "cpu_engine.hpp"
 
+#include "cpu/jit_uni_concat.hpp"
 #include "cpu/ref_concat.hpp"
 #include "cpu/simple_concat.hpp"
 
@@ -33,6 +34,7 @@ static const cpd_create_f cpu_concat_impl_list[] = {
         INSTANCE(simple_concat_t<data_type::s8>),
         INSTANCE(simple_concat_t<data_type::s32>),
         INSTANCE(simple_concat_t<data_type::bf16>),
+        INSTANCE(jit_uni_concat_t),
         INSTANCE(ref_concat_t),
         nullptr,
 };
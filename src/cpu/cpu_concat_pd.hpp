@@ -31,6 +31,12 @@ namespace cpu {
 
 struct cpu_concat_pd_t : public concat_pd_t {
     using concat_pd_t::concat_pd_t;
+
+    /* returns true if the i-th input was produced in place, i.e. it is the
+     * sub-memory of dst that holds its image, so there is nothing to copy */
+    bool is_in_place(int i, const void *src, const void *dst) const {
+        return src == dst && *src_md(i) == *src_image_md(i);
+    }
 };
 
 } // namespace cpu
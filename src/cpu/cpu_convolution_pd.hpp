@@ -54,6 +54,20 @@ struct cpu_convolution_fwd_pd_t : public convolution_fwd_pd_t {
 
 struct cpu_convolution_bwd_data_pd_t : public convolution_bwd_data_pd_t {
     using convolution_bwd_data_pd_t::convolution_bwd_data_pd_t;
+
+    bool has_padded_diff_src() const {
+        memory_desc_wrapper diff_src_d(&diff_src_md_);
+        return IC() != diff_src_d.padded_dims()[1];
+    }
+
+    bool wants_zero_pad_diff_src(bool jit_impl = true) const {
+        if (!has_padded_diff_src()) return false;
+        const auto &po = attr()->post_ops_;
+        int idx;
+        if ((idx = po.find(primitive_kind::eltwise)) == -1) return false;
+        return !math::eltwise_fwd_preserves_zero(
+                po.entry_[idx].eltwise.alg, jit_impl);
+    }
 };
 
 struct cpu_convolution_bwd_weights_pd_t : public convolution_bwd_weights_pd_t {
@@ -23,6 +23,10 @@
 #include "cpu_stream.hpp"
 #include "memory.hpp"
 
+#include "cpu/matmul/gemm_bf16_matmul.hpp"
+#include "cpu/matmul/gemm_f32_matmul.hpp"
+#include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
+#include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/rnn/ref_rnn.hpp"
 
 #include "cpu/gemm_bf16_convolution.hpp"
@@ -33,6 +37,7 @@
 #include "cpu/gemm_x8s8s32x_inner_product.hpp"
 #include "cpu/jit_avx2_1x1_convolution.hpp"
 #include "cpu/jit_avx2_convolution.hpp"
+#include "cpu/jit_avx2_f32_wino_conv_2x3.hpp"
 #include "cpu/jit_avx512_common_1x1_convolution.hpp"
 #include "cpu/jit_avx512_common_convolution.hpp"
 #include "cpu/jit_avx512_common_convolution_winograd.hpp"
@@ -57,6 +62,9 @@
 #include "cpu/jit_uni_layer_normalization.hpp"
 #include "cpu/jit_uni_lrn.hpp"
 #include "cpu/jit_uni_pooling.hpp"
+#include "cpu/jit_uni_reduction.hpp"
+#include "cpu/jit_uni_resampling.hpp"
+#include "cpu/jit_uni_shuffle.hpp"
 #include "cpu/jit_uni_softmax.hpp"
 #include "cpu/jit_uni_tbb_batch_normalization.hpp"
 #include "cpu/nchw_pooling.hpp"
@@ -72,6 +80,8 @@
 #include "cpu/ref_layer_normalization.hpp"
 #include "cpu/ref_lrn.hpp"
 #include "cpu/ref_pooling.hpp"
+#include "cpu/ref_reduction.hpp"
+#include "cpu/ref_resampling.hpp"
 #include "cpu/ref_shuffle.hpp"
 #include "cpu/ref_softmax.hpp"
 
@@ -125,6 +135,7 @@ static const pd_create_f cpu_impl_list[] = {
         INSTANCE(jit_avx2_1x1_convolution_fwd_t),
         INSTANCE(jit_avx2_1x1_convolution_bwd_data_t),
         INSTANCE(jit_avx2_1x1_convolution_bwd_weights_t),
+        INSTANCE(jit_avx2_f32_wino_conv_2x3_fwd_t),
         INSTANCE(jit_sse41_dw_convolution_fwd_t),
         INSTANCE(jit_sse41_dw_convolution_bwd_data_t),
         INSTANCE(jit_sse41_dw_convolution_bwd_weights_t),
@@ -223,6 +234,8 @@ static const pd_create_f cpu_impl_list[] = {
         INSTANCE(ref_deconvolution_bwd_data_t),
         INSTANCE(ref_deconvolution_fwd_t),
         /* shuffle */
+        INSTANCE(jit_uni_shuffle_t<avx512_common>),
+        INSTANCE(jit_uni_shuffle_t<avx2>),
         INSTANCE(ref_shuffle_t<4>), /* f32 or s32 */
         INSTANCE(ref_shuffle_t<2>), /* bf16 */
         INSTANCE(ref_shuffle_t<1>), /* s8 or u8 */
@@ -255,7 +268,12 @@ static const pd_create_f cpu_impl_list[] = {
         INSTANCE(jit_uni_softmax_fwd_t<avx2>),
         INSTANCE(jit_uni_softmax_fwd_t<sse41>),
         INSTANCE(ref_softmax_fwd_t<f32>),
+        INSTANCE(ref_softmax_fwd_t<bf16>),
+        INSTANCE(jit_uni_softmax_bwd_t<avx512_common>),
+        INSTANCE(jit_uni_softmax_bwd_t<avx2>),
+        INSTANCE(jit_uni_softmax_bwd_t<sse41>),
         INSTANCE(ref_softmax_bwd_t<f32>),
+        INSTANCE(ref_softmax_bwd_t<bf16>),
         /* pool */
         INSTANCE(jit_uni_pooling_fwd_t<avx512_core, bf16>),
         INSTANCE(jit_uni_pooling_bwd_t<avx512_core, bf16>),
@@ -368,6 +386,54 @@ static const pd_create_f cpu_impl_list[] = {
         INSTANCE(jit_uni_binary_t<avx2>),
         INSTANCE(ref_binary_t<f32>),
         INSTANCE(ref_binary_t<bf16>),
+        INSTANCE(ref_binary_t<u8, u8, u8>),
+        INSTANCE(ref_binary_t<u8, s8, u8>),
+        INSTANCE(ref_binary_t<u8, f32, u8>),
+        INSTANCE(ref_binary_t<s8, s8, s8>),
+        INSTANCE(ref_binary_t<s8, u8, s8>),
+        INSTANCE(ref_binary_t<s8, f32, s8>),
+        /* matmul */
+        INSTANCE(gemm_f32_matmul_t),
+        INSTANCE(gemm_bf16_matmul_t<f32>),
+        INSTANCE(gemm_bf16_matmul_t<bf16>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, f32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, s32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, s8>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, u8>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, f32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, s32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, s8>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, u8>),
+        INSTANCE(ref_matmul_t<f32>),
+        INSTANCE(ref_matmul_t<bf16, bf16, f32, f32>),
+        INSTANCE(ref_matmul_t<bf16, bf16, bf16, f32>),
+        INSTANCE(ref_matmul_t<u8, s8, f32, s32>),
+        INSTANCE(ref_matmul_t<u8, s8, s32, s32>),
+        INSTANCE(ref_matmul_t<u8, s8, s8, s32>),
+        INSTANCE(ref_matmul_t<u8, s8, u8, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, f32, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, s32, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, s8, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, u8, s32>),
+        /* reduction */
+        INSTANCE(jit_uni_reduction_t<avx512_common>),
+        INSTANCE(jit_uni_reduction_t<avx2>),
+        INSTANCE(ref_reduction_t<f32>),
+        INSTANCE(ref_reduction_t<bf16>),
+        INSTANCE(ref_reduction_t<bf16, f32>),
+        INSTANCE(ref_reduction_t<s8>),
+        INSTANCE(ref_reduction_t<s8, f32>),
+        INSTANCE(ref_reduction_t<u8>),
+        INSTANCE(ref_reduction_t<u8, f32>),
+        /* resampling */
+        INSTANCE(jit_uni_resampling_fwd_t<avx512_common>),
+        INSTANCE(jit_uni_resampling_bwd_t<avx512_common>),
+        INSTANCE(jit_uni_resampling_fwd_t<avx2>),
+        INSTANCE(jit_uni_resampling_bwd_t<avx2>),
+        INSTANCE(ref_resampling_fwd_t<f32>),
+        INSTANCE(ref_resampling_bwd_t<f32>),
+        INSTANCE(ref_resampling_fwd_t<bf16>),
+        INSTANCE(ref_resampling_bwd_t<bf16>),
         /* eol */
         nullptr,
 };
@@ -26,6 +26,21 @@ namespace cpu {
 
 struct cpu_layer_normalization_fwd_pd_t : public layer_normalization_fwd_pd_t {
     using layer_normalization_fwd_pd_t::layer_normalization_fwd_pd_t;
+
+protected:
+    /* Sum and eltwise post-ops are applied to the normalized (and scaled and
+     * shifted) data in the order of appending. */
+    bool attr_ok() const {
+        using sm = primitive_attr_t::skip_mask_t;
+        const auto &p = attr()->post_ops_;
+
+        bool ok = attr()->has_default_values(sm::post_ops);
+        for (int idx = 0; idx < p.len_; ++idx)
+            ok = ok
+                    && (p.entry_[idx].is_sum(false)
+                            || p.entry_[idx].is_eltwise(false));
+        return ok;
+    }
 };
 
 struct cpu_layer_normalization_bwd_pd_t : public layer_normalization_bwd_pd_t {
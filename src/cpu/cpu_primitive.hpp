@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_PRIMITIVE_HPP
+#define CPU_PRIMITIVE_HPP
+
+#include <assert.h>
+
+#include "dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "primitive.hpp"
+#include "primitive_attr.hpp"
+#include "utils.hpp"
+#include "z_magic.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Returns the number of output scales implied by the scales mask and the
+ * dimensions of @p dst_md */
+inline dim_t oscales_count(const primitive_attr_t *attr,
+        const memory_desc_t *dst_md) {
+    const int mask = attr->output_scales_.mask_;
+    dim_t count = 1;
+    for (int d = 0; d < dst_md->ndims; ++d)
+        if (mask & (1 << d)) count *= dst_md->dims[d];
+    return count;
+}
+
+/* Checks the memory passed with DNNL_ARG_ATTR_OUTPUT_SCALES: it must be a
+ * dense 1D f32 array holding exactly the number of scales implied by the
+ * mask */
+inline bool runtime_oscales_ok(const primitive_attr_t *attr,
+        const memory_desc_t *dst_md, const memory_t *scales_mem) {
+    if (scales_mem == nullptr) return false;
+    const memory_desc_wrapper scales_d(scales_mem->md());
+    return scales_d.data_type() == data_type::f32 && scales_d.ndims() == 1
+            && scales_d.is_dense()
+            && scales_d.nelems() == oscales_count(attr, dst_md);
+}
+
+/* Checks the memory passed with (DNNL_ARG_ATTR_ZERO_POINTS | arg): only a
+ * single s32 zero point per argument is supported */
+inline bool runtime_zero_point_ok(const memory_t *zero_point_mem) {
+    if (zero_point_mem == nullptr) return false;
+    const memory_desc_wrapper zero_point_d(zero_point_mem->md());
+    return zero_point_d.data_type() == data_type::s32
+            && zero_point_d.ndims() == 1 && zero_point_d.nelems() == 1;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+/* Defines `const float *scales` pointing either to the output scales baked
+ * into the primitive attributes or to the ones passed at execution time with
+ * the DNNL_ARG_ATTR_OUTPUT_SCALES argument. A common run-time scale is
+ * broadcast to a local buffer of 16 elements, as the JIT kernels may load a
+ * full vector of scales regardless of the mask. Returns
+ * status::invalid_arguments from the enclosing function if run-time scales
+ * are expected but missing or malformed. */
+#define DEFINE_SCALES_BUFFER(scales) \
+    alignas(64) float CONCAT2(scales, _buf16)[16]; \
+    const float *scales = pd()->attr()->output_scales_.scales_; \
+    if (!pd()->attr()->output_scales_.defined()) { \
+        if (!dnnl::impl::cpu::runtime_oscales_ok(pd()->attr(), pd()->dst_md(), \
+                    ctx.input(DNNL_ARG_ATTR_OUTPUT_SCALES))) \
+            return dnnl::impl::status::invalid_arguments; \
+        scales = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_OUTPUT_SCALES); \
+        if (pd()->attr()->output_scales_.mask_ == 0) { \
+            dnnl::impl::utils::array_set( \
+                    CONCAT2(scales, _buf16), scales[0], 16); \
+            scales = CONCAT2(scales, _buf16); \
+        } \
+    }
+
+/* Defines `int32_t zero_point` holding either the zero point of @p mem_arg
+ * baked into the primitive attributes or the one passed at execution time
+ * with the (DNNL_ARG_ATTR_ZERO_POINTS | mem_arg) argument. Returns
+ * status::invalid_arguments from the enclosing function if the run-time
+ * zero point is expected but missing or malformed. */
+#define DEFINE_ZERO_POINT_VALUE(zero_point, mem_arg) \
+    int32_t zero_point = *pd()->attr()->zero_points_.get(mem_arg); \
+    if (!pd()->attr()->zero_points_.defined(mem_arg)) { \
+        if (!dnnl::impl::cpu::runtime_zero_point_ok( \
+                    ctx.input(DNNL_ARG_ATTR_ZERO_POINTS | mem_arg))) \
+            return dnnl::impl::status::invalid_arguments; \
+        zero_point = *CTX_IN_MEM( \
+                const int32_t *, DNNL_ARG_ATTR_ZERO_POINTS | mem_arg); \
+    }
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
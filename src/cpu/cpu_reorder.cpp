@@ -57,6 +57,8 @@ static const rpd_create_f cpu_reorder_impl_list[] = {
         rnn_data_reorder_t<f32, u8>::pd_t::create,
         rnn_weights_reorder_t<f32, f32>::pd_t::create,
         rnn_weights_reorder_t<f32, s8>::pd_t::create,
+        rnn_weights_reorder_t<f32, bf16>::pd_t::create,
+        rnn_weights_reorder_t<bf16, bf16>::pd_t::create,
 
         /* conv reorders w/ compensation */
         REG_SR(f32, any, s8, hwio, fmt_order::keep, spec::conv_s8s8),
@@ -19,6 +19,7 @@
 #include "cpu/ref_sum.hpp"
 #include "cpu/simple_sum.hpp"
 #include "jit_avx512_core_bf16_sum.hpp"
+#include "jit_uni_sum.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -31,6 +32,8 @@ namespace {
 static const spd_create_f cpu_sum_impl_list[] = {
         INSTANCE(jit_bf16_sum_t<data_type::bf16, data_type::bf16>),
         INSTANCE(jit_bf16_sum_t<data_type::bf16, data_type::f32>),
+        INSTANCE(jit_uni_sum_t<avx512_common>),
+        INSTANCE(jit_uni_sum_t<avx2>),
         INSTANCE(simple_sum_t<data_type::bf16>),
         INSTANCE(simple_sum_t<data_type::bf16, data_type::f32>),
         INSTANCE(simple_sum_t<data_type::f32>),
@@ -63,6 +63,7 @@ static inline CBLAS_OFFSET cblas_offset(const char *offset) {
 static inline bool use_reference_igemm() {
     return !(mayiuse(avx512_core) || mayiuse(avx512_core_vnni));
 }
+#endif
 
 template <typename T>
 static bool is_good_ld(dim_t ld) {
@@ -71,7 +72,6 @@ static bool is_good_ld(dim_t ld) {
 
     return ((ld % align) == 0) && ((ld % no_align) != 0);
 }
-#endif
 
 static dnnl_status_t check_pack_get_size_input(const char *identifier,
         const char *transa, const char *transb, const int *M, const int *N,
@@ -209,6 +209,41 @@ dnnl_status_t gemm_s8u8s32_pack_get_size(const char *identifier,
     return dnnl_success;
 }
 
+// There is no packed bf16 gemm in MKL, so the bf16 packing always goes
+// through the internal gemm driver.
+dnnl_status_t gemm_bf16bf16f32_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, const int *lda, const int *ldb, size_t *size,
+        bool *pack) {
+
+    if (!mayiuse(avx512_core)) return dnnl_unimplemented;
+
+    dnnl_status_t result;
+    *size = 0;
+    if (pack) *pack = true;
+
+    result = check_pack_get_size_input(
+            identifier, transa, transb, M, N, K, lda, ldb);
+    if (result != dnnl_success) return result;
+
+    bool do_a = utils::one_of(*identifier, 'a', 'A');
+    float alpha = 1.0f;
+    gemm_pack_storage_shell_t shell {dnnl_get_max_threads()};
+
+    result = gemm_pack_driver<bfloat16_t, bfloat16_t, float>(identifier,
+            transa, transb, M, N, K, &alpha, lda, ldb, nullptr, &shell, true);
+    if (result != dnnl_success) return result;
+
+    *size = shell.size();
+    if (pack) {
+        *pack = !(shell.single_nocopy()
+                && utils::one_of(do_a ? *transa : *transb, 'n', 'N')
+                && is_good_ld<bfloat16_t>(do_a ? *lda : *ldb));
+    }
+
+    return dnnl_success;
+}
+
 dnnl_status_t sgemm_pack(const char *identifier, const char *transa,
         const char *transb, const int *M, const int *N, const int *K,
         const int *lda, const int *ldb, const float *src, float *dst) {
@@ -270,6 +305,24 @@ dnnl_status_t gemm_s8u8s32_pack(const char *identifier, const char *transa,
 #endif
 }
 
+dnnl_status_t gemm_bf16bf16f32_pack(const char *identifier,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, const int *lda, const int *ldb, const bfloat16_t *src,
+        bfloat16_t *dst) {
+    float one = 1.f, *alpha = &one;
+
+    if (!mayiuse(avx512_core)) return dnnl_unimplemented;
+
+    auto result = check_pack_input(
+            identifier, transa, transb, M, N, K, alpha, lda, ldb, src, dst);
+    if (result != dnnl_success) return result;
+
+    gemm_pack_storage_t pack_dst {dst};
+
+    return gemm_pack_driver<bfloat16_t, bfloat16_t, float>(identifier, transa,
+            transb, M, N, K, alpha, lda, ldb, src, &pack_dst, false);
+}
+
 dnnl_status_t sgemm_compute(const char *transa, const char *transb,
         const int *M, const int *N, const int *K, const float *A,
         const int *lda, const float *B, const int *ldb, const float *beta,
@@ -292,6 +345,20 @@ dnnl_status_t sgemm_compute(const char *transa, const char *transb,
 #endif
 }
 
+dnnl_status_t gemm_bf16bf16f32_compute(const char *transa,
+        const char *transb, const int *M, const int *N, const int *K,
+        const bfloat16_t *A, const int *lda, const bfloat16_t *B,
+        const int *ldb, const float *beta, float *C, const int *ldc) {
+    if (!mayiuse(avx512_core)) return dnnl_unimplemented;
+
+    const dim_t M_s64 = *M, N_s64 = *N, K_s64 = *K;
+    const dim_t lda_s64 = *lda, ldb_s64 = *ldb, ldc_s64 = *ldc;
+    const float one = 1.f;
+
+    return gemm_bf16bf16f32(transa, transb, &M_s64, &N_s64, &K_s64, &one, A,
+            &lda_s64, B, &ldb_s64, beta, C, &ldc_s64);
+}
+
 dnnl_status_t gemm_s8u8s32_compute(const char *transa, const char *transb,
         const char *offsetc, const int *M, const int *N, const int *K,
         const int8_t *A, const int *lda, const uint8_t *B, const int *ldb,
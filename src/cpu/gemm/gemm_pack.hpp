@@ -20,6 +20,7 @@
 #include "dnnl_config.h"
 #include "dnnl_types.h"
 
+#include "bfloat16.hpp"
 #include "cpu_isa_traits.hpp"
 
 namespace dnnl {
@@ -46,6 +47,11 @@ dnnl_status_t DNNL_API gemm_s8u8s32_pack_get_size(const char *identifier,
         const int *K, const int *lda, const int *ldb, size_t *size,
         bool *pack = nullptr);
 
+dnnl_status_t DNNL_API gemm_bf16bf16f32_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, const int *lda, const int *ldb, size_t *size,
+        bool *pack = nullptr);
+
 dnnl_status_t DNNL_API sgemm_pack(const char *identifier, const char *transa,
         const char *transb, const int *M, const int *N, const int *K,
         const int *lda, const int *ldb, const float *src, float *dst);
@@ -55,6 +61,11 @@ dnnl_status_t DNNL_API gemm_s8u8s32_pack(const char *identifier,
         const int *K, const int *lda, const int *ldb, const void *src,
         void *dst);
 
+dnnl_status_t DNNL_API gemm_bf16bf16f32_pack(const char *identifier,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, const int *lda, const int *ldb, const bfloat16_t *src,
+        bfloat16_t *dst);
+
 dnnl_status_t DNNL_API sgemm_compute(const char *transa, const char *transb,
         const int *M, const int *N, const int *K, const float *A,
         const int *lda, const float *B, const int *ldb, const float *beta,
@@ -66,6 +77,11 @@ dnnl_status_t DNNL_API gemm_s8u8s32_compute(const char *transa,
         const int *ldb, const float *beta, int32_t *C, const int *ldc,
         const int32_t *co);
 
+dnnl_status_t DNNL_API gemm_bf16bf16f32_compute(const char *transa,
+        const char *transb, const int *M, const int *N, const int *K,
+        const bfloat16_t *A, const int *lda, const bfloat16_t *B,
+        const int *ldb, const float *beta, float *C, const int *ldc);
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
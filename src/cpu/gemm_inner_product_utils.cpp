@@ -32,12 +32,21 @@ using namespace math;
 template <data_type_t acc_type, data_type_t dst_type>
 pp_kernel_t<acc_type, dst_type>::pp_kernel_t(
         const cpu_inner_product_fwd_pd_t *pd, bool skip_sum)
+    : pp_kernel_t(pd->OC(), pd->attr(),
+            pd->with_bias() ? pd->desc()->bias_desc.data_type
+                            : data_type::undef,
+            pd->attr()->output_scales_.mask_ == (1 << 1), skip_sum) {}
+
+template <data_type_t acc_type, data_type_t dst_type>
+pp_kernel_t<acc_type, dst_type>::pp_kernel_t(size_t OC,
+        const primitive_attr_t *attr, data_type_t bias_dt, bool per_oc_scales,
+        bool skip_sum)
     : ker_(nullptr)
     , eltwise_injector_(nullptr)
     , ref_eltwise_(nullptr)
     , bf16_emu_(nullptr)
-    , OC_(pd->OC())
-    , do_bias_(pd->with_bias())
+    , OC_(OC)
+    , do_bias_(bias_dt != data_type::undef)
     , bias_data_type_(data_type::undef)
     , bias_data_type_size_(0)
     , do_scale_(false)
@@ -55,14 +64,14 @@ pp_kernel_t<acc_type, dst_type>::pp_kernel_t(
     using namespace types;
     using namespace Xbyak;
 
-    do_scale_ = !pd->attr()->output_scales_.has_default_values();
+    do_scale_ = !attr->output_scales_.has_default_values();
     if (do_scale_) {
-        scale_idx_mult_ = (pd->attr()->output_scales_.mask_ == (1 << 1));
+        scale_idx_mult_ = per_oc_scales;
         vreg_scale = Zmm(idx_compute_vreg_start_++);
     }
     if (dst_type == data_type::u8) vreg_zero = Zmm(idx_compute_vreg_start_++);
 
-    auto &p = pd->attr()->post_ops_;
+    auto &p = attr->post_ops_;
     const int eltwise_ind = p.find(primitive_kind::eltwise);
     do_eltwise_ = eltwise_ind != -1;
     if (do_eltwise_) eltwise_ = p.entry_[eltwise_ind].eltwise;
@@ -76,8 +85,7 @@ pp_kernel_t<acc_type, dst_type>::pp_kernel_t(
     }
 
     if (do_bias_) {
-        bias_data_type_ = pd->desc()->bias_desc.data_type;
-        assert(bias_data_type_ != data_type::undef);
+        bias_data_type_ = bias_dt;
         bias_data_type_size_ = data_type_size(bias_data_type_);
         compute_vreg_bias_shift_ = compute_vregs_per_iter_++;
     }
@@ -38,6 +38,12 @@ class pp_kernel_t : jit_generator {
 public:
     DECLARE_CPU_JIT_AUX_FUNCTIONS(gemm_x8s8s32x_inner_product_fwd_t::pp_kernel);
     pp_kernel_t(const cpu_inner_product_fwd_pd_t *pd, bool skip_sum);
+    /* Generic form for the primitives other than inner product: @p OC is
+     * the innermost dimension of the destination, the bias is not applied
+     * if @p bias_dt is undef, and the scales are indexed by the innermost
+     * dimension if @p per_oc_scales is set */
+    pp_kernel_t(size_t OC, const primitive_attr_t *attr, data_type_t bias_dt,
+            bool per_oc_scales, bool skip_sum);
     ~pp_kernel_t() {
         if (do_eltwise_) {
             delete eltwise_injector_;
@@ -132,8 +132,7 @@ struct _gemm_x8s8s32x_convolution_fwd_t : public primitive_impl_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
@@ -189,10 +188,10 @@ private:
     };
 
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     void execute_forward_thr(const int ithr, const int nthr,
             const src_data_t *src_base, const wei_data_t *wei_base,
-            const char *bia_base, dst_data_t *dst_base,
+            const char *bia_base, dst_data_t *dst_base, const float *scales,
             const memory_tracking::grantor_t &scratchpad) const;
 
     int nthr_ = 0;
@@ -225,6 +224,7 @@ struct _gemm_u8s8s32x_convolution_bwd_data_t : public primitive_impl_t {
                     && set_default_formats_common(
                             dat_tag(), wei_tag(), dat_tag())
                     && attr()->post_ops_.has_default_values()
+                    && attr()->output_scales_.defined()
                     && memory_desc_matches_tag(*diff_src_md(), dat_tag())
                     && memory_desc_matches_tag(*diff_dst_md(), dat_tag())
                     && memory_desc_matches_tag(*weights_md(), wei_tag());
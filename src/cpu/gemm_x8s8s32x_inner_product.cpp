@@ -16,6 +16,8 @@
 
 #include "dnnl_thread.hpp"
 #include "math_utils.hpp"
+
+#include "cpu_primitive.hpp"
 #include "simple_q10n.hpp"
 
 #include "gemm/gemm.hpp"
@@ -30,7 +32,8 @@ using namespace format_tag;
 using namespace memory_tracking::names;
 
 template <data_type_t src_type, data_type_t dst_type>
-void gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
+status_t
+gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -50,7 +53,7 @@ void gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
     const src_data_t off_b = 0;
     const int32_t off_c = 0;
 
-    const float *scales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(scales);
 
     acc_data_t *acc = pd()->dst_is_acc_
             ? (acc_data_t *)dst
@@ -70,6 +73,7 @@ void gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
             (*pp_kernel_)(dst, acc, bias, scales, start, end);
         });
     }
+    return status::success;
 }
 
 using namespace data_type;
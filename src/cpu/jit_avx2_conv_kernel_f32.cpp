@@ -741,9 +741,11 @@ void jit_avx2_conv_bwd_data_kernel_f32::compute_loop(
         mov(reg_channel, ptr[param1 + GET_OFF(channel)]);
     }
 
-    Label no_update_label;
-    cmp(reg_channel, 0);
-    je(no_update_label, T_NEAR);
+    Label no_update_label, store_label, eltwise_label;
+    if (!jcp.with_sum) {
+        cmp(reg_channel, 0);
+        je(no_update_label, T_NEAR);
+    }
     for (int ii = 0; ii < nb_ic_block; ii++) {
         for (int jj = 0; jj < ur_w; jj++) {
             size_t offt = sizeof(float) * ((size_t)ii * id * ih * iw + jj)
@@ -752,8 +754,35 @@ void jit_avx2_conv_bwd_data_kernel_f32::compute_loop(
             vaddps(Ymm(ur_w * ii + jj), Ymm(ur_w * ii + jj), Ymm(15));
         }
     }
+
+    if (!jcp.with_sum) {
+        jmp(eltwise_label, T_NEAR);
+    } else {
+        cmp(reg_channel, 0);
+        jne(eltwise_label, T_NEAR);
+    }
+
+    // the bias is added to the first partial sum only
     L(no_update_label);
+    if (jcp.with_bias) {
+        mov(reg_bias, ptr[param1 + GET_OFF(bias)]);
+        for (int ii = 0; ii < nb_ic_block; ii++)
+            for (int jj = 0; jj < ur_w; jj++)
+                vaddps(Ymm(ur_w * ii + jj), Ymm(ur_w * ii + jj),
+                        yword[reg_bias + sizeof(float) * ii * ic_block]);
+    }
 
+    // the eltwise is applied to the final result only, i.e. by the call
+    // that gets the last oc blocks
+    L(eltwise_label);
+    if (jcp.with_eltwise) {
+        cmp(reg_channel, jcp.nb_oc - jcp.nb_oc_blocking);
+        jl(store_label, T_NEAR);
+
+        eltwise_injector_->compute_vector_range(0, nb_ic_block * ur_w);
+    }
+
+    L(store_label);
     for (int ii = 0; ii < nb_ic_block; ii++)
         for (int jj = 0; jj < ur_w; jj++) {
             size_t offt = sizeof(float) * ((size_t)ii * id * ih * iw + jj)
@@ -824,12 +853,34 @@ void jit_avx2_conv_bwd_data_kernel_f32::generate() {
     }
 
     this->postamble();
+
+    if (jcp.with_eltwise) eltwise_injector_->prepare_table();
+}
+
+bool jit_avx2_conv_bwd_data_kernel_f32::post_ops_ok(
+        jit_conv_conf_t &jcp, const primitive_attr_t &attr) {
+    const auto &p = attr.post_ops_;
+
+    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
+    // diff_src is accumulated as is, so the sum may not be scaled
+    auto is_sum = [&](int idx) {
+        return p.entry_[idx].is_sum() && p.entry_[idx].sum.scale == 1.f;
+    };
+
+    switch (p.len_) {
+        case 0: return true; // no post_ops
+        case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+        case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+        default: return false;
+    }
+
+    return false;
 }
 
 status_t jit_avx2_conv_bwd_data_kernel_f32::init_conf(jit_conv_conf_t &jcp,
         const convolution_desc_t &cd, const memory_desc_wrapper &diff_src_d,
         const memory_desc_wrapper &weights_d,
-        const memory_desc_wrapper &diff_dst_d) {
+        const memory_desc_wrapper &diff_dst_d, const primitive_attr_t &attr) {
     if (!mayiuse(avx2)) return status::unimplemented;
 
     const bool with_groups = weights_d.ndims() == diff_src_d.ndims() + 1;
@@ -843,6 +894,7 @@ status_t jit_avx2_conv_bwd_data_kernel_f32::init_conf(jit_conv_conf_t &jcp,
     jcp.oc = diff_dst_d.dims()[1] / jcp.ngroups;
     jcp.oc_without_padding = jcp.oc;
     jcp.ic = diff_src_d.dims()[1] / jcp.ngroups;
+    jcp.ic_without_padding = jcp.ic;
 
     jcp.id = (ndims == 5) ? diff_src_d.dims()[2] : 1;
     jcp.ih = (ndims == 3) ? 1 : diff_src_d.dims()[ndims - 2];
@@ -867,6 +919,19 @@ status_t jit_avx2_conv_bwd_data_kernel_f32::init_conf(jit_conv_conf_t &jcp,
     jcp.dilate_h = (ndims == 3) ? 0 : cd.dilates[ndims - 4];
     jcp.dilate_w = cd.dilates[ndims - 3];
 
+    // the bias and the post-ops are applied to diff_src, as needed by the
+    // deconvolution that is computed as a backward data convolution
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef
+            && cd.bias_desc.data_type == data_type::f32;
+
+    if (!post_ops_ok(jcp, attr)) return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+
     const int simd_w = 8;
 
     /* derivatives */
@@ -985,8 +1050,8 @@ status_t jit_avx2_conv_bwd_data_kernel_f32::init_conf(jit_conv_conf_t &jcp,
 
 void jit_avx2_conv_bwd_data_kernel_f32::init_scratchpad(
         memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
-    UNUSED(scratchpad);
-    UNUSED(jcp);
+    if (jcp.with_bias && jcp.ic != jcp.ic_without_padding)
+        scratchpad.book(key_conv_padded_bias, sizeof(float) * jcp.ic);
 }
 
 void jit_avx2_conv_bwd_weights_kernel_f32::generate() {
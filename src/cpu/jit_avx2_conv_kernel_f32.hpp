@@ -97,15 +97,24 @@ private:
 struct jit_avx2_conv_bwd_data_kernel_f32 : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_conv_bwd_data_kernel_f32)
 
-    jit_avx2_conv_bwd_data_kernel_f32(jit_conv_conf_t ajcp) : jcp(ajcp) {
+    jit_avx2_conv_bwd_data_kernel_f32(jit_conv_conf_t ajcp)
+        : jcp(ajcp), eltwise_injector_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_
+                    = new jit_uni_eltwise_injector_f32<avx2>(this, jcp.eltwise);
+
         this->generate();
         jit_ker = (void (*)(jit_conv_call_s *))this->getCode();
     }
 
+    ~jit_avx2_conv_bwd_data_kernel_f32() { delete eltwise_injector_; }
+
+    static bool post_ops_ok(jit_conv_conf_t &jcp, const primitive_attr_t &attr);
     static status_t init_conf(jit_conv_conf_t &jcp,
             const convolution_desc_t &cd, const memory_desc_wrapper &diff_src_d,
             const memory_desc_wrapper &weights_d,
-            const memory_desc_wrapper &diff_dst_d);
+            const memory_desc_wrapper &diff_dst_d,
+            const primitive_attr_t &attr);
     static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
             const jit_conv_conf_t &jcp);
 
@@ -134,6 +143,9 @@ private:
     reg64_t reg_channel = r13; // used in ndims < 5 case only
     reg64_t reg_channel_work = r9; // used in ndims < 5 case only
     reg64_t reg_long_offt = r15;
+    reg64_t reg_bias = rbp;
+
+    jit_uni_eltwise_injector_f32<avx2> *eltwise_injector_;
 
     inline void compute_loop(int ur_w, int l_overflow, int r_overflow);
 
@@ -171,6 +171,7 @@ void jit_avx2_convolution_bwd_data_t::execute_backward_data(
         const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
@@ -238,6 +239,11 @@ void jit_avx2_convolution_bwd_data_t::execute_backward_data(
                             diff_dst_d, n, g * jcp.nb_oc + oc, od, oh, 0)];
                     par_conv.filt = &weights[wht_blk_off(weights_d, g, oc,
                             jcp.nb_ic_blocking * icbb, d_b_overflow, k_lo, 0)];
+                    if (jcp.with_bias) {
+                        const size_t icb
+                                = g * jcp.nb_ic + jcp.nb_ic_blocking * icbb;
+                        par_conv.bias = &bias[icb * jcp.ic_block];
+                    }
 
                     par_conv.src_prf = nullptr;
                     par_conv.dst_prf = nullptr;
@@ -254,7 +260,19 @@ void jit_avx2_convolution_bwd_data_t::execute_backward_data(
         }
     };
 
+    if (jcp.with_bias && jcp.ic != jcp.ic_without_padding) {
+        auto padded_bias = ctx.get_scratchpad_grantor().get<data_t>(
+                key_conv_padded_bias);
+        utils::array_copy(padded_bias, bias, jcp.ic_without_padding);
+        utils::array_set(padded_bias + jcp.ic_without_padding, 0.f,
+                jcp.ic - jcp.ic_without_padding);
+        bias = padded_bias;
+    }
+
     parallel(0, ker);
+
+    if (pd()->wants_zero_pad_diff_src())
+        ctx.memory(DNNL_ARG_DIFF_SRC)->zero_pad();
 }
 
 void jit_avx2_convolution_bwd_weights_t::execute_backward_weights(
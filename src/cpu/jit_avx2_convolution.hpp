@@ -116,11 +116,14 @@ struct jit_avx2_convolution_bwd_data_t : public primitive_impl_t {
                     && set_default_alg_kind(alg_kind::convolution_direct)
                     && expect_data_types(data_type::f32, data_type::f32,
                             data_type::undef, data_type::f32, data_type::f32)
-                    && !has_zero_dim_memory() && set_default_formats();
+                    && !has_zero_dim_memory() && set_default_formats()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops);
             if (!ok) return status::unimplemented;
 
             status_t status = jit_avx2_conv_bwd_data_kernel_f32::init_conf(jcp_,
-                    *desc(), *diff_src_md(), *weights_md(), *diff_dst_md());
+                    *desc(), *diff_src_md(), *weights_md(), *diff_dst_md(),
+                    *attr());
             if (status != status::success) return status;
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -130,6 +133,9 @@ struct jit_avx2_convolution_bwd_data_t : public primitive_impl_t {
             return status::success;
         }
 
+        virtual bool support_bias() const override { return jcp_.with_bias; }
+        virtual bool support_post_ops() const override { return true; }
+
         jit_conv_conf_t jcp_;
 
     protected:
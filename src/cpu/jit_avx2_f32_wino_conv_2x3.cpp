@@ -0,0 +1,305 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "gemm/gemm.hpp"
+#include "jit_avx2_f32_wino_conv_2x3.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+const int simd_w = 8;
+
+/* The transforms only pay off when the multiplication in the Winograd domain
+ * dominates, i.e. for channel-rich layers */
+bool is_winograd_faster_than_direct(const jit_conv_conf_2x3_wino_t &jcp) {
+    return jcp.ic >= 64 && jcp.oc >= 64;
+}
+} // namespace
+
+status_t jit_avx2_f32_wino_conv_2x3_fwd_t::pd_t::init_conf(
+        memory_desc_t &expect_wei_md) {
+    auto &jcp = jcp_;
+
+    if (!mayiuse(avx2)) return status::unimplemented;
+    if (ndims() != 4 || with_groups()) return status::unimplemented;
+
+    jcp.nthr = dnnl_get_max_threads();
+
+    jcp.ngroups = 1;
+    jcp.mb = MB();
+    jcp.oc_without_padding = OC();
+    jcp.oc = rnd_up(OC(), simd_w);
+    jcp.ic = rnd_up(IC(), simd_w);
+    jcp.ih = IH();
+    jcp.iw = IW();
+    jcp.oh = OH();
+    jcp.ow = OW();
+    jcp.kh = KH();
+    jcp.kw = KW();
+    jcp.t_pad = padT();
+    jcp.b_pad = padB();
+    jcp.l_pad = padL();
+    jcp.r_pad = padR();
+    jcp.stride_h = KSH();
+    jcp.stride_w = KSW();
+    jcp.dilate_h = KDH();
+    jcp.dilate_w = KDW();
+    jcp.with_bias = with_bias();
+
+    jcp.m = 2;
+    jcp.r = 3;
+    jcp.alpha = jcp.m + jcp.r - 1;
+
+    bool ok = true && jcp.kh == jcp.r && jcp.kw == jcp.r && jcp.stride_h == 1
+            && jcp.stride_w == 1 && jcp.dilate_h == 0 && jcp.dilate_w == 0
+            && jcp.t_pad >= 0 && jcp.t_pad < jcp.r && jcp.l_pad >= 0
+            && jcp.l_pad < jcp.r && jcp.b_pad >= 0 && jcp.r_pad >= 0;
+    if (!ok) return status::unimplemented;
+
+    if (!IMPLICATION(desc()->alg_kind == alg_kind::convolution_auto,
+                is_winograd_faster_than_direct(jcp)))
+        return status::unimplemented;
+
+    jcp.ic_block = simd_w;
+    jcp.oc_block = simd_w;
+    jcp.nb_ic = jcp.ic / jcp.ic_block;
+    jcp.nb_oc = jcp.oc / jcp.oc_block;
+
+    jcp.tile_h = div_up(jcp.oh, jcp.m);
+    jcp.tile_w = div_up(jcp.ow, jcp.m);
+
+    /* GEMM dimensions for every point of the Winograd tile: N is the number
+     * of tiles processed at once by a thread. The transformed source and
+     * destination of a block of tiles should stay in L2. */
+    const int aa = jcp.alpha * jcp.alpha;
+    const int L2_cap = get_cache_size(2, true) / sizeof(float);
+    const int n_tiles = jcp.mb * jcp.tile_h * jcp.tile_w;
+    jcp.N = jcp.oc;
+    jcp.K = jcp.ic;
+    jcp.M = nstl::max(1, L2_cap / 2 / (aa * (jcp.ic + jcp.oc)));
+    jcp.M = nstl::max(1, nstl::min(jcp.M, div_up(n_tiles, jcp.nthr)));
+
+    /* Weights are transformed by the wino reorder. A single ic and oc block
+     * makes every point of the tile a plain column-major (oc x ic) matrix
+     * directly consumable by sgemm. */
+    expect_wei_md.format_kind = format_kind::wino;
+    expect_wei_md.data_type = data_type::f32;
+    dnnl_wino_desc_t &wd = expect_wei_md.format_desc.wino_desc;
+    wd.wino_format = dnnl_wino_wei_aaOio;
+    wd.r = jcp.r;
+    wd.alpha = jcp.alpha;
+    wd.ic = jcp.ic;
+    wd.oc = jcp.oc;
+    wd.ic_block = jcp.ic;
+    wd.oc_block = jcp.oc;
+    wd.ic2_block = 1;
+    wd.oc2_block = 1;
+    wd.adj_scale = 1.f;
+    wd.size = sizeof(float) * aa * jcp.ic * jcp.oc;
+
+    return status::success;
+}
+
+void jit_avx2_f32_wino_conv_2x3_fwd_t::src_transform(
+        float *V, const float *src, int tile_start, int n_tiles) const {
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const int alpha = jcp.alpha;
+
+    for (int t = 0; t < n_tiles; ++t) {
+        const int tile = tile_start + t;
+        const int n = tile / (jcp.tile_h * jcp.tile_w);
+        const int ty = (tile / jcp.tile_w) % jcp.tile_h;
+        const int tx = tile % jcp.tile_w;
+        const int iy0 = ty * jcp.m - jcp.t_pad;
+        const int ix0 = tx * jcp.m - jcp.l_pad;
+
+        for (int icb = 0; icb < jcp.nb_ic; ++icb) {
+            float d[4][4][simd_w], tmp[4][4][simd_w];
+
+            for_(int i = 0; i < alpha; ++i)
+            for (int j = 0; j < alpha; ++j) {
+                const int iy = iy0 + i, ix = ix0 + j;
+                const bool inside = iy >= 0 && iy < jcp.ih && ix >= 0
+                        && ix < jcp.iw;
+                const float *s
+                        = inside ? &src[src_d.blk_off(n, icb, iy, ix)] : nullptr;
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c)
+                    d[i][j][c] = inside ? s[c] : 0.f;
+            }
+
+            // tmp = B^T * d
+            for (int j = 0; j < alpha; ++j) {
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c) {
+                    tmp[0][j][c] = d[0][j][c] - d[2][j][c];
+                    tmp[1][j][c] = d[1][j][c] + d[2][j][c];
+                    tmp[2][j][c] = d[2][j][c] - d[1][j][c];
+                    tmp[3][j][c] = d[1][j][c] - d[3][j][c];
+                }
+            }
+
+            // V = tmp * B
+            for (int i = 0; i < alpha; ++i) {
+                float *v0 = &V[((i * alpha + 0) * jcp.M + t) * jcp.ic
+                        + icb * simd_w];
+                float *v1 = v0 + jcp.M * jcp.ic;
+                float *v2 = v1 + jcp.M * jcp.ic;
+                float *v3 = v2 + jcp.M * jcp.ic;
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c) {
+                    v0[c] = tmp[i][0][c] - tmp[i][2][c];
+                    v1[c] = tmp[i][1][c] + tmp[i][2][c];
+                    v2[c] = tmp[i][2][c] - tmp[i][1][c];
+                    v3[c] = tmp[i][1][c] - tmp[i][3][c];
+                }
+            }
+        }
+    }
+}
+
+void jit_avx2_f32_wino_conv_2x3_fwd_t::dst_transform(float *dst,
+        const float *M, const float *bias, int tile_start, int n_tiles) const {
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const int alpha = jcp.alpha;
+    const bool with_sum = pd()->attr()->post_ops_.find(primitive_kind::sum)
+            != -1;
+
+    for (int t = 0; t < n_tiles; ++t) {
+        const int tile = tile_start + t;
+        const int n = tile / (jcp.tile_h * jcp.tile_w);
+        const int ty = (tile / jcp.tile_w) % jcp.tile_h;
+        const int tx = tile % jcp.tile_w;
+        const int oy0 = ty * jcp.m;
+        const int ox0 = tx * jcp.m;
+
+        for (int ocb = 0; ocb < jcp.nb_oc; ++ocb) {
+            float tmp[2][4][simd_w], y[2][2][simd_w], b[simd_w];
+
+            PRAGMA_OMP_SIMD()
+            for (int c = 0; c < simd_w; ++c) {
+                const int oc = ocb * simd_w + c;
+                b[c] = jcp.with_bias && oc < jcp.oc_without_padding ? bias[oc]
+                                                                    : 0.f;
+            }
+
+            // tmp = A^T * M
+            for (int j = 0; j < alpha; ++j) {
+                const float *m0 = &M[((0 * alpha + j) * jcp.M + t) * jcp.oc
+                        + ocb * simd_w];
+                const float *m1 = m0 + alpha * jcp.M * jcp.oc;
+                const float *m2 = m1 + alpha * jcp.M * jcp.oc;
+                const float *m3 = m2 + alpha * jcp.M * jcp.oc;
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c) {
+                    tmp[0][j][c] = m0[c] + m1[c] + m2[c];
+                    tmp[1][j][c] = m1[c] - m2[c] - m3[c];
+                }
+            }
+
+            // y = tmp * A + bias
+            for (int i = 0; i < jcp.m; ++i) {
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c) {
+                    y[i][0][c] = tmp[i][0][c] + tmp[i][1][c] + tmp[i][2][c]
+                            + b[c];
+                    y[i][1][c] = tmp[i][1][c] - tmp[i][2][c] - tmp[i][3][c]
+                            + b[c];
+                }
+            }
+
+            for_(int i = 0; i < jcp.m; ++i)
+            for (int j = 0; j < jcp.m; ++j) {
+                const int oy = oy0 + i, ox = ox0 + j;
+                if (oy >= jcp.oh || ox >= jcp.ow) continue;
+                float *d = &dst[dst_d.blk_off(n, ocb, oy, ox)];
+                for (int c = 0; c < simd_w; ++c) {
+                    if (ocb * simd_w + c >= jcp.oc_without_padding) {
+                        d[c] = 0.f;
+                        continue;
+                    }
+                    float v = y[i][j][c];
+                    if (with_sum) v += sum_scale_ * d[c];
+                    if (eltwise_) v = eltwise_->compute_scalar(v);
+                    d[c] = v;
+                }
+            }
+        }
+    }
+}
+
+void jit_avx2_f32_wino_conv_2x3_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &jcp = pd()->jcp_;
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *V_base = scratchpad.get<float>(key_wino_V);
+    float *M_base = scratchpad.get<float>(key_wino_M);
+
+    const int aa = jcp.alpha * jcp.alpha;
+    const int n_tiles_total = jcp.mb * jcp.tile_h * jcp.tile_w;
+    const int n_chunks = div_up(n_tiles_total, jcp.M);
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(n_chunks, nthr, ithr, start, end);
+
+        float *V = V_base + (size_t)ithr * aa * jcp.M * jcp.ic;
+        float *M = M_base + (size_t)ithr * aa * jcp.M * jcp.oc;
+
+        const float one = 1.f, zero = 0.f;
+        for (int chunk = start; chunk < end; ++chunk) {
+            const int tile_start = chunk * jcp.M;
+            const int n_tiles = nstl::min(jcp.M, n_tiles_total - tile_start);
+
+            src_transform(V, src, tile_start, n_tiles);
+
+            for (int a = 0; a < aa; ++a) {
+                const int lda = jcp.oc, ldb = jcp.ic, ldc = jcp.oc;
+                extended_sgemm("N", "N", &jcp.N, &n_tiles, &jcp.K, &one,
+                        wei + (size_t)a * jcp.ic * jcp.oc, &lda,
+                        V + (size_t)a * jcp.M * jcp.ic, &ldb, &zero,
+                        M + (size_t)a * jcp.M * jcp.oc, &ldc);
+            }
+
+            dst_transform(dst, M, bias, tile_start, n_tiles);
+        }
+    });
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
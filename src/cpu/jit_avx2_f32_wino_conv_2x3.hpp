@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_AVX2_F32_WINO_CONV_2x3_HPP
+#define CPU_JIT_AVX2_F32_WINO_CONV_2x3_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_convolution_pd.hpp"
+#include "jit_generator.hpp"
+#include "jit_primitive_conf.hpp"
+#include "ref_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Winograd F(2x2, 3x3) forward convolution for AVX2.
+ *
+ * The source tiles of a block of jcp.M tiles are transformed to the Winograd
+ * domain, multiplied by the pre-transformed weights with 16 independent
+ * jit sgemm calls (one per point of the 4x4 Winograd tile) and transformed
+ * back to the destination. Data use nChw8c layout, weights use the
+ * wino_wei_aaOio format with a single ic and oc block, so that each point of
+ * the Winograd tile is a plain (oc x ic) column-major matrix. */
+struct jit_avx2_f32_wino_conv_2x3_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(engine_t *engine, const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit_fp32_wino_2x3:", avx2, ""),
+                jit_avx2_f32_wino_conv_2x3_fwd_t);
+
+        status_t init() {
+            bool ok = true && desc()->prop_kind == prop_kind::forward_inference
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32)
+                    && !has_zero_dim_memory()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops)
+                    && post_ops_ok() && set_default_formats();
+            if (!ok) return status::unimplemented;
+
+            memory_desc_t expect_wei_md = *weights_md();
+            status_t status = init_conf(expect_wei_md);
+            if (status != status::success) return status;
+            set_default_alg_kind(alg_kind::convolution_winograd);
+
+            if (weights_md_.format_kind == format_kind::any)
+                weights_md_ = expect_wei_md;
+            if (weights_md_ != expect_wei_md) return status::unimplemented;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        jit_conv_conf_2x3_wino_t jcp_;
+
+    protected:
+        status_t init_conf(memory_desc_t &expect_wei_md);
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+
+            auto scratchpad = scratchpad_registry().registrar();
+
+            const size_t aa = jcp_.alpha * jcp_.alpha;
+            scratchpad.book(key_wino_V,
+                    sizeof(float) * aa * jcp_.M * jcp_.ic * jcp_.nthr,
+                    PAGE_4K);
+            scratchpad.book(key_wino_M,
+                    sizeof(float) * aa * jcp_.M * jcp_.oc * jcp_.nthr,
+                    PAGE_4K);
+        }
+
+        bool post_ops_ok() const {
+            const auto &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+            auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(); };
+
+            switch (po.len_) {
+                case 0: return true; // no post_ops
+                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+                default: return false;
+            }
+            return false;
+        }
+
+        bool set_default_formats() {
+            using namespace format_tag;
+            return set_default_formats_common(nChw8c, any, nChw8c);
+        }
+    };
+
+    jit_avx2_f32_wino_conv_2x3_fwd_t(const pd_t *apd)
+        : primitive_impl_t(apd), eltwise_(nullptr), sum_scale_(0.f) {
+        const auto &post_ops = pd()->attr()->post_ops_;
+        const int sum_idx = post_ops.find(primitive_kind::sum);
+        if (sum_idx != -1) sum_scale_ = post_ops.entry_[sum_idx].sum.scale;
+
+        const int eltwise_idx = post_ops.find(primitive_kind::eltwise);
+        if (eltwise_idx != -1)
+            eltwise_ = new ref_eltwise_scalar_fwd_t(
+                    post_ops.entry_[eltwise_idx].eltwise);
+    }
+
+    ~jit_avx2_f32_wino_conv_2x3_fwd_t() { delete eltwise_; }
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    void src_transform(float *V, const float *src, int tile_start,
+            int n_tiles) const;
+    void dst_transform(float *dst, const float *M, const float *bias,
+            int tile_start, int n_tiles) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    ref_eltwise_scalar_fwd_t *eltwise_;
+    float sum_scale_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -91,9 +91,14 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::prepare_output(int ur_w) {
 }
 
 template <typename Vmm>
-void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
+void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(
+        int ur_w, bool last_oc_block_flag) {
     Label no_update_label, store_label, eltwise_label;
 
+    auto vmm_mask = [&](const Vmm &vmm, bool mask_flag) {
+        return mask_flag ? vmm | ktail_mask : vmm;
+    };
+
     mov(reg_channel, ptr[param1 + GET_OFF(channel)]);
     if (jcp.with_bias) { mov(reg_bias, ptr[param1 + GET_OFF(bias)]); }
 
@@ -102,14 +107,17 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
         je(no_update_label, T_NEAR);
     }
 
-    for (int k = 0; k < jcp.nb_oc_blocking; k++)
+    for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+        const bool mask_flag
+                = last_oc_block_flag && k == jcp.nb_oc_blocking - 1;
         for (int j = 0; j < ur_w; j++) {
             Vmm vmm = vmm_out(j, k);
             size_t aux_output_offset = get_output_offset(j, k);
-            vaddps(vmm,
+            vaddps(vmm_mask(vmm, mask_flag), vmm,
                     make_safe_addr(
                             reg_out, aux_output_offset, reg_out_long_offt));
         }
+    }
 
     if (!jcp.with_sum) {
         jmp(eltwise_label, T_NEAR);
@@ -121,10 +129,13 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
     L(no_update_label);
     if (jcp.with_bias) {
         for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+            const bool mask_flag
+                    = last_oc_block_flag && k == jcp.nb_oc_blocking - 1;
             int bias_offset = jcp.typesize_out * k * jcp.oc_block;
             for (int j = 0; j < ur_w; j++) {
                 Vmm vmm = vmm_out(j, k);
-                vaddps(vmm, EVEX_compress_addr(reg_bias, bias_offset));
+                vaddps(vmm_mask(vmm, mask_flag), vmm,
+                        EVEX_compress_addr(reg_bias, bias_offset));
             }
             mic_prefetcht1(EVEX_compress_addr(reg_bias, bias_offset + 64));
         }
@@ -146,18 +157,20 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::store_output(int ur_w) {
     }
 
     L(store_label);
-    for (int k = 0; k < jcp.nb_oc_blocking; k++)
+    for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+        const bool mask_flag
+                = last_oc_block_flag && k == jcp.nb_oc_blocking - 1;
         for (int j = 0; j < ur_w; j++) {
             Vmm vmm = vmm_out(j, k);
-            size_t aux_output_offset = (size_t)typesize
-                    * ((size_t)k * jcp.od * jcp.oh * jcp.ow + j) * jcp.oc_block;
+            size_t aux_output_offset = get_output_offset(j, k);
             vmovups(EVEX_compress_addr_safe(
                             reg_out, aux_output_offset, reg_out_long_offt),
-                    vmm);
+                    vmm_mask(vmm, mask_flag));
             if (!is_owb_prefetching(jcp))
                 mic_prefetcht0(EVEX_compress_addr_safe(
                         reg_out_prf, aux_output_offset, reg_out_long_offt));
         }
+    }
 }
 
 template <typename Vmm>
@@ -724,7 +737,7 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::compute_loop_fma(
 
 template <typename Vmm>
 void _jit_avx512_common_conv_fwd_kernel<Vmm>::compute_loop_fma_core(
-        int ur_w, int pad_l, int pad_r) {
+        int ur_w, int pad_l, int pad_r, int ic_step) {
     int kw = jcp.kw;
     int stride_w = jcp.stride_w;
     int ic_block = jcp.ic_block;
@@ -733,7 +746,7 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::compute_loop_fma_core(
     Label kh_label, kd_label;
     int shift_kernel_ptr
             = jcp.typesize_in * jcp.kw * jcp.oc_block * jcp.ic_block;
-    int inp_mul = !jcp.is_1stconv ? ic_block : 1;
+    int inp_mul = get_src_w_stride();
     int shift_input_ptr
             = jcp.typesize_in * (jcp.dilate_h + 1) * jcp.iw * inp_mul;
 
@@ -775,7 +788,7 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::compute_loop_fma_core(
         for (int ki = 0; ki < kw; ki++) {
             int jj_start = get_ow_start(ki, pad_l);
             int jj_end = get_ow_end(ur_w, ki, pad_r);
-            for (int ic = 0; ic < ic_block; ic++) {
+            for (int ic = 0; ic < ic_step; ic++) {
                 if (jcp.kernel_kind == expl_bcast) {
                     for (int jj = jj_start; jj < jj_end; jj++) {
                         size_t aux_input_offset = input_offset(jj, ic, ki);
@@ -859,18 +872,52 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::compute_loop(
         else
             compute_loop_4fma(ur_w, pad_l, pad_r);
     else if (jcp.ver == ver_fma)
-        if ((jcp.is_1stconv && jcp.kernel_kind != expl_bcast)
+        if (is_src_layout_nxc()) {
+            // Channels-last input: the last ic block may be partial, which
+            // only the generic fma core loop can handle
+            const int ic_tail = jcp.ic_without_padding % jcp.ic_block;
+            if (ic_tail) {
+                Label ic_tail_label, ic_done_label;
+                cmp(qword[param1 + GET_OFF(channel)], jcp.nb_ic - 1);
+                je(ic_tail_label, T_NEAR);
+
+                compute_loop_fma_core(ur_w, pad_l, pad_r, jcp.ic_block);
+                jmp(ic_done_label, T_NEAR);
+
+                L(ic_tail_label);
+                compute_loop_fma_core(ur_w, pad_l, pad_r, ic_tail);
+
+                L(ic_done_label);
+            } else {
+                compute_loop_fma_core(ur_w, pad_l, pad_r, jcp.ic_block);
+            }
+        } else if ((jcp.is_1stconv && jcp.kernel_kind != expl_bcast)
                 || mayiuse(avx512_mic))
             compute_loop_fma(ur_w, pad_l, pad_r);
         else if (jcp.kernel_kind == embd_bcast && jcp.nb_oc_blocking == 1)
             compute_loop_fma(ur_w, pad_l, pad_r);
         else
-            compute_loop_fma_core(ur_w, pad_l, pad_r);
+            compute_loop_fma_core(ur_w, pad_l, pad_r, jcp.ic_block);
     else
         assert(!"unknown convolution version");
 
     L(skip_compute_loop);
-    store_output(ur_w);
+    if (is_dst_layout_nxc() && jcp.oc_without_padding % jcp.oc_block != 0) {
+        Label common_store_label, store_done_label;
+        cmp(qword[param1 + GET_OFF(oc_blocks)],
+                jcp.nb_oc - jcp.nb_oc_blocking);
+        jne(common_store_label, T_NEAR);
+
+        store_output(ur_w, true); // last oc block
+        jmp(store_done_label, T_NEAR);
+
+        L(common_store_label);
+        store_output(ur_w, false);
+
+        L(store_done_label);
+    } else {
+        store_output(ur_w, false);
+    }
     if (jcp.ndims == 5) pop(reg_oi);
 }
 
@@ -887,13 +934,20 @@ void _jit_avx512_common_conv_fwd_kernel<Vmm>::generate() {
     int dilate_w = jcp.dilate_w + 1;
     int stride_w = jcp.stride_w;
 
-    int inp_mult = jcp.is_1stconv ? 1 : jcp.ic_block;
+    int inp_mult = get_src_w_stride();
     int inp_shift_pad = jcp.typesize_in * (ur_w * stride_w - l_pad) * inp_mult;
     int inp_shift = jcp.typesize_in * ur_w * stride_w * inp_mult;
     int inp_shift_pad_second_block = -1 * jcp.typesize_in * l_pad * inp_mult;
-    int out_shift = jcp.typesize_out * ur_w * jcp.oc_block;
+    int out_shift = jcp.typesize_out * ur_w * get_dst_w_stride();
 
     preamble();
+    if (is_dst_layout_nxc() && jcp.oc_without_padding % jcp.oc_block != 0) {
+        int tail_size = jcp.oc_without_padding % jcp.oc_block;
+        int mask = (1 << tail_size) - 1;
+        Reg32 regw_tmp = reg_oi.cvt32();
+        mov(regw_tmp, mask);
+        kmovw(ktail_mask, regw_tmp);
+    }
     mov(reg_inp, ptr[param1 + GET_OFF(src)]);
     mov(reg_out, ptr[param1 + GET_OFF(dst)]);
     mov(reg_ker, ptr[param1 + GET_OFF(filt)]);
@@ -1166,7 +1220,14 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     jcp.back_pad = (jcp.od - 1) * jcp.stride_d
             + (jcp.kd - 1) * (jcp.dilate_d + 1) - (jcp.id + jcp.f_pad - 1);
 
-    jcp.is_1stconv = is_1stconv(jcp);
+    // Channels-last data is read and written in place, with the channel
+    // tails handled in the kernel; weights stay blocked
+    const auto dat_tag_nxc = pick(ndims - 3, nwc, nhwc, ndhwc);
+    const bool is_data_layout_nxc = mayiuse(avx512_core)
+            && src_d.matches_one_of_tag(dat_tag_nxc) == dat_tag_nxc
+            && dst_d.matches_one_of_tag(dat_tag_nxc) == dat_tag_nxc;
+
+    jcp.is_1stconv = is_1stconv(jcp) && !is_data_layout_nxc;
 
     bool ok_to_pad_channels
             = true && jcp.ngroups == 1 && src_d.data_type() == data_type::f32;
@@ -1175,6 +1236,7 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     jcp.simd_w = full_simd_w;
     bool ok_to_try_xmm = true && mayiuse(avx512_core)
             && src_d.data_type() == data_type::f32 && !jcp.is_1stconv
+            && !is_data_layout_nxc
             && !ok_to_pad_channels
             && (jcp.ic % jcp.simd_w != 0 || jcp.oc % jcp.simd_w != 0)
             && (jcp.ic % 8 != 0 || jcp.oc % 8 != 0);
@@ -1182,6 +1244,7 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
 
     jcp.oc_block = jcp.simd_w;
     jcp.ic_block = jcp.is_1stconv ? jcp.ic : jcp.simd_w;
+    jcp.ic_without_padding = jcp.ic;
     jcp.aligned_threads = 0;
 
     if (ok_to_pad_channels) {
@@ -1203,13 +1266,18 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
         if (dst_d.data_type() == data_type::s32) return status::unimplemented;
     }
 
-    auto src_tag = jcp.is_1stconv
-            ? pick(ndims - 3, ncw, nchw, ncdhw)
-            : ((jcp.simd_w == 4) ? pick(ndims - 3, nCw4c, nChw4c, nCdhw4c)
-                                 : pick(ndims - 3, nCw16c, nChw16c, nCdhw16c));
-    auto dst_tag = (jcp.simd_w == 4)
-            ? pick(ndims - 3, nCw4c, nChw4c, nCdhw4c)
-            : pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
+    auto src_tag = is_data_layout_nxc
+            ? dat_tag_nxc
+            : jcp.is_1stconv
+                    ? pick(ndims - 3, ncw, nchw, ncdhw)
+                    : ((jcp.simd_w == 4)
+                                    ? pick(ndims - 3, nCw4c, nChw4c, nCdhw4c)
+                                    : pick(ndims - 3, nCw16c, nChw16c,
+                                            nCdhw16c));
+    auto dst_tag = is_data_layout_nxc
+            ? dat_tag_nxc
+            : (jcp.simd_w == 4) ? pick(ndims - 3, nCw4c, nChw4c, nCdhw4c)
+                                : pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
     auto wei_tag = with_groups
             ? ((jcp.simd_w == 4)
                             ? pick(ndims - 3, gOIw4i4o, gOIhw4i4o, gOIdhw4i4o)
@@ -1538,8 +1606,10 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
 
     jcp.ur_w_tail = jcp.ow % jcp.ur_w;
 
-    args_ok = true && jcp.l_pad <= jcp.ur_w && jcp.ic <= src_d.padded_dims()[1]
-            && jcp.oc <= dst_d.padded_dims()[1]
+    args_ok = true && jcp.l_pad <= jcp.ur_w
+            && IMPLICATION(!is_data_layout_nxc,
+                    jcp.ic <= src_d.padded_dims()[1]
+                            && jcp.oc <= dst_d.padded_dims()[1])
             && jcp.ic <= weights_d.padded_dims()[with_groups + 1]
             && jcp.oc <= weights_d.padded_dims()[with_groups + 0];
     if (!args_ok) return status::unimplemented;
@@ -1629,11 +1699,16 @@ void jit_avx512_common_conv_bwd_data_kernel_f32::prepare_output(int ur_w) {
 }
 
 void jit_avx512_common_conv_bwd_data_kernel_f32::store_output(int ur_w) {
-    Label no_update_label;
+    Label no_update_label, store_label, eltwise_label;
 
     mov(reg_channel, ptr[param + GET_OFF(channel)]);
-    cmp(reg_channel, 0);
-    je(no_update_label, T_NEAR);
+    if (jcp.with_bias) mov(reg_bias, ptr[param + GET_OFF(bias)]);
+
+    if (!jcp.with_sum) {
+        cmp(reg_channel, 0);
+        je(no_update_label, T_NEAR);
+    }
+
     for (int k = 0; k < jcp.nb_ic_blocking; k++) {
         for (int j = 0; j < ur_w; j++) {
             Zmm zmm = zmm_out(j, k);
@@ -1645,7 +1720,42 @@ void jit_avx512_common_conv_bwd_data_kernel_f32::store_output(int ur_w) {
         }
     }
 
+    if (!jcp.with_sum) {
+        jmp(eltwise_label, T_NEAR);
+    } else {
+        cmp(reg_channel, 0);
+        jne(eltwise_label, T_NEAR);
+    }
+
+    // the bias is added to the first partial sum only
     L(no_update_label);
+    if (jcp.with_bias) {
+        for (int k = 0; k < jcp.nb_ic_blocking; k++) {
+            int bias_offset = typesize * k * jcp.ic_block;
+            for (int j = 0; j < ur_w; j++) {
+                Zmm zmm = zmm_out(j, k);
+                vaddps(zmm, EVEX_compress_addr(reg_bias, bias_offset));
+            }
+        }
+    }
+
+    // the eltwise is applied to the final result only
+    L(eltwise_label);
+    if (jcp.with_eltwise) {
+        cmp(reg_channel, jcp.nb_oc - 1);
+        jl(store_label, T_NEAR);
+
+        if (ur_w == jcp.ur_w) {
+            eltwise_injector_->compute_vector_range(
+                    0, jcp.nb_ic_blocking * jcp.ur_w);
+        } else {
+            for (int k = 0; k < jcp.nb_ic_blocking; k++)
+                eltwise_injector_->compute_vector_range(
+                        k * jcp.ur_w, k * jcp.ur_w + ur_w);
+        }
+    }
+
+    L(store_label);
     for (int k = 0; k < jcp.nb_ic_blocking; k++) {
         for (int j = 0; j < ur_w; j++) {
             Zmm zmm = zmm_out(j, k);
@@ -2229,13 +2339,35 @@ void jit_avx512_common_conv_bwd_data_kernel_f32::generate() {
     }
 
     postamble();
+
+    if (jcp.with_eltwise) eltwise_injector_->prepare_table();
+}
+
+bool jit_avx512_common_conv_bwd_data_kernel_f32::post_ops_ok(
+        jit_conv_conf_t &jcp, const primitive_attr_t &attr) {
+    const auto &p = attr.post_ops_;
+
+    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
+    // diff_src is accumulated as is, so the sum may not be scaled
+    auto is_sum = [&](int idx) {
+        return p.entry_[idx].is_sum() && p.entry_[idx].sum.scale == 1.f;
+    };
+
+    switch (p.len_) {
+        case 0: return true; // no post_ops
+        case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+        case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+        default: return false;
+    }
+
+    return false;
 }
 
 status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
         jit_conv_conf_t &jcp, const convolution_desc_t &cd,
         const memory_desc_wrapper &diff_src_d,
         const memory_desc_wrapper &weights_d,
-        const memory_desc_wrapper &diff_dst_d) {
+        const memory_desc_wrapper &diff_dst_d, const primitive_attr_t &attr) {
     if (!mayiuse(avx512_common)) return status::unimplemented;
 
     jcp = zero<decltype(jcp)>();
@@ -2253,6 +2385,7 @@ status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
     jcp.oc = diff_dst_d.dims()[1] / jcp.ngroups;
     jcp.oc_without_padding = jcp.oc;
     jcp.ic = diff_src_d.dims()[1] / jcp.ngroups;
+    jcp.ic_without_padding = jcp.ic;
 
     jcp.id = (ndims == 5) ? diff_src_d.dims()[2] : 1;
     jcp.ih = (ndims == 3) ? 1 : diff_src_d.dims()[ndims - 2];
@@ -2281,6 +2414,19 @@ status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
             || (jcp.dilate_h != 0 && jcp.stride_h != 1))
         return status::unimplemented;
 
+    // the bias and the post-ops are applied to diff_src, as needed by the
+    // deconvolution that is computed as a backward data convolution
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef
+            && cd.bias_desc.data_type == data_type::f32;
+
+    if (!post_ops_ok(jcp, attr)) return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+
     jcp.r_pad = (jcp.ow - 1) * jcp.stride_w + (jcp.kw - 1) * (jcp.dilate_w + 1)
             - (jcp.iw + jcp.l_pad - 1);
     jcp.b_pad = (jcp.oh - 1) * jcp.stride_h + (jcp.kh - 1) * (jcp.dilate_h + 1)
@@ -2498,8 +2644,8 @@ status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
 
 void jit_avx512_common_conv_bwd_data_kernel_f32::init_scratchpad(
         memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
-    UNUSED(scratchpad);
-    UNUSED(jcp);
+    if (jcp.with_bias && jcp.ic != jcp.ic_without_padding)
+        scratchpad.book(key_conv_padded_bias, jcp.typesize_out * jcp.ic);
 }
 
 // Initialize static data members
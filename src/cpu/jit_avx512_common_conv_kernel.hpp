@@ -125,26 +125,51 @@ private:
     Xbyak::Reg64 imm_addr64 = r15;
     Vmm vmm_wei = Vmm(31);
 
+    Xbyak::Opmask ktail_mask = Xbyak::Opmask(2);
+
     jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
 
     inline void prepare_output(int ur_w);
-    inline void store_output(int ur_w);
+    inline void store_output(int ur_w, bool last_oc_block_flag);
     inline void compute_loop_fma(int ur_w, int pad_l, int pad_r);
-    inline void compute_loop_fma_core(int ur_w, int pad_l, int pad_r);
+    inline void compute_loop_fma_core(
+            int ur_w, int pad_l, int pad_r, int ic_step);
     inline void compute_loop_4fma(int ur_w, int pad_l, int pad_r);
     inline void compute_loop_4fma_1st(int ur_w, int pad_l, int pad_r);
     inline void compute_loop(int ur_w, int pad_l, int pad_r);
 
     void generate();
 
+    inline bool is_src_layout_nxc() const {
+        return utils::one_of(jcp.src_tag, format_tag::nwc, format_tag::nhwc,
+                format_tag::ndhwc);
+    }
+    inline bool is_dst_layout_nxc() const {
+        return utils::one_of(jcp.dst_tag, format_tag::nwc, format_tag::nhwc,
+                format_tag::ndhwc);
+    }
+
+    /* distance (in elements) between two consecutive points along w */
+    inline size_t get_src_w_stride() const {
+        if (is_src_layout_nxc())
+            return (size_t)jcp.ngroups * jcp.ic_without_padding;
+        return !jcp.is_1stconv ? jcp.ic_block : 1;
+    }
+    inline size_t get_dst_w_stride() const {
+        return is_dst_layout_nxc() ? (size_t)jcp.ngroups * jcp.oc_without_padding
+                                   : (size_t)jcp.oc_block;
+    }
+
     inline size_t get_output_offset(int oi, int n_oc_block) {
+        size_t ocb_str = is_dst_layout_nxc()
+                ? (size_t)jcp.oc_block
+                : (size_t)jcp.od * jcp.oh * jcp.ow * jcp.oc_block;
         return (size_t)jcp.typesize_out
-                * ((size_t)n_oc_block * jcp.oh * jcp.ow * jcp.od + oi)
-                * jcp.oc_block;
+                * ((size_t)n_oc_block * ocb_str + oi * get_dst_w_stride());
     }
 
     inline size_t get_input_offset(int ki, int ic, int oi, int pad_l) {
-        size_t iw_str = !jcp.is_1stconv ? jcp.ic_block : 1;
+        size_t iw_str = get_src_w_stride();
         size_t ic_str = !jcp.is_1stconv ? 1 : (size_t)jcp.iw * jcp.ih * jcp.id;
         return (size_t)jcp.typesize_in
                 * ((size_t)(ki * (jcp.dilate_w + 1) + oi * jcp.stride_w - pad_l)
@@ -220,17 +245,25 @@ struct jit_avx512_common_conv_fwd_kernel {
 struct jit_avx512_common_conv_bwd_data_kernel_f32 : public jit_generator {
 
     jit_avx512_common_conv_bwd_data_kernel_f32(jit_conv_conf_t ajcp)
-        : jcp(ajcp) {
+        : jcp(ajcp), eltwise_injector_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise);
+
         generate();
         jit_ker = (void (*)(jit_conv_call_s *))getCode();
     }
 
+    ~jit_avx512_common_conv_bwd_data_kernel_f32() { delete eltwise_injector_; }
+
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_common_conv_bwd_data_kernel_f32)
 
+    static bool post_ops_ok(jit_conv_conf_t &jcp, const primitive_attr_t &attr);
     static status_t init_conf(jit_conv_conf_t &jcp,
             const convolution_desc_t &cd, const memory_desc_wrapper &diff_src_d,
             const memory_desc_wrapper &weights_d,
-            const memory_desc_wrapper &diff_dst_d);
+            const memory_desc_wrapper &diff_dst_d,
+            const primitive_attr_t &attr);
     static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
             const jit_conv_conf_t &jcp);
 
@@ -273,6 +306,9 @@ private:
 
     reg64_t reg_tmp = rbp;
     reg64_t reg_long_offt = r14;
+    reg64_t reg_bias = reg_kj; // used in store_output only
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
 
     inline Xbyak::Zmm zmm_ker(int i_ic) {
         assert(i_ic < 4);
@@ -57,7 +57,7 @@ inline void jit_conv_ker_pipeline(jit_conv_ker_t ker, jit_conv_call_s &p,
 // TODO: implement it for BWD_D and BWD_W too
 inline void jit_conv_ker_pipeline_ow_thr(jit_conv_ker_t ker, jit_conv_call_s &p,
         const void *src, const void *dst, const void *filt, const void *bias,
-        int channel, int kh_padding, int owb) {
+        int channel, int kh_padding, int owb, int oc_blocks) {
     PIPELINE(src);
     PIPELINE(dst);
     PIPELINE(filt);
@@ -67,6 +67,7 @@ inline void jit_conv_ker_pipeline_ow_thr(jit_conv_ker_t ker, jit_conv_call_s &p,
     // skip computation part and initialize output by zeroes
     PIPELINE(kh_padding);
     PIPELINE(owb);
+    PIPELINE(oc_blocks);
 
     if (p.src) ker(&p);
 }
@@ -90,8 +91,8 @@ inline void jit_conv_3d_ker_pipeline(jit_conv_ker_t ker, jit_conv_call_s &p,
 // TODO: implement it for BWD_D and BWD_W too
 inline void jit_conv_3d_ker_pipeline_ow_thr(jit_conv_ker_t ker,
         jit_conv_call_s &p, const void *src, const void *dst, const void *filt,
-        const void *bias, int channel, int kh_padding, int kd_padding,
-        int owb) {
+        const void *bias, int channel, int kh_padding, int kd_padding, int owb,
+        int oc_blocks) {
     PIPELINE(src);
     PIPELINE(dst);
     PIPELINE(filt);
@@ -102,6 +103,7 @@ inline void jit_conv_3d_ker_pipeline_ow_thr(jit_conv_ker_t ker,
     PIPELINE(kh_padding);
     PIPELINE(kd_padding);
     PIPELINE(owb);
+    PIPELINE(oc_blocks);
 
     if (p.src) ker(&p);
 }
@@ -176,6 +178,10 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = pd()->jcp_;
+    const bool is_src_layout_nxc = utils::one_of(jcp.src_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+    const bool is_dst_layout_nxc = utils::one_of(jcp.dst_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
@@ -194,6 +200,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
 
         auto par_conv = jit_conv_call_s();
         size_t src_c_stride = src_d.blk_off(0, 1);
+        if (is_src_layout_nxc) src_c_stride *= jcp.ic_block;
         size_t wht_ic_stride = wht_blk_off(weights_d, 0, 0, 1);
 
         for (int icb_l2 = 0; icb_l2 < jcp.nb_ic; icb_l2 += jcp.nb_ic_L2) {
@@ -217,18 +224,23 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                 int g_ocb = g * jcp.nb_oc + ocb;
                 int g_oc = g_ocb * jcp.oc_block;
                 int g_icb = g * jcp.nb_ic * jcp.nonblk_group_off;
+                // channels-last data is addressed by channel, not by block
+                int src_c = is_src_layout_nxc
+                        ? (g_icb + icb_l2) * jcp.ic_block
+                        : g_icb + icb_l2;
+                int dst_c = is_dst_layout_nxc ? g_oc : g_ocb;
 
                 int ow_s = owb * jcp.ow_block;
                 int iw_s = ow_s * jcp.stride_w;
                 auto bias_w = bias ? bias + g_oc : nullptr;
-                auto dst_w = dst + dst_d.blk_off(n, g_ocb, ow_s);
-                auto src_w = src + src_d.blk_off(n, g_icb + icb_l2, iw_s);
+                auto dst_w = dst + dst_d.blk_off(n, dst_c, ow_s);
+                auto src_w = src + src_d.blk_off(n, src_c, iw_s);
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb, icb_l2);
 
                 for (int icb = icb_l2;
                         icb < min(jcp.nb_ic, icb_l2 + jcp.nb_ic_L2); ++icb) {
                     jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv,
-                            src_w, dst_w, wht_w, bias_w, icb, 1, owb);
+                            src_w, dst_w, wht_w, bias_w, icb, 1, owb, ocb);
 
                     src_w += src_c_stride;
                     wht_w += wht_ic_stride;
@@ -251,8 +263,8 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         // on the last iteration of loop above. Only valid pointers make sense
         // here as call parameters to avoid execution of prefetch instructions
         // with nullptr, other parameters are not used in real jit call here
-        jit_conv_ker_pipeline_ow_thr(
-                kernel_->jit_ker, par_conv, src, dst, weights, bias, 0, 0, 0);
+        jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv, src, dst,
+                weights, bias, 0, 0, 0, 0);
     });
 }
 
@@ -271,6 +283,10 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = pd()->jcp_;
+    const bool is_src_layout_nxc = utils::one_of(jcp.src_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+    const bool is_dst_layout_nxc = utils::one_of(jcp.dst_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
@@ -290,6 +306,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         auto par_conv = jit_conv_call_s();
         size_t src_h_stride = src_d.blk_off(0, 0, 1);
         size_t src_c_stride = src_d.blk_off(0, 1);
+        if (is_src_layout_nxc) src_c_stride *= jcp.ic_block;
         size_t dst_h_stride = dst_d.blk_off(0, 0, 1);
         size_t wht_h_stride = wht_blk_off(weights_d, 0, 0, 0, 1);
         size_t wht_ic_stride = wht_blk_off(weights_d, 0, 0, 1);
@@ -312,6 +329,11 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                 int g_ocb = g * jcp.nb_oc + ocb;
                 int g_oc = g_ocb * jcp.oc_block;
                 int g_icb = g * jcp.nb_ic * jcp.nonblk_group_off;
+                // channels-last data is addressed by channel, not by block
+                int src_c = is_src_layout_nxc
+                        ? (g_icb + icb_l2) * jcp.ic_block
+                        : g_icb + icb_l2;
+                int dst_c = is_dst_layout_nxc ? g_oc : g_ocb;
 
                 int work_rem = end - start;
 
@@ -323,9 +345,9 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                 for (int oh_b = oh_s; oh_b < oh_e; oh_b += jcp.h_blocking) {
                     int ih_b = -jcp.t_pad + oh_b * jcp.stride_h;
 
-                    auto dst_w = dst + dst_d.blk_off(n, g_ocb, oh_b, ow_s);
+                    auto dst_w = dst + dst_d.blk_off(n, dst_c, oh_b, ow_s);
                     auto src_w = src
-                            + src_d.blk_off(n, g_icb + icb_l2, ih_b, iw_s);
+                            + src_d.blk_off(n, src_c, ih_b, iw_s);
                     auto wht_w
                             = weights + wht_blk_off(weights_d, g, ocb, icb_l2);
 
@@ -354,7 +376,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
 
                             jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker,
                                     par_conv, aux_src, dst_c, aux_wht, bias_w,
-                                    icb, kh_padding, owb);
+                                    icb, kh_padding, owb, ocb);
 
                             src_c += src_h_stride * jcp.stride_h;
                             dst_c += dst_h_stride;
@@ -379,8 +401,8 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         // on the last iteration of loop above. Only valid pointers make sense
         // here as call parameters to avoid execution of prefetch instructions
         // with nullptr, other parameters are not used in real jit call here
-        jit_conv_ker_pipeline_ow_thr(
-                kernel_->jit_ker, par_conv, src, dst, weights, bias, 0, 0, 0);
+        jit_conv_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv, src, dst,
+                weights, bias, 0, 0, 0, 0);
     });
 }
 
@@ -400,6 +422,10 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
     const memory_desc_wrapper bias_d(pd()->weights_md(1));
 
     const auto &jcp = pd()->jcp_;
+    const bool is_src_layout_nxc = utils::one_of(jcp.src_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+    const bool is_dst_layout_nxc = utils::one_of(jcp.dst_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     parallel(0, [&](const int ithr, const int nthr) {
@@ -414,6 +440,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         size_t src_d_stride = src_d.blk_off(0, 0, 1);
         size_t src_h_stride = src_d.blk_off(0, 0, 0, 1);
         size_t src_c_stride = src_d.blk_off(0, 1);
+        if (is_src_layout_nxc) src_c_stride *= jcp.ic_block;
         size_t dst_h_stride = dst_d.blk_off(0, 0, 0, 1);
         size_t wht_d_stride = wht_blk_off(weights_d, 0, 0, 0, 1);
         size_t wht_h_stride = wht_blk_off(weights_d, 0, 0, 0, 0, 1);
@@ -437,6 +464,11 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                 int g_ocb = g * jcp.nb_oc + ocb;
                 int g_oc = g_ocb * jcp.oc_block;
                 int g_icb = g * jcp.nb_ic * jcp.nonblk_group_off;
+                // channels-last data is addressed by channel, not by block
+                int src_c = is_src_layout_nxc
+                        ? (g_icb + icb_l2) * jcp.ic_block
+                        : g_icb + icb_l2;
+                int dst_c = is_dst_layout_nxc ? g_oc : g_ocb;
 
                 int work_rem = end - start;
                 int ih_s = -jcp.t_pad + oh_s * jcp.stride_h;
@@ -455,9 +487,9 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                         = nstl::max(0, jcp.kd - d_t_overflow - d_b_overflow);
 
                 auto bias_w = bias ? bias + bias_d.blk_off(g_oc) : 0;
-                auto dst_w = dst + dst_d.blk_off(n, g_ocb, od_s, oh_s, ow_s);
+                auto dst_w = dst + dst_d.blk_off(n, dst_c, od_s, oh_s, ow_s);
                 auto src_w = src
-                        + src_d.blk_off(n, g_icb + icb_l2, id_s, ih_s, iw_s)
+                        + src_d.blk_off(n, src_c, id_s, ih_s, iw_s)
                         + d_t_overflow * dilate_d * src_d_stride;
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb, icb_l2)
                         + d_t_overflow * wht_d_stride;
@@ -481,7 +513,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
                                 par_conv,
                                 src_c + i_t_overflow * dilate_h * src_h_stride,
                                 dst_c, wht_w + i_t_overflow * wht_h_stride,
-                                bias_w, icb, kh_padding, kd_padding, owb);
+                                bias_w, icb, kh_padding, kd_padding, owb, ocb);
 
                         src_c += src_h_stride * jcp.stride_h;
                         dst_c += dst_h_stride;
@@ -507,21 +539,40 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         // on the last iteration of loop above. Only valid pointers make sense
         // here as call parameters to avoid execution of prefetch instructions
         // with nullptr, other parameters are not used in real jit call here
-        jit_conv_3d_ker_pipeline(
-                kernel_->jit_ker, par_conv, src, dst, weights, bias, 0, 0, 0);
+        jit_conv_3d_ker_pipeline_ow_thr(kernel_->jit_ker, par_conv, src, dst,
+                weights, bias, 0, 0, 0, 0, 0);
     });
 }
 
 template struct jit_avx512_common_convolution_fwd_t<data_type::f32>;
 
+template <data_type_t diff_dst_type, data_type_t wei_type,
+        data_type_t diff_src_type>
+void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
+        diff_src_type>::prepare_padded_bias(const diff_src_data_t *&bias,
+        const memory_tracking::grantor_t &scratchpad) const {
+    const auto &jcp = pd()->jcp_;
+    if (!jcp.with_bias || jcp.ic == jcp.ic_without_padding) return;
+
+    auto padded_bias
+            = scratchpad.template get<diff_src_data_t>(key_conv_padded_bias);
+    utils::array_copy(padded_bias, bias, jcp.ic_without_padding);
+    utils::array_set(padded_bias + jcp.ic_without_padding, (diff_src_data_t)0,
+            jcp.ic - jcp.ic_without_padding);
+    bias = padded_bias;
+}
+
 template <data_type_t diff_dst_type, data_type_t wei_type,
         data_type_t diff_src_type>
 void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_1d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -563,11 +614,13 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                 auto diff_dst_w
                         = diff_dst + diff_dst_d.blk_off(n, g_ocb + ocb_l2);
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb);
+                auto bias_w = jcp.with_bias ? bias + g_icb * jcp.ic_block
+                                            : nullptr;
 
                 for (int ocb = ocb_l2;
                         ocb < min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2); ++ocb) {
                     jit_conv_ker_pipeline(kernel_->jit_ker, par_conv,
-                            diff_src_w, diff_dst_w, wht_w, 0, ocb, 1);
+                            diff_src_w, diff_dst_w, wht_w, bias_w, ocb, 1);
                     diff_dst_w += diff_dst_c_stride;
                     wht_w += wht_oc_stride;
                 }
@@ -601,8 +654,11 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_2d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -649,6 +705,8 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                 auto diff_dst_w
                         = diff_dst + diff_dst_d.blk_off(n, g_ocb + ocb_l2);
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb);
+                auto bias_w = jcp.with_bias ? bias + g_icb * jcp.ic_block
+                                            : nullptr;
 
                 for (int ocb = ocb_l2;
                         ocb < min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2); ++ocb) {
@@ -701,7 +759,8 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                         jit_conv_ker_pipeline(kernel_->jit_ker, par_conv,
                                 diff_src_w + ij * diff_src_h_stride,
                                 diff_dst_w + oj * diff_dst_h_stride,
-                                wht_w + k_lo * wht_h_stride, 0, ocb, k_len);
+                                wht_w + k_lo * wht_h_stride, bias_w, ocb,
+                                k_len);
                     }
                     diff_dst_w += diff_dst_c_stride;
                     wht_w += wht_oc_stride;
@@ -733,8 +792,11 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
         diff_src_type>::execute_backward_data_3d(const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const diff_src_data_t *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(diff_src_data_t *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -826,6 +888,8 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                         + d_oj * diff_dst_d_stride;
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb_l2, icb)
                         + d_lo * wht_d_stride;
+                auto bias_w = jcp.with_bias ? bias + g_icb * jcp.ic_block
+                                            : nullptr;
 
                 for (int ocb = ocb_l2;
                         ocb < min(jcp.nb_oc, ocb_l2 + jcp.nb_oc_L2); ++ocb) {
@@ -879,7 +943,7 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
                         jit_conv_3d_ker_pipeline(kernel_->jit_ker, par_conv,
                                 diff_src_w + ij * diff_src_h_stride,
                                 diff_dst_w + oj * diff_dst_h_stride,
-                                wht_w + k_lo * wht_h_stride, 0, ocb, k_len,
+                                wht_w + k_lo * wht_h_stride, bias_w, ocb, k_len,
                                 d_len);
                     }
                     diff_dst_w += diff_dst_c_stride;
@@ -125,13 +125,15 @@ struct jit_avx512_common_convolution_bwd_data_t : public primitive_impl_t {
                     && set_default_alg_kind(alg_kind::convolution_direct)
                     && expect_data_types(diff_src_type, wei_type,
                             data_type::undef, diff_dst_type, data_type::undef)
-                    && !has_zero_dim_memory() && set_default_formats();
+                    && !has_zero_dim_memory() && set_default_formats()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops);
             if (!ok) return status::unimplemented;
 
             status_t status
                     = jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
                             jcp_, *desc(), *diff_src_md(), *weights_md(),
-                            *diff_dst_md());
+                            *diff_dst_md(), *attr());
             if (status != status::success) return status;
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -141,6 +143,9 @@ struct jit_avx512_common_convolution_bwd_data_t : public primitive_impl_t {
             return status::success;
         }
 
+        virtual bool support_bias() const override { return jcp_.with_bias; }
+        virtual bool support_post_ops() const override { return true; }
+
         jit_conv_conf_t jcp_;
 
     protected:
@@ -175,10 +180,16 @@ struct jit_avx512_common_convolution_bwd_data_t : public primitive_impl_t {
             execute_backward_data_3d(ctx);
         else
             assert(false);
+
+        if (pd()->wants_zero_pad_diff_src())
+            ctx.memory(DNNL_ARG_DIFF_SRC)->zero_pad();
+
         return status::success;
     }
 
 private:
+    void prepare_padded_bias(const diff_src_data_t *&bias,
+            const memory_tracking::grantor_t &scratchpad) const;
     void execute_backward_data_1d(const exec_ctx_t &ctx) const;
     void execute_backward_data_2d(const exec_ctx_t &ctx) const;
     void execute_backward_data_3d(const exec_ctx_t &ctx) const;
@@ -295,6 +295,33 @@ void jit_avx512_core_bf16_1x1_conv_kernel::reduce_loop(
                 vmovups(ptr[rsp + broadcast_space], bcast_values);
             }
 #endif
+            if (!isa_has_bf16(jcp.isa) && jcp.prop_kind != backward_weights) {
+                // Without native vdpbf16ps the reduction is done in f32: each
+                // of the two vnni-packed halves is expanded once and then
+                // accumulated with plain FMAs, instead of emulating the bf16
+                // dot-product for every (i_load, i_ur) pair.
+                for (int h = 0; h < 2 && i_reduce + h < n_reduce; ++h) {
+                    for (int i_load = 0; i_load < load_loop_blk; ++i_load) {
+                        auto wei = vreg_load(i_load);
+                        if (h == 0) {
+                            vpslld(wei, load_ptr(i_reduce, i_load), 16);
+                        } else {
+                            vpsrld(wei, load_ptr(i_reduce, i_load), 16);
+                            vpslld(wei, wei, 16);
+                        }
+                    }
+                    for (int i_ur = 0; i_ur < ur; ++i_ur) {
+                        int offt = i_ur * jcp.reduce_loop_unroll + i_reduce + h;
+                        vpbroadcastw(vreg_bcast,
+                                ptr[aux_reg_bcast_data + jcp.typesize_in * offt]);
+                        vpslld(vreg_bcast, vreg_bcast, 16);
+                        for (int i_load = 0; i_load < load_loop_blk; ++i_load)
+                            vfmadd231ps(vreg_accum(i_load, i_ur),
+                                    vreg_load(i_load), vreg_bcast);
+                    }
+                }
+                continue;
+            }
             if (isa_has_bf16(jcp.isa)) {
                 for (int i_load = 0; i_load < load_loop_blk; ++i_load) {
 #ifdef BF16_CONV_1x1_BWD_W_JIT_KER_USES_PERMW_TRANSPOSITION
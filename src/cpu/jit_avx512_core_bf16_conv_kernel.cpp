@@ -74,25 +74,37 @@ void jit_avx512_core_bf16_fwd_kernel::prepare_output(int ur_w) {
         }
 }
 
-void jit_avx512_core_bf16_fwd_kernel::store_output(int ur_w) {
+void jit_avx512_core_bf16_fwd_kernel::store_output(
+        int ur_w, bool last_oc_block_flag) {
     Label store_label;
     if (!isa_has_bf16(jcp.isa)) bf16_emu_->init_vcvtneps2bf16();
 
+    auto vmm_mask = [&](const Zmm &zmm, bool mask_flag, bool store) {
+        return mask_flag ? (store ? zmm | ktail_mask : zmm | ktail_mask | T_z)
+                         : zmm;
+    };
+    auto ymm_mask = [&](const Ymm &ymm, bool mask_flag) {
+        return mask_flag ? ymm | ktail_mask : ymm;
+    };
+
     if (jcp.with_sum) {
         for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+            const bool mask_flag
+                    = last_oc_block_flag && k == jcp.nb_oc_blocking - 1;
             for (int j = 0; j < ur_w; j++) {
                 Zmm zmm = zmm_out(j, k);
                 size_t aux_output_offset = get_output_offset(j, k);
+                auto addr = make_safe_addr(
+                        reg_out, aux_output_offset, reg_out_long_offt);
                 if (jcp.dst_dt == data_type::bf16) {
-                    vpmovzxwd(zmm_prev_dst,
-                            make_safe_addr(reg_out, aux_output_offset,
-                                    reg_out_long_offt));
+                    vpmovzxwd(vmm_mask(zmm_prev_dst, mask_flag, false), addr);
                     vpslld(zmm_prev_dst, zmm_prev_dst, 16);
                     vaddps(zmm, zmm_prev_dst);
+                } else if (mask_flag) {
+                    vmovups(vmm_mask(zmm_prev_dst, mask_flag, false), addr);
+                    vaddps(zmm, zmm_prev_dst);
                 } else {
-                    vaddps(zmm,
-                            make_safe_addr(reg_out, aux_output_offset,
-                                    reg_out_long_offt));
+                    vaddps(zmm, addr);
                 }
             }
         }
@@ -101,16 +113,21 @@ void jit_avx512_core_bf16_fwd_kernel::store_output(int ur_w) {
     if (jcp.with_bias) {
         mov(reg_bias, ptr[param1 + GET_OFF(bias)]);
         for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+            const bool mask_flag
+                    = last_oc_block_flag && k == jcp.nb_oc_blocking - 1;
             int bias_offset = jcp.typesize_bia * k * jcp.oc_block;
+            auto bias_addr = EVEX_compress_addr(reg_bias, bias_offset);
             for (int j = 0; j < ur_w; j++) {
                 Zmm zmm = zmm_out(j, k);
                 if (jcp.bia_dt == data_type::bf16) {
-                    vpmovzxwd(zmm_bias,
-                            EVEX_compress_addr(reg_bias, bias_offset));
+                    vpmovzxwd(vmm_mask(zmm_bias, mask_flag, false), bias_addr);
                     vpslld(zmm_bias, zmm_bias, 16);
                     vaddps(zmm, zmm_bias);
+                } else if (mask_flag) {
+                    vmovups(vmm_mask(zmm_bias, mask_flag, false), bias_addr);
+                    vaddps(zmm, zmm_bias);
                 } else
-                    vaddps(zmm, EVEX_compress_addr(reg_bias, bias_offset));
+                    vaddps(zmm, bias_addr);
             }
         }
     }
@@ -128,24 +145,23 @@ void jit_avx512_core_bf16_fwd_kernel::store_output(int ur_w) {
 
     L(store_label);
     if (jcp.dst_dt == data_type::f32) {
-        for (int k = 0; k < jcp.nb_oc_blocking; k++)
+        for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+            const bool mask_flag
+                    = last_oc_block_flag && k == jcp.nb_oc_blocking - 1;
             for (int j = 0; j < ur_w; j++) {
                 Zmm zmm = zmm_out(j, k);
-                size_t aux_output_offset = jcp.typesize_out
-                        * ((size_t)k * jcp.od * jcp.oh * jcp.ow + j)
-                        * jcp.oc_block;
+                size_t aux_output_offset = get_output_offset(j, k);
                 auto addr = EVEX_compress_addr(reg_out, aux_output_offset);
 
-                vmovups(addr, zmm);
+                vmovups(addr, vmm_mask(zmm, mask_flag, true));
             }
+        }
     } else if (jcp.dst_dt == data_type::bf16) {
-        if (isa_has_bf16(jcp.isa)) {
+        if (isa_has_bf16(jcp.isa) && !is_dst_layout_nxc()) {
             for (int k = 0; k < jcp.nb_oc_blocking; k++) {
                 int n_2bf2ps = (ur_w / 2) * 2, j = 0;
                 for (j = 0; j < n_2bf2ps; j += 2) {
-                    size_t aux_output_offset = jcp.typesize_out
-                            * ((size_t)k * jcp.od * jcp.oh * jcp.ow + j)
-                            * jcp.oc_block;
+                    size_t aux_output_offset = get_output_offset(j, k);
                     auto addr = EVEX_compress_addr(reg_out, aux_output_offset);
 
                     auto zmm_str = zmm_inp(j, jcp.nb_oc_blocking);
@@ -153,9 +169,7 @@ void jit_avx512_core_bf16_fwd_kernel::store_output(int ur_w) {
                     vmovups(addr, zmm_str);
                 }
                 if (j < ur_w) {
-                    size_t aux_output_offset = jcp.typesize_out
-                            * ((size_t)k * jcp.od * jcp.oh * jcp.ow + j)
-                            * jcp.oc_block;
+                    size_t aux_output_offset = get_output_offset(j, k);
                     auto addr = EVEX_compress_addr(reg_out, aux_output_offset);
                     auto ymm_str = ymm_inp(j, jcp.nb_oc_blocking);
                     vcvtneps2bf16(ymm_str, zmm_out(j, k));
@@ -163,54 +177,35 @@ void jit_avx512_core_bf16_fwd_kernel::store_output(int ur_w) {
                 }
             }
         } else {
-            for (int k = 0; k < jcp.nb_oc_blocking; k++)
+            // With the channels-last layout the output points are not
+            // adjacent, so every vector is converted and stored separately
+            for (int k = 0; k < jcp.nb_oc_blocking; k++) {
+                const bool mask_flag
+                        = last_oc_block_flag && k == jcp.nb_oc_blocking - 1;
                 for (int j = 0; j < ur_w; j++) {
                     Zmm zmm = zmm_out(j, k);
-                    size_t aux_output_offset = jcp.typesize_out
-                            * ((size_t)k * jcp.od * jcp.oh * jcp.ow + j)
-                            * jcp.oc_block;
+                    size_t aux_output_offset = get_output_offset(j, k);
                     auto addr = EVEX_compress_addr(reg_out, aux_output_offset);
                     Ymm ymm = ymm_inp(0, jcp.nb_oc_blocking);
-                    bf16_emu_->vcvtneps2bf16(ymm, zmm);
-                    vmovups(addr, ymm);
+                    if (isa_has_bf16(jcp.isa))
+                        vcvtneps2bf16(ymm, zmm);
+                    else
+                        bf16_emu_->vcvtneps2bf16(ymm, zmm);
+                    vmovdqu16(addr, ymm_mask(ymm, mask_flag));
                 }
+            }
         }
     } else
         assert(!"unsupported destination type");
 }
 
-void jit_avx512_core_bf16_fwd_kernel::compute_loop(
-        int ur_w, int pad_l, int pad_r) {
-    Label kh_label, kd_label;
+void jit_avx512_core_bf16_fwd_kernel::compute_ic_block(
+        int ur_w, int pad_l, int pad_r, int ic_step) {
+    Label kh_label, kd_label, skip_kh_loop;
     const size_t shift_kernel_ptr
             = (size_t)jcp.typesize_in * jcp.kw * jcp.oc_block * jcp.ic_block;
     const size_t shift_input_ptr = (size_t)jcp.typesize_in * (jcp.dilate_h + 1)
-            * jcp.iw * jcp.ic_block;
-
-    prepare_output(ur_w);
-
-    Label skip_compute_loop;
-    if (jcp.ndims == 5) {
-        mov(reg_kj, ptr[param1 + GET_OFF(kd_padding)]);
-        if ((jcp.dilate_d >= jcp.id)
-                || (jcp.kd - 1) * (jcp.dilate_d + 1)
-                        < nstl::max(jcp.f_pad, jcp.back_pad)) {
-            cmp(reg_kj, 0);
-            je(skip_compute_loop, T_NEAR);
-        }
-    }
-    mov(reg_kj, reg_kh);
-    if ((jcp.kh - 1) * (jcp.dilate_h + 1) < nstl::max(jcp.t_pad, jcp.b_pad)) {
-        cmp(reg_kj, 0);
-        je(skip_compute_loop, T_NEAR);
-    }
-
-    // IC loop
-    Label icb_label;
-    mov(reg_icb, jcp.nb_ic);
-    L(icb_label);
-
-    Label skip_kh_loop;
+            * jcp.iw * get_src_w_stride();
 
     if (jcp.ndims == 5) {
         push(reg_out);
@@ -239,12 +234,47 @@ void jit_avx512_core_bf16_fwd_kernel::compute_loop(
         for (int ki = 0; ki < jcp.kw; ki++) {
             int ow_start = get_ow_start(ki, pad_l);
             int ow_end = get_ow_end(ur_w, ki, pad_r);
-            for (int ic = 0; ic < div_up(nstl::min(jcp.ic_block, jcp.ic), 2);
-                    ic++) {
+            if (!isa_has_bf16(jcp.isa)) {
+                // Without native vdpbf16ps every input channel is expanded
+                // to f32 once and accumulated with a plain FMA, which is
+                // cheaper than emulating the bf16 dot-product per pair.
+                for (int ic = 0; ic < ic_step; ic++) {
+                    for (int oi = ow_start; oi < ow_end; oi++) {
+                        size_t input_offset
+                                = get_input_offset(ki, ic / 2, oi, pad_l)
+                                + (ic % 2) * jcp.typesize_in;
+                        auto inp = zmm_inp(oi, jcp.nb_oc_blocking);
+                        vpbroadcastw(inp, ptr[aux_reg_inp + input_offset]);
+                        vpslld(inp, inp, 16);
+                    }
+                    for (int kk = 0; kk < jcp.nb_oc_blocking; kk++) {
+                        size_t kernel_offset
+                                = get_kernel_offset(ki, ic / 2, kk, 0);
+                        load_bf16_half_as_f32(zmm_wei,
+                                EVEX_compress_addr(aux_reg_ker, kernel_offset),
+                                ic % 2);
+                        for (int oi = ow_start; oi < ow_end; oi++)
+                            vfmadd231ps(zmm_out(oi, kk), zmm_wei,
+                                    zmm_inp(oi, jcp.nb_oc_blocking));
+                    }
+                }
+                continue;
+            }
+            for (int ic = 0; ic < div_up(ic_step, 2); ic++) {
+                // An odd channel tail must not touch the element past the
+                // last channel: load a single value and zero the odd half
+                const bool odd_tail = ic_step % 2 != 0 && 2 * ic + 1 == ic_step;
                 for (int oi = ow_start; oi < ow_end; oi++) {
                     size_t input_offset = get_input_offset(ki, ic, oi, pad_l);
-                    vpbroadcastd(zmm_inp(oi, jcp.nb_oc_blocking),
-                            EVEX_compress_addr(aux_reg_inp, input_offset));
+                    auto inp = zmm_inp(oi, jcp.nb_oc_blocking);
+                    if (odd_tail) {
+                        vpbroadcastw(inp, ptr[aux_reg_inp + input_offset]);
+                        vpslld(inp, inp, 16);
+                        vpsrld(inp, inp, 16);
+                    } else {
+                        vpbroadcastd(inp,
+                                EVEX_compress_addr(aux_reg_inp, input_offset));
+                    }
                 }
                 for (int kk = 0; kk < jcp.nb_oc_blocking; kk++) {
                     size_t kernel_offset = get_kernel_offset(ki, ic, kk, 0);
@@ -272,7 +302,7 @@ void jit_avx512_core_bf16_fwd_kernel::compute_loop(
     if (jcp.ndims == 5) {
         add(aux_reg_inp_d,
                 jcp.typesize_in * (jcp.dilate_d + 1) * jcp.ih * jcp.iw
-                        * jcp.ic_block);
+                        * get_src_w_stride());
         add(aux_reg_ker_d,
                 jcp.typesize_in * jcp.kw * jcp.kh * jcp.oc_block
                         * jcp.ic_block);
@@ -285,9 +315,56 @@ void jit_avx512_core_bf16_fwd_kernel::compute_loop(
     }
 
     L(skip_kh_loop);
+}
+
+void jit_avx512_core_bf16_fwd_kernel::compute_loop(
+        int ur_w, int pad_l, int pad_r) {
+    prepare_output(ur_w);
+
+    Label skip_compute_loop;
+    if (jcp.ndims == 5) {
+        mov(reg_kj, ptr[param1 + GET_OFF(kd_padding)]);
+        if ((jcp.dilate_d >= jcp.id)
+                || (jcp.kd - 1) * (jcp.dilate_d + 1)
+                        < nstl::max(jcp.f_pad, jcp.back_pad)) {
+            cmp(reg_kj, 0);
+            je(skip_compute_loop, T_NEAR);
+        }
+    }
+    mov(reg_kj, reg_kh);
+    if ((jcp.kh - 1) * (jcp.dilate_h + 1) < nstl::max(jcp.t_pad, jcp.b_pad)) {
+        cmp(reg_kj, 0);
+        je(skip_compute_loop, T_NEAR);
+    }
+
+    // IC loop
+    const int ic_tail = is_src_layout_nxc()
+            ? jcp.ic_without_padding % jcp.ic_block
+            : 0;
+    Label icb_label;
+    mov(reg_icb, jcp.nb_ic);
+    L(icb_label);
+
+    if (ic_tail) {
+        Label ic_tail_label, icb_done_label;
+        cmp(reg_icb, 1); // last ic block?
+        je(ic_tail_label, T_NEAR);
+
+        compute_ic_block(ur_w, pad_l, pad_r, jcp.ic_block);
+        jmp(icb_done_label, T_NEAR);
+
+        L(ic_tail_label);
+        compute_ic_block(ur_w, pad_l, pad_r, ic_tail);
+
+        L(icb_done_label);
+    } else {
+        compute_ic_block(ur_w, pad_l, pad_r, jcp.ic_block);
+    }
 
     // End of IC Loop
-    size_t inp_step = (size_t)jcp.id * jcp.ih * jcp.iw * jcp.ic_block;
+    size_t inp_step = is_src_layout_nxc()
+            ? (size_t)jcp.ic_block
+            : (size_t)jcp.id * jcp.ih * jcp.iw * jcp.ic_block;
     size_t ker_step
             = (size_t)jcp.kd * jcp.kh * jcp.kw * jcp.oc_block * jcp.ic_block;
     add(reg_inp, jcp.typesize_in * inp_step);
@@ -301,7 +378,24 @@ void jit_avx512_core_bf16_fwd_kernel::compute_loop(
     sub(reg_ker, jcp.typesize_in * ker_step * jcp.nb_ic);
 
     L(skip_compute_loop);
-    store_output(ur_w);
+    const bool oc_tail = is_dst_layout_nxc()
+            && jcp.oc_without_padding % jcp.oc_block != 0;
+    if (oc_tail) {
+        Label common_store_label, store_done_label;
+        cmp(qword[param1 + GET_OFF(oc_blocks)],
+                jcp.nb_oc - jcp.nb_oc_blocking);
+        jne(common_store_label, T_NEAR);
+
+        store_output(ur_w, true); // last oc block
+        jmp(store_done_label, T_NEAR);
+
+        L(common_store_label);
+        store_output(ur_w, false);
+
+        L(store_done_label);
+    } else {
+        store_output(ur_w, false);
+    }
 }
 
 void jit_avx512_core_bf16_fwd_kernel::generate() {
@@ -316,10 +410,10 @@ void jit_avx512_core_bf16_fwd_kernel::generate() {
     int dilate_w = jcp.dilate_w + 1;
     int stride_w = jcp.stride_w;
 
-    int inp_mult = jcp.ic_block;
+    int inp_mult = get_src_w_stride();
 
     size_t inp_shift = (size_t)jcp.typesize_in * ur_w * stride_w * inp_mult;
-    size_t out_shift = (size_t)jcp.typesize_out * ur_w * jcp.oc_block;
+    size_t out_shift = (size_t)jcp.typesize_out * ur_w * get_dst_w_stride();
 
     int inp_shift_pad = jcp.typesize_in * (ur_w * stride_w - l_pad) * inp_mult;
     int inp_shift_pad_second_block = -1 * jcp.typesize_in * l_pad * inp_mult;
@@ -330,6 +424,14 @@ void jit_avx512_core_bf16_fwd_kernel::generate() {
     mov(reg_ker, ptr[param1 + GET_OFF(filt)]);
     mov(reg_kh, ptr[param1 + GET_OFF(kh_padding)]);
 
+    if (is_dst_layout_nxc() && jcp.oc_without_padding % jcp.oc_block != 0) {
+        int tail_size = jcp.oc_without_padding % jcp.oc_block;
+        int mask = (1 << tail_size) - 1;
+        Reg32 regw_tmp = reg_oi.cvt32();
+        mov(regw_tmp, mask);
+        kmovw(ktail_mask, regw_tmp);
+    }
+
     int r_pad = nstl::max(
             0, (ow - 1) * stride_w + (kw - 1) * dilate_w - (iw + l_pad - 1));
     int n_oi = ow / ur_w;
@@ -567,17 +669,25 @@ status_t jit_avx512_core_bf16_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
 
     const int simd_w = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
 
-    auto dat_tag = utils::pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
+    auto dat_tag_blk = utils::pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
+    auto dat_tag_nxc = utils::pick(ndims - 3, nwc, nhwc, ndhwc);
     auto wei_tag
             = utils::pick(2 * ndims - 6 + with_groups, OIw8i16o2i, gOIw8i16o2i,
                     OIhw8i16o2i, gOIhw8i16o2i, OIdhw8i16o2i, gOIdhw8i16o2i);
 
-    jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
-    jcp.dst_tag = dst_d.matches_one_of_tag(dat_tag);
+    jcp.src_tag = src_d.matches_one_of_tag(dat_tag_blk, dat_tag_nxc);
+    jcp.dst_tag = dst_d.matches_one_of_tag(dat_tag_blk, dat_tag_nxc);
     jcp.wei_tag = weights_d.matches_one_of_tag(wei_tag);
 
+    // Channels-last data is read and written in place, with the channel
+    // tails handled in the kernel; weights stay blocked
+    const bool is_data_layout_nxc
+            = jcp.src_tag == dat_tag_nxc && jcp.dst_tag == dat_tag_nxc;
+    auto dat_tag = is_data_layout_nxc ? dat_tag_nxc : dat_tag_blk;
+
     jcp.oc_block = simd_w;
     jcp.ic_block = simd_w;
+    jcp.ic_without_padding = jcp.ic;
     jcp.aligned_threads = 0;
 
     bool ok_to_pad_channels = jcp.ngroups == 1;
@@ -591,8 +701,10 @@ status_t jit_avx512_core_bf16_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
             && jcp.ic % jcp.ic_block == 0;
     if (!args_ok) return status::unimplemented;
 
-    args_ok = true && jcp.ic <= src_d.padded_dims()[1]
-            && jcp.oc <= dst_d.padded_dims()[1]
+    args_ok = true
+            && IMPLICATION(!is_data_layout_nxc,
+                    jcp.ic <= src_d.padded_dims()[1]
+                            && jcp.oc <= dst_d.padded_dims()[1])
             && jcp.ic <= weights_d.padded_dims()[with_groups + 1]
             && jcp.oc <= weights_d.padded_dims()[with_groups + 0];
     if (!args_ok) return status::unimplemented;
@@ -671,6 +783,55 @@ void jit_avx512_core_bf16_bwd_data_kernel::prepare_output(int ur_w) {
 }
 
 void jit_avx512_core_bf16_bwd_data_kernel::store_output(int ur_w) {
+    // all the oc blocks are reduced in a single call, so the bias and the
+    // post-ops are applied to the final result as is
+    auto diff_src_addr = [=](int j, int k) {
+        size_t aux_diff_src_offset = jcp.typesize_out
+                * ((size_t)k * jcp.id * jcp.ih * jcp.iw + j) * jcp.ic_block;
+        return EVEX_compress_addr(reg_src, aux_diff_src_offset);
+    };
+
+    if (jcp.with_sum) {
+        for (int k = 0; k < jcp.nb_ic_blocking; k++)
+            for (int j = 0; j < ur_w; j++) {
+                Zmm zmm = zmm_out(j, k);
+                if (jcp.dst_dt == data_type::bf16) {
+                    vpmovzxwd(zmm_tmp, diff_src_addr(j, k));
+                    vpslld(zmm_tmp, zmm_tmp, 16);
+                    vaddps(zmm, zmm_tmp);
+                } else
+                    vaddps(zmm, diff_src_addr(j, k));
+            }
+    }
+
+    if (jcp.with_bias) {
+        mov(reg_bias, ptr[param + GET_OFF(bias)]);
+        for (int k = 0; k < jcp.nb_ic_blocking; k++) {
+            int bias_offset = jcp.typesize_bia * k * jcp.ic_block;
+            auto bias_addr = EVEX_compress_addr(reg_bias, bias_offset);
+            for (int j = 0; j < ur_w; j++) {
+                Zmm zmm = zmm_out(j, k);
+                if (jcp.bia_dt == data_type::bf16) {
+                    vpmovzxwd(zmm_tmp, bias_addr);
+                    vpslld(zmm_tmp, zmm_tmp, 16);
+                    vaddps(zmm, zmm_tmp);
+                } else
+                    vaddps(zmm, bias_addr);
+            }
+        }
+    }
+
+    if (jcp.with_eltwise) {
+        if (ur_w == jcp.ur_w) {
+            eltwise_injector_->compute_vector_range(
+                    0, jcp.nb_ic_blocking * jcp.ur_w);
+        } else {
+            for (int k = 0; k < jcp.nb_ic_blocking; k++)
+                eltwise_injector_->compute_vector_range(
+                        k * jcp.ur_w, k * jcp.ur_w + ur_w);
+        }
+    }
+
     if (!isa_has_bf16(jcp.isa)) bf16_emu_->init_vcvtneps2bf16();
 
     if (jcp.dst_dt == data_type::f32) {
@@ -799,6 +960,32 @@ void jit_avx512_core_bf16_bwd_data_kernel::compute_loop(
                     || jj_end
                             == ur_w - nstl::max(0, r_overflow - ki * dilate_w));
 
+            if (!isa_has_bf16(jcp.isa)) {
+                // See the forward kernel: expand to f32 and use plain FMAs
+                for (int oc = 0; oc < nstl::min(oc_block, jcp.oc); oc++) {
+                    for (int jj = jj_start; jj < jj_end; jj += stride_w) {
+                        size_t aux_dst_offset = jcp.typesize_in
+                                * ((jj + jcp.l_pad - ki * dilate_w) / stride_w
+                                                * oc_block
+                                        + oc);
+                        auto inp = zmm_inp(jj / stride_w);
+                        vpbroadcastw(inp, ptr[aux_reg_dst + aux_dst_offset]);
+                        vpslld(inp, inp, 16);
+                    }
+                    for (int kk = 0; kk < jcp.nb_ic_blocking; kk++) {
+                        size_t aux_kernel_offset
+                                = kernel_offset(kk, 2 * (oc / 2), ki);
+                        load_bf16_half_as_f32(zmm_wei,
+                                EVEX_compress_addr(
+                                        aux_reg_ker, aux_kernel_offset),
+                                oc % 2);
+                        for (int jj = jj_start; jj < jj_end; jj += stride_w)
+                            vfmadd231ps(zmm_out(jj, kk), zmm_wei,
+                                    zmm_inp(jj / stride_w));
+                    }
+                }
+                continue;
+            }
             for (int oc = 0; oc < div_up(nstl::min(oc_block, jcp.oc), 2);
                     oc++) {
                 for (int jj = jj_start; jj < jj_end; jj += stride_w) {
@@ -935,12 +1122,41 @@ void jit_avx512_core_bf16_bwd_data_kernel::generate() {
     }
 
     postamble();
+
+    if (jcp.with_eltwise) eltwise_injector_->prepare_table();
+}
+
+bool jit_avx512_core_bf16_bwd_data_kernel::post_ops_ok(
+        jit_conv_conf_t &jcp, const primitive_attr_t &attr) {
+    const auto &p = attr.post_ops_;
+
+    auto is_eltwise = [&](int idx) { return p.entry_[idx].is_eltwise(); };
+    // diff_src is accumulated as is, so the sum may not be scaled
+    auto is_sum = [&](int idx) {
+        return p.entry_[idx].is_sum() && p.entry_[idx].sum.scale == 1.f;
+    };
+
+    switch (p.len_) {
+        case 0: return true; // no post_ops
+        case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+        case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+        default: return false;
+    }
+
+    return false;
+}
+
+void jit_avx512_core_bf16_bwd_data_kernel::init_scratchpad(
+        memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp) {
+    using namespace memory_tracking::names;
+    if (jcp.with_bias && jcp.ic != jcp.ic_without_padding)
+        scratchpad.book(key_conv_padded_bias, jcp.typesize_bia * jcp.ic);
 }
 
 status_t jit_avx512_core_bf16_bwd_data_kernel::init_conf(jit_conv_conf_t &jcp,
         const convolution_desc_t &cd, const memory_desc_wrapper &diff_src_d,
         const memory_desc_wrapper &weights_d,
-        const memory_desc_wrapper &diff_dst_d) {
+        const memory_desc_wrapper &diff_dst_d, const primitive_attr_t &attr) {
     const int simd_w = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
     const bool with_groups = weights_d.ndims() == diff_src_d.ndims() + 1;
     int ndims = diff_src_d.ndims();
@@ -957,6 +1173,7 @@ status_t jit_avx512_core_bf16_bwd_data_kernel::init_conf(jit_conv_conf_t &jcp,
     jcp.oc = diff_dst_d.dims()[1] / jcp.ngroups;
     jcp.oc_without_padding = jcp.oc;
     jcp.ic = diff_src_d.dims()[1] / jcp.ngroups;
+    jcp.ic_without_padding = jcp.ic;
 
     jcp.id = (ndims == 5) ? diff_src_d.dims()[2] : 1;
     jcp.ih = (ndims == 3) ? 1 : diff_src_d.dims()[ndims - 2];
@@ -988,6 +1205,22 @@ status_t jit_avx512_core_bf16_bwd_data_kernel::init_conf(jit_conv_conf_t &jcp,
             || (jcp.dilate_h != 0 && jcp.stride_h != 1))
         return status::unimplemented;
 
+    // the bias and the post-ops are applied to diff_src, as needed by the
+    // deconvolution that is computed as a backward data convolution
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef
+            && utils::one_of(cd.bias_desc.data_type, data_type::f32,
+                    data_type::bf16);
+    jcp.bia_dt = jcp.with_bias ? cd.bias_desc.data_type : data_type::undef;
+    jcp.typesize_bia = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+
+    if (!post_ops_ok(jcp, attr)) return status::unimplemented;
+
+    const auto &p = attr.post_ops_;
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    const int eltwise_ind = p.find(primitive_kind::eltwise);
+    jcp.with_eltwise = eltwise_ind != -1;
+    if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
+
     jcp.r_pad = (jcp.ow - 1) * jcp.stride_w + (jcp.kw - 1) * (jcp.dilate_w + 1)
             - (jcp.iw + jcp.l_pad - 1);
     jcp.b_pad = (jcp.oh - 1) * jcp.stride_h + (jcp.kh - 1) * (jcp.dilate_h + 1)
@@ -128,6 +128,8 @@ private:
     Xbyak::Zmm zmm_prev_dst = Xbyak::Zmm(31);
     Xbyak::Zmm zmm_bias = Xbyak::Zmm(31);
 
+    Xbyak::Opmask ktail_mask = Xbyak::Opmask(2);
+
     Xbyak::Zmm bf16_emu_reserv_1 = Xbyak::Zmm(26);
     Xbyak::Zmm bf16_emu_reserv_2 = Xbyak::Zmm(27);
     Xbyak::Zmm bf16_emu_reserv_3 = Xbyak::Zmm(28);
@@ -139,20 +141,54 @@ private:
     bf16_emulation_t *bf16_emu_;
 
     inline void prepare_output(int ur_w);
-    inline void store_output(int ur_w);
+    inline void store_output(int ur_w, bool last_oc_block_flag);
+    inline void compute_ic_block(int ur_w, int pad_l, int pad_r, int ic_step);
     inline void compute_loop(int ur_w, int pad_l, int pad_r);
 
+    /* Loads the even (half == 0) or odd (half == 1) bf16 elements of a
+     * vnni-packed vector and expands them to f32 */
+    void load_bf16_half_as_f32(
+            const Xbyak::Zmm &zmm, const Xbyak::Address &addr, int half) {
+        if (half == 0) {
+            vpslld(zmm, addr, 16);
+        } else {
+            vpsrld(zmm, addr, 16);
+            vpslld(zmm, zmm, 16);
+        }
+    }
+
     void generate();
 
+    bool is_src_layout_nxc() const {
+        return utils::one_of(jcp.src_tag, format_tag::nwc, format_tag::nhwc,
+                format_tag::ndhwc);
+    }
+    bool is_dst_layout_nxc() const {
+        return utils::one_of(jcp.dst_tag, format_tag::nwc, format_tag::nhwc,
+                format_tag::ndhwc);
+    }
+
+    /* distance (in elements) between two consecutive points along w */
+    size_t get_src_w_stride() const {
+        return is_src_layout_nxc() ? (size_t)jcp.ngroups * jcp.ic_without_padding
+                                   : (size_t)jcp.ic_block;
+    }
+    size_t get_dst_w_stride() const {
+        return is_dst_layout_nxc() ? (size_t)jcp.ngroups * jcp.oc_without_padding
+                                   : (size_t)jcp.oc_block;
+    }
+
     size_t get_output_offset(int oi, int n_oc_block) {
+        size_t ocb_str = is_dst_layout_nxc()
+                ? (size_t)jcp.oc_block
+                : (size_t)jcp.od * jcp.oh * jcp.ow * jcp.oc_block;
         return (size_t)jcp.typesize_out
-                * ((size_t)n_oc_block * jcp.oh * jcp.ow * jcp.od + oi)
-                * jcp.oc_block;
+                * ((size_t)n_oc_block * ocb_str + oi * get_dst_w_stride());
     }
 
     size_t get_input_offset(int ki, int ic, int oi, int pad_l) {
         size_t scale = 2; //bf16 vnni is used
-        size_t iw_str = jcp.ic_block;
+        size_t iw_str = get_src_w_stride();
         size_t ic_str = 1;
         return (size_t)jcp.typesize_in
                 * ((size_t)(ki * (jcp.dilate_w + 1) + oi * jcp.stride_w - pad_l)
@@ -186,7 +222,13 @@ private:
 struct jit_avx512_core_bf16_bwd_data_kernel : public jit_generator {
 
     jit_avx512_core_bf16_bwd_data_kernel(const jit_conv_conf_t &ajcp)
-        : jit_generator(nullptr, ker_code_size), jcp(ajcp), bf16_emu_(nullptr) {
+        : jit_generator(nullptr, ker_code_size)
+        , jcp(ajcp)
+        , eltwise_injector_(nullptr)
+        , bf16_emu_(nullptr) {
+        if (jcp.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
+                    this, jcp.eltwise);
         if (!isa_has_bf16(jcp.isa))
             bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
                     bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
@@ -195,14 +237,21 @@ struct jit_avx512_core_bf16_bwd_data_kernel : public jit_generator {
         jit_ker = (decltype(jit_ker))getCode();
     }
 
-    ~jit_avx512_core_bf16_bwd_data_kernel() { delete bf16_emu_; }
+    ~jit_avx512_core_bf16_bwd_data_kernel() {
+        delete eltwise_injector_;
+        delete bf16_emu_;
+    }
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_bf16_bwd_data_kernel_f32)
 
+    static bool post_ops_ok(jit_conv_conf_t &jcp, const primitive_attr_t &attr);
     static status_t init_conf(jit_conv_conf_t &jcp,
             const convolution_desc_t &cd, const memory_desc_wrapper &diff_src_d,
             const memory_desc_wrapper &weights_d,
-            const memory_desc_wrapper &diff_dst_d);
+            const memory_desc_wrapper &diff_dst_d,
+            const primitive_attr_t &attr);
+    static void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+            const jit_conv_conf_t &jcp);
 
     const jit_conv_conf_t &jcp;
     void (*jit_ker)(jit_conv_call_s *);
@@ -231,6 +280,7 @@ private:
     reg64_t reg_kh = abi_not_param1;
 
     reg64_t reg_ocb = r11;
+    reg64_t reg_bias = reg_ocb; // used in store_output only
 
     Xbyak::Zmm zmm_inp(int i_ic) {
         int idx = i_ic + jcp.nb_ic_blocking * jcp.ur_w;
@@ -258,11 +308,26 @@ private:
     Xbyak::Zmm bf16_emu_reserv_5 = Xbyak::Zmm(30);
 
     Xbyak::Zmm zmm_wei = Xbyak::Zmm(31);
+    Xbyak::Zmm zmm_tmp = zmm_wei; // used in store_output only
+
+    jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
     bf16_emulation_t *bf16_emu_;
 
     inline void prepare_output(int ur_w);
     inline void store_output(int ur_w);
     inline void compute_loop(int ur_w, int l_overflow, int r_overflow);
+
+    /* Loads the even (half == 0) or odd (half == 1) bf16 elements of a
+     * vnni-packed vector and expands them to f32 */
+    void load_bf16_half_as_f32(
+            const Xbyak::Zmm &zmm, const Xbyak::Address &addr, int half) {
+        if (half == 0) {
+            vpslld(zmm, addr, 16);
+        } else {
+            vpsrld(zmm, addr, 16);
+            vpslld(zmm, zmm, 16);
+        }
+    }
     void generate();
 
     int get_iw_start(int ki, int l_overflow) {
@@ -66,6 +66,10 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_1d(
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = kernel_->jcp;
+    const bool is_src_layout_nxc = utils::one_of(jcp.src_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+    const bool is_dst_layout_nxc = utils::one_of(jcp.dst_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
@@ -100,14 +104,17 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_1d(
             int g_ocb = g * jcp.nb_oc + ocb;
             int g_oc = g_ocb * jcp.oc_block;
             int g_icb = g * jcp.nb_ic;
+            // channels-last data is addressed by channel, not by block
+            int src_c = is_src_layout_nxc ? g_icb * jcp.ic_block : g_icb;
+            int dst_c = is_dst_layout_nxc ? g_oc : g_ocb;
 
             int ow_s = owb * jcp.ow_block;
             int iw_s = ow_s * jcp.stride_w;
 
             auto bias_w = bias ? bias + g_oc * bia_dt_size : nullptr;
 
-            auto dst_w = dst + jcp.typesize_out * dst_d.blk_off(n, g_ocb, ow_s);
-            auto src_w = src + src_d.blk_off(n, g_icb, iw_s);
+            auto dst_w = dst + jcp.typesize_out * dst_d.blk_off(n, dst_c, ow_s);
+            auto src_w = src + src_d.blk_off(n, src_c, iw_s);
             auto wht_w = weights + wht_blk_off(weights_d, g, ocb);
 
             par_conv.src = src_w;
@@ -115,6 +122,7 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_1d(
             par_conv.filt = wht_w;
             par_conv.bias = bias_w;
             par_conv.owb = owb;
+            par_conv.oc_blocks = ocb;
             kernel_->jit_ker(&par_conv);
 
             if (jcp.loop_order == loop_cwgn) {
@@ -147,6 +155,10 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_2d(
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = kernel_->jcp;
+    const bool is_src_layout_nxc = utils::one_of(jcp.src_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+    const bool is_dst_layout_nxc = utils::one_of(jcp.dst_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
@@ -184,6 +196,9 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_2d(
             int g_ocb = g * jcp.nb_oc + ocb;
             int g_oc = g_ocb * jcp.oc_block;
             int g_icb = g * jcp.nb_ic;
+            // channels-last data is addressed by channel, not by block
+            int src_c = is_src_layout_nxc ? g_icb * jcp.ic_block : g_icb;
+            int dst_c = is_dst_layout_nxc ? g_oc : g_ocb;
 
             int work_rem = end - start;
             int ih_s = -jcp.t_pad + oh_s * jcp.stride_h;
@@ -194,8 +209,8 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_2d(
             auto bias_w = bias ? bias + bia_dt_size * g_oc : nullptr;
 
             auto dst_w = dst
-                    + jcp.typesize_out * dst_d.blk_off(n, g_ocb, oh_s, ow_s);
-            auto src_w = src + src_d.blk_off(n, g_icb, ih_s, iw_s);
+                    + jcp.typesize_out * dst_d.blk_off(n, dst_c, oh_s, ow_s);
+            auto src_w = src + src_d.blk_off(n, src_c, ih_s, iw_s);
             auto wht_w = weights + wht_blk_off(weights_d, g, ocb, 0);
 
             for (int oj = oh_s, ij = ih_s; oj < oh_e;
@@ -216,6 +231,7 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_2d(
                 par_conv.bias = bias_w;
                 par_conv.kh_padding = kh_padding;
                 par_conv.owb = owb;
+                par_conv.oc_blocks = ocb;
                 kernel_->jit_ker(&par_conv);
 
                 src_w += src_h_stride * jcp.stride_h;
@@ -249,6 +265,10 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_3d(
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
 
     const auto &jcp = kernel_->jcp;
+    const bool is_src_layout_nxc = utils::one_of(jcp.src_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+    const bool is_dst_layout_nxc = utils::one_of(jcp.dst_tag,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
@@ -289,6 +309,9 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_3d(
             int g_ocb = g * jcp.nb_oc + ocb;
             int g_oc = g_ocb * jcp.oc_block;
             int g_icb = g * jcp.nb_ic;
+            // channels-last data is addressed by channel, not by block
+            int src_c = is_src_layout_nxc ? g_icb * jcp.ic_block : g_icb;
+            int dst_c = is_dst_layout_nxc ? g_oc : g_ocb;
 
             int work_rem = end - start;
             int ih_s = -jcp.t_pad + oh_s * jcp.stride_h;
@@ -308,8 +331,8 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_3d(
 
             auto dst_w = dst
                     + jcp.typesize_out
-                            * dst_d.blk_off(n, g_ocb, od_s, oh_s, ow_s);
-            auto src_w = src + src_d.blk_off(n, g_icb, id_s, ih_s, iw_s)
+                            * dst_d.blk_off(n, dst_c, od_s, oh_s, ow_s);
+            auto src_w = src + src_d.blk_off(n, src_c, id_s, ih_s, iw_s)
                     + d_t_overflow * dilate_d * src_d_stride;
             auto wht_w = weights + wht_blk_off(weights_d, g, ocb, 0)
                     + d_t_overflow * wht_d_stride;
@@ -333,6 +356,7 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_3d(
                 par_conv.kh_padding = kh_padding;
                 par_conv.kd_padding = kd_padding;
                 par_conv.owb = owb;
+                par_conv.oc_blocks = ocb;
                 kernel_->jit_ker(&par_conv);
 
                 src_w += src_h_stride * jcp.stride_h;
@@ -350,12 +374,29 @@ void jit_avx512_core_bf16_convolution_fwd_t::execute_forward_3d(
     });
 }
 
+void jit_avx512_core_bf16_convolution_bwd_data_t ::prepare_padded_bias(
+        const char *&bias, const memory_tracking::grantor_t &scratchpad) const {
+    const auto &jcp = pd()->jcp_;
+    if (!jcp.with_bias || jcp.ic == jcp.ic_without_padding) return;
+
+    const size_t bia_dt_size = jcp.typesize_bia;
+    auto padded_bias = scratchpad.template get<char>(
+            memory_tracking::names::key_conv_padded_bias);
+    utils::array_copy(padded_bias, bias, bia_dt_size * jcp.ic_without_padding);
+    utils::array_set(padded_bias + bia_dt_size * jcp.ic_without_padding, 0,
+            bia_dt_size * (jcp.ic - jcp.ic_without_padding));
+    bias = padded_bias;
+}
+
 void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data_3d(
         const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -438,6 +479,9 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data_3d(
                     + jcp.typesize_out * diff_src_d.blk_off(n, g_icb, id_s);
             auto diff_dst_w = diff_dst + diff_dst_d.blk_off(n, g_ocb, od_s);
             auto wht_w = weights + wht_blk_off(weights_d, g, 0, icb, kd_lo);
+            auto bias_w = jcp.with_bias
+                    ? bias + jcp.typesize_bia * g_icb * jcp.ic_block
+                    : nullptr;
 
             for (int ij = ih_s; ij < ih_e; ++ij) {
                 int oj, kh_len, kh_lo;
@@ -483,6 +527,7 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data_3d(
                 par_conv.filt = wht_w + kh_lo * wht_h_stride;
                 par_conv.kh_padding = kh_len;
                 par_conv.kd_padding = kd_len;
+                par_conv.bias = bias_w;
 
                 kernel_->jit_ker(&par_conv);
             }
@@ -503,8 +548,11 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data(
         const exec_ctx_t &ctx) const {
     auto diff_dst = CTX_IN_MEM(const diff_dst_data_t *, DNNL_ARG_DIFF_DST);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
 
+    prepare_padded_bias(bias, ctx.get_scratchpad_grantor());
+
     const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
     const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -546,6 +594,9 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data(
                     + jcp.typesize_out * diff_src_d.blk_off(n, g_icb);
             auto diff_dst_w = diff_dst + diff_dst_d.blk_off(n, g_ocb);
             auto wht_w = weights + wht_blk_off(weights_d, g, 0, icb);
+            auto bias_w = jcp.with_bias
+                    ? bias + jcp.typesize_bia * g_icb * jcp.ic_block
+                    : nullptr;
 
             for (int ij = ih_s; ij < ih_e; ++ij) {
                 int oj, k_len, k_lo;
@@ -590,6 +641,7 @@ void jit_avx512_core_bf16_convolution_bwd_data_t ::execute_backward_data(
                 par_conv.dst = diff_dst_w + oj * diff_dst_h_stride;
                 par_conv.filt = wht_w + k_lo * wht_h_stride;
                 par_conv.kh_padding = k_len;
+                par_conv.bias = bias_w;
 
                 kernel_->jit_ker(&par_conv);
             }
@@ -142,15 +142,26 @@ struct jit_avx512_core_bf16_convolution_bwd_data_t : public primitive_impl_t {
                             || expect_data_types(data_type::bf16,
                                     data_type::bf16, data_type::undef,
                                     data_type::bf16, data_type::undef))
-                    && !has_zero_dim_memory() && set_default_formats();
+                    && !has_zero_dim_memory() && set_default_formats()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops);
             if (!ok) return status::unimplemented;
 
             status_t status = jit_avx512_core_bf16_bwd_data_kernel::init_conf(
                     jcp_, *desc(), *diff_src_md(), *weights_md(),
-                    *diff_dst_md());
-            return status;
+                    *diff_dst_md(), *attr());
+            if (status != status::success) return status;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            jit_avx512_core_bf16_bwd_data_kernel::init_scratchpad(
+                    scratchpad, jcp_);
+
+            return status::success;
         }
 
+        virtual bool support_bias() const override { return jcp_.with_bias; }
+        virtual bool support_post_ops() const override { return true; }
+
         jit_conv_conf_t jcp_;
 
     protected:
@@ -183,10 +194,15 @@ struct jit_avx512_core_bf16_convolution_bwd_data_t : public primitive_impl_t {
         else
             assert(!"invalid dimension");
 
+        if (pd()->wants_zero_pad_diff_src())
+            ctx.memory(DNNL_ARG_DIFF_SRC)->zero_pad();
+
         return status::success;
     }
 
 private:
+    void prepare_padded_bias(const char *&bias,
+            const memory_tracking::grantor_t &scratchpad) const;
     void execute_backward_data(const exec_ctx_t &ctx) const;
     void execute_backward_data_3d(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
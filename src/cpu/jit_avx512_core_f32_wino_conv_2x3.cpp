@@ -784,6 +784,7 @@ status_t jit_avx512_core_f32_wino_conv_2x3_fwd_ker_t ::init_conf(
     jcp.k_chunks = jcp.K / jcp.k2_block;
 
     const auto &oscales = attr.output_scales_;
+    if (!oscales.defined()) return status::unimplemented;
     jcp.is_oc_scale = oscales.mask_ == 1 << 1;
     assert(IMPLICATION(!jcp.is_oc_scale, oscales.mask_ == 0));
 
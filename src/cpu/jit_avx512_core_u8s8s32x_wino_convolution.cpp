@@ -924,6 +924,7 @@ status_t jit_avx512_core_u8s8s32x_wino_conv_fwd_ker_t ::init_conf(
     jcp.k_chunks = jcp.K / jcp.k2_block;
 
     const auto &oscales = attr.output_scales_;
+    if (!oscales.defined()) return status::unimplemented;
     jcp.is_oc_scale = oscales.mask_ == 1 << 1;
     assert(IMPLICATION(!jcp.is_oc_scale, oscales.mask_ == 0));
 
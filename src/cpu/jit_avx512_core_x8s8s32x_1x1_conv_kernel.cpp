@@ -799,7 +799,10 @@ void jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_scratchpad(
     using namespace dnnl::impl::memory_tracking::names;
 
     if (jcp.signed_input && jcp.ver != ver_vnni) {
-        dim_t count = nstl::max<dim_t>(attr.output_scales_.count_, 16);
+        // run-time scales do not carry the count, so derive it from the mask
+        const dim_t oscales_count
+                = jcp.is_oc_scale ? (dim_t)jcp.ngroups * jcp.oc : 1;
+        dim_t count = nstl::max<dim_t>(oscales_count, 16);
         scratchpad.book(key_conv_adjusted_scales, sizeof(float) * count);
     }
 }
@@ -21,6 +21,7 @@
 
 #include "jit_generator.hpp"
 
+#include "cpu_primitive.hpp"
 #include "jit_avx512_core_x8s8s32x_1x1_convolution.hpp"
 
 namespace dnnl {
@@ -33,7 +34,7 @@ using namespace dnnl::impl::utils;
 
 /* convolution forward */
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
+status_t jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
         dst_type>::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -42,30 +43,33 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
 
     auto scratchpad = ctx.get_scratchpad_grantor();
 
+    DEFINE_SCALES_BUFFER(oscales);
     if (pd()->jcp_.signed_input && pd()->jcp_.ver != ver_vnni) {
         auto local_scales
                 = scratchpad.template get<float>(key_conv_adjusted_scales);
-        auto scales = pd()->attr()->output_scales_.scales_;
-        size_t count = pd()->attr()->output_scales_.count_;
+        size_t count = oscales_count(pd()->attr(), pd()->dst_md());
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
-            utils::array_set(local_scales, scales[0] * factor, 16);
+            utils::array_set(local_scales, oscales[0] * factor, 16);
         } else {
             for (size_t c = 0; c < count; c++)
-                local_scales[c] = scales[c] * factor;
+                local_scales[c] = oscales[c] * factor;
         }
     }
 
     parallel(kernel_->jcp.nthr, [&](const int ithr, const int nthr) {
-        execute_forward_thr(ithr, nthr, src, weights, bias, dst, scratchpad);
+        execute_forward_thr(
+                ithr, nthr, src, weights, bias, dst, oscales, scratchpad);
     });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
 void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
         dst_type>::execute_forward_thr(const int ithr, const int nthr,
         const src_data_t *src, const wei_data_t *weights, const char *bias,
-        dst_data_t *dst, const memory_tracking::grantor_t &scratchpad) const {
+        dst_data_t *dst, const float *oscales,
+        const memory_tracking::grantor_t &scratchpad) const {
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -88,8 +92,6 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
     const int pad_t = pd()->desc()->padding[0][0];
     const int pad_l = pd()->desc()->padding[0][1];
 
-    const auto &oscales = pd()->attr()->output_scales_;
-
     int offset = jcp.ngroups * (jcp.oc / jcp.oc_block) * (jcp.ic / jcp.ic_block)
             * jcp.oc_block * jcp.ic_block;
     wei_data_t *w = const_cast<wei_data_t *>(weights);
@@ -170,7 +172,7 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
                 = (jcp.signed_input) ? &compensation[_ocb * jcp.oc_block] : 0;
         p.scales = (jcp.signed_input && jcp.ver != ver_vnni)
                 ? &local_scales[jcp.is_oc_scale * _ocb * jcp.oc_block]
-                : &oscales.scales_[jcp.is_oc_scale * _ocb * jcp.oc_block];
+                : &oscales[jcp.is_oc_scale * _ocb * jcp.oc_block];
         if (pd()->rtus_.reduce_src_) {
             rp.ws = rtus_space + ithr * pd()->rtus_.space_per_thread_
                     + _icb * jcp.is * jcp.ic_block;
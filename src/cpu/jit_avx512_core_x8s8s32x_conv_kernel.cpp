@@ -1138,8 +1138,10 @@ void jit_avx512_core_x8s8s32x_fwd_kernel::init_scratchpad(
         memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp,
         const primitive_attr_t &attr) {
     if (jcp.signed_input && jcp.ver != ver_vnni) {
-        dim_t count
-                = nstl::max(attr.output_scales_.count_, (dim_t)jcp.ic_block);
+        // run-time scales do not carry the count, so derive it from the mask
+        const dim_t oscales_count
+                = jcp.is_oc_scale ? (dim_t)jcp.ngroups * jcp.oc : 1;
+        dim_t count = nstl::max(oscales_count, (dim_t)jcp.ic_block);
         scratchpad.book(key_conv_adjusted_scales, sizeof(float) * count);
     }
 }
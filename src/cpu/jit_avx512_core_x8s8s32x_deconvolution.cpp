@@ -179,6 +179,7 @@ status_t jit_avx512_core_x8s8s32x_deconv_fwd_kernel::init_conf(
     jcp.ver = ver_avx512_core;
     if (mayiuse(avx512_core_vnni)) jcp.ver = ver_vnni;
     const auto &oscales = attr.output_scales_;
+    if (!oscales.defined()) return status::unimplemented;
     jcp.is_oc_scale = oscales.mask_ == 1 << 1;
 
     assert(IMPLICATION(!jcp.is_oc_scale, oscales.mask_ == 0));
@@ -330,6 +330,7 @@ struct jit_conv_call_s {
     size_t channel;
     size_t channel_prf;
     size_t oc_blocks;
+    size_t oc_blocks_prf;
     size_t ur_w;
     size_t ur_str_w;
     size_t ch_blocks;
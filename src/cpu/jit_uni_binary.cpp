@@ -23,7 +23,10 @@
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
+#include "cpu_primitive.hpp"
+#include "jit_avx512_core_bf16cvt.hpp"
 #include "jit_generator.hpp"
+#include "jit_uni_eltwise.hpp"
 
 #include "jit_uni_binary.hpp"
 
@@ -31,224 +34,545 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
-namespace {
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+bool jit_uni_binary_t<isa>::pd_t::init_conf() {
+    using namespace format_tag;
+
+    const memory_desc_wrapper src0_d(src_md(0));
+    const memory_desc_wrapper src1_d(src_md(1));
+    if (!src0_d.is_blocking_desc() || !src1_d.is_blocking_desc()) return false;
+    if (!src0_d.is_dense(true) || !src1_d.is_dense(true)) return false;
+
+    const int ndims = this->ndims();
+    const dims_t &dims = src0_d.dims();
+    const dims_t &dims1 = src1_d.dims();
+
+    auto &c = conf_;
+    c.nouter = c.reps = 1;
+    c.len = src0_d.nelems(true);
+    c.src1_outer_mod = 1;
+    c.src1_outer_stride = 0;
+    c.src1_scalar = false;
+
+    if (is_tensor_op() && src1_d.similar_to(src0_d, true, false)) {
+        // the padded area is processed as well, so it has to stay zero
+        if (src0_d.nelems(true) == src0_d.nelems()) return true;
+
+        bool ok = desc()->alg_kind != alg_kind::binary_div;
+        const auto &p = attr()->post_ops_;
+        for (int idx = 0; idx < p.len_; ++idx)
+            if (p.entry_[idx].is_eltwise(false))
+                ok = ok
+                        && math::eltwise_fwd_preserves_zero(
+                                p.entry_[idx].eltwise.alg, true);
+        return ok;
+    }
 
-typedef float data_t;
+    if (src0_d.nelems(true) != src0_d.nelems()) return false;
+    if (src1_d.nelems(true) != src1_d.nelems()) return false;
 
-using namespace Xbyak;
+    if (src1_d.nelems() == 1) {
+        c.src1_scalar = true;
+        return true;
+    }
+
+    if (ndims < 2) return false;
+
+    const auto &blk0 = src0_d.blocking_desc();
+    const dim_t MB = dims[0], C = dims[1];
+    const dim_t SP = src0_d.nelems() / MB / C;
+    const bool src0_ncsp = src0_d.matches_one_of_tag(ncw, nchw, ncdhw);
+
+    bool per_c = true, per_sp = ndims > 2;
+    for (int d = 0; d < ndims; ++d) {
+        per_c = per_c && dims1[d] == (d == 1 ? C : 1);
+        per_sp = per_sp && dims1[d] == (d > 1 ? dims[d] : 1);
+    }
+
+    if (per_c) {
+        if (blk0.inner_nblks == 0 && blk0.strides[1] == 1) {
+            // channels are innermost: src1 is reused for every point
+            c.reps = MB * SP;
+            c.len = C;
+        } else if (src0_d.matches_one_of_tag(nCw8c, nChw8c, nCdhw8c, nCw16c,
+                           nChw16c, nCdhw16c)) {
+            const dim_t blk = blk0.inner_blks[0];
+            c.nouter = MB * C / blk;
+            c.reps = SP;
+            c.len = blk;
+            c.src1_outer_mod = C / blk;
+            c.src1_outer_stride = blk;
+        } else if (src0_ncsp) {
+            // a single channel value is broadcast over the spatial
+            c.nouter = MB * C;
+            c.len = SP;
+            c.src1_outer_mod = C;
+            c.src1_outer_stride = 1;
+            c.src1_scalar = true;
+        } else
+            return false;
+        return true;
+    }
+
+    if (per_sp && src0_ncsp) {
+        // src1 has to keep the spatial points in the src0 order
+        const auto &blk1 = src1_d.blocking_desc();
+        bool ok = blk1.inner_nblks == 0 && blk1.strides[ndims - 1] == 1;
+        for (int d = 2; d < ndims - 1; ++d)
+            ok = ok && blk1.strides[d] == blk1.strides[d + 1] * dims[d + 1];
+        if (!ok) return false;
+
+        c.reps = MB * C;
+        c.len = SP;
+        return true;
+    }
+
+    return false;
+}
+
+namespace {
 
 template <cpu_isa_t isa>
-struct jit_binary_base_t : public jit_generator {
+struct jit_uni_binary_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_binary_kernel_t)
+
     struct call_params_t {
         // keep all sizes at 8 bytes -- jit code expects this
-        const data_t *src0, *src1, *dst;
-        size_t spat_offt_count;
+        const void *src0, *src1;
+        void *dst;
+        const float *scales;
+        size_t reps, len;
     };
-    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_binary_t)
 
-    // cpu specific part
     using Vmm = typename cpu_isa_traits<isa>::Vmm;
-    const AddressFrame &vmmword = (isa == avx2) ? yword : zword;
+    using injector_t = jit_uni_eltwise_injector_f32<isa>;
+
     const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const int unroll = isa == avx512_common ? 8 : 4;
+
+    void (*ker_)(const call_params_t *);
+    void operator()(const call_params_t *p) { (*ker_)(p); }
+
+    jit_uni_binary_kernel_t(const binary_pd_t *pd, const dim_t len,
+            const bool src1_scalar)
+        : pd_(pd)
+        , src1_scalar_(src1_scalar)
+        , tail_(len % simd_w)
+        , src0_dt_(pd->src_md(0)->data_type)
+        , src1_dt_(pd->src_md(1)->data_type)
+        , dst_dt_(pd->dst_md()->data_type)
+        , src0_sz_(types::data_type_size(src0_dt_))
+        , src1_sz_(types::data_type_size(src1_dt_))
+        , dst_sz_(types::data_type_size(dst_dt_))
+        , do_scale_(!pd->attr()->output_scales_.has_default_values())
+        , bf16_emu_(nullptr) {
+        const auto &p = pd_->attr()->post_ops_;
+        for (int idx = 0; idx < p.len_; ++idx)
+            eltwise_injectors_[idx] = p.entry_[idx].is_eltwise(false)
+                    ? new injector_t(this, p.entry_[idx].eltwise)
+                    : nullptr;
+
+        const bool use_bf16 = utils::one_of(
+                data_type::bf16, src0_dt_, src1_dt_, dst_dt_);
+        if (use_bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                    bf16_emu_reserv_4);
+
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(
+                const_cast<uint8_t *>(this->getCode()));
+    }
 
+    ~jit_uni_binary_kernel_t() {
+        const auto &p = pd_->attr()->post_ops_;
+        for (int idx = 0; idx < p.len_; ++idx)
+            delete eltwise_injectors_[idx];
+        delete bf16_emu_;
+    }
+
+private:
     const binary_pd_t *pd_;
+    const bool src1_scalar_;
+    const int tail_;
+    const data_type_t src0_dt_, src1_dt_, dst_dt_;
+    const size_t src0_sz_, src1_sz_, dst_sz_;
+    const bool do_scale_;
 
-    void (*ker)(const call_params_t *);
-    void operator()(const call_params_t *p) { (*ker)(p); }
+    injector_t *eltwise_injectors_[post_ops_t::capacity];
+    bf16_emulation_t *bf16_emu_;
 
     Reg64 reg_param = abi_param1;
 
     Reg64 reg_src0 = r8;
     Reg64 reg_src1 = r9;
     Reg64 reg_dst = r10;
-    Reg64 reg_spat_offt = r11;
-    Reg64 reg_spat_offt_count = r12;
-    Reg64 reg_reverse_spat_offt = r13;
-    Reg64 reg_tmp = r14;
-
-    size_t unroll_regs_ = isa == avx512_common ? 8 : 4;
-    size_t simd_w_ = vlen / sizeof(data_t);
-    size_t nelems_simd_tail_;
-
-    void compute_predefined_variables() {
-        const memory_desc_wrapper src0_d(pd_->src_md(0));
-        size_t nelems = src0_d.nelems(true);
-        nelems_simd_tail_ = nelems % simd_w_;
+    Reg64 reg_offt = r11; // offset within a repetition, in elements
+    Reg64 reg_reps = r12;
+    Reg64 reg_len = r13;
+    Reg64 reg_rem = r14; // elements left within a repetition
+    Reg64 reg_tmp = r15;
+    // rax is the eltwise injectors table pointer
+    Reg64 bf16_emu_scratch = rbx;
+
+    Opmask k_tail_mask = k2; // k1 is used by the eltwise injectors
+
+    // Vmm(0) holds the avx2 tail mask
+    Vmm vmm_tail_mask = Vmm(0);
+    Vmm vmm_src1_bcast = Vmm(1);
+    Vmm vmm_scale = Vmm(2);
+    Vmm vmm_sum_scale = Vmm(3);
+    Vmm vmm_sat_lbound = Vmm(4);
+    Vmm vmm_sat_ubound = Vmm(5);
+    const int vmm_compute_start = 6;
+    Vmm vmm_src0(int i) { return Vmm(vmm_compute_start + i); }
+    Vmm vmm_src1(int i) { return Vmm(vmm_compute_start + unroll + i); }
+
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+
+    Address src0_ptr(int i) {
+        return ptr[reg_src0 + reg_offt * src0_sz_ + i * simd_w * src0_sz_];
     }
-
-    void load_common_params() {
-#define PARAM_OFF(x) offsetof(call_params_t, x)
-        mov(reg_spat_offt_count, ptr[reg_param + PARAM_OFF(spat_offt_count)]);
-        mov(reg_src0, ptr[reg_param + PARAM_OFF(src0)]);
-        mov(reg_src1, ptr[reg_param + PARAM_OFF(src1)]);
-        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
-#undef PARAM_OFF
+    Address src1_ptr(int i) {
+        return ptr[reg_src1 + reg_offt * src1_sz_ + i * simd_w * src1_sz_];
     }
-
-    Address src0_ptr(size_t offt = 0) {
-        return vmmword[reg_src0 + reg_spat_offt + offt];
+    Address dst_ptr(int i) {
+        return ptr[reg_dst + reg_offt * dst_sz_ + i * simd_w * dst_sz_];
     }
 
-    Address src1_ptr(size_t offt = 0) {
-        return vmmword[reg_src1 + reg_spat_offt + offt];
+    void broadcast_float(const Vmm &v, float f) {
+        mov(reg_tmp.cvt32(), float2int(f));
+        vmovd(Xmm(v.getIdx()), reg_tmp.cvt32());
+        uni_vbroadcastss(v, Xmm(v.getIdx()));
     }
 
-    Address dst_ptr(size_t offt = 0) {
-        return vmmword[reg_dst + reg_spat_offt + offt];
-    }
+    // Loads (a tail of) simd_w elements of type dt and converts them to f32
+    void load(const Vmm &v, const Address &addr, data_type_t dt, bool tail) {
+        using namespace data_type;
+        if (isa == avx2) {
+            // only f32 is supported on avx2
+            if (tail)
+                vmaskmovps(v, vmm_tail_mask, addr);
+            else
+                vmovups(v, addr);
+            return;
+        }
 
-    void perform_op(const Vmm &v0, const Vmm &v1) {
-        using namespace alg_kind;
-        const auto alg = pd_->desc()->alg_kind;
-        if (alg == alg_kind::binary_add)
-            uni_vaddps(v0, v0, v1);
-        else if (alg == alg_kind::binary_mul)
-            uni_vmulps(v0, v0, v1);
+        const Vmm v_masked = tail ? v | k_tail_mask | T_z : v;
+        switch (dt) {
+            case f32: vmovups(v_masked, addr); break;
+            case bf16:
+                vpmovzxwd(v_masked, addr);
+                vpslld(v, v, 16);
+                break;
+            case s8:
+                vpmovsxbd(v_masked, addr);
+                vcvtdq2ps(v, v);
+                break;
+            case u8:
+                vpmovzxbd(v_masked, addr);
+                vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unsupported data type");
+        }
     }
 
-    virtual void prepare_tail_mask() {}
-    virtual void compute_dst(int unroll, bool tail = false) {}
+    // Converts f32 values to dt and stores (a tail of) simd_w of them
+    void store(const Address &addr, const Vmm &v, data_type_t dt, bool tail) {
+        using namespace data_type;
+        if (isa == avx2) {
+            if (tail)
+                vmaskmovps(addr, vmm_tail_mask, v);
+            else
+                vmovups(addr, v);
+            return;
+        }
 
-    void forward() {
-        Label unroll_loop, unroll_loop_tail, nelems_tail, end;
+        const Address addr_masked = tail ? addr | k_tail_mask : addr;
+        switch (dt) {
+            case f32: vmovups(addr_masked, v); break;
+            case bf16: {
+                const Ymm y = Ymm(v.getIdx());
+                if (bf16_emu_)
+                    bf16_emu_->vcvtneps2bf16(y, Zmm(v.getIdx()));
+                else
+                    vcvtneps2bf16(y, v);
+                vmovdqu16(addr_masked, y);
+                break;
+            }
+            case s8:
+            case u8:
+                vmaxps(v, v, vmm_sat_lbound);
+                vminps(v, v, vmm_sat_ubound);
+                vcvtps2dq(v, v);
+                // the down-converting stores take the mask on the source
+                if (dt == s8)
+                    vpmovsdb(addr, tail ? v | k_tail_mask : v);
+                else
+                    vpmovusdb(addr, tail ? v | k_tail_mask : v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
 
-        // reverse spat_offt to dispatch between labels
-        mov(reg_reverse_spat_offt, reg_spat_offt_count);
-        xor_(reg_spat_offt, reg_spat_offt); // spat_offt to get addr of src/dst
-        L(unroll_loop);
-        {
-            cmp(reg_reverse_spat_offt, unroll_regs_ * vlen);
-            jl(unroll_loop_tail, T_NEAR);
+    void load_src1_scalar() {
+        using namespace data_type;
+        const Xmm x = Xmm(vmm_src1_bcast.getIdx());
+        const Reg32 reg_tmp32 = reg_tmp.cvt32();
+        switch (src1_dt_) {
+            case f32: uni_vbroadcastss(vmm_src1_bcast, ptr[reg_src1]); return;
+            case bf16:
+                movzx(reg_tmp32, word[reg_src1]);
+                shl(reg_tmp32, 16);
+                vmovd(x, reg_tmp32);
+                break;
+            case s8:
+                movsx(reg_tmp32, byte[reg_src1]);
+                vmovd(x, reg_tmp32);
+                vcvtdq2ps(x, x);
+                break;
+            case u8:
+                movzx(reg_tmp32, byte[reg_src1]);
+                vmovd(x, reg_tmp32);
+                vcvtdq2ps(x, x);
+                break;
+            default: assert(!"unsupported data type");
+        }
+        uni_vbroadcastss(vmm_src1_bcast, x);
+    }
 
-            compute_dst(unroll_regs_);
-            sub(reg_reverse_spat_offt, unroll_regs_ * vlen);
-            add(reg_spat_offt, unroll_regs_ * vlen);
-            jmp(unroll_loop);
+    void prepare_tail_mask() {
+        if (tail_ == 0) return;
+
+        if (isa == avx2) {
+            static const uint32_t mask_f32[14]
+                    = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                            0xffffffff, 0xffffffff, 0xffffffff, 0, 0, 0, 0, 0,
+                            0, 0};
+            mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - tail_]));
+            vmovups(vmm_tail_mask, ptr[reg_tmp]);
+        } else {
+            mov(reg_tmp.cvt32(), (1 << tail_) - 1);
+            kmovw(k_tail_mask, reg_tmp.cvt32());
         }
+    }
 
-        L(unroll_loop_tail);
-        {
-            cmp(reg_reverse_spat_offt, vlen);
-            jl(nelems_tail, T_NEAR);
+    void perform_op(const Vmm &v0, const Vmm &v1) {
+        using namespace alg_kind;
+        switch (pd_->desc()->alg_kind) {
+            case binary_add: uni_vaddps(v0, v0, v1); break;
+            case binary_mul: uni_vmulps(v0, v0, v1); break;
+            case binary_max: uni_vmaxps(v0, v0, v1); break;
+            case binary_min: uni_vminps(v0, v0, v1); break;
+            case binary_sub: uni_vsubps(v0, v0, v1); break;
+            case binary_div: uni_vdivps(v0, v0, v1); break;
+            default: assert(!"unsupported algorithm");
+        }
+    }
 
-            compute_dst(1);
-            sub(reg_reverse_spat_offt, vlen);
-            add(reg_spat_offt, vlen);
-            jmp(unroll_loop_tail);
+    void compute_dst(int nvregs, bool tail) {
+        for (int i = 0; i < nvregs; i++) {
+            load(vmm_src0(i), src0_ptr(i), src0_dt_, tail);
+            if (!src1_scalar_) load(vmm_src1(i), src1_ptr(i), src1_dt_, tail);
+            perform_op(
+                    vmm_src0(i), src1_scalar_ ? vmm_src1_bcast : vmm_src1(i));
+            if (do_scale_) uni_vmulps(vmm_src0(i), vmm_src0(i), vmm_scale);
         }
 
-        L(nelems_tail);
-        {
-            cmp(reg_reverse_spat_offt, 1);
-            jl(end, T_NEAR);
+        const auto &p = pd_->attr()->post_ops_;
+        for (int idx = 0; idx < p.len_; ++idx) {
+            if (p.entry_[idx].is_eltwise(false)) {
+                eltwise_injectors_[idx]->compute_vector_range(
+                        vmm_src0(0).getIdx(), vmm_src0(nvregs).getIdx());
+                continue;
+            }
 
-            compute_dst(1, true);
+            const float sum_scale = p.entry_[idx].sum.scale;
+            if (sum_scale != 1.f) broadcast_float(vmm_sum_scale, sum_scale);
+            for (int i = 0; i < nvregs; i++) {
+                load(vmm_src1(i), dst_ptr(i), dst_dt_, tail);
+                if (sum_scale != 1.f)
+                    uni_vfmadd231ps(vmm_src0(i), vmm_src1(i), vmm_sum_scale);
+                else
+                    uni_vaddps(vmm_src0(i), vmm_src0(i), vmm_src1(i));
+            }
         }
 
-        L(end);
+        for (int i = 0; i < nvregs; i++)
+            store(dst_ptr(i), vmm_src0(i), dst_dt_, tail);
     }
 
-    // either this stub or duplication at each jit_binary_t ctor due to methods
-    // that are participated are not defined at the moment of base ctor
-    // initialization.
-    void get_code() {
+    void generate() {
+        using namespace data_type;
         preamble();
-        compute_predefined_variables();
-        load_common_params();
-        prepare_tail_mask();
-        forward();
-        postamble();
 
-        ker = reinterpret_cast<decltype(ker)>(
-                const_cast<uint8_t *>(this->getCode()));
-    }
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src0, ptr[reg_param + PARAM_OFF(src0)]);
+        mov(reg_src1, ptr[reg_param + PARAM_OFF(src1)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_reps, ptr[reg_param + PARAM_OFF(reps)]);
+        mov(reg_len, ptr[reg_param + PARAM_OFF(len)]);
+        if (do_scale_) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(scales)]);
+            uni_vbroadcastss(vmm_scale, ptr[reg_tmp]);
+        }
+#undef PARAM_OFF
 
-    jit_binary_base_t(const binary_pd_t *pd) : pd_(pd) {}
-};
+        if (utils::one_of(dst_dt_, s8, u8)) {
+            broadcast_float(vmm_sat_lbound, dst_dt_ == s8 ? -128.f : 0.f);
+            broadcast_float(vmm_sat_ubound, dst_dt_ == s8 ? 127.f : 255.f);
+        }
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+        prepare_tail_mask();
+        if (src1_scalar_) load_src1_scalar();
 
-template <cpu_isa_t isa>
-struct jit_binary_t;
+        Label rep_loop, unroll_loop, unroll_loop_tail, nelems_tail, rep_end;
 
-template <>
-struct jit_binary_t<avx512_common> : public jit_binary_base_t<avx512_common> {
-    Opmask tail_opmask = Opmask(1);
+        L(rep_loop);
+        {
+            xor_(reg_offt, reg_offt);
+            mov(reg_rem, reg_len);
+
+            L(unroll_loop);
+            {
+                cmp(reg_rem, unroll * simd_w);
+                jl(unroll_loop_tail, T_NEAR);
+
+                compute_dst(unroll, false);
+                sub(reg_rem, unroll * simd_w);
+                add(reg_offt, unroll * simd_w);
+                jmp(unroll_loop);
+            }
 
-    void prepare_tail_mask() override {
-        if (!nelems_simd_tail_) return;
+            L(unroll_loop_tail);
+            {
+                cmp(reg_rem, simd_w);
+                jl(nelems_tail, T_NEAR);
 
-        const int mask_f32 = (1 << nelems_simd_tail_) - 1;
+                compute_dst(1, false);
+                sub(reg_rem, simd_w);
+                add(reg_offt, simd_w);
+                jmp(unroll_loop_tail);
+            }
 
-        Reg32 regw_tmp = reg_tmp.cvt32();
-        mov(regw_tmp, mask_f32);
-        kmovw(tail_opmask, regw_tmp);
-    }
+            L(nelems_tail);
+            if (tail_ != 0) {
+                cmp(reg_rem, 1);
+                jl(rep_end, T_NEAR);
 
-    void compute_dst(int unroll, bool tail = false) override {
-        for (int i = 0; i < unroll; i++) {
-            Vmm vreg_tmp_src0 = Vmm(2 * i + 1);
-            Vmm vreg_tmp_src1 = Vmm(2 * i + 2);
-            if (!tail) {
-                uni_vmovups(vreg_tmp_src0, src0_ptr(vlen * i));
-                uni_vmovups(vreg_tmp_src1, src1_ptr(vlen * i));
-                perform_op(vreg_tmp_src0, vreg_tmp_src1);
-                uni_vmovups(dst_ptr(vlen * i), vreg_tmp_src0);
-            } else {
-                uni_vmovups_tail(
-                        vreg_tmp_src0, tail_opmask, src0_ptr(vlen * i));
-                uni_vmovups_tail(
-                        vreg_tmp_src1, tail_opmask, src1_ptr(vlen * i));
-                perform_op(vreg_tmp_src0, vreg_tmp_src1);
-                uni_vmovups_tail(dst_ptr(vlen * i), tail_opmask, vreg_tmp_src0);
+                compute_dst(1, true);
+                add(reg_offt, tail_);
             }
+
+            L(rep_end);
+            // src1 is reused for every repetition
+            lea(reg_src0, ptr[reg_src0 + reg_offt * src0_sz_]);
+            lea(reg_dst, ptr[reg_dst + reg_offt * dst_sz_]);
+            dec(reg_reps);
+            jnz(rep_loop, T_NEAR);
         }
-    }
 
-    jit_binary_t(const binary_pd_t *pd) : jit_binary_base_t(pd) { get_code(); }
+        postamble();
+
+        const auto &p = pd_->attr()->post_ops_;
+        for (int idx = 0; idx < p.len_; ++idx)
+            if (eltwise_injectors_[idx])
+                eltwise_injectors_[idx]->prepare_table();
+    }
 };
 
-template <>
-struct jit_binary_t<avx2> : public jit_binary_base_t<avx2> {
-    Vmm tail_vmask = Vmm(0);
+} // namespace
 
-    void prepare_tail_mask() override {
-        if (!nelems_simd_tail_) return;
+namespace binary_impl {
 
-        static const uint32_t mask_f32[14]
-                = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-                        0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0, 0};
+template <cpu_isa_t isa>
+struct driver_t : public c_compatible {
+    using conf_t = typename jit_uni_binary_t<isa>::pd_t::conf_t;
+    using kernel_t = jit_uni_binary_kernel_t<isa>;
 
-        mov(reg_tmp,
-                reinterpret_cast<size_t>(&mask_f32[7 - nelems_simd_tail_]));
-        vmovups(tail_vmask, ptr[reg_tmp]);
-    }
+    driver_t(const binary_pd_t *pd, const conf_t &conf)
+        : conf_(conf)
+        , src0_sz_(types::data_type_size(pd->src_md(0)->data_type))
+        , src1_sz_(types::data_type_size(pd->src_md(1)->data_type))
+        , dst_sz_(types::data_type_size(pd->dst_md()->data_type))
+        , ker_(pd, conf.len, conf.src1_scalar) {}
 
-    void compute_dst(int unroll, bool tail = false) override {
-        for (int i = 0; i < unroll; i++) {
-            Vmm vreg_tmp_src0 = Vmm(2 * i + 1);
-            Vmm vreg_tmp_src1 = Vmm(2 * i + 2);
-            if (!tail) {
-                uni_vmovups(vreg_tmp_src0, src0_ptr(vlen * i));
-                uni_vmovups(vreg_tmp_src1, src1_ptr(vlen * i));
-                perform_op(vreg_tmp_src0, vreg_tmp_src1);
-                uni_vmovups(dst_ptr(vlen * i), vreg_tmp_src0);
-            } else {
-                uni_vmovups_tail(vreg_tmp_src0, tail_vmask, src0_ptr(vlen * i));
-                uni_vmovups_tail(vreg_tmp_src1, tail_vmask, src1_ptr(vlen * i));
-                perform_op(vreg_tmp_src0, vreg_tmp_src1);
-                uni_vmovups_tail(dst_ptr(vlen * i), tail_vmask, vreg_tmp_src0);
+    // Compute strategy:
+    // The blocks repetitions are divided equally between the threads. If
+    // there are fewer of them than the threads, each repetition is also split
+    // into chunks of full vectors, the last chunk also handles a tail.
+    void exec(int ithr, int nthr, const char *src0, const char *src1,
+            char *dst, const float *scales) {
+        const auto &c = conf_;
+        const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+        const dim_t nunits = c.nouter * c.reps;
+
+        dim_t chunk_len = c.len, nchunks = 1;
+        if (nunits < nthr) {
+            const dim_t max_chunks = nstl::max(c.len / simd_w, (dim_t)1);
+            nchunks = nstl::min(utils::div_up((dim_t)nthr, nunits), max_chunks);
+            chunk_len = utils::rnd_up(utils::div_up(c.len, nchunks), simd_w);
+            nchunks = utils::div_up(c.len, chunk_len);
+        }
+
+        typename kernel_t::call_params_t p;
+        p.scales = scales;
+
+        auto src1_off = [&](dim_t unit) {
+            return (unit / c.reps % c.src1_outer_mod) * c.src1_outer_stride;
+        };
+
+        dim_t start = 0, end = 0;
+        if (nchunks > 1) {
+            balance211(nunits * nchunks, nthr, ithr, start, end);
+            for (dim_t iwork = start; iwork < end; ++iwork) {
+                const dim_t unit = iwork / nchunks;
+                const dim_t off = (iwork % nchunks) * chunk_len;
+                const dim_t off0 = unit * c.len + off;
+                const dim_t off1 = src1_off(unit) + (c.src1_scalar ? 0 : off);
+                p.src0 = src0 + off0 * src0_sz_;
+                p.src1 = src1 + off1 * src1_sz_;
+                p.dst = dst + off0 * dst_sz_;
+                p.reps = 1;
+                p.len = nstl::min(chunk_len, c.len - off);
+                ker_(&p);
             }
+            return;
+        }
+
+        balance211(nunits, nthr, ithr, start, end);
+        while (start < end) {
+            // the repetitions of one block share the same src1 data
+            const dim_t reps = nstl::min(c.reps - start % c.reps, end - start);
+            p.src0 = src0 + start * c.len * src0_sz_;
+            p.src1 = src1 + src1_off(start) * src1_sz_;
+            p.dst = dst + start * c.len * dst_sz_;
+            p.reps = reps;
+            p.len = c.len;
+            ker_(&p);
+            start += reps;
         }
     }
 
-    jit_binary_t(const binary_pd_t *pd) : jit_binary_base_t(pd) { get_code(); }
+private:
+    const conf_t conf_;
+    const size_t src0_sz_, src1_sz_, dst_sz_;
+
+    kernel_t ker_;
 };
 
-} // namespace
+} // namespace binary_impl
 
 template <cpu_isa_t isa>
 jit_uni_binary_t<isa>::jit_uni_binary_t(const pd_t *apd)
     : primitive_impl_t(apd) {
-    binary_driver_ = new binary_impl::driver_t<isa>(pd());
+    binary_driver_ = new binary_impl::driver_t<isa>(pd(), pd()->conf_);
 }
 
 template <cpu_isa_t isa>
@@ -258,64 +582,28 @@ jit_uni_binary_t<isa>::~jit_uni_binary_t() {
 
 template <cpu_isa_t isa>
 status_t jit_uni_binary_t<isa>::execute(const exec_ctx_t &ctx) const {
-    const auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
-    const auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto src0 = CTX_IN_MEM(const char *, DNNL_ARG_SRC_0);
+    auto src1 = CTX_IN_MEM(const char *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    src0 += src0_d.offset0() * src0_d.data_type_size();
+    src1 += src1_d.offset0() * src1_d.data_type_size();
+    dst += dst_d.offset0() * dst_d.data_type_size();
 
     // Consider moving to parallel_nd when additional support will be added.
     // It's not used now due to need smaller granularity than nelems.
     parallel(0, [&](const int ithr, const int nthr) {
-        binary_driver_->exec(ithr, nthr, src0, src1, dst);
+        binary_driver_->exec(ithr, nthr, src0, src1, dst, scales);
     });
 
     return status::success;
 }
 
-namespace binary_impl {
-
-template <cpu_isa_t isa>
-struct driver_t : public c_compatible {
-
-    driver_t(const binary_pd_t *pd) : pd_(pd), ker_(pd_) {}
-    ~driver_t() {}
-
-    // Compute strategy:
-    // Compute number of full vectors, divide it equally between all threads.
-    // Last one will also handle a tail if present.
-    void exec(int ithr, int nthr, const data_t *src0, const data_t *src1,
-            data_t *dst) {
-        typename jit_binary_t<isa>::call_params_t p;
-
-        const memory_desc_wrapper src0_d(pd_->src_md(0));
-        const dim_t nelems0 = src0_d.nelems(true);
-
-        const int vlen = cpu_isa_traits<isa>::vlen;
-        const int simd_w = vlen / sizeof(data_t);
-        const dim_t nelems0_simd = nelems0 / simd_w;
-        const dim_t nelems0_simd_tail = nelems0 - nelems0_simd * simd_w;
-
-        dim_t start = 0, end = 0;
-        balance211(nelems0_simd, nthr, ithr, start, end);
-
-        const dim_t spat_offt_count_tail
-                = end == nelems0_simd && end > start ? nelems0_simd_tail : 0;
-        p.spat_offt_count = ((end - start) * simd_w + spat_offt_count_tail)
-                * sizeof(data_t);
-        p.src0 = src0 + start * simd_w;
-        p.src1 = src1 + start * simd_w;
-        p.dst = dst + start * simd_w;
-
-        if (p.spat_offt_count != 0) ker_(&p);
-    }
-
-private:
-    const binary_pd_t *pd_;
-
-    jit_binary_t<isa> ker_;
-};
-
-} // namespace binary_impl
-
 /* struct instantiation */
 template struct jit_uni_binary_t<avx2>;
 template struct jit_uni_binary_t<avx512_common>;
@@ -46,25 +46,46 @@ struct jit_uni_binary_t : public primitive_impl_t {
                 JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_binary_t);
 
         status_t init() {
-            using namespace data_type;
             bool ok = true && set_default_params() == status::success
                     && mayiuse(isa) && !has_zero_dim_memory()
-                    && utils::everyone_is(
-                            f32, src_md(0)->data_type, src_md(1)->data_type)
-                    && memory_desc_wrapper(src_md(0))
-                            == memory_desc_wrapper(src_md(1))
-                    && attr()->has_default_values();
+                    && data_types_ok() && attr_ok() && init_conf();
             if (!ok) return status::unimplemented;
 
             return status::success;
         };
+
+        /* The tensor is processed as `nouter` blocks of `reps` x `len`
+         * elements of src0 and dst stored one after another. Each block
+         * reads src1 from (block % src1_outer_mod) * src1_outer_stride:
+         * either a single value broadcast over the whole block or a vector
+         * of `len` elements reused by every repetition. */
+        struct conf_t {
+            dim_t nouter, reps, len;
+            dim_t src1_outer_mod, src1_outer_stride;
+            bool src1_scalar;
+        } conf_;
+
+    private:
+        bool data_types_ok() const {
+            using namespace data_type;
+            const data_type_t dts[] = {src_md(0)->data_type,
+                    src_md(1)->data_type, dst_md()->data_type};
+            for (auto dt : dts) {
+                const bool ok = isa == avx2 ? dt == f32
+                                            : utils::one_of(dt, f32, bf16, s8,
+                                                    u8);
+                if (!ok || (dt == bf16 && !mayiuse(avx512_core)))
+                    return false;
+            }
+            return true;
+        }
+
+        bool init_conf();
     };
 
     jit_uni_binary_t(const pd_t *apd);
     ~jit_uni_binary_t();
 
-    typedef float data_t;
-
     virtual status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_thread.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "type_helpers.hpp"
+
+#include "jit_uni_concat.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t jit_uni_concat_t::pd_t::init() {
+    if (cpu_concat_pd_t::init() != status::success)
+        return status::unimplemented;
+
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        if (i_d.nelems() == 0) continue;
+
+        auto prb = tr::prb_t();
+        if (tr::prb_init(prb, *src_md(i), *src_image_md(i), attr())
+                != status::success)
+            return status::unimplemented;
+
+        tr::kernel_t::desc_t ker_desc;
+        if (tr::prb_prepare(prb, ker_desc) != status::success)
+            return status::unimplemented;
+
+        inputs_.push_back(i);
+        prbs_.push_back(prb);
+        ker_descs_.push_back(ker_desc);
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_concat_t::execute(const exec_ctx_t &ctx) const {
+    const auto &prbs = pd()->prbs_;
+    const auto &ker_descs = pd()->ker_descs_;
+    const int n = (int)kernels_.size();
+
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    // work_off[k] is the first work item of the k-th input, an item being
+    // one call of its kernel
+    std::vector<const char *> in(n);
+    std::vector<char *> out(n);
+    std::vector<size_t> work_off(n + 1, 0);
+    for (int k = 0; k < n; ++k) {
+        const int i = pd()->inputs_[k];
+        const auto &prb = prbs[k];
+        auto src = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + i);
+        in[k] = src + prb.ioff * types::data_type_size(prb.itype);
+        out[k] = dst + prb.ooff * types::data_type_size(prb.otype);
+
+        size_t work = 1;
+        for (int d = ker_descs[k].prb.ndims; d < prb.ndims; ++d)
+            work *= prb.nodes[d].n;
+        if (pd()->is_in_place(i, src, dst)) work = 0;
+        work_off[k + 1] = work_off[k] + work;
+    }
+
+    const size_t work_amount = work_off[n];
+    if (work_amount == 0) return status::success;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        size_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        int k = 0;
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            while (iwork >= work_off[k + 1])
+                ++k;
+
+            const auto &prb = prbs[k];
+            size_t w = iwork - work_off[k];
+            ptrdiff_t i_off = 0, o_off = 0;
+            for (int d = ker_descs[k].prb.ndims; d < prb.ndims; ++d) {
+                const auto &node = prb.nodes[d];
+                const ptrdiff_t idx = w % node.n;
+                w /= node.n;
+                i_off += idx * node.is;
+                o_off += idx * node.os;
+            }
+
+            tr::call_param_t c;
+            c.in = in[k] + i_off * types::data_type_size(prb.itype);
+            c.out = out[k] + o_off * types::data_type_size(prb.otype);
+            c.scale = nullptr;
+            (*kernels_[k])(&c);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_CONCAT_HPP
+#define JIT_UNI_CONCAT_HPP
+
+#include <vector>
+
+#include "c_types_map.hpp"
+
+#include "cpu_concat_pd.hpp"
+#include "jit_uni_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Concat of inputs with arbitrary blocked layouts and data types.
+ *
+ * Each input is copied to its image in dst by a jit_uni_reorder kernel, which
+ * converts the layout and the data type on the fly. The outer dimensions of
+ * all the inputs form a single iteration space that is split among the
+ * threads, so dst is written in one parallel pass.
+ *
+ * The inputs that are in place (see cpu_concat_pd_t::is_in_place()) are
+ * skipped at execution time. */
+struct jit_uni_concat_t : public primitive_impl_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        DECLARE_CONCAT_PD_T("jit:uni", jit_uni_concat_t);
+
+        status_t init();
+
+        /* the non-empty inputs and their problems */
+        std::vector<int> inputs_;
+        std::vector<tr::prb_t> prbs_;
+        std::vector<tr::kernel_t::desc_t> ker_descs_;
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_impl_t(apd) {
+        for (const auto &ker_desc : pd()->ker_descs_)
+            kernels_.push_back(tr::kernel_t::create(ker_desc));
+    }
+
+    ~jit_uni_concat_t() {
+        for (auto &k : kernels_)
+            delete k;
+    }
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+    std::vector<tr::kernel_t *> kernels_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
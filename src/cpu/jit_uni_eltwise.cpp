@@ -596,6 +596,223 @@ void jit_uni_eltwise_injector_f32<isa>::swish_compute_vector(
     h->uni_vmulps(vmm_src, vmm_src, vmm_aux0);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::compute_cmp_mask(const Vmm &vmm_src,
+        const Xbyak::Operand &compare_operand, int cmp_predicate) {
+    if (utils::one_of(isa, avx512_common, avx512_core)) {
+        h->vcmpps(k_mask, vmm_src, compare_operand, cmp_predicate);
+    } else if (isa == avx2) {
+        h->vcmpps(vmm_mask, vmm_src, compare_operand, cmp_predicate);
+    } else {
+        h->uni_vmovups(vmm_mask, vmm_src);
+        h->cmpps(vmm_mask, compare_operand, cmp_predicate);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::blend_with_mask(
+        const Vmm &vmm_dst, const Xbyak::Operand &src) {
+    if (utils::one_of(isa, avx512_common, avx512_core))
+        h->vblendmps(vmm_dst | k_mask, vmm_dst, src);
+    else
+        h->uni_vblendvps(vmm_dst, vmm_dst, src, vmm_mask);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::relu_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // the same code works for src and dst as long as alpha >= 0
+    const int one_off = 0, alpha_off = 25, zero_off = 26;
+
+    compute_cmp_mask(vmm_src, table_val(zero_off), _cmp_nle_us);
+    h->uni_vmovups(vmm_src, table_val(alpha_off));
+    blend_with_mask(vmm_src, table_val(one_off));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::elu_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int one_off = 0, alpha_off = 25, zero_off = 26;
+
+    if (use_dst_) {
+        // d > 0 ? 1 : d + alpha
+        compute_cmp_mask(vmm_src, table_val(zero_off), _cmp_nle_us);
+        h->uni_vaddps(vmm_src, vmm_src, table_val(alpha_off));
+    } else {
+        // s > 0 ? 1 : alpha * exp(s), exp does not use vmm_aux3
+        h->uni_vmovups(vmm_aux3, vmm_src);
+        exp_compute_vector(vmm_src);
+        h->uni_vmulps(vmm_src, vmm_src, table_val(alpha_off));
+        compute_cmp_mask(vmm_aux3, table_val(zero_off), _cmp_nle_us);
+    }
+    blend_with_mask(vmm_src, table_val(one_off));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::tanh_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int one_off = 0;
+
+    // (1 - d) * (1 + d), d = tanh(s), which is more accurate than 1 - d^2
+    // when d is close to 1
+    if (!use_dst_) tanh_compute_vector(vmm_src);
+    h->uni_vmovups(vmm_aux0, table_val(one_off));
+    h->uni_vsubps(vmm_aux0, vmm_aux0, vmm_src);
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one_off));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::square_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int two_off = 27;
+
+    h->uni_vmulps(vmm_src, vmm_src, table_val(two_off));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::abs_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int one_off = 0, zero_off = 26, minus_one_off = 28;
+
+    // s > 0 ? 1 : s < 0 ? -1 : 0
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vmovups(vmm_src, table_val(zero_off));
+    compute_cmp_mask(vmm_aux1, table_val(zero_off), _cmp_nle_us);
+    blend_with_mask(vmm_src, table_val(one_off));
+    compute_cmp_mask(vmm_aux1, table_val(zero_off), _cmp_lt_os);
+    blend_with_mask(vmm_src, table_val(minus_one_off));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::sqrt_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int half_off = 1, zero_off = 26;
+
+    // s > 0 ? 0.5 / sqrt(s) : 0, or d > 0 ? 0.5 / d : 0
+    compute_cmp_mask(vmm_src, table_val(zero_off), _cmp_nle_us);
+    if (!use_dst_) h->uni_vsqrtps(vmm_src, vmm_src);
+    h->uni_vmovups(vmm_aux1, table_val(half_off));
+    h->uni_vdivps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vmovups(vmm_src, table_val(zero_off));
+    blend_with_mask(vmm_src, vmm_aux1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::linear_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int alpha_off = 25;
+
+    h->uni_vmovups(vmm_src, table_val(alpha_off));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::bounded_relu_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int one_off = 0, alpha_off = 25, zero_off = 26;
+
+    // 0 < s < alpha ? 1 : 0
+    h->uni_vmovups(vmm_aux1, vmm_src);
+    h->uni_vmovups(vmm_src, table_val(one_off));
+    compute_cmp_mask(vmm_aux1, table_val(zero_off), _cmp_le_os);
+    blend_with_mask(vmm_src, table_val(zero_off));
+    compute_cmp_mask(vmm_aux1, table_val(alpha_off), _cmp_nlt_us);
+    blend_with_mask(vmm_src, table_val(zero_off));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::soft_relu_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    logistic_compute_vector(vmm_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::logistic_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int one_off = 0;
+
+    // d * (1 - d) = logistic(s) * (1 - logistic(s)). The derivative is
+    // even, so it is computed for -|s|, where 1 - d does not cancel.
+    if (!use_dst_) {
+        h->uni_vorps(vmm_src, vmm_src, table_val(12));
+        logistic_compute_vector(vmm_src);
+    }
+    h->uni_vmovups(vmm_aux0, table_val(one_off));
+    h->uni_vsubps(vmm_aux0, vmm_aux0, vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::exp_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    // d = exp(s)
+    if (!use_dst_) exp_compute_vector(vmm_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::gelu_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int one_off = 0, half_off = 1, fitting_const_off = 23,
+              sqrt_2_over_pi_off = 24, fitting_const_times_three_off = 29;
+
+    // G1(x) = sqrt(2/pi) * x * (1 + fitting_const * x^2)
+    // G2(x) = sqrt(2/pi) * x * (1 + 3 * fitting_const * x^2)
+    h->uni_vmovups(vmm_aux0, vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_src);
+    h->uni_vmovups(vmm_aux1, table_val(fitting_const_times_three_off));
+    h->uni_vfmadd213ps(vmm_aux1, vmm_src, table_val(one_off));
+    h->uni_vmovups(vmm_aux2, table_val(fitting_const_off));
+    h->uni_vfmadd213ps(vmm_aux2, vmm_src, table_val(one_off));
+    h->uni_vmovups(vmm_src, vmm_aux0);
+    h->uni_vmulps(vmm_src, vmm_src, table_val(sqrt_2_over_pi_off));
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux2);
+
+    // save G2 on stack as tanh uses all the auxiliary registers
+    h->sub(h->rsp, vlen);
+    h->uni_vmovups(h->ptr[h->rsp], vmm_aux1);
+
+    // T = tanh(G1(x))
+    tanh_compute_vector(vmm_src);
+
+    h->uni_vmovups(vmm_aux2, h->ptr[h->rsp]);
+    h->add(h->rsp, vlen);
+
+    // 0.5 * (1 + T) * (1 + G2 * (1 - T))
+    h->uni_vmovups(vmm_aux1, table_val(one_off));
+    h->uni_vsubps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_aux2);
+    h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(one_off));
+    h->uni_vaddps(vmm_src, vmm_src, table_val(one_off));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_aux1);
+    h->uni_vmulps(vmm_src, vmm_src, table_val(half_off));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::swish_compute_vector_bwd(
+        const Vmm &vmm_src) {
+    const int one_off = 0, alpha_off = 25;
+
+    // save src on stack as logistic uses all the auxiliary registers
+    h->sub(h->rsp, vlen);
+    h->uni_vmovups(h->ptr[h->rsp], vmm_src);
+
+    // v = logistic(alpha * x)
+    h->uni_vmulps(vmm_src, vmm_src, table_val(alpha_off));
+    logistic_compute_vector(vmm_src);
+
+    h->uni_vmovups(vmm_aux0, h->ptr[h->rsp]);
+    h->add(h->rsp, vlen);
+
+    // v + x * alpha * v * (1 - v)
+    h->uni_vmovups(vmm_aux1, table_val(one_off));
+    h->uni_vsubps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_src);
+    h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_aux0);
+    h->uni_vmulps(vmm_aux1, vmm_aux1, table_val(alpha_off));
+    h->uni_vaddps(vmm_src, vmm_src, vmm_aux1);
+}
+
 template <cpu_isa_t isa>
 void jit_uni_eltwise_injector_f32<isa>::relu_prepare_table() {
     for (size_t d = 0; d < vlen / sizeof(float); ++d)
@@ -718,23 +935,73 @@ void jit_uni_eltwise_injector_f32<isa>::bounded_relu_prepare_table() {
         h->dd(0);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_f32<isa>::bwd_prepare_table() {
+    // the backward table extends the elu one, so that the forward helpers
+    // (exp, tanh, logistic) can be reused to compute the derivatives
+    elu_prepare_table();
+
+    const unsigned int cvals[] = {
+            0x40000000, //[27] 2.0f
+            0xbf800000, //[28] -1.0f
+            0x3e095d4f, //[29] 3 * 0.044715
+    };
+
+    for (size_t i = 0; i < sizeof(cvals) / sizeof(cvals[0]); ++i) {
+        for (size_t d = 0; d < vlen / sizeof(float); ++d)
+            h->dd(cvals[i]);
+    }
+}
+
 template <cpu_isa_t isa>
 int jit_uni_eltwise_injector_f32<isa>::aux_vecs_count(alg_kind_t alg_) {
-    switch (alg_) {
-        case alg_kind::eltwise_relu: return (alpha_ == 0.f) ? 0 : 2;
-        case alg_kind::eltwise_elu: return 4;
-        case alg_kind::eltwise_tanh: return 5;
-        case alg_kind::eltwise_square: return 0;
-        case alg_kind::eltwise_abs: return 0;
-        case alg_kind::eltwise_sqrt: return 2;
-        case alg_kind::eltwise_swish: return 4;
-        case alg_kind::eltwise_linear: return 1;
-        case alg_kind::eltwise_bounded_relu: return 0;
-        case alg_kind::eltwise_soft_relu: return 4;
-        case alg_kind::eltwise_logistic: return 4;
-        case alg_kind::eltwise_exp: return 3;
-        case alg_kind::eltwise_gelu: return 5;
-        default: assert(!"unsupported eltwise algorithm");
+    using namespace alg_kind;
+    if (is_fwd_) {
+        switch (alg_) {
+            case eltwise_relu_use_dst_for_bwd:
+            case eltwise_relu: return (alpha_ == 0.f) ? 0 : 2;
+            case eltwise_elu_use_dst_for_bwd:
+            case eltwise_elu: return 4;
+            case eltwise_tanh_use_dst_for_bwd:
+            case eltwise_tanh: return 5;
+            case eltwise_square: return 0;
+            case eltwise_abs: return 0;
+            case eltwise_sqrt_use_dst_for_bwd:
+            case eltwise_sqrt: return 2;
+            case eltwise_swish: return 4;
+            case eltwise_linear: return 1;
+            case eltwise_bounded_relu: return 0;
+            case eltwise_soft_relu: return 4;
+            case eltwise_logistic_use_dst_for_bwd:
+            case eltwise_logistic: return 4;
+            case eltwise_exp_use_dst_for_bwd:
+            case eltwise_exp: return 3;
+            case eltwise_gelu: return 5;
+            default: assert(!"unsupported eltwise algorithm");
+        }
+    } else {
+        switch (alg_) {
+            case eltwise_relu_use_dst_for_bwd:
+            case eltwise_relu: return 1;
+            case eltwise_elu_use_dst_for_bwd: return 1;
+            case eltwise_elu: return 4;
+            case eltwise_tanh_use_dst_for_bwd: return 1;
+            case eltwise_tanh: return 5;
+            case eltwise_square: return 0;
+            case eltwise_abs: return 2;
+            case eltwise_sqrt_use_dst_for_bwd:
+            case eltwise_sqrt: return 2;
+            case eltwise_swish: return 4;
+            case eltwise_linear: return 0;
+            case eltwise_bounded_relu: return 2;
+            case eltwise_soft_relu: return 4;
+            case eltwise_logistic_use_dst_for_bwd: return 1;
+            case eltwise_logistic: return 4;
+            case eltwise_exp_use_dst_for_bwd: return 0;
+            case eltwise_exp: return 3;
+            case eltwise_gelu: return 5;
+            default: assert(!"unsupported eltwise algorithm");
+        }
     }
 
     return 0;
@@ -745,28 +1012,73 @@ void jit_uni_eltwise_injector_f32<isa>::compute_body(
         size_t start_idx, size_t end_idx) {
     using namespace alg_kind;
     for (size_t idx = start_idx; idx < end_idx; idx++) {
-        switch (alg_) {
-            case eltwise_relu:
-                if (alpha_ == 0.f)
-                    relu_zero_ns_compute_vector(Vmm(idx));
-                else
-                    relu_compute_vector(Vmm(idx));
-                break;
-            case eltwise_elu: elu_compute_vector(Vmm(idx)); break;
-            case eltwise_tanh: tanh_compute_vector(Vmm(idx)); break;
-            case eltwise_square: square_compute_vector(Vmm(idx)); break;
-            case eltwise_abs: abs_compute_vector(Vmm(idx)); break;
-            case eltwise_sqrt: sqrt_compute_vector(Vmm(idx)); break;
-            case eltwise_swish: swish_compute_vector(Vmm(idx)); break;
-            case eltwise_linear: linear_compute_vector(Vmm(idx)); break;
-            case eltwise_bounded_relu:
-                bounded_relu_compute_vector(Vmm(idx));
-                break;
-            case eltwise_soft_relu: soft_relu_compute_vector(Vmm(idx)); break;
-            case eltwise_logistic: logistic_compute_vector(Vmm(idx)); break;
-            case eltwise_exp: exp_compute_vector(Vmm(idx)); break;
-            case eltwise_gelu: gelu_compute_vector(Vmm(idx)); break;
-            default: assert(!"unsupported eltwise algorithm");
+        if (is_fwd_) {
+            switch (alg_) {
+                case eltwise_relu_use_dst_for_bwd:
+                case eltwise_relu:
+                    if (alpha_ == 0.f)
+                        relu_zero_ns_compute_vector(Vmm(idx));
+                    else
+                        relu_compute_vector(Vmm(idx));
+                    break;
+                case eltwise_elu_use_dst_for_bwd:
+                case eltwise_elu: elu_compute_vector(Vmm(idx)); break;
+                case eltwise_tanh_use_dst_for_bwd:
+                case eltwise_tanh: tanh_compute_vector(Vmm(idx)); break;
+                case eltwise_square: square_compute_vector(Vmm(idx)); break;
+                case eltwise_abs: abs_compute_vector(Vmm(idx)); break;
+                case eltwise_sqrt_use_dst_for_bwd:
+                case eltwise_sqrt: sqrt_compute_vector(Vmm(idx)); break;
+                case eltwise_swish: swish_compute_vector(Vmm(idx)); break;
+                case eltwise_linear: linear_compute_vector(Vmm(idx)); break;
+                case eltwise_bounded_relu:
+                    bounded_relu_compute_vector(Vmm(idx));
+                    break;
+                case eltwise_soft_relu:
+                    soft_relu_compute_vector(Vmm(idx));
+                    break;
+                case eltwise_logistic_use_dst_for_bwd:
+                case eltwise_logistic:
+                    logistic_compute_vector(Vmm(idx));
+                    break;
+                case eltwise_exp_use_dst_for_bwd:
+                case eltwise_exp: exp_compute_vector(Vmm(idx)); break;
+                case eltwise_gelu: gelu_compute_vector(Vmm(idx)); break;
+                default: assert(!"unsupported eltwise algorithm");
+            }
+        } else {
+            switch (alg_) {
+                case eltwise_relu_use_dst_for_bwd:
+                case eltwise_relu: relu_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_elu_use_dst_for_bwd:
+                case eltwise_elu: elu_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_tanh_use_dst_for_bwd:
+                case eltwise_tanh: tanh_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_square:
+                    square_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_abs: abs_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_sqrt_use_dst_for_bwd:
+                case eltwise_sqrt: sqrt_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_swish: swish_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_linear:
+                    linear_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_bounded_relu:
+                    bounded_relu_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_soft_relu:
+                    soft_relu_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_logistic_use_dst_for_bwd:
+                case eltwise_logistic:
+                    logistic_compute_vector_bwd(Vmm(idx));
+                    break;
+                case eltwise_exp_use_dst_for_bwd:
+                case eltwise_exp: exp_compute_vector_bwd(Vmm(idx)); break;
+                case eltwise_gelu: gelu_compute_vector_bwd(Vmm(idx)); break;
+                default: assert(!"unsupported eltwise algorithm");
+            }
         }
         if (scale_ != 1.f) {
             h->uni_vmulps(Vmm(idx), Vmm(idx), h->ptr[p_table]);
@@ -797,8 +1109,18 @@ void jit_uni_eltwise_injector_f32<isa>::prepare_table(bool gen_table) {
         for (size_t d = 0; d < vlen / sizeof(float); ++d)
             h->dd(float2int(scale_));
 
+        if (!is_fwd_) {
+            bwd_prepare_table();
+            return;
+        }
+
         switch (alg_) {
+            case eltwise_relu_use_dst_for_bwd:
             case eltwise_relu: relu_prepare_table(); break;
+            case eltwise_elu_use_dst_for_bwd:
+            case eltwise_tanh_use_dst_for_bwd:
+            case eltwise_logistic_use_dst_for_bwd:
+            case eltwise_exp_use_dst_for_bwd:
             case eltwise_elu:
             case eltwise_tanh:
             case eltwise_logistic:
@@ -806,6 +1128,7 @@ void jit_uni_eltwise_injector_f32<isa>::prepare_table(bool gen_table) {
             case eltwise_gelu: elu_prepare_table(); break;
             case eltwise_soft_relu: soft_relu_prepare_table(); break;
             case eltwise_abs: abs_prepare_table(); break;
+            case eltwise_sqrt_use_dst_for_bwd:
             case eltwise_sqrt: sqrt_prepare_table(); break;
             case eltwise_swish: elu_prepare_table(); break;
             case eltwise_linear: linear_prepare_table(); break;
@@ -1427,11 +1750,10 @@ void jit_uni_relu_kernel_int<avx512_common>::store_8bit(
 }
 
 template <cpu_isa_t isa>
-struct jit_uni_kernel_fwd : public jit_uni_eltwise_kernel,
-                            public jit_generator {
-    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel_fwd)
+struct jit_uni_kernel : public jit_uni_eltwise_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel)
 
-    jit_uni_kernel_fwd(const eltwise_desc_t &desc)
+    jit_uni_kernel(const eltwise_desc_t &desc)
         : jit_uni_eltwise_kernel(desc)
         , jit_generator()
         , bf16_injector_(nullptr)
@@ -1445,17 +1767,15 @@ struct jit_uni_kernel_fwd : public jit_uni_eltwise_kernel,
                     k_mask_cvt, k_tail_mask, k_full_mask, bf16_emu_);
         }
 
-        eltwise_injector_
-                = new jit_uni_eltwise_injector_f32<isa>(this, desc.alg_kind,
-                        desc.alpha, desc.beta, 1.f, false, r9, Opmask(1));
+        // on backward the injector computes the derivative in place of
+        // src (or dst), which is then multiplied by diff_dst
+        eltwise_injector_ = new jit_uni_eltwise_injector_f32<isa>(this,
+                desc.alg_kind, desc.alpha, desc.beta, 1.f, false, r9,
+                Opmask(1), !is_bwd());
 
         using namespace alg_kind;
 
-        assert(is_bwd() == false);
-        assert(utils::one_of(desc.alg_kind, eltwise_tanh, eltwise_elu,
-                eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
-                eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
-                eltwise_exp, eltwise_gelu, eltwise_swish));
+        assert(IMPLICATION(!is_bwd(), desc.alg_kind != eltwise_relu));
 
         preamble();
 
@@ -1467,6 +1787,8 @@ struct jit_uni_kernel_fwd : public jit_uni_eltwise_kernel,
 
         Reg64 param = abi_param1;
         mov(reg_from, ptr[param + GET_OFF(from)]);
+        if (is_bwd())
+            mov(reg_for_comparison, ptr[param + GET_OFF(for_comparison)]);
         mov(reg_to, ptr[param + GET_OFF(to)]);
         mov(reg_work_amount, ptr[param + GET_OFF(work_amount)]);
         eltwise_injector_->load_table_addr();
@@ -1479,18 +1801,12 @@ struct jit_uni_kernel_fwd : public jit_uni_eltwise_kernel,
 
         L(vectorized_loop_start);
 
-        if (is_bf16()) {
-            bf16_injector_->load_bf16_cvt_to_f32(vmm_src.getIdx(), reg_from);
-            eltwise_injector_->compute_vector(vmm_src.getIdx());
-            bf16_injector_->cvt_f32_to_bf16_store(vmm_src.getIdx(), reg_to);
-        } else {
-            uni_vmovups(vmm_src, ptr[reg_from]);
-            eltwise_injector_->compute_vector(vmm_src.getIdx());
-            uni_vmovups(ptr[reg_to], vmm_src);
-        }
+        compute_step(false);
+
         auto shift = vlen();
         add(reg_from, shift);
         add(reg_to, shift);
+        if (is_bwd()) add(reg_for_comparison, shift);
 
         sub(reg_work_amount, simd_w());
         cmp(reg_work_amount, simd_w());
@@ -1502,19 +1818,12 @@ struct jit_uni_kernel_fwd : public jit_uni_eltwise_kernel,
 
         cmp(reg_work_amount, 0);
         jle(reminder_loop_end, T_NEAR);
-        if (is_bf16()) {
-            bf16_injector_->load_bf16_cvt_to_f32(
-                    vmm_src.getIdx(), reg_from, true);
-            eltwise_injector_->compute_vector(vmm_src.getIdx());
-            bf16_injector_->cvt_f32_to_bf16_store(
-                    vmm_src.getIdx(), reg_to, true);
-        } else {
-            movss(xmm_src, ptr[reg_from]);
-            eltwise_injector_->compute_vector(xmm_src.getIdx());
-            movss(ptr[reg_to], xmm_src);
-        }
+
+        compute_step(true);
+
         add(reg_from, dtype_size());
         add(reg_to, dtype_size());
+        if (is_bwd()) add(reg_for_comparison, dtype_size());
 
         dec(reg_work_amount);
         jmp(reminder_loop_start, T_NEAR);
@@ -1530,7 +1839,7 @@ struct jit_uni_kernel_fwd : public jit_uni_eltwise_kernel,
         ker_ = (decltype(ker_))this->getCode();
     }
 
-    ~jit_uni_kernel_fwd() {
+    ~jit_uni_kernel() {
         delete eltwise_injector_;
         delete bf16_injector_;
         delete bf16_emu_;
@@ -1547,13 +1856,44 @@ private:
     }
     int simd_w() { return vlen() / dtype_size(); }
 
+    void load(const Vmm &vmm, Reg64 reg_addr, bool tail) {
+        if (is_bf16())
+            bf16_injector_->load_bf16_cvt_to_f32(vmm.getIdx(), reg_addr, tail);
+        else if (tail)
+            movss(Xmm(vmm.getIdx()), ptr[reg_addr]);
+        else
+            uni_vmovups(vmm, ptr[reg_addr]);
+    }
+
+    void store(Reg64 reg_addr, const Vmm &vmm, bool tail) {
+        if (is_bf16())
+            bf16_injector_->cvt_f32_to_bf16_store(vmm.getIdx(), reg_addr, tail);
+        else if (tail)
+            movss(ptr[reg_addr], Xmm(vmm.getIdx()));
+        else
+            uni_vmovups(ptr[reg_addr], vmm);
+    }
+
+    void compute_step(bool tail) {
+        // the injector may clobber any register but vmm_src, so diff_dst
+        // is loaded only after the derivative is computed
+        load(vmm_src, is_bwd() ? reg_for_comparison : reg_from, tail);
+        eltwise_injector_->compute_vector(vmm_src.getIdx());
+        if (is_bwd()) {
+            load(vmm_diff_dst, reg_from, tail);
+            uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
+        }
+        store(reg_to, vmm_src, tail);
+    }
+
     Reg64 reg_from = rax;
+    Reg64 reg_for_comparison = rdx;
     Reg64 reg_to = r8;
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
 
-    Xmm xmm_src = Xmm(1);
     Vmm vmm_src = Vmm(1);
+    Vmm vmm_diff_dst = Vmm(2);
     jit_uni_eltwise_injector_f32<isa> *eltwise_injector_;
 
     /* bf16 support */
@@ -1588,7 +1928,11 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init() {
             && utils::one_of(desc()->alg_kind, eltwise_tanh, eltwise_elu,
                     eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
                     eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
-                    eltwise_exp, eltwise_gelu, eltwise_swish)
+                    eltwise_exp, eltwise_gelu, eltwise_swish,
+                    eltwise_relu_use_dst_for_bwd, eltwise_tanh_use_dst_for_bwd,
+                    eltwise_elu_use_dst_for_bwd, eltwise_sqrt_use_dst_for_bwd,
+                    eltwise_logistic_use_dst_for_bwd,
+                    eltwise_exp_use_dst_for_bwd)
             && utils::one_of(d_type, bf16, f32);
 
     bool ok = true && mayiuse(isa) && is_fwd()
@@ -1616,7 +1960,7 @@ jit_uni_eltwise_fwd_t<isa, d_type>::jit_uni_eltwise_fwd_t(const pd_t *apd)
             else
                 kernel_ = new jit_uni_relu_kernel_float<isa>(desc);
             break;
-        default: kernel_ = new jit_uni_kernel_fwd<isa>(desc);
+        default: kernel_ = new jit_uni_kernel<isa>(desc);
     }
 }
 
@@ -1657,16 +2001,14 @@ void jit_uni_eltwise_fwd_t<isa, d_type>::execute_forward(
 
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_bwd_t<isa, d_type>::pd_t::init() {
-    bool ok = true && !is_fwd()
-            && utils::one_of(desc()->alg_kind, alg_kind::eltwise_relu)
-            && src_md()->data_type == d_type
+    bool ok = true && !is_fwd() && data_md()->data_type == d_type
             && IMPLICATION(desc()->data_desc.data_type == data_type::bf16,
                     mayiuse(avx512_core))
             && !has_zero_dim_memory() && mayiuse(isa)
             && set_default_formats_common()
-            && memory_desc_wrapper(src_md()).is_dense()
+            && memory_desc_wrapper(data_md()).is_dense()
             && memory_desc_wrapper(diff_dst_md())
-                    == memory_desc_wrapper(src_md())
+                    == memory_desc_wrapper(data_md())
             && attr()->has_default_values();
 
     return ok ? status::success : status::unimplemented;
@@ -1680,7 +2022,7 @@ jit_uni_eltwise_bwd_t<isa, d_type>::jit_uni_eltwise_bwd_t(const pd_t *apd)
         case alg_kind::eltwise_relu:
             kernel_ = new jit_uni_relu_kernel_float<isa>(desc);
             break;
-        default: assert(!"unknown eltwise alg_kind");
+        default: kernel_ = new jit_uni_kernel<isa>(desc);
     }
 }
 
@@ -1692,11 +2034,12 @@ jit_uni_eltwise_bwd_t<isa, d_type>::~jit_uni_eltwise_bwd_t() {
 template <cpu_isa_t isa, data_type_t d_type>
 void jit_uni_eltwise_bwd_t<isa, d_type>::execute_backward(
         const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto src = CTX_IN_MEM(
+            const data_t *, pd()->use_dst() ? DNNL_ARG_DST : DNNL_ARG_SRC);
     auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
-    const memory_desc_wrapper data_d(pd()->src_md());
+    const memory_desc_wrapper data_d(pd()->data_md());
     const memory_desc_wrapper diff_data_d(pd()->diff_src_md());
 
     const size_t nelems = data_d.nelems();
@@ -35,14 +35,26 @@ struct jit_uni_eltwise_injector_f32 {
     using Vmm = typename utils::conditional3<isa == sse41, Xbyak::Xmm,
             isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
 
+    // When is_fwd is false the injector computes the derivative of the
+    // function instead of the function itself, taking dst rather than src
+    // for the *_use_dst_for_bwd algorithms. The caller is responsible for
+    // multiplying the result by diff_dst.
     jit_uni_eltwise_injector_f32(jit_generator *host, alg_kind_t alg,
             float alpha, float beta, float scale, bool save_state = true,
             Xbyak::Reg64 p_table = Xbyak::util::rax,
-            Xbyak::Opmask k_mask = Xbyak::Opmask(1))
+            Xbyak::Opmask k_mask = Xbyak::Opmask(1), bool is_fwd = true)
         : alg_(alg)
         , alpha_(alpha)
         , beta_(beta)
         , scale_(scale)
+        , is_fwd_(is_fwd)
+        , use_dst_(!is_fwd
+                  && utils::one_of(alg, alg_kind::eltwise_relu_use_dst_for_bwd,
+                          alg_kind::eltwise_tanh_use_dst_for_bwd,
+                          alg_kind::eltwise_elu_use_dst_for_bwd,
+                          alg_kind::eltwise_sqrt_use_dst_for_bwd,
+                          alg_kind::eltwise_logistic_use_dst_for_bwd,
+                          alg_kind::eltwise_exp_use_dst_for_bwd))
         , h(host)
         , save_state_(save_state)
         , p_table(p_table)
@@ -52,7 +64,10 @@ struct jit_uni_eltwise_injector_f32 {
         assert(utils::one_of(alg_, eltwise_relu, eltwise_tanh, eltwise_elu,
                 eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
                 eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
-                eltwise_exp, eltwise_gelu, eltwise_swish));
+                eltwise_exp, eltwise_gelu, eltwise_swish,
+                eltwise_relu_use_dst_for_bwd, eltwise_tanh_use_dst_for_bwd,
+                eltwise_elu_use_dst_for_bwd, eltwise_sqrt_use_dst_for_bwd,
+                eltwise_logistic_use_dst_for_bwd, eltwise_exp_use_dst_for_bwd));
     }
 
     jit_uni_eltwise_injector_f32(jit_generator *host,
@@ -71,6 +86,8 @@ struct jit_uni_eltwise_injector_f32 {
     const float alpha_;
     const float beta_;
     const float scale_;
+    const bool is_fwd_;
+    const bool use_dst_;
 
     jit_generator *const h;
 
@@ -84,6 +101,7 @@ private:
     enum {
         _cmp_lt_os = jit_generator::_cmp_lt_os,
         _cmp_le_os = jit_generator::_cmp_le_os,
+        _cmp_nlt_us = jit_generator::_cmp_nlt_us,
         _cmp_nle_us = jit_generator::_cmp_nle_us,
         _op_floor = jit_generator::_op_floor
     };
@@ -129,6 +147,24 @@ private:
     void gelu_compute_vector(const Vmm &vmm_src);
     void swish_compute_vector(const Vmm &vmm_src);
 
+    void relu_compute_vector_bwd(const Vmm &vmm_src);
+    void elu_compute_vector_bwd(const Vmm &vmm_src);
+    void tanh_compute_vector_bwd(const Vmm &vmm_src);
+    void square_compute_vector_bwd(const Vmm &vmm_src);
+    void abs_compute_vector_bwd(const Vmm &vmm_src);
+    void sqrt_compute_vector_bwd(const Vmm &vmm_src);
+    void linear_compute_vector_bwd(const Vmm &vmm_src);
+    void bounded_relu_compute_vector_bwd(const Vmm &vmm_src);
+    void soft_relu_compute_vector_bwd(const Vmm &vmm_src);
+    void logistic_compute_vector_bwd(const Vmm &vmm_src);
+    void exp_compute_vector_bwd(const Vmm &vmm_src);
+    void gelu_compute_vector_bwd(const Vmm &vmm_src);
+    void swish_compute_vector_bwd(const Vmm &vmm_src);
+
+    void compute_cmp_mask(const Vmm &vmm_src,
+            const Xbyak::Operand &compare_operand, int cmp_predicate);
+    void blend_with_mask(const Vmm &vmm_dst, const Xbyak::Operand &src);
+
     void relu_prepare_table();
     void elu_prepare_table();
     void soft_relu_prepare_table();
@@ -136,6 +172,7 @@ private:
     void sqrt_prepare_table();
     void linear_prepare_table();
     void bounded_relu_prepare_table();
+    void bwd_prepare_table();
 };
 
 struct jit_uni_eltwise_kernel;
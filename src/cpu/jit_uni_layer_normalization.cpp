@@ -34,8 +34,8 @@ using namespace memory_tracking::names;
 
 void jit_uni_layer_normalization_fwd_t::execute_forward(
         const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
 
     float *mean, *variance;
@@ -57,6 +57,7 @@ void jit_uni_layer_normalization_fwd_t::execute_forward(
 
     const dim_t N = pd()->across_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const size_t row_size = C_padded * src_d.data_type_size();
 
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
@@ -66,9 +67,9 @@ void jit_uni_layer_normalization_fwd_t::execute_forward(
         auto v_variance = calculate_stats ? 0 : variance[n];
 
         if (calculate_stats)
-            (*stat_kernel_)(&src[n * C_padded], &v_mean, &v_variance);
+            (*stat_kernel_)(&src[n * row_size], &v_mean, &v_variance);
 
-        (*data_kernel_)(&src[n * C_padded], &dst[n * C_padded], scaleshift,
+        (*data_kernel_)(&src[n * row_size], &dst[n * row_size], scaleshift,
                 &v_mean, &v_variance);
 
         if (calculate_stats) {
@@ -83,10 +84,10 @@ void jit_uni_layer_normalization_fwd_t::execute_forward(
 void jit_uni_layer_normalization_bwd_t::execute_backward(
         const exec_ctx_t &ctx) const {
     auto scratchpad = ctx.get_scratchpad_grantor();
-    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
-    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto diff_dst = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_DST);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
-    auto diff_src = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+    auto diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
     auto diff_scaleshift = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
     const float *mean, *variance;
@@ -103,6 +104,7 @@ void jit_uni_layer_normalization_bwd_t::execute_backward(
     const dim_t N = pd()->across_axis();
     const dim_t C = pd()->norm_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const size_t row_size = C_padded * src_d.data_type_size();
 
     float *reduce = scratchpad.template get<float>(key_lnorm_reduction);
     if (diff_scaleshift == nullptr)
@@ -120,7 +122,7 @@ void jit_uni_layer_normalization_bwd_t::execute_backward(
             my_diff_beta[c] = 0.;
         }
         for (dim_t n = N_s; n < N_e; n++) {
-            (*diff_ss_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
+            (*diff_ss_kernel_)(&src[n * row_size], &diff_dst[n * row_size],
                     my_diff_gamma, my_diff_beta, &mean[n], &variance[n]);
         }
     });
@@ -147,8 +149,8 @@ void jit_uni_layer_normalization_bwd_t::execute_backward(
         }
 
         for (dim_t n = N_s; n < N_e; n++) {
-            (*diff_data_kernel_)(&src[n * C_padded], &diff_dst[n * C_padded],
-                    &diff_src[n * C_padded], my_diff_gamma, my_diff_beta,
+            (*diff_data_kernel_)(&src[n * row_size], &diff_dst[n * row_size],
+                    &diff_src[n * row_size], my_diff_gamma, my_diff_beta,
                     scaleshift, &mean[n], &variance[n]);
         }
     });
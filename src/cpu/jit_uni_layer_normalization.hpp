@@ -33,6 +33,7 @@ namespace cpu {
 static status_t fill_compatible_stats_md(
         const memory_desc_t &src_md, memory_desc_t &stat_md) {
     stat_md = src_md;
+    stat_md.data_type = data_type::f32;
     stat_md.ndims -= 1;
     return memory_desc_init_by_blocking_desc(
             stat_md, src_md.format_desc.blocking);
@@ -79,15 +80,21 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_impl_t {
             const memory_desc_wrapper src_d(src_md());
             const memory_desc_wrapper stat_d(stat_md());
 
+            const data_type_t dt = src_md()->data_type;
             bool ok = true && is_fwd() && !has_zero_dim_memory()
-                    && utils::everyone_is(f32, src_md()->data_type,
-                            stat_md()->data_type, dst_md()->data_type)
+                    && utils::one_of(dt, f32, bf16)
+                    && dst_md()->data_type == dt
+                    && stat_md()->data_type == f32
+                    && IMPLICATION(dt == bf16, mayiuse(avx512_core))
                     && IMPLICATION(
                             use_scaleshift(), weights_md()->data_type == f32)
                     && src_d.is_blocking_desc()
                     && src_d.blocking_desc().strides[ndims() - 1]
                             == 1 //plain format, last logical dim is last physical
-                    && attr()->has_default_values();
+                    && attr_ok()
+                    // post-ops are applied by the jit kernel only
+                    && IMPLICATION(
+                            !attr()->has_default_values(), mayiuse(avx2));
             if (!ok) return status::unimplemented;
 
             CHECK(fill_compatible_stats_md(*src_md(), reordered_stat_md_));
@@ -220,10 +227,14 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_impl_t {
             const memory_desc_wrapper src_d(src_md());
             const memory_desc_wrapper stat_d(stat_md());
 
+            const data_type_t dt = src_md()->data_type;
             bool ok = true && is_bwd() && !has_zero_dim_memory()
                     && set_default_formats_common()
-                    && utils::everyone_is(f32, src_md()->data_type,
-                            diff_src_md()->data_type, stat_md()->data_type)
+                    && utils::one_of(dt, f32, bf16)
+                    && utils::everyone_is(dt, diff_src_md()->data_type,
+                            diff_dst_md()->data_type)
+                    && stat_md()->data_type == f32
+                    && IMPLICATION(dt == bf16, mayiuse(avx512_core))
                     && IMPLICATION(use_scaleshift(),
                             utils::everyone_is(f32, weights_md()->data_type,
                                     diff_weights_md()->data_type))
@@ -18,23 +18,111 @@
 #define CPU_JIT_UNI_LAYER_NORMALIZATION_KERNELS_HPP
 
 #include "cpu_layer_normalization_pd.hpp"
+#include "jit_avx512_core_bf16cvt.hpp"
 #include "jit_generator.hpp"
+#include "jit_uni_eltwise.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
-class statistics_kernel_t : jit_generator {
+/* The kernels process f32 or bf16 data with avx2 instructions; the statistics
+ * and the scale and shift are always f32. The bf16 data requires avx512_core,
+ * the stores use the bf16 emulation unless vcvtneps2bf16 is available. */
+class lnorm_kernel_base_t : protected jit_generator {
+protected:
+    lnorm_kernel_base_t(data_type_t dt) : dt_(dt), bf16_emu_(nullptr) {
+        if (dt_ == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                    bf16_emu_reserv_4);
+    }
+    ~lnorm_kernel_base_t() { delete bf16_emu_; }
+
+    const data_type_t dt_;
+
+    void prepare_bf16() {
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+    }
+
+    // loads nelems (1 or simd_w_) values starting from reg[idx]
+    void load(const Xbyak::Ymm &ymm, const Xbyak::Reg64 &reg, int nelems,
+            dim_t idx, data_type_t dt = data_type::f32) {
+        using namespace Xbyak;
+        assert(utils::one_of(nelems, 1, simd_w_));
+        const Xmm xmm = Xmm(ymm.getIdx());
+        const size_t offt = idx * types::data_type_size(dt);
+        if (dt == data_type::bf16) {
+            if (nelems == 1) {
+                vpxor(xmm, xmm, xmm);
+                vpinsrw(xmm, xmm, word[reg + offt], 0);
+            } else
+                vpmovzxwd(ymm, xword[reg + offt]);
+            vpslld(ymm, ymm, 16);
+        } else if (nelems == 1)
+            vmovss(xmm, dword[reg + offt]);
+        else
+            vmovups(ymm, yword[reg + offt]);
+    }
+
+    // stores nelems (1 or simd_w_) values starting from reg[idx], the bf16
+    // conversion destroys the source register
+    void store(const Xbyak::Ymm &ymm, const Xbyak::Reg64 &reg, int nelems,
+            dim_t idx, data_type_t dt = data_type::f32) {
+        using namespace Xbyak;
+        assert(utils::one_of(nelems, 1, simd_w_));
+        const Xmm xmm = Xmm(ymm.getIdx());
+        const size_t offt = idx * types::data_type_size(dt);
+        if (dt == data_type::bf16) {
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(ymm, Zmm(ymm.getIdx()));
+            else
+                vcvtneps2bf16(xmm, ymm);
+            if (nelems == 1)
+                vpextrw(word[reg + offt], xmm, 0);
+            else
+                vmovdqu(xword[reg + offt], xmm);
+        } else if (nelems == 1)
+            vmovss(dword[reg + offt], xmm);
+        else
+            vmovups(yword[reg + offt], ymm);
+    }
+
+    void load_data(const Xbyak::Ymm &ymm, const Xbyak::Reg64 &reg, int nelems,
+            dim_t idx) {
+        load(ymm, reg, nelems, idx, dt_);
+    }
+
+    void store_data(const Xbyak::Ymm &ymm, const Xbyak::Reg64 &reg,
+            int nelems, dim_t idx) {
+        store(ymm, reg, nelems, idx, dt_);
+    }
+
+    const int simd_w_ = 8;
+
+private:
+    Xbyak::Zmm bf16_emu_reserv_1 = Xbyak::Zmm(28);
+    Xbyak::Zmm bf16_emu_reserv_2 = Xbyak::Zmm(29);
+    Xbyak::Zmm bf16_emu_reserv_3 = Xbyak::Zmm(30);
+    Xbyak::Zmm bf16_emu_reserv_4 = Xbyak::Zmm(31);
+    Xbyak::Reg64 bf16_emu_scratch = Xbyak::util::r15;
+
+    bf16_emulation_t *bf16_emu_;
+};
+
+class statistics_kernel_t : lnorm_kernel_base_t {
 public:
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_layer_normalization_fwd_t::statistics_kernel);
     statistics_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis()), ker_(nullptr) {
+        : lnorm_kernel_base_t(pd->src_md()->data_type)
+        , C_(pd->norm_axis())
+        , ker_(nullptr) {
         if (mayiuse(avx2)) { generate(); }
     }
     ~statistics_kernel_t() {}
 
-    void operator()(const float *src, float *mean, float *var) {
+    void operator()(const void *src, float *mean, float *var) {
         if (ker_) {
             ker_args args;
             args.src = src;
@@ -42,17 +130,19 @@ public:
             args.var = var;
             ker_(&args);
         } else {
+            assert(dt_ == data_type::f32);
+            const float *src_f32 = (const float *)src;
             float v_mean = 0;
             PRAGMA_OMP_SIMD(reduction(+ : v_mean))
             for (dim_t c = 0; c < C_; ++c) {
-                v_mean += src[c];
+                v_mean += src_f32[c];
             }
             v_mean /= C_;
 
             float v_variance = 0;
             PRAGMA_OMP_SIMD(reduction(+ : v_variance))
             for (dim_t c = 0; c < C_; ++c) {
-                auto m = src[c] - v_mean;
+                auto m = src_f32[c] - v_mean;
                 v_variance += m * m;
             }
             v_variance /= C_;
@@ -65,10 +155,9 @@ public:
 private:
     int C_;
     int unroll_factor_ = 8;
-    int simd_w_ = 8;
 
     struct ker_args {
-        const float *src;
+        const void *src;
         float *mean;
         float *var;
     };
@@ -86,7 +175,7 @@ private:
 
         // compute mean
         compute([=](Ymm ymm_dst) { vaddps(ymm_dst, ymm_dst, ymm_src); });
-        movss(ptr[reg_mean], Xmm(0));
+        vmovss(ptr[reg_mean], Xmm(0));
 
         //compute var
         vbroadcastss(ymm_mean, Xmm(0));
@@ -94,22 +183,13 @@ private:
             vsubps(ymm_src, ymm_mean, ymm_src);
             vfmadd231ps(ymm_dst, ymm_src, ymm_src);
         });
-        movss(ptr[reg_var], Xmm(0));
+        vmovss(ptr[reg_var], Xmm(0));
 
         postamble();
 
         ker_ = getCode<decltype(ker_)>();
     }
 
-    void load_src(Xbyak::Ymm &ymm_src, int nelems, size_t offt = 0) {
-        if (nelems == 1)
-            movss(Xbyak::Xmm(ymm_src.getIdx()), dword[reg_src + offt]);
-        else if (nelems == simd_w_)
-            vmovups(ymm_src, yword[reg_src + offt]);
-        else
-            assert(!"unsupported nelems for load src");
-    }
-
     template <typename F>
     void compute(F op) {
         using namespace Xbyak;
@@ -127,8 +207,8 @@ private:
             // unrolled loop
             for (int i = 0; i < C_vecs / unroll; i++)
                 for (int j = 0; j < unroll; j++) {
-                    load_src(ymm_src, simd_w_,
-                            (i * unroll + j) * simd_w_ * sizeof(float));
+                    load_data(ymm_src, reg_src, simd_w_,
+                            (i * unroll + j) * simd_w_);
                     op(Ymm(j));
                 }
 
@@ -142,7 +222,7 @@ private:
 
             // unrolled loop remainder
             for (int i = utils::rnd_dn(C_vecs, unroll); i < C_vecs; i++) {
-                load_src(ymm_src, simd_w_, i * simd_w_ * sizeof(float));
+                load_data(ymm_src, reg_src, simd_w_, i * simd_w_);
                 op(Ymm(0));
             }
 
@@ -156,15 +236,15 @@ private:
 
         // vector remainder
         for (int i = utils::rnd_dn(C_, simd_w_); i < C_; i++) {
-            load_src(ymm_src, 1, i * sizeof(float));
+            load_data(ymm_src, reg_src, 1, i);
             op(Ymm(0));
         }
 
         // scale
         Xmm xmm_tmp = Xmm(ymm_src.getIdx());
         mov(reg_tmp, float2int(C_));
-        movq(xmm_tmp, reg_tmp);
-        divss(Xmm(0), xmm_tmp);
+        vmovq(xmm_tmp, reg_tmp);
+        vdivss(Xmm(0), Xmm(0), xmm_tmp);
     };
 
     Xbyak::Reg64 reg_param = abi_param1;
@@ -178,19 +258,28 @@ private:
     Xbyak::Ymm ymm_mean = Xbyak::Ymm(15);
 };
 
-class data_kernel_t : jit_generator {
+class data_kernel_t : lnorm_kernel_base_t {
 public:
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_layer_normalization_fwd_t::data_kernel);
     data_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis())
+        : lnorm_kernel_base_t(pd->src_md()->data_type)
+        , C_(pd->norm_axis())
         , use_scaleshift_(pd->use_scaleshift())
         , eps_(pd->desc()->layer_norm_epsilon)
+        , post_ops_(pd->attr()->post_ops_)
         , ker_(nullptr) {
+        for (int idx = 0; idx < post_ops_.len_; ++idx)
+            eltwise_injectors_[idx] = post_ops_.entry_[idx].is_eltwise(false)
+                    ? new injector_t(this, post_ops_.entry_[idx].eltwise)
+                    : nullptr;
         if (mayiuse(avx2)) { generate(); }
     }
-    ~data_kernel_t() {}
-    void operator()(const float *src, float *dst, const float *ss,
+    ~data_kernel_t() {
+        for (int idx = 0; idx < post_ops_.len_; ++idx)
+            delete eltwise_injectors_[idx];
+    }
+    void operator()(const void *src, void *dst, const float *ss,
             const float *mean, const float *var) {
         if (ker_) {
             ker_args args;
@@ -202,55 +291,68 @@ public:
             args.inv_sqrtvar = &inv_sqrtvar;
             ker_(&args);
         } else {
+            // post-ops are not supported without the jit kernel
+            assert(dt_ == data_type::f32 && post_ops_.len_ == 0);
+            const float *src_f32 = (const float *)src;
+            float *dst_f32 = (float *)dst;
             float inv_sqrtvar = 1. / sqrtf(*var + eps_);
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; ++c) {
                 const float sm = (use_scaleshift_ ? ss[c] : 1.0f) * inv_sqrtvar;
                 const float sv = use_scaleshift_ ? ss[C_ + c] : 0;
-                dst[c] = sm * (src[c] - *mean) + sv;
+                dst_f32[c] = sm * (src_f32[c] - *mean) + sv;
             }
         }
     }
 
 private:
+    using injector_t = jit_uni_eltwise_injector_f32<avx2>;
+
     int C_;
     bool use_scaleshift_;
     const float eps_;
-    int simd_w_ = 8;
+    const post_ops_t &post_ops_;
+
+    injector_t *eltwise_injectors_[post_ops_t::capacity];
 
     struct ker_args {
-        const float *src;
-        float *dst;
+        const void *src;
+        void *dst;
         const float *ss;
         const float *mean;
         const float *inv_sqrtvar;
     };
     void (*ker_)(const ker_args *args);
 
-    void load(Xbyak::Ymm &ymm_src, Xbyak::Reg64 reg_src, int nelems,
-            size_t offt) {
-        if (nelems == 1)
-            movss(Xbyak::Xmm(ymm_src.getIdx()), dword[reg_src + offt]);
-        else if (nelems == simd_w_)
-            vmovups(ymm_src, yword[reg_src + offt]);
-        else
-            assert(!"unsupported nelems");
-    }
+    // sum and eltwise post-ops are applied in the order of appending
+    void apply_post_ops(int nelems, dim_t idx) {
+        using namespace Xbyak;
 
-    void store(Xbyak::Ymm &ymm_dst, Xbyak::Reg64 reg_dst, int nelems,
-            size_t offt) {
-        if (nelems == 1)
-            movss(dword[reg_dst + offt], Xbyak::Xmm(ymm_dst.getIdx()));
-        else if (nelems == simd_w_)
-            vmovups(yword[reg_dst + offt], ymm_dst);
-        else
-            assert(!"unsupported nelems");
+        for (int i = 0; i < post_ops_.len_; ++i) {
+            const auto &e = post_ops_.entry_[i];
+            if (e.is_eltwise(false)) {
+                eltwise_injectors_[i]->compute_vector(ymm_data.getIdx());
+                continue;
+            }
+
+            load_data(ymm_sum, reg_dst, nelems, idx);
+            if (e.sum.scale == 1.f)
+                vaddps(ymm_data, ymm_data, ymm_sum);
+            else {
+                Xmm xmm_tmp = Xmm(ymm_tmp.getIdx());
+                mov(reg_tmp, float2int(e.sum.scale));
+                vmovq(xmm_tmp, reg_tmp);
+                vbroadcastss(ymm_tmp, xmm_tmp);
+                vfmadd231ps(ymm_data, ymm_sum, ymm_tmp);
+            }
+        }
     }
 
     void generate() {
         using namespace Xbyak;
 
         preamble();
+        prepare_bf16();
 #define PARAM_OFF(x) offsetof(ker_args, x)
         mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
         mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
@@ -258,36 +360,41 @@ private:
 
         Xmm xmm_tmp = Xmm(ymm_tmp.getIdx());
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(mean)]);
-        movss(xmm_tmp, dword[reg_tmp]);
+        vmovss(xmm_tmp, dword[reg_tmp]);
         vbroadcastss(ymm_mean, xmm_tmp);
 
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
-        movss(xmm_tmp, dword[reg_tmp]);
+        vmovss(xmm_tmp, dword[reg_tmp]);
         vbroadcastss(ymm_inv_sqrtvar, xmm_tmp);
 #undef PARAM_OFF
 
         const int C_vecs = C_ / simd_w_;
 
-        auto op = [=](int nelems, size_t offt) {
+        auto op = [=](int nelems, dim_t idx) {
             if (use_scaleshift_) {
-                load(ymm_gamma, reg_ss, nelems, offt);
-                load(ymm_beta, reg_ss, nelems, offt + C_ * sizeof(float));
+                load(ymm_gamma, reg_ss, nelems, idx);
+                load(ymm_beta, reg_ss, nelems, C_ + idx);
             }
-            load(ymm_data, reg_src, nelems, offt);
+            load_data(ymm_data, reg_src, nelems, idx);
             vsubps(ymm_data, ymm_data, ymm_mean);
             vmulps(ymm_data, ymm_data, ymm_inv_sqrtvar);
             if (use_scaleshift_) vfmadd213ps(ymm_data, ymm_gamma, ymm_beta);
-            store(ymm_data, reg_dst, nelems, offt);
+            apply_post_ops(nelems, idx);
+            store_data(ymm_data, reg_dst, nelems, idx);
         };
 
         for (int i = 0; i < C_vecs; i++)
-            op(simd_w_, i * simd_w_ * sizeof(float));
+            op(simd_w_, i * simd_w_);
 
         for (int i = utils::rnd_dn(C_, simd_w_); i < C_; i++)
-            op(1, i * sizeof(float));
+            op(1, i);
 
         postamble();
 
+        for (int idx = 0; idx < post_ops_.len_; ++idx)
+            if (eltwise_injectors_[idx])
+                eltwise_injectors_[idx]->prepare_table();
+
         ker_ = getCode<decltype(ker_)>();
     }
 
@@ -297,6 +404,8 @@ private:
     Xbyak::Reg64 reg_ss = r9;
     Xbyak::Reg64 reg_tmp = r8;
 
+    // the eltwise injectors use the lower vector registers
+    Xbyak::Ymm ymm_sum = Xbyak::Ymm(9);
     Xbyak::Ymm ymm_inv_sqrtvar = Xbyak::Ymm(10);
     Xbyak::Ymm ymm_data = Xbyak::Ymm(11);
     Xbyak::Ymm ymm_gamma = Xbyak::Ymm(12);
@@ -305,18 +414,19 @@ private:
     Xbyak::Ymm ymm_mean = Xbyak::Ymm(15);
 };
 
-class diff_ss_kernel_t : jit_generator {
+class diff_ss_kernel_t : lnorm_kernel_base_t {
 public:
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_layer_normalization_fwd_t::diff_dst_kernel);
     diff_ss_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis())
+        : lnorm_kernel_base_t(pd->src_md()->data_type)
+        , C_(pd->norm_axis())
         , eps_(pd->desc()->layer_norm_epsilon)
         , ker_(nullptr) {
         if (mayiuse(avx2)) { generate(); }
     }
     ~diff_ss_kernel_t() {}
-    void operator()(const float *src, const float *diff_dst, float *diff_gamma,
+    void operator()(const void *src, const void *diff_dst, float *diff_gamma,
             float *diff_beta, const float *mean, const float *var) {
         if (ker_) {
             ker_args args;
@@ -329,11 +439,14 @@ public:
             args.inv_sqrtvar = &inv_sqrtvar;
             ker_(&args);
         } else {
+            assert(dt_ == data_type::f32);
+            const float *src_f32 = (const float *)src;
+            const float *diff_dst_f32 = (const float *)diff_dst;
             float inv_sqrtvar = 1. / sqrtf(*var + eps_);
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; c++) {
-                float dd = diff_dst[c];
-                diff_gamma[c] += (src[c] - *mean) * dd * inv_sqrtvar;
+                float dd = diff_dst_f32[c];
+                diff_gamma[c] += (src_f32[c] - *mean) * dd * inv_sqrtvar;
                 diff_beta[c] += dd;
             }
         }
@@ -342,11 +455,10 @@ public:
 private:
     int C_;
     const float eps_;
-    int simd_w_ = 8;
 
     struct ker_args {
-        const float *src;
-        const float *diff_dst;
+        const void *src;
+        const void *diff_dst;
         float *diff_gamma;
         float *diff_beta;
         const float *mean;
@@ -354,26 +466,6 @@ private:
     };
     void (*ker_)(const ker_args *args);
 
-    void load(Xbyak::Ymm &ymm_src, Xbyak::Reg64 reg_src, int nelems,
-            size_t offt) {
-        if (nelems == 1)
-            movss(Xbyak::Xmm(ymm_src.getIdx()), dword[reg_src + offt]);
-        else if (nelems == simd_w_)
-            vmovups(ymm_src, yword[reg_src + offt]);
-        else
-            assert(!"unsupported nelems");
-    }
-
-    void store(Xbyak::Ymm &ymm_dst, Xbyak::Reg64 reg_dst, int nelems,
-            size_t offt) {
-        if (nelems == 1)
-            movss(dword[reg_dst + offt], Xbyak::Xmm(ymm_dst.getIdx()));
-        else if (nelems == simd_w_)
-            vmovups(yword[reg_dst + offt], ymm_dst);
-        else
-            assert(!"unsupported nelems");
-    }
-
     void generate() {
         using namespace Xbyak;
 
@@ -385,33 +477,33 @@ private:
         mov(reg_diff_beta, ptr[reg_param + PARAM_OFF(diff_beta)]);
 
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(mean)]);
-        movss(xmm_tmp, dword[reg_tmp]);
+        vmovss(xmm_tmp, dword[reg_tmp]);
         vbroadcastss(ymm_mean, xmm_tmp);
 
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
-        movss(xmm_tmp, dword[reg_tmp]);
+        vmovss(xmm_tmp, dword[reg_tmp]);
         vbroadcastss(ymm_inv_sqrtvar, xmm_tmp);
 #undef PARAM_OFF
 
         const int C_vecs = C_ / simd_w_;
-        auto op = [=](int nelems, size_t offt) {
-            load(ymm_ddst, reg_diff_dst, nelems, offt);
-            load(ymm_dbeta, reg_diff_beta, nelems, offt);
-            load(ymm_dgamma, reg_diff_gamma, nelems, offt);
-            load(ymm_src, reg_src, nelems, offt);
+        auto op = [=](int nelems, dim_t idx) {
+            load_data(ymm_ddst, reg_diff_dst, nelems, idx);
+            load(ymm_dbeta, reg_diff_beta, nelems, idx);
+            load(ymm_dgamma, reg_diff_gamma, nelems, idx);
+            load_data(ymm_src, reg_src, nelems, idx);
             vaddps(ymm_dbeta, ymm_dbeta, ymm_ddst);
             vsubps(ymm_src, ymm_src, ymm_mean);
             vmulps(ymm_src, ymm_src, ymm_inv_sqrtvar);
             vfmadd231ps(ymm_dgamma, ymm_src, ymm_ddst);
-            store(ymm_dbeta, reg_diff_beta, nelems, offt);
-            store(ymm_dgamma, reg_diff_gamma, nelems, offt);
+            store(ymm_dbeta, reg_diff_beta, nelems, idx);
+            store(ymm_dgamma, reg_diff_gamma, nelems, idx);
         };
 
         for (int i = 0; i < C_vecs; i++)
-            op(simd_w_, i * simd_w_ * sizeof(float));
+            op(simd_w_, i * simd_w_);
 
         for (int i = utils::rnd_dn(C_, simd_w_); i < C_; i++)
-            op(1, i * sizeof(float));
+            op(1, i);
 
         postamble();
 
@@ -435,12 +527,13 @@ private:
     Xbyak::Ymm ymm_mean = Xbyak::Ymm(15);
 };
 
-class diff_data_kernel_t : jit_generator {
+class diff_data_kernel_t : lnorm_kernel_base_t {
 public:
     DECLARE_CPU_JIT_AUX_FUNCTIONS(
             jit_uni_layer_normalization_fwd_t::diff_data_kernel);
     diff_data_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis())
+        : lnorm_kernel_base_t(pd->src_md()->data_type)
+        , C_(pd->norm_axis())
         , eps_(pd->desc()->layer_norm_epsilon)
         , calculate_diff_stats_(!pd->use_global_stats())
         , use_scaleshift_(pd->use_scaleshift())
@@ -448,7 +541,7 @@ public:
         if (mayiuse(avx2)) { generate(); }
     }
     ~diff_data_kernel_t() {}
-    void operator()(const float *src, const float *diff_dst, float *diff_src,
+    void operator()(const void *src, const void *diff_dst, void *diff_src,
             float *diff_gamma, const float *diff_beta, const float *ss,
             const float *mean, const float *var) {
         if (ker_) {
@@ -464,17 +557,21 @@ public:
             args.inv_sqrtvar = &inv_sqrtvar;
             ker_(&args);
         } else {
+            assert(dt_ == data_type::f32);
+            const float *src_f32 = (const float *)src;
+            const float *diff_dst_f32 = (const float *)diff_dst;
+            float *diff_src_f32 = (float *)diff_src;
             float inv_sqrtvar = 1. / sqrtf(*var + eps_);
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; c++) {
                 float gamma = use_scaleshift_ ? ss[c] : 1;
-                float v_diff_src = diff_dst[c];
+                float v_diff_src = diff_dst_f32[c];
                 if (calculate_diff_stats_)
                     v_diff_src -= diff_beta[c] / C_
-                            + (src[c] - *mean) * diff_gamma[c] * inv_sqrtvar
+                            + (src_f32[c] - *mean) * diff_gamma[c] * inv_sqrtvar
                                     / C_;
                 v_diff_src *= gamma * inv_sqrtvar;
-                diff_src[c] = v_diff_src;
+                diff_src_f32[c] = v_diff_src;
             }
         }
     }
@@ -484,12 +581,11 @@ private:
     const float eps_;
     bool calculate_diff_stats_;
     bool use_scaleshift_;
-    int simd_w_ = 8;
 
     struct ker_args {
-        const float *src;
-        const float *diff_dst;
-        float *diff_src;
+        const void *src;
+        const void *diff_dst;
+        void *diff_src;
         const float *diff_gamma;
         const float *diff_beta;
         const float *ss;
@@ -498,30 +594,11 @@ private:
     };
     void (*ker_)(const ker_args *args);
 
-    void load(Xbyak::Ymm &ymm_src, Xbyak::Reg64 reg_src, int nelems,
-            size_t offt) {
-        if (nelems == 1)
-            movss(Xbyak::Xmm(ymm_src.getIdx()), dword[reg_src + offt]);
-        else if (nelems == simd_w_)
-            vmovups(ymm_src, yword[reg_src + offt]);
-        else
-            assert(!"unsupported nelems");
-    }
-
-    void store(Xbyak::Ymm &ymm_dst, Xbyak::Reg64 reg_dst, int nelems,
-            size_t offt) {
-        if (nelems == 1)
-            movss(dword[reg_dst + offt], Xbyak::Xmm(ymm_dst.getIdx()));
-        else if (nelems == simd_w_)
-            vmovups(yword[reg_dst + offt], ymm_dst);
-        else
-            assert(!"unsupported nelems");
-    }
-
     void generate() {
         using namespace Xbyak;
 
         preamble();
+        prepare_bf16();
 #define PARAM_OFF(x) offsetof(ker_args, x)
         mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
         mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
@@ -532,27 +609,27 @@ private:
 
         if (calculate_diff_stats_) {
             mov(reg_tmp, ptr[reg_param + PARAM_OFF(mean)]);
-            movss(xmm_tmp, dword[reg_tmp]);
+            vmovss(xmm_tmp, dword[reg_tmp]);
             vbroadcastss(ymm_mean, xmm_tmp);
         }
 
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
-        movss(xmm_tmp, dword[reg_tmp]);
+        vmovss(xmm_tmp, dword[reg_tmp]);
         vbroadcastss(ymm_inv_sqrtvar, xmm_tmp);
 #undef PARAM_OFF
 
         mov(reg_tmp, float2int(C_));
-        movq(xmm_tmp, reg_tmp);
-        uni_vbroadcastss(ymm_C, xmm_tmp);
+        vmovq(xmm_tmp, reg_tmp);
+        vbroadcastss(ymm_C, xmm_tmp);
 
         const int C_vecs = C_ / simd_w_;
-        auto op = [=](int nelems, size_t offt) {
-            load(ymm_dsrc, reg_diff_dst, nelems, offt);
-            if (use_scaleshift_) load(ymm_gamma, reg_gamma, nelems, offt);
+        auto op = [=](int nelems, dim_t idx) {
+            load_data(ymm_dsrc, reg_diff_dst, nelems, idx);
+            if (use_scaleshift_) load(ymm_gamma, reg_gamma, nelems, idx);
             if (calculate_diff_stats_) {
-                load(ymm_dbeta, reg_diff_beta, nelems, offt);
-                load(ymm_dgamma, reg_diff_gamma, nelems, offt);
-                load(ymm_src, reg_src, nelems, offt);
+                load(ymm_dbeta, reg_diff_beta, nelems, idx);
+                load(ymm_dgamma, reg_diff_gamma, nelems, idx);
+                load_data(ymm_src, reg_src, nelems, idx);
             }
             if (calculate_diff_stats_) {
                 vsubps(ymm_src, ymm_src, ymm_mean);
@@ -563,14 +640,14 @@ private:
             }
             if (use_scaleshift_) vmulps(ymm_dsrc, ymm_dsrc, ymm_gamma);
             vmulps(ymm_dsrc, ymm_dsrc, ymm_inv_sqrtvar);
-            store(ymm_dsrc, reg_diff_src, nelems, offt);
+            store_data(ymm_dsrc, reg_diff_src, nelems, idx);
         };
 
         for (int i = 0; i < C_vecs; i++)
-            op(simd_w_, i * simd_w_ * sizeof(float));
+            op(simd_w_, i * simd_w_);
 
         for (int i = utils::rnd_dn(C_, simd_w_); i < C_; i++)
-            op(1, i * sizeof(float));
+            op(1, i);
 
         postamble();
 
@@ -0,0 +1,808 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+
+#include "jit_uni_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+bool jit_uni_reduction_t<isa>::pd_t::init_conf() {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    if (!src_d.is_blocking_desc() || !dst_d.is_blocking_desc()) return false;
+    if (!src_d.is_dense(true) || !dst_d.is_dense(true)) return false;
+
+    const int ndims = this->ndims();
+
+    // the padded area is reduced as well: it is only allowed in the kept
+    // dimensions, where the zeros reduce to zeros (but for the norms)
+    for (int d = 0; d < ndims; ++d) {
+        if (src_d.padded_dims()[d] == src_d.dims()[d]) continue;
+        if (is_reduced(d) || is_norm()) return false;
+    }
+
+    // lists the non-trivial dimensions (and blocks) in the memory order
+    struct entry_t {
+        int d;
+        dim_t size;
+    };
+    auto get_entries = [&](const memory_desc_wrapper &md, entry_t *e) {
+        const auto &blk = md.blocking_desc();
+        dims_t blocks;
+        md.compute_blocks(blocks);
+
+        int perm[DNNL_MAX_NDIMS];
+        for (int d = 0; d < ndims; ++d)
+            perm[d] = d;
+        for (int i = 1; i < ndims; ++i)
+            for (int j = i; j > 0
+                    && blk.strides[perm[j - 1]] < blk.strides[perm[j]];
+                    --j)
+                nstl::swap(perm[j - 1], perm[j]);
+
+        int n = 0;
+        for (int i = 0; i < ndims; ++i) {
+            const int d = perm[i];
+            const dim_t size = md.padded_dims()[d] / blocks[d];
+            if (size > 1) e[n++] = {d, size};
+        }
+        for (int iblk = 0; iblk < blk.inner_nblks; ++iblk)
+            if (blk.inner_blks[iblk] > 1)
+                e[n++] = {(int)blk.inner_idxs[iblk], blk.inner_blks[iblk]};
+        return n;
+    };
+
+    entry_t src_e[2 * DNNL_MAX_NDIMS], dst_e[2 * DNNL_MAX_NDIMS];
+    const int src_n = get_entries(src_d, src_e);
+    const int dst_n = get_entries(dst_d, dst_e);
+
+    // the reduced entries have to form a single contiguous group...
+    int first = src_n, last = -1;
+    for (int i = 0; i < src_n; ++i)
+        if (is_reduced(src_e[i].d)) {
+            first = nstl::min(first, i);
+            last = i;
+        }
+    for (int i = first; i < last; ++i)
+        if (!is_reduced(src_e[i].d)) return false;
+
+    // ...and the kept ones have to be laid out in dst the same way
+    int n = 0;
+    for (int i = 0; i < src_n; ++i) {
+        if (is_reduced(src_e[i].d)) continue;
+        if (n == dst_n || dst_e[n].d != src_e[i].d
+                || dst_e[n].size != src_e[i].size)
+            return false;
+        ++n;
+    }
+    if (n != dst_n) return false;
+
+    auto &c = conf_;
+    c.outer = c.reduce = c.inner = 1;
+    for (int i = 0; i < src_n; ++i) {
+        dim_t &part = i < first ? c.outer : i <= last ? c.reduce : c.inner;
+        part *= src_e[i].size;
+    }
+    if (last < 0) {
+        // nothing is reduced: process the tensor as a single row
+        c.inner *= c.outer;
+        c.outer = 1;
+    }
+
+    // the outer points are split into chunks only if there are too few
+    // of them to keep the threads busy
+    const int nthr = dnnl_get_max_threads();
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    c.inner_chunk = c.inner;
+    if (!c.horizontal() && c.outer < nthr) {
+        const dim_t nchunks = utils::div_up((dim_t)nthr, c.outer);
+        c.inner_chunk = nstl::max((dim_t)simd_w,
+                utils::rnd_up(utils::div_up(c.inner, nchunks), simd_w));
+        c.inner_chunk = nstl::min(c.inner_chunk, c.inner);
+    }
+    c.nchunks = utils::div_up(c.inner, c.inner_chunk);
+
+    // the balancer works with int sizes
+    const dim_t njobs = c.outer * (c.horizontal() ? 1 : c.nchunks);
+    const dim_t int_max = nstl::numeric_limits<int>::max();
+    if (njobs > int_max || c.reduce > int_max || c.job_size() > int_max)
+        return false;
+
+    const size_t max_buffer_size = (size_t)nthr * 16 * 1024;
+    c.balancer.init(nthr, (int)c.job_size(), (int)njobs, (int)c.reduce,
+            max_buffer_size, true);
+
+    return true;
+}
+
+namespace {
+
+/* Reduces `nrows` rows of f32-convertible values into one row.
+ *
+ * In the vertical mode the rows are `row_stride` bytes apart and `len`
+ * elements long, the result is a row of `len` elements.
+ *
+ * In the horizontal mode every row of `len` contiguous elements is reduced
+ * into a single element, the rows are `row_stride` bytes apart and the
+ * results are stored one after another.
+ *
+ * If `finalize` is set, the accumulated values are finalized (e.g. divided by
+ * the reduction size for the mean) and converted to the destination data
+ * type, otherwise f32 partial results are written. */
+template <cpu_isa_t isa>
+struct jit_uni_reduction_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduction_kernel_t)
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *src;
+        void *dst;
+        size_t nrows, len;
+    };
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const int unroll = isa == avx512_common ? 8 : 4;
+
+    void (*ker_)(const call_params_t *);
+    void operator()(const call_params_t *p) { (*ker_)(p); }
+
+    jit_uni_reduction_kernel_t(const reduction_pd_t *pd, data_type_t src_dt,
+            data_type_t dst_dt, bool horizontal, size_t row_stride,
+            bool accumulate_src, bool finalize)
+        : alg_(pd->desc()->alg_kind)
+        , p_(pd->desc()->p)
+        , eps_(pd->desc()->eps)
+        , reduce_size_(pd->reduce_size())
+        , is_norm_(pd->is_norm())
+        , src_dt_(src_dt)
+        , dst_dt_(dst_dt)
+        , src_sz_(types::data_type_size(src_dt))
+        , dst_sz_(types::data_type_size(dst_dt))
+        , horizontal_(horizontal)
+        , row_stride_(row_stride)
+        , accumulate_src_(accumulate_src)
+        , finalize_(finalize)
+        , bf16_emu_(nullptr) {
+        if (dst_dt == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                    bf16_emu_reserv_4);
+
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(
+                const_cast<uint8_t *>(this->getCode()));
+    }
+
+    ~jit_uni_reduction_kernel_t() { delete bf16_emu_; }
+
+private:
+    const alg_kind_t alg_;
+    const float p_, eps_;
+    const dim_t reduce_size_;
+    const bool is_norm_;
+    const data_type_t src_dt_, dst_dt_;
+    const size_t src_sz_, dst_sz_;
+    const bool horizontal_;
+    const size_t row_stride_;
+    const bool accumulate_src_, finalize_;
+
+    bf16_emulation_t *bf16_emu_;
+
+    Reg64 reg_param = abi_param1;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_nrows = r10;
+    Reg64 reg_len = r11;
+    Reg64 reg_offt = r12; // offset within a row, in elements
+    Reg64 reg_rem = r13; // elements left within a row
+    Reg64 reg_row_ptr = r14;
+    Reg64 reg_row = r15;
+    Reg64 reg_tmp = rax;
+    Reg64 bf16_emu_scratch = rbx;
+
+    Opmask k_tail_mask = k2;
+
+    // Vmm(0) holds the avx2 tail mask
+    Vmm vmm_tail_mask = Vmm(0);
+    Vmm vmm_identity = Vmm(1);
+    Vmm vmm_abs_mask = Vmm(2);
+    Vmm vmm_reduce_size = Vmm(3);
+    Vmm vmm_eps = Vmm(4);
+    Vmm vmm_sat_lbound = Vmm(5);
+    Vmm vmm_sat_ubound = Vmm(6);
+    const int vmm_compute_start = 7;
+    Vmm vmm_acc(int i) { return Vmm(vmm_compute_start + i); }
+    Vmm vmm_src(int i) { return Vmm(vmm_compute_start + unroll + i); }
+
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+
+    Address src_ptr(int i) {
+        return ptr[reg_row_ptr + reg_offt * src_sz_ + i * simd_w * src_sz_];
+    }
+    Address dst_ptr(int i) {
+        return ptr[reg_dst + reg_offt * dst_sz_ + i * simd_w * dst_sz_];
+    }
+
+    void broadcast_float(const Vmm &v, float f) {
+        mov(reg_tmp.cvt32(), float2int(f));
+        vmovd(Xmm(v.getIdx()), reg_tmp.cvt32());
+        uni_vbroadcastss(v, Xmm(v.getIdx()));
+    }
+
+    float identity() const {
+        using namespace alg_kind;
+        switch (alg_) {
+            case reduction_max: return nstl::numeric_limits<float>::lowest();
+            case reduction_min: return nstl::numeric_limits<float>::max();
+            case reduction_mul: return 1.f;
+            default: return 0.f;
+        }
+    }
+
+    // Loads (a tail of) simd_w elements of type dt and converts them to f32
+    void load(const Vmm &v, const Address &addr, data_type_t dt, bool tail) {
+        using namespace data_type;
+        if (isa == avx2) {
+            // only f32 is supported on avx2
+            if (tail)
+                vmaskmovps(v, vmm_tail_mask, addr);
+            else
+                vmovups(v, addr);
+            return;
+        }
+
+        const Vmm v_masked = tail ? v | k_tail_mask | T_z : v;
+        switch (dt) {
+            case f32: vmovups(v_masked, addr); break;
+            case bf16:
+                vpmovzxwd(v_masked, addr);
+                vpslld(v, v, 16);
+                break;
+            case s8:
+                vpmovsxbd(v_masked, addr);
+                vcvtdq2ps(v, v);
+                break;
+            case u8:
+                vpmovzxbd(v_masked, addr);
+                vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    // Converts f32 values to dt and stores (a tail of) simd_w of them
+    void store(const Address &addr, const Vmm &v, data_type_t dt, bool tail) {
+        using namespace data_type;
+        if (isa == avx2) {
+            if (tail)
+                vmaskmovps(addr, vmm_tail_mask, v);
+            else
+                vmovups(addr, v);
+            return;
+        }
+
+        const Address addr_masked = tail ? addr | k_tail_mask : addr;
+        switch (dt) {
+            case f32: vmovups(addr_masked, v); break;
+            case bf16: {
+                const Ymm y = Ymm(v.getIdx());
+                if (bf16_emu_)
+                    bf16_emu_->vcvtneps2bf16(y, Zmm(v.getIdx()));
+                else
+                    vcvtneps2bf16(y, v);
+                vmovdqu16(addr_masked, y);
+                break;
+            }
+            case s8:
+            case u8:
+                saturate(v, dt);
+                // the down-converting stores take the mask on the source
+                if (dt == s8)
+                    vpmovsdb(addr, tail ? v | k_tail_mask : v);
+                else
+                    vpmovusdb(addr, tail ? v | k_tail_mask : v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    // Converts the lowest f32 value of v to dt and stores it
+    void store_scalar(const Address &addr, const Vmm &v, data_type_t dt) {
+        using namespace data_type;
+        const Xmm x = Xmm(v.getIdx());
+        switch (dt) {
+            case f32: vmovss(addr, x); break;
+            case bf16:
+                if (bf16_emu_)
+                    bf16_emu_->vcvtneps2bf16(Ymm(v.getIdx()), Zmm(v.getIdx()));
+                else
+                    vcvtneps2bf16(Ymm(v.getIdx()), v);
+                vpextrw(addr, x, 0);
+                break;
+            case s8:
+            case u8:
+                saturate(v, dt);
+                vmovd(reg_tmp.cvt32(), x);
+                mov(addr, reg_tmp.cvt8());
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void saturate(const Vmm &v, data_type_t dt) {
+        uni_vmaxps(v, v, vmm_sat_lbound);
+        uni_vminps(v, v, vmm_sat_ubound);
+        uni_vcvtps2dq(v, v);
+    }
+
+    // Sets the tail mask for the reg_rem (< simd_w) elements
+    void prepare_tail_mask() {
+        if (isa == avx2) {
+            static const uint32_t mask_f32[16]
+                    = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0,
+                            0, 0, 0, 0, 0, 0, 0};
+            mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[8]));
+            shl(reg_rem, 2);
+            sub(reg_tmp, reg_rem);
+            shr(reg_rem, 2);
+            vmovups(vmm_tail_mask, ptr[reg_tmp]);
+        } else {
+            mov(reg_tmp.cvt32(), 1);
+            shlx(reg_tmp.cvt32(), reg_tmp.cvt32(), reg_rem.cvt32());
+            sub(reg_tmp.cvt32(), 1);
+            kmovw(k_tail_mask, reg_tmp.cvt32());
+        }
+    }
+
+    // |x|^p for the norms
+    void apply_power(const Vmm &v) {
+        if (!(accumulate_src_ && is_norm_)) return;
+        if (p_ == 2.f)
+            uni_vmulps(v, v, v);
+        else
+            uni_vandps(v, v, vmm_abs_mask);
+    }
+
+    template <typename T>
+    void perform_op(const T &acc, const T &v) {
+        using namespace alg_kind;
+        switch (alg_) {
+            case reduction_max: vmaxps(acc, acc, v); break;
+            case reduction_min: vminps(acc, acc, v); break;
+            case reduction_mul: vmulps(acc, acc, v); break;
+            default: vaddps(acc, acc, v); break;
+        }
+    }
+
+    void apply_finalize(const Vmm &v) {
+        using namespace alg_kind;
+        if (!finalize_) return;
+        switch (alg_) {
+            case reduction_mean: uni_vdivps(v, v, vmm_reduce_size); break;
+            case reduction_norm_lp_max:
+            case reduction_norm_lp_power_p_max:
+                uni_vmaxps(v, v, vmm_eps);
+                break;
+            case reduction_norm_lp_sum:
+            case reduction_norm_lp_power_p_sum:
+                uni_vaddps(v, v, vmm_eps);
+                break;
+            default: break;
+        }
+        if (p_ == 2.f
+                && utils::one_of(
+                        alg_, reduction_norm_lp_max, reduction_norm_lp_sum))
+            uni_vsqrtps(v, v);
+    }
+
+    // Replaces the elements out of the tail with the identity
+    void blend_identity(const Vmm &v) {
+        if (isa == avx2)
+            vblendvps(v, vmm_identity, v, vmm_tail_mask);
+        else
+            vblendmps(v | k_tail_mask, vmm_identity, v);
+    }
+
+    // Reduces nvregs vectors of all the rows at the current offset
+    void compute_vertical(int nvregs, bool tail) {
+        for (int i = 0; i < nvregs; i++)
+            uni_vmovups(vmm_acc(i), vmm_identity);
+
+        Label row_loop;
+        mov(reg_row_ptr, reg_src);
+        mov(reg_row, reg_nrows);
+        L(row_loop);
+        {
+            for (int i = 0; i < nvregs; i++) {
+                load(vmm_src(i), src_ptr(i), src_dt_, tail);
+                apply_power(vmm_src(i));
+                perform_op(vmm_acc(i), vmm_src(i));
+            }
+            add(reg_row_ptr, row_stride_);
+            dec(reg_row);
+            jnz(row_loop, T_NEAR);
+        }
+
+        for (int i = 0; i < nvregs; i++) {
+            apply_finalize(vmm_acc(i));
+            store(dst_ptr(i), vmm_acc(i), finalize_ ? dst_dt_ : data_type::f32,
+                    tail);
+        }
+    }
+
+    // Accumulates nvregs vectors of the current row at the current offset
+    void accumulate_horizontal(int nvregs, bool tail) {
+        for (int i = 0; i < nvregs; i++) {
+            load(vmm_src(i), src_ptr(i), src_dt_, tail);
+            apply_power(vmm_src(i));
+            if (tail) blend_identity(vmm_src(i));
+            perform_op(vmm_acc(i), vmm_src(i));
+        }
+    }
+
+    // Reduces the accumulators into the lowest element of vmm_acc(0)
+    void reduce_accumulators() {
+        for (int i = 1; i < unroll; i++)
+            perform_op(vmm_acc(0), vmm_acc(i));
+
+        const Vmm acc = vmm_acc(0), tmp = vmm_src(0);
+        if (isa == avx512_common) {
+            vextractf64x4(Ymm(tmp.getIdx()), Zmm(acc.getIdx()), 1);
+            perform_op(Ymm(acc.getIdx()), Ymm(tmp.getIdx()));
+        }
+        const Xmm xacc = Xmm(acc.getIdx()), xtmp = Xmm(tmp.getIdx());
+        vextractf128(xtmp, Ymm(acc.getIdx()), 1);
+        perform_op(xacc, xtmp);
+        vshufps(xtmp, xacc, xacc, 0x4e);
+        perform_op(xacc, xtmp);
+        vshufps(xtmp, xacc, xacc, 0xb1);
+        perform_op(xacc, xtmp);
+    }
+
+    // Processes the row at reg_src of reg_len elements in the vertical mode
+    void generate_vertical() {
+        Label unroll_loop, unroll_loop_tail, nelems_tail, end;
+
+        xor_(reg_offt, reg_offt);
+        mov(reg_rem, reg_len);
+
+        L(unroll_loop);
+        {
+            cmp(reg_rem, unroll * simd_w);
+            jl(unroll_loop_tail, T_NEAR);
+
+            compute_vertical(unroll, false);
+            sub(reg_rem, unroll * simd_w);
+            add(reg_offt, unroll * simd_w);
+            jmp(unroll_loop, T_NEAR);
+        }
+
+        L(unroll_loop_tail);
+        {
+            cmp(reg_rem, simd_w);
+            jl(nelems_tail, T_NEAR);
+
+            compute_vertical(1, false);
+            sub(reg_rem, simd_w);
+            add(reg_offt, simd_w);
+            jmp(unroll_loop_tail, T_NEAR);
+        }
+
+        L(nelems_tail);
+        {
+            cmp(reg_rem, 0);
+            je(end, T_NEAR);
+
+            prepare_tail_mask();
+            compute_vertical(1, true);
+        }
+
+        L(end);
+    }
+
+    // Reduces reg_nrows rows of reg_len elements into an element each
+    void generate_horizontal() {
+        Label row_loop, unroll_loop, unroll_loop_tail, nelems_tail, row_end;
+
+        mov(reg_row_ptr, reg_src);
+        L(row_loop);
+        {
+            for (int i = 0; i < unroll; i++)
+                uni_vmovups(vmm_acc(i), vmm_identity);
+            xor_(reg_offt, reg_offt);
+            mov(reg_rem, reg_len);
+
+            L(unroll_loop);
+            {
+                cmp(reg_rem, unroll * simd_w);
+                jl(unroll_loop_tail, T_NEAR);
+
+                accumulate_horizontal(unroll, false);
+                sub(reg_rem, unroll * simd_w);
+                add(reg_offt, unroll * simd_w);
+                jmp(unroll_loop, T_NEAR);
+            }
+
+            L(unroll_loop_tail);
+            {
+                cmp(reg_rem, simd_w);
+                jl(nelems_tail, T_NEAR);
+
+                accumulate_horizontal(1, false);
+                sub(reg_rem, simd_w);
+                add(reg_offt, simd_w);
+                jmp(unroll_loop_tail, T_NEAR);
+            }
+
+            L(nelems_tail);
+            {
+                cmp(reg_rem, 0);
+                je(row_end, T_NEAR);
+
+                prepare_tail_mask();
+                accumulate_horizontal(1, true);
+            }
+
+            L(row_end);
+            reduce_accumulators();
+            apply_finalize(vmm_acc(0));
+            store_scalar(ptr[reg_dst], vmm_acc(0),
+                    finalize_ ? dst_dt_ : data_type::f32);
+
+            add(reg_row_ptr, row_stride_);
+            add(reg_dst, finalize_ ? dst_sz_ : sizeof(float));
+            dec(reg_nrows);
+            jnz(row_loop, T_NEAR);
+        }
+    }
+
+    void generate() {
+        using namespace data_type;
+        preamble();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+        mov(reg_len, ptr[reg_param + PARAM_OFF(len)]);
+#undef PARAM_OFF
+
+        broadcast_float(vmm_identity, identity());
+        if (accumulate_src_ && is_norm_ && p_ == 1.f) {
+            mov(reg_tmp.cvt32(), 0x7fffffff);
+            vmovd(Xmm(vmm_abs_mask.getIdx()), reg_tmp.cvt32());
+            uni_vbroadcastss(vmm_abs_mask, Xmm(vmm_abs_mask.getIdx()));
+        }
+        if (finalize_) {
+            broadcast_float(vmm_reduce_size, (float)reduce_size_);
+            broadcast_float(vmm_eps, eps_);
+            if (utils::one_of(dst_dt_, s8, u8)) {
+                broadcast_float(vmm_sat_lbound, dst_dt_ == s8 ? -128.f : 0.f);
+                broadcast_float(vmm_sat_ubound, dst_dt_ == s8 ? 127.f : 255.f);
+            }
+        }
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+
+        if (horizontal_)
+            generate_horizontal();
+        else
+            generate_vertical();
+
+        postamble();
+    }
+};
+
+} // namespace
+
+namespace reduction_impl {
+
+template <cpu_isa_t isa>
+struct driver_t : public c_compatible {
+    using conf_t = typename jit_uni_reduction_t<isa>::pd_t::conf_t;
+    using kernel_t = jit_uni_reduction_kernel_t<isa>;
+
+    driver_t(const reduction_pd_t *pd, const conf_t &conf)
+        : conf_(conf)
+        , src_sz_(types::data_type_size(pd->src_md()->data_type))
+        , dst_sz_(types::data_type_size(pd->dst_md()->data_type))
+        , ker_(nullptr)
+        , partial_ker_(nullptr)
+        , combine_ker_(nullptr) {
+        const auto src_dt = pd->src_md()->data_type;
+        const auto dst_dt = pd->dst_md()->data_type;
+        const size_t row_stride
+                = (conf.horizontal() ? conf.reduce : conf.inner) * src_sz_;
+
+        if (conf.balancer.nthr_per_group_ == 1) {
+            ker_ = new kernel_t(pd, src_dt, dst_dt, conf.horizontal(),
+                    row_stride, true, true);
+            return;
+        }
+
+        partial_ker_ = new kernel_t(pd, src_dt, data_type::f32,
+                conf.horizontal(), row_stride, true, false);
+        combine_ker_ = new kernel_t(pd, data_type::f32, dst_dt, false,
+                conf.ws_per_thr() * sizeof(float), false, true);
+    }
+
+    ~driver_t() {
+        delete ker_;
+        delete partial_ker_;
+        delete combine_ker_;
+    }
+
+    // Compute strategy:
+    // Every thread reduces its part of the reduction dimension for the jobs
+    // of its group. If a group has a single thread, the results are final and
+    // go to dst directly. Otherwise they go to the thread's scratchpad space
+    // and the second pass combines the partial results of each group.
+    void exec(const char *src, char *dst, float *ws) {
+        const auto &b = conf_.balancer;
+
+        parallel(b.nthr_, [&](const int ithr, const int nthr) {
+            for (int i = ithr; i < b.nthr_; i += nthr)
+                reduce(i, src, dst, ws);
+        });
+
+        if (b.nthr_per_group_ == 1) return;
+
+        parallel(b.nthr_, [&](const int ithr, const int nthr) {
+            for (int i = ithr; i < b.nthr_; i += nthr)
+                combine(i, dst, ws);
+        });
+    }
+
+private:
+    const conf_t conf_;
+    const size_t src_sz_, dst_sz_;
+
+    kernel_t *ker_, *partial_ker_, *combine_ker_;
+
+    void reduce(int ithr, const char *src, char *dst, float *ws) const {
+        const auto &c = conf_;
+        const auto &b = c.balancer;
+        if (b.idle(ithr)) return;
+
+        const int njobs = b.ithr_njobs(ithr);
+        const int job_off = b.ithr_job_off(ithr);
+        if (njobs == 0) return;
+
+        dim_t r_start = 0, r_end = 0;
+        balance211(c.reduce, b.nthr_per_group_, b.id_in_group(ithr), r_start,
+                r_end);
+        assert(r_start < r_end);
+
+        const bool partial = b.nthr_per_group_ > 1;
+        kernel_t *ker = partial ? partial_ker_ : ker_;
+        float *thr_ws = partial ? ws + ithr * c.ws_per_thr() : nullptr;
+
+        typename kernel_t::call_params_t p;
+        if (c.horizontal()) {
+            // the rows of consecutive jobs follow each other
+            p.src = src + (job_off * c.reduce + r_start) * src_sz_;
+            p.dst = partial ? (void *)thr_ws : dst + job_off * dst_sz_;
+            p.nrows = njobs;
+            p.len = r_end - r_start;
+            (*ker)(&p);
+            return;
+        }
+
+        for (int j = 0; j < njobs; ++j) {
+            const dim_t job = job_off + j;
+            const dim_t o = job / c.nchunks;
+            const dim_t i0 = (job % c.nchunks) * c.inner_chunk;
+            p.src = src + ((o * c.reduce + r_start) * c.inner + i0) * src_sz_;
+            p.dst = partial ? (void *)(thr_ws + j * c.inner_chunk)
+                            : dst + (o * c.inner + i0) * dst_sz_;
+            p.nrows = r_end - r_start;
+            p.len = nstl::min(c.inner_chunk, c.inner - i0);
+            (*ker)(&p);
+        }
+    }
+
+    void combine(int ithr, char *dst, const float *ws) const {
+        const auto &c = conf_;
+        const auto &b = c.balancer;
+        if (b.idle(ithr)) return;
+
+        const int grp = b.group_id(ithr);
+        const int job_off = b.grp_job_off(grp);
+        int start = 0, end = 0;
+        balance211(b.grp_njobs(grp), b.nthr_per_group_, b.id_in_group(ithr),
+                start, end);
+        if (start == end) return;
+
+        // the partial results of the group threads are ws_per_thr apart
+        const float *grp_ws = ws + grp * b.nthr_per_group_ * c.ws_per_thr();
+
+        typename kernel_t::call_params_t p;
+        p.nrows = b.nthr_per_group_;
+        if (c.horizontal()) {
+            p.src = grp_ws + start;
+            p.dst = dst + (job_off + start) * dst_sz_;
+            p.len = end - start;
+            (*combine_ker_)(&p);
+            return;
+        }
+
+        for (int j = start; j < end; ++j) {
+            const dim_t job = job_off + j;
+            const dim_t o = job / c.nchunks;
+            const dim_t i0 = (job % c.nchunks) * c.inner_chunk;
+            p.src = grp_ws + j * c.inner_chunk;
+            p.dst = dst + (o * c.inner + i0) * dst_sz_;
+            p.len = nstl::min(c.inner_chunk, c.inner - i0);
+            (*combine_ker_)(&p);
+        }
+    }
+};
+
+} // namespace reduction_impl
+
+template <cpu_isa_t isa>
+jit_uni_reduction_t<isa>::jit_uni_reduction_t(const pd_t *apd)
+    : primitive_impl_t(apd) {
+    reduction_driver_
+            = new reduction_impl::driver_t<isa>(pd(), pd()->conf_);
+}
+
+template <cpu_isa_t isa>
+jit_uni_reduction_t<isa>::~jit_uni_reduction_t() {
+    delete reduction_driver_;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_reduction_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    float *ws = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_reducer_space);
+
+    reduction_driver_->exec(src, dst, ws);
+
+    return status::success;
+}
+
+/* struct instantiation */
+template struct jit_uni_reduction_t<avx2>;
+template struct jit_uni_reduction_t<avx512_common>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_REDUCTION_HPP
+#define JIT_UNI_REDUCTION_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "cpu_reducer.hpp"
+#include "cpu_reduction_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace reduction_impl {
+template <cpu_isa_t isa>
+struct driver_t;
+}
+
+template <cpu_isa_t isa>
+struct jit_uni_reduction_t : public primitive_impl_t {
+    struct pd_t : public cpu_reduction_pd_t {
+        pd_t(engine_t *engine, const reduction_desc_t *adesc,
+                const primitive_attr_t *attr, const reduction_pd_t *hint_pd)
+            : cpu_reduction_pd_t(engine, adesc, attr, hint_pd) {}
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_reduction_t);
+
+        status_t init() {
+            bool ok = true && set_default_params() == status::success
+                    && mayiuse(isa) && !has_zero_dim_memory()
+                    && data_types_ok() && attr()->has_default_values()
+                    && IMPLICATION(is_norm(),
+                            utils::one_of(desc()->p, 1.f, 2.f))
+                    && init_conf();
+            if (!ok) return status::unimplemented;
+
+            init_scratchpad();
+
+            return status::success;
+        };
+
+        /* The source is viewed as a dense [outer][reduce][inner] array that
+         * is reduced over the middle dimension into the dense [outer][inner]
+         * destination. A job is an outer point and a chunk of `inner_chunk`
+         * inner points (a single point if inner == 1). The jobs are shared
+         * among groups of threads by the balancer. If a group has several
+         * threads they split the reduction and put f32 partial results to
+         * the scratchpad, which are combined in the second pass. */
+        struct conf_t {
+            dim_t outer, reduce, inner;
+            dim_t inner_chunk, nchunks;
+            reduce_balancer_t balancer;
+
+            bool horizontal() const { return inner == 1; }
+            dim_t job_size() const { return horizontal() ? 1 : inner_chunk; }
+            dim_t ws_per_thr() const {
+                return balancer.njobs_per_group_ub_ * job_size();
+            }
+        } conf_;
+
+    private:
+        bool data_types_ok() const {
+            using namespace data_type;
+            const data_type_t dts[]
+                    = {src_md()->data_type, dst_md()->data_type};
+            for (auto dt : dts) {
+                const bool ok = isa == avx2 ? dt == f32
+                                            : utils::one_of(dt, f32, bf16, s8,
+                                                    u8);
+                if (!ok || (dt == bf16 && !mayiuse(avx512_core)))
+                    return false;
+            }
+            return true;
+        }
+
+        bool init_conf();
+
+        void init_scratchpad() {
+            if (conf_.balancer.nthr_per_group_ == 1) return;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(memory_tracking::names::key_reducer_space,
+                    sizeof(float) * conf_.balancer.nthr_
+                            * conf_.ws_per_thr());
+        }
+    };
+
+    jit_uni_reduction_t(const pd_t *apd);
+    ~jit_uni_reduction_t();
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    reduction_impl::driver_t<isa> *reduction_driver_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
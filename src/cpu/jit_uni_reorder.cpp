@@ -22,6 +22,7 @@
 #include "nstl.hpp"
 #include "type_helpers.hpp"
 
+#include "cpu_primitive.hpp"
 #include "cpu_reorder_pd.hpp"
 #include "jit_uni_reorder.hpp"
 
@@ -116,11 +117,8 @@ struct jit_uni_reorder_kernel_f32 : public kernel_t, public jit_generator {
                         p.itype == bf16, utils::one_of(p.otype, f32, bf16))
                 && IMPLICATION(
                         p.otype == bf16, utils::one_of(p.itype, f32, bf16))
-                && utils::everyone_is(0, p.ioff, p.ooff) /* do we need this? */
-                && utils::one_of(p.beta, 0.f, 1.f) /* anything else? */
+                && utils::everyone_is(0, p.ioff, p.ooff) /* applied by driver */
                 && simple_impl_desc_init(p, nullptr) && mayiuse(sse41)
-                && IMPLICATION(!utils::everyone_is(f32, p.itype, p.otype),
-                        mayiuse(avx))
                 && IMPLICATION((p.itype == bf16 || p.otype == bf16),
                         mayiuse(avx512_core));
         if (!ok) return false;
@@ -305,25 +303,49 @@ struct jit_uni_reorder_kernel_f32 : public kernel_t, public jit_generator {
             const int *o_off, const int *s_off) {
         using namespace data_type;
 
+        /* the non-VEX flavors are used on sse41, where memory operands of
+         * the full xmm size must be aligned, so such operands are loaded
+         * with movups first */
+        const bool use_vex = mayiuse(avx);
+
         auto cvt2ps = [=](const Xmm &dst, const Operand &src, data_type_t idt) {
             Xmm dst_pure = Xmm(dst.getIdx());
             switch (idt) {
                 case f32:
                     if (src.isMEM() || src.getIdx() != dst.getIdx())
-                        vmovups(dst, src);
+                        use_vex ? vmovups(dst, src) : movups(dst, src);
                     break;
                 case bf16:
                     vpmovzxwd(dst, src);
                     vpslld(dst, dst, 0x10);
                     break;
-                case s32: vcvtdq2ps(dst, src); break;
+                case s32:
+                    if (use_vex) {
+                        vcvtdq2ps(dst, src);
+                    } else if (src.isMEM()) {
+                        movups(dst, src);
+                        cvtdq2ps(dst, dst);
+                    } else {
+                        cvtdq2ps(dst, src);
+                    }
+                    break;
                 case s8:
-                    vpmovsxbd(dst, src);
-                    vcvtdq2ps(dst_pure, dst);
+                    if (use_vex) {
+                        vpmovsxbd(dst, src);
+                        vcvtdq2ps(dst_pure, dst);
+                    } else {
+                        pmovsxbd(dst, src);
+                        cvtdq2ps(dst_pure, dst);
+                    }
                     break;
                 case u8:
-                    vpmovzxbd(dst, src);
-                    vcvtdq2ps(dst_pure, dst);
+                    if (use_vex) {
+                        vpmovzxbd(dst, src);
+                        vcvtdq2ps(dst_pure, dst);
+                    } else {
+                        pmovzxbd(dst, src);
+                        cvtdq2ps(dst_pure, dst);
+                    }
                     break;
                 default: assert(!"unreachable");
             }
@@ -343,36 +365,48 @@ struct jit_uni_reorder_kernel_f32 : public kernel_t, public jit_generator {
                     break;
                 case s32:
                     if (idt == f32)
-                        vcvtps2dq(xmm, xmm);
+                        use_vex ? vcvtps2dq(xmm, xmm) : cvtps2dq(xmm, xmm);
                     else if (idt == s8)
-                        vpmovsxbd(xmm, xmm);
+                        use_vex ? vpmovsxbd(xmm, xmm) : pmovsxbd(xmm, xmm);
                     else if (idt == u8)
-                        vpmovzxbd(xmm, xmm);
+                        use_vex ? vpmovzxbd(xmm, xmm) : pmovzxbd(xmm, xmm);
                     break;
                 case s8:
-                    if (idt == f32) vcvtps2dq(xmm, xmm);
+                    if (idt == f32)
+                        use_vex ? vcvtps2dq(xmm, xmm) : cvtps2dq(xmm, xmm);
                     if (idt == f32 || idt == s32) {
                         if (mayiuse(avx512_core)) {
                             vpmovsdb(xmm, xmm);
-                        } else {
+                        } else if (use_vex) {
                             vpackssdw(xmm, xmm, xmm_zero);
                             vpacksswb(xmm, xmm, xmm_zero);
+                        } else {
+                            packssdw(xmm, xmm_zero);
+                            packsswb(xmm, xmm_zero);
                         }
                     }
-                    if (idt == u8) vpminub(xmm, xmm, xmm_4x127b);
+                    if (idt == u8)
+                        use_vex ? vpminub(xmm, xmm, xmm_4x127b)
+                                : pminub(xmm, xmm_4x127b);
                     break;
                 case u8:
-                    if (idt == f32) vcvtps2dq(xmm, xmm);
+                    if (idt == f32)
+                        use_vex ? vcvtps2dq(xmm, xmm) : cvtps2dq(xmm, xmm);
                     if (idt == f32 || idt == s32) {
                         if (mayiuse(avx512_core)) {
                             vpmaxsd(xmm, xmm, xmm_zero);
                             vpmovusdb(xmm, xmm);
-                        } else {
+                        } else if (use_vex) {
                             vpackssdw(xmm, xmm, xmm_zero);
                             vpackuswb(xmm, xmm, xmm_zero);
+                        } else {
+                            packssdw(xmm, xmm_zero);
+                            packuswb(xmm, xmm_zero);
                         }
                     }
-                    if (idt == s8) vpmaxsb(xmm, xmm, xmm_zero);
+                    if (idt == s8)
+                        use_vex ? vpmaxsb(xmm, xmm, xmm_zero)
+                                : pmaxsb(xmm, xmm_zero);
                     break;
                 default: assert(!"unreachable");
             }
@@ -524,23 +558,22 @@ struct jit_uni_reorder_kernel_f32 : public kernel_t, public jit_generator {
             }
 
             /* dst <-- beta * dst + xmm[:] */
-            assert(prb_.beta == 0.f || prb_.beta == 1.f);
-            if (prb_.beta == 1.f) {
+            if (prb_.beta != 0.f) {
                 for (int ur = 0; ur < reg_unroll; ur += ur_step) {
-                    if (prb_.otype == f32) {
-                        /* non VEX instructions do not support unaligned
-                         * memory for instructions other than movups. */
-                        if (mayiuse(avx)) {
-                            vaddps(Xmm(ur), o_addr(o_off[ur]));
-                        } else {
-                            /* register xmm(1) is unused */
-                            movups(Xmm(1), o_addr(o_off[ur]));
-                            addps(Xmm(ur), Xmm(1));
-                        }
-                    } else {
-                        cvt2ps(Xmm(1), o_addr(o_off[ur]), prb_.otype);
-                        vaddps(Xmm(ur), Xmm(1));
+                    if (prb_.otype == f32 && prb_.beta == 1.f && use_vex) {
+                        vaddps(Xmm(ur), o_addr(o_off[ur]));
+                        continue;
                     }
+
+                    /* non VEX instructions do not support unaligned
+                     * memory for instructions other than movups, so dst
+                     * goes to the unused register xmm(1) first */
+                    if (prb_.otype == f32)
+                        movups(Xmm(1), o_addr(o_off[ur]));
+                    else
+                        cvt2ps(Xmm(1), o_addr(o_off[ur]), prb_.otype);
+                    if (prb_.beta != 1.f) mulps(Xmm(1), xmm_beta);
+                    addps(Xmm(ur), Xmm(1));
                 }
             }
         } else {
@@ -555,24 +588,26 @@ struct jit_uni_reorder_kernel_f32 : public kernel_t, public jit_generator {
             }
 
             /* dst <-- beta * dst + xmm[0] */
-            assert(prb_.beta == 0.f || prb_.beta == 1.f);
-            if (prb_.beta == 1.f) {
+            if (prb_.beta != 0.f) {
                 for (int ur = 0; ur < reg_unroll; ur += ur_step) {
-                    if (prb_.otype == f32) {
+                    if (prb_.otype == f32 && prb_.beta == 1.f) {
                         addss(Xmm(ur), o_addr(o_off[ur]));
+                        continue;
+                    }
+
+                    if (utils::one_of(prb_.otype, f32, s32)) {
+                        movss(xmm_tmp, o_addr(o_off[ur]));
+                    } else if (utils::one_of(prb_.otype, s8, u8)) {
+                        pinsrb(xmm_tmp, o_addr(o_off[ur]), 0x0);
+                    } else if (prb_.otype == bf16) {
+                        pinsrw(xmm_tmp, o_addr(o_off[ur]), 0x0);
                     } else {
-                        if (prb_.otype == s32) {
-                            vmovss(xmm_tmp, o_addr(o_off[ur]));
-                        } else if (utils::one_of(prb_.otype, s8, u8)) {
-                            pinsrb(xmm_tmp, o_addr(o_off[ur]), 0x0);
-                        } else if (prb_.otype == bf16) {
-                            pinsrw(xmm_tmp, o_addr(o_off[ur]), 0x0);
-                        } else {
-                            assert(!"unsupported o_type");
-                        }
-                        cvt2ps(xmm_tmp, xmm_tmp, prb_.otype);
-                        addps(Xmm(ur), xmm_tmp);
+                        assert(!"unsupported o_type");
                     }
+                    if (prb_.otype != f32)
+                        cvt2ps(xmm_tmp, xmm_tmp, prb_.otype);
+                    if (prb_.beta != 1.f) mulss(xmm_tmp, xmm_beta);
+                    addss(Xmm(ur), xmm_tmp);
                 }
             }
         }
@@ -705,13 +740,20 @@ struct jit_uni_reorder_kernel_f32 : public kernel_t, public jit_generator {
         mov(reg_ptr_out, PARAM(out));
 #undef PARAM
 
-        if (mayiuse(avx)) {
+        if (mayiuse(avx))
             vxorps(xmm_zero, xmm_zero, xmm_zero);
+        else
+            xorps(xmm_zero, xmm_zero);
 
-            if (prb_.itype == data_type::u8 && prb_.otype == data_type::s8) {
-                mov(reg_tmp.cvt32(), 0x7f7f7f7f);
-                movd(xmm_4x127b, reg_tmp.cvt32());
-            }
+        if (prb_.itype == data_type::u8 && prb_.otype == data_type::s8) {
+            mov(reg_tmp.cvt32(), 0x7f7f7f7f);
+            movd(xmm_4x127b, reg_tmp.cvt32());
+        }
+
+        if (!utils::one_of(prb_.beta, 0.f, 1.f)) {
+            mov(reg_tmp.cvt32(), float2int(prb_.beta));
+            movd(xmm_beta, reg_tmp.cvt32());
+            shufps(xmm_beta, xmm_beta, 0x0);
         }
 
         impl();
@@ -739,6 +781,7 @@ private:
     Xmm xmm_zero = xmm14;
     Xmm xmm_4x127b = xmm13; // TODO: unite with xmm_zero
     Xmm xmm_tmp = xmm12;
+    Xmm xmm_beta = xmm11;
 
     /* bf16 support on SKX */
     bf16_emulation_t *bf16_emu_;
@@ -913,6 +956,46 @@ static void prb_thread_kernel_balance(tr::prb_t &prb, int &ndims_ker_max) {
     }
 }
 
+status_t tr::prb_prepare(tr::prb_t &prb, tr::kernel_t::desc_t &ker_desc) {
+    DEBUG({
+        printf("init : ");
+        prb_dump(prb);
+    });
+    // Sort the prb array in increasing sizes of the output stride
+    prb_normalize(prb);
+    DEBUG({
+        printf("norm : ");
+        prb_dump(prb);
+    });
+    /* Combine the variables, which appear together on both
+     * sides of the reorder */
+    prb_simplify(prb);
+    DEBUG({
+        printf("smpl : ");
+        prb_dump(prb);
+    });
+
+    prb_block_for_cache(prb);
+    DEBUG({
+        printf("cache: ");
+        prb_dump(prb);
+    });
+
+    int ndims_ker_max;
+    prb_thread_kernel_balance(prb, ndims_ker_max);
+
+    status_t ker_init_status
+            = tr::kernel_t::desc_init(ker_desc, prb, ndims_ker_max);
+    if (ker_init_status != status::success) return ker_init_status;
+
+    DEBUG({
+        printf("ker  : ");
+        prb_dump(ker_desc.prb);
+    });
+
+    return status::success;
+}
+
 struct jit_uni_reorder_t : public primitive_impl_t {
     struct pd_t : public cpu_reorder_pd_t {
         using cpu_reorder_pd_t::cpu_reorder_pd_t;
@@ -928,46 +1011,10 @@ struct jit_uni_reorder_t : public primitive_impl_t {
             status_t prb_init_status = prb_init(prb, *src_md, *dst_md, attr);
             if (prb_init_status != status::success) return prb_init_status;
 
-            DEBUG({
-                printf("init : ");
-                prb_dump(prb);
-            });
-            // Sort the prb array in increasing sizes of the output stride
-            prb_normalize(prb);
-            DEBUG({
-                printf("norm : ");
-                prb_dump(prb);
-            });
-            /* Combine the variables, which appear together on both
-             * sides of the reorder */
-            prb_simplify(prb);
-            DEBUG({
-                printf("smpl : ");
-                prb_dump(prb);
-            });
-
-            prb_block_for_cache(prb);
-            DEBUG({
-                printf("cache: ");
-                prb_dump(prb);
-            });
-
-            int ndims_ker_max;
-            prb_thread_kernel_balance(prb, ndims_ker_max);
-
             tr::kernel_t::desc_t ker_desc;
-            status_t ker_init_status
-                    = tr::kernel_t::desc_init(ker_desc, prb, ndims_ker_max);
-            if (ker_init_status != status::success) return ker_init_status;
-
-            const int ndims_driver = prb.ndims - ker_desc.prb.ndims;
-            if (ndims_driver > jit_uni_reorder_t::ndims_driver_max)
-                return status::unimplemented;
-
-            DEBUG({
-                printf("ker  : ");
-                prb_dump(ker_desc.prb);
-            });
+            status_t prb_prepare_status = tr::prb_prepare(prb, ker_desc);
+            if (prb_prepare_status != status::success)
+                return prb_prepare_status;
 
             auto _pd = new pd_t(
                     engine, attr, src_engine, src_md, dst_engine, dst_md);
@@ -1068,6 +1115,51 @@ struct jit_uni_reorder_t : public primitive_impl_t {
                 });
     }
 
+    /* the driver for any number of dimensions, the flat range of its
+     * iterations is split between the threads */
+    void omp_driver_nd(int ithr, int nthr, int off, const char *in, char *out,
+            const float *scale) const {
+        const tr::node_t *ns = pd()->prb_.nodes + off;
+        const int ndims_drv = pd()->prb_.ndims - off;
+        const size_t itype_sz = data_type_size(pd()->prb_.itype);
+        const size_t otype_sz = data_type_size(pd()->prb_.otype);
+
+        size_t work_amount = 1;
+        for (int d = 0; d < ndims_drv; ++d)
+            work_amount *= ns[d].n;
+
+        size_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        /* ns[0] is the innermost dimension, as in the drivers above */
+        ptrdiff_t idx[tr::max_ndims];
+        size_t rem = start;
+        for (int d = 0; d < ndims_drv; ++d) {
+            idx[d] = (ptrdiff_t)(rem % ns[d].n);
+            rem /= ns[d].n;
+        }
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            ptrdiff_t i_off = 0, o_off = 0, s_off = 0;
+            for (int d = 0; d < ndims_drv; ++d) {
+                i_off += idx[d] * ns[d].is;
+                o_off += idx[d] * ns[d].os;
+                s_off += idx[d] * ns[d].ss;
+            }
+
+            auto c = tr::call_param_t();
+            c.in = in + i_off * itype_sz;
+            c.out = out + o_off * otype_sz;
+            c.scale = scale + s_off;
+            (*kernel_)(&c);
+
+            for (int d = 0; d < ndims_drv; ++d) {
+                if (++idx[d] < (ptrdiff_t)ns[d].n) break;
+                idx[d] = 0;
+            }
+        }
+    }
+
     void omp_driver(const char *in, char *out, const float *scale) const {
         in += pd()->prb_.ioff * data_type_size(pd()->prb_.itype);
         out += pd()->prb_.ooff * data_type_size(pd()->prb_.otype);
@@ -1083,7 +1175,6 @@ struct jit_uni_reorder_t : public primitive_impl_t {
 
         int ndims = pd()->prb_.ndims;
         int ndims_ker = pd()->ker_desc_.prb.ndims;
-        assert(ndims - ndims_ker <= ndims_driver_max);
 
         if (ndims - ndims_ker == 0) {
             omp_driver_0d(ndims_ker, in, out, scale);
@@ -1102,7 +1193,9 @@ struct jit_uni_reorder_t : public primitive_impl_t {
                     case 4:
                         omp_driver_4d(ithr, nthr, ndims_ker, in, out, scale);
                         break;
-                    default: assert(!"unimplemented");
+                    default:
+                        omp_driver_nd(ithr, nthr, ndims_ker, in, out, scale);
+                        break;
                 }
             });
         }
@@ -1112,13 +1205,13 @@ struct jit_uni_reorder_t : public primitive_impl_t {
         auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
         auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
 
-        omp_driver(in, out, pd()->attr()->output_scales_.scales_);
+        DEFINE_SCALES_BUFFER(scales);
+
+        omp_driver(in, out, scales);
 
         return status::success;
     }
 
-    enum { ndims_driver_max = 4 };
-
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
     tr::kernel_t *kernel_;
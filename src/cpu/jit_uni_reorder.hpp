@@ -112,6 +112,11 @@ protected:
     void (*ker_)(const call_param_t *);
 };
 
+/** prepares the problem for the execution: normalizes, simplifies and
+ * blocks it for cache, then splits its dimensions between the parallel
+ * driver (the outermost ones) and the kernel described by ker_desc */
+status_t prb_prepare(prb_t &prb, kernel_t::desc_t &ker_desc);
+
 /* TODO: add trans_t class */
 
 } // namespace tr
@@ -0,0 +1,570 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "resampling_utils.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+
+#include "jit_uni_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+namespace resampling_impl {
+
+template <cpu_isa_t isa>
+bool init_conf(jit_resampling_conf_t &conf, const resampling_pd_t *pd) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    const bool is_fwd = pd->is_fwd();
+    const memory_desc_wrapper in_d(is_fwd ? pd->src_md() : pd->diff_dst_md());
+    const memory_desc_wrapper out_d(is_fwd ? pd->dst_md() : pd->diff_src_md());
+
+    const data_type_t dt = in_d.data_type();
+    const bool dt_ok = out_d.data_type() == dt
+            && (isa == avx2 ? dt == f32 : utils::one_of(dt, f32, bf16))
+            && IMPLICATION(dt == bf16, mayiuse(avx512_core));
+    if (!dt_ok) return false;
+
+    const int ndims = pd->ndims();
+    const auto blocked_16c = utils::pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
+    const auto blocked_8c = utils::pick(ndims - 3, nCw8c, nChw8c, nCdhw8c);
+    const auto channels_last = utils::pick(ndims - 3, nwc, nhwc, ndhwc);
+    const auto tag
+            = in_d.matches_one_of_tag(blocked_16c, blocked_8c, channels_last);
+    if (tag == format_tag::undef || !out_d.matches_tag(tag)) return false;
+
+    conf.is_fwd = is_fwd;
+    conf.alg = pd->desc()->alg_kind;
+    conf.dt = dt;
+    conf.MB = pd->MB();
+    conf.c_block = tag == blocked_16c ? 16 : tag == blocked_8c ? 8 : pd->C();
+    conf.nb_c = utils::div_up(pd->C(), conf.c_block);
+
+    const dim_t src_sp[3] = {pd->ID(), pd->IH(), pd->IW()};
+    const dim_t dst_sp[3] = {pd->OD(), pd->OH(), pd->OW()};
+    const auto &in_str = in_d.blocking_desc().strides;
+    const auto &out_str = out_d.blocking_desc().strides;
+    for (int i = 0; i < 2; ++i) {
+        conf.in_str[i] = in_str[i];
+        conf.out_str[i] = out_str[i];
+    }
+    for (int k = 0; k < 3; ++k) {
+        const int d = ndims - 3 + k; // the missing dims have zero strides
+        conf.src_sp[k] = src_sp[k];
+        conf.dst_sp[k] = dst_sp[k];
+        conf.in_str[2 + k] = d >= 2 ? in_str[d] : 0;
+        conf.out_str[2 + k] = d >= 2 ? out_str[d] : 0;
+    }
+
+    // a forward entry uses at most 2 input points, while a backward one
+    // collects all the output points within a distance of 1 in src terms
+    auto max_entries = [&](int k) {
+        if (is_fwd) return conf.alg == alg_kind::resampling_nearest ? 1 : 2;
+        return (int)(2 * utils::div_up(dst_sp[k], src_sp[k]) + 2);
+    };
+    conf.max_dh_entries = (dim_t)max_entries(0) * max_entries(1);
+
+    return true;
+}
+
+/* An input point of a dimension: its offset in bytes and its weight */
+struct entry_t {
+    dim_t off;
+    float wei;
+};
+
+/* Tabulates the entries of every output point of a dimension with src_size
+ * and dst_size points (in the forward pass terms). The entries of the output
+ * point i are ent[beg[i]] ... ent[beg[i + 1] - 1]. */
+struct table_t {
+    std::vector<dim_t> beg;
+    std::vector<entry_t> ent;
+
+    void init(alg_kind_t alg, bool is_fwd, dim_t src_size, dim_t dst_size,
+            dim_t stride) {
+        using namespace resampling_utils;
+
+        // the src points of the dst point o, the coinciding ones are merged
+        auto fwd_entries = [&](dim_t o, dim_t *idx, float *wei) {
+            if (alg == alg_kind::resampling_nearest) {
+                idx[0] = nearest_idx(o, dst_size, src_size);
+                wei[0] = 1.f;
+                return 1;
+            }
+            const linear_coeffs_t c(o, dst_size, src_size);
+            if (c.idx[0] == c.idx[1] || c.wei[1] == 0.f) {
+                idx[0] = c.idx[0];
+                wei[0] = 1.f;
+                return 1;
+            }
+            for (int k = 0; k < 2; ++k) {
+                idx[k] = c.idx[k];
+                wei[k] = c.wei[k];
+            }
+            return 2;
+        };
+
+        dim_t idx[2];
+        float wei[2];
+
+        if (is_fwd) {
+            beg.resize(dst_size + 1);
+            for (dim_t o = 0; o < dst_size; ++o) {
+                beg[o] = ent.size();
+                const int n = fwd_entries(o, idx, wei);
+                for (int k = 0; k < n; ++k)
+                    ent.push_back({idx[k] * stride, wei[k]});
+            }
+            beg[dst_size] = ent.size();
+            return;
+        }
+
+        // the backward table is the transposed forward one
+        beg.assign(src_size + 1, 0);
+        for (dim_t o = 0; o < dst_size; ++o) {
+            const int n = fwd_entries(o, idx, wei);
+            for (int k = 0; k < n; ++k)
+                ++beg[idx[k] + 1];
+        }
+        for (dim_t i = 0; i < src_size; ++i)
+            beg[i + 1] += beg[i];
+
+        ent.resize(beg[src_size]);
+        std::vector<dim_t> pos(beg.begin(), beg.end() - 1);
+        for (dim_t o = 0; o < dst_size; ++o) {
+            const int n = fwd_entries(o, idx, wei);
+            for (int k = 0; k < n; ++k)
+                ent[pos[idx[k]]++] = {o * stride, wei[k]};
+        }
+    }
+
+    dim_t size(dim_t i) const { return beg[i + 1] - beg[i]; }
+    const entry_t *begin(dim_t i) const { return &ent[beg[i]]; }
+    const entry_t *end(dim_t i) const { return &ent[beg[i + 1]]; }
+};
+
+} // namespace resampling_impl
+
+namespace {
+
+using resampling_impl::entry_t;
+
+/* Computes a row of output points. For every output point o the kernel
+ * accumulates in f32
+ *
+ *     out[o] += w_ent[j].wei * dh_ent[k].wei
+ *             * in[w_ent[j].off + dh_ent[k].off],
+ *
+ * where j runs over the W entries of o and k over the (D, H) entries of the
+ * row. A point is a vector of c_block channels processed by unroll vector
+ * registers at a time. */
+template <cpu_isa_t isa>
+struct jit_uni_resampling_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling_kernel_t)
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *src;
+        void *dst;
+        const entry_t *dh_beg, *dh_end;
+        const dim_t *w_beg; // the index of the first W entry of every point
+        const entry_t *w_ent;
+        size_t npoints;
+    };
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const int unroll = isa == avx512_common ? 8 : 4;
+
+    void (*ker_)(const call_params_t *);
+    void operator()(const call_params_t *p) { (*ker_)(p); }
+
+    jit_uni_resampling_kernel_t(const jit_resampling_conf_t &conf)
+        : dt_(conf.dt)
+        , dt_sz_(types::data_type_size(conf.dt))
+        , c_block_(conf.c_block)
+        , out_w_stride_(conf.out_str[4] * types::data_type_size(conf.dt))
+        , bf16_emu_(nullptr) {
+        if (dt_ == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                    bf16_emu_reserv_4);
+
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(
+                const_cast<uint8_t *>(this->getCode()));
+    }
+
+    ~jit_uni_resampling_kernel_t() { delete bf16_emu_; }
+
+private:
+    static_assert(sizeof(entry_t) == 16, "jit code expects 16-byte entries");
+
+    const data_type_t dt_;
+    const size_t dt_sz_;
+    const dim_t c_block_;
+    const size_t out_w_stride_;
+
+    bf16_emulation_t *bf16_emu_;
+
+    Reg64 reg_param = abi_param1;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_dh_beg = r10;
+    Reg64 reg_dh_end = r11;
+    Reg64 reg_w_beg = r12;
+    Reg64 reg_w_ent = r13;
+    Reg64 reg_npoints = r14;
+    Reg64 reg_j = r15;
+    Reg64 reg_j_end = rax;
+    Reg64 reg_k = rdx;
+    Reg64 reg_addr = rsi;
+    Reg64 reg_c_off = rbp;
+    Reg64 bf16_emu_scratch = rbx;
+
+    Opmask k_tail_mask = k2;
+
+    Vmm vmm_acc(int i) { return Vmm(i); }
+    Vmm vmm_src(int i) { return Vmm(unroll + i); }
+    Vmm vmm_w_wei = Vmm(2 * unroll);
+    Vmm vmm_wei = Vmm(2 * unroll + 1);
+    Vmm vmm_tail_mask = Vmm(2 * unroll + 2);
+
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+
+    int tail() const { return (int)(c_block_ % simd_w); }
+
+    // Loads (a tail of) simd_w elements and converts them to f32
+    void load(const Vmm &v, const Address &addr, bool tail) {
+        if (isa == avx2) {
+            // only f32 is supported on avx2
+            if (tail)
+                vmaskmovps(v, vmm_tail_mask, addr);
+            else
+                vmovups(v, addr);
+            return;
+        }
+
+        const Vmm v_masked = tail ? v | k_tail_mask | T_z : v;
+        if (dt_ == data_type::bf16) {
+            vpmovzxwd(v_masked, addr);
+            vpslld(v, v, 16);
+        } else
+            vmovups(v_masked, addr);
+    }
+
+    // Converts f32 values and stores (a tail of) simd_w of them
+    void store(const Address &addr, const Vmm &v, bool tail) {
+        if (isa == avx2) {
+            if (tail)
+                vmaskmovps(addr, vmm_tail_mask, v);
+            else
+                vmovups(addr, v);
+            return;
+        }
+
+        const Address addr_masked = tail ? addr | k_tail_mask : addr;
+        if (dt_ == data_type::bf16) {
+            const Ymm y = Ymm(v.getIdx());
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(y, Zmm(v.getIdx()));
+            else
+                vcvtneps2bf16(y, v);
+            vmovdqu16(addr_masked, y);
+        } else
+            vmovups(addr_masked, v);
+    }
+
+    // Sets the mask for the tail of a point
+    void prepare_tail_mask() {
+        if (isa == avx2) {
+            static const uint32_t mask_f32[16]
+                    = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                            0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0,
+                            0, 0, 0, 0, 0, 0, 0};
+            mov(reg_addr, reinterpret_cast<size_t>(&mask_f32[8 - tail()]));
+            vmovups(vmm_tail_mask, ptr[reg_addr]);
+        } else {
+            mov(reg_addr.cvt32(), (1 << tail()) - 1);
+            kmovw(k_tail_mask, reg_addr.cvt32());
+        }
+    }
+
+    // Computes nvregs vectors of the current point at reg_c_off, the last
+    // one is a tail if the tail flag is set
+    void compute_point(int nvregs, bool tail) {
+        Label w_loop, w_end, dh_loop, dh_end;
+
+        for (int i = 0; i < nvregs; i++)
+            uni_vpxor(vmm_acc(i), vmm_acc(i), vmm_acc(i));
+
+        // the W entries of the point
+        mov(reg_j, ptr[reg_w_beg]);
+        mov(reg_j_end, ptr[reg_w_beg + sizeof(dim_t)]);
+        shl(reg_j, 4);
+        shl(reg_j_end, 4);
+        add(reg_j, reg_w_ent);
+        add(reg_j_end, reg_w_ent);
+
+        L(w_loop);
+        {
+            cmp(reg_j, reg_j_end);
+            jge(w_end, T_NEAR);
+
+            uni_vbroadcastss(vmm_w_wei, ptr[reg_j + offsetof(entry_t, wei)]);
+            mov(reg_k, reg_dh_beg);
+            L(dh_loop);
+            {
+                cmp(reg_k, reg_dh_end);
+                jge(dh_end, T_NEAR);
+
+                mov(reg_addr, ptr[reg_k + offsetof(entry_t, off)]);
+                add(reg_addr, ptr[reg_j + offsetof(entry_t, off)]);
+                add(reg_addr, reg_src);
+                uni_vbroadcastss(vmm_wei, ptr[reg_k + offsetof(entry_t, wei)]);
+                uni_vmulps(vmm_wei, vmm_wei, vmm_w_wei);
+                for (int i = 0; i < nvregs; i++) {
+                    load(vmm_src(i),
+                            ptr[reg_addr + reg_c_off + i * simd_w * dt_sz_],
+                            tail && i == nvregs - 1);
+                    uni_vfmadd231ps(vmm_acc(i), vmm_src(i), vmm_wei);
+                }
+
+                add(reg_k, sizeof(entry_t));
+                jmp(dh_loop, T_NEAR);
+            }
+            L(dh_end);
+
+            add(reg_j, sizeof(entry_t));
+            jmp(w_loop, T_NEAR);
+        }
+        L(w_end);
+
+        for (int i = 0; i < nvregs; i++)
+            store(ptr[reg_dst + reg_c_off + i * simd_w * dt_sz_], vmm_acc(i),
+                    tail && i == nvregs - 1);
+    }
+
+    void generate() {
+        preamble();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_dh_beg, ptr[reg_param + PARAM_OFF(dh_beg)]);
+        mov(reg_dh_end, ptr[reg_param + PARAM_OFF(dh_end)]);
+        mov(reg_w_beg, ptr[reg_param + PARAM_OFF(w_beg)]);
+        mov(reg_w_ent, ptr[reg_param + PARAM_OFF(w_ent)]);
+        mov(reg_npoints, ptr[reg_param + PARAM_OFF(npoints)]);
+#undef PARAM_OFF
+
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+        if (tail() > 0) prepare_tail_mask();
+
+        // a point is split into groups of unroll vectors and the rest
+        const int nvecs = (int)(c_block_ / simd_w);
+        const int ngroups = nvecs / unroll;
+        const int nvregs_rest = nvecs % unroll + (tail() > 0);
+        const size_t group_size = unroll * simd_w * dt_sz_;
+
+        Label point_loop, group_loop;
+        L(point_loop);
+        {
+            xor_(reg_c_off, reg_c_off);
+            if (ngroups > 0) {
+                L(group_loop);
+                compute_point(unroll, false);
+                add(reg_c_off, group_size);
+                cmp(reg_c_off, ngroups * group_size);
+                jl(group_loop, T_NEAR);
+            }
+            if (nvregs_rest > 0) compute_point(nvregs_rest, tail() > 0);
+
+            add(reg_dst, out_w_stride_);
+            add(reg_w_beg, sizeof(dim_t));
+            dec(reg_npoints);
+            jnz(point_loop, T_NEAR);
+        }
+
+        postamble();
+    }
+};
+
+} // namespace
+
+namespace resampling_impl {
+
+template <cpu_isa_t isa>
+struct driver_t : public c_compatible {
+    using kernel_t = jit_uni_resampling_kernel_t<isa>;
+
+    driver_t(const jit_resampling_conf_t &conf)
+        : conf_(conf), dt_sz_(types::data_type_size(conf.dt)) {
+        // the tables point to the kernel input: src or diff_dst
+        for (int k = 0; k < 3; ++k)
+            tables_[k].init(conf.alg, conf.is_fwd, conf.src_sp[k],
+                    conf.dst_sp[k], conf.in_str[2 + k] * dt_sz_);
+        ker_ = new kernel_t(conf);
+    }
+
+    ~driver_t() { delete ker_; }
+
+    // Every thread computes whole output rows: it combines the (D, H)
+    // entries of a row in its part of the scratchpad and runs the kernel
+    // over the row using the W table.
+    void exec(const char *in, char *out, entry_t *dh_table) const {
+        const auto &c = conf_;
+        const auto &sp = c.is_fwd ? c.dst_sp : c.src_sp;
+        const dim_t OD = sp[0], OH = sp[1], OW = sp[2];
+        const auto &td = tables_[0], &th = tables_[1], &tw = tables_[2];
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            entry_t *dh_beg = dh_table + ithr * c.max_dh_entries;
+
+            for_nd(ithr, nthr, c.MB, c.nb_c, OD, OH,
+                    [&](dim_t n, dim_t cb, dim_t od, dim_t oh) {
+                        entry_t *dh_end = dh_beg;
+                        for_(const entry_t *ed = td.begin(od);
+                                ed != td.end(od); ++ed)
+                        for (const entry_t *eh = th.begin(oh);
+                                eh != th.end(oh); ++eh)
+                            *dh_end++ = {ed->off + eh->off, ed->wei * eh->wei};
+                        assert(dh_end - dh_beg <= c.max_dh_entries);
+
+                        typename kernel_t::call_params_t p;
+                        p.src = in
+                                + (n * c.in_str[0] + cb * c.in_str[1])
+                                        * dt_sz_;
+                        p.dst = out
+                                + (n * c.out_str[0] + cb * c.out_str[1]
+                                          + od * c.out_str[2]
+                                          + oh * c.out_str[3])
+                                        * dt_sz_;
+                        p.dh_beg = dh_beg;
+                        p.dh_end = dh_end;
+                        p.w_beg = &tw.beg[0];
+                        p.w_ent = tw.ent.empty() ? nullptr : &tw.ent[0];
+                        p.npoints = OW;
+                        (*ker_)(&p);
+                    });
+        });
+    }
+
+private:
+    const jit_resampling_conf_t conf_;
+    const size_t dt_sz_;
+
+    table_t tables_[3];
+    kernel_t *ker_;
+};
+
+} // namespace resampling_impl
+
+template <cpu_isa_t isa>
+jit_uni_resampling_fwd_t<isa>::jit_uni_resampling_fwd_t(const pd_t *apd)
+    : primitive_impl_t(apd) {
+    resampling_driver_ = new resampling_impl::driver_t<isa>(pd()->conf_);
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_fwd_t<isa>::~jit_uni_resampling_fwd_t() {
+    delete resampling_driver_;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t dt_sz = src_d.data_type_size();
+
+    auto dh_table = ctx.get_scratchpad_grantor().template get<
+            resampling_impl::entry_t>(
+            memory_tracking::names::key_resampling_dh_table);
+
+    resampling_driver_->exec(src + src_d.offset0() * dt_sz,
+            dst + dst_d.offset0() * dt_sz, dh_table);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_bwd_t<isa>::jit_uni_resampling_bwd_t(const pd_t *apd)
+    : primitive_impl_t(apd) {
+    resampling_driver_ = new resampling_impl::driver_t<isa>(pd()->conf_);
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_bwd_t<isa>::~jit_uni_resampling_bwd_t() {
+    delete resampling_driver_;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
+
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const size_t dt_sz = diff_src_d.data_type_size();
+
+    auto dh_table = ctx.get_scratchpad_grantor().template get<
+            resampling_impl::entry_t>(
+            memory_tracking::names::key_resampling_dh_table);
+
+    resampling_driver_->exec(diff_dst + diff_dst_d.offset0() * dt_sz,
+            diff_src + diff_src_d.offset0() * dt_sz, dh_table);
+
+    return status::success;
+}
+
+template bool resampling_impl::init_conf<avx512_common>(
+        jit_resampling_conf_t &conf, const resampling_pd_t *pd);
+template bool resampling_impl::init_conf<avx2>(
+        jit_resampling_conf_t &conf, const resampling_pd_t *pd);
+
+template struct jit_uni_resampling_fwd_t<avx512_common>;
+template struct jit_uni_resampling_fwd_t<avx2>;
+template struct jit_uni_resampling_bwd_t<avx512_common>;
+template struct jit_uni_resampling_bwd_t<avx2>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_RESAMPLING_HPP
+#define JIT_UNI_RESAMPLING_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "cpu_resampling_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Every output point (a vector of channels) is computed as a weighted sum of
+ * input points. The input offsets and the weights are tabulated for each
+ * spatial dimension: the forward pass gathers src points into dst, while the
+ * backward pass uses the transposed tables to gather diff_dst points into
+ * diff_src, so that no atomic updates are needed. */
+struct jit_resampling_conf_t {
+    bool is_fwd;
+    alg_kind_t alg;
+    data_type_t dt;
+
+    dim_t MB, nb_c; // nb_c is 1 for the channels-last layouts
+    dim_t c_block; // number of channels in a point
+
+    // spatial dims (D, H, W) of src and dst in the forward pass terms
+    dim_t src_sp[3], dst_sp[3];
+    // strides of the kernel input and output: N, C (block), D, H, W
+    dim_t in_str[5], out_str[5];
+
+    // the maximal number of the tabulated (D, H) entries of an output row
+    dim_t max_dh_entries;
+};
+
+namespace resampling_impl {
+template <cpu_isa_t isa>
+struct driver_t;
+
+template <cpu_isa_t isa>
+bool init_conf(jit_resampling_conf_t &conf, const resampling_pd_t *pd);
+
+inline void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_resampling_conf_t &conf) {
+    // a table of (offset, weight) entries per thread
+    scratchpad.book(memory_tracking::names::key_resampling_dh_table,
+            2 * sizeof(dim_t) * conf.max_dh_entries * dnnl_get_max_threads());
+}
+} // namespace resampling_impl
+
+template <cpu_isa_t isa>
+struct jit_uni_resampling_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_resampling_fwd_t);
+
+        status_t init() {
+            bool ok = true && set_default_params() == status::success
+                    && is_fwd() && mayiuse(isa) && !has_zero_dim_memory()
+                    && attr()->has_default_values()
+                    && resampling_impl::init_conf<isa>(conf_, this);
+            if (!ok) return status::unimplemented;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            resampling_impl::init_scratchpad(scratchpad, conf_);
+
+            return status::success;
+        }
+
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_fwd_t(const pd_t *apd);
+    ~jit_uni_resampling_fwd_t();
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    resampling_impl::driver_t<isa> *resampling_driver_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_resampling_bwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_resampling_bwd_t);
+
+        status_t init() {
+            bool ok = true && set_default_params() == status::success
+                    && !is_fwd() && mayiuse(isa) && !has_zero_dim_memory()
+                    && attr()->has_default_values()
+                    && resampling_impl::init_conf<isa>(conf_, this);
+            if (!ok) return status::unimplemented;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            resampling_impl::init_scratchpad(scratchpad, conf_);
+
+            return status::success;
+        }
+
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_bwd_t(const pd_t *apd);
+    ~jit_uni_resampling_bwd_t();
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    resampling_impl::driver_t<isa> *resampling_driver_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
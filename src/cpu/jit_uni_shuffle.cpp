@@ -0,0 +1,314 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <limits.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_generator.hpp"
+
+#include "jit_uni_shuffle.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace shuffle_impl {
+
+template <cpu_isa_t isa>
+bool init_conf(jit_shuffle_conf_t &conf, const shuffle_pd_t *pd) {
+    using namespace format_tag;
+
+    const memory_desc_wrapper data_d(pd->data_md());
+    if (pd->axis() != 1 || data_d.has_zero_dim()
+            || data_d.data_type_size() != sizeof(float))
+        return false;
+
+    format_tag_t dat_tag = format_tag::undef;
+    if (isa == avx512_common)
+        dat_tag = memory_desc_matches_one_of_tag(
+                *pd->data_md(), nChw16c, nCdhw16c, nhwc, ndhwc);
+    else
+        dat_tag = memory_desc_matches_one_of_tag(*pd->data_md(), nChw16c,
+                nCdhw16c, nChw8c, nCdhw8c, nhwc, ndhwc);
+    if (dat_tag == format_tag::undef) return false;
+
+    conf.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    conf.blocked = !utils::one_of(dat_tag, nhwc, ndhwc);
+
+    conf.MB = pd->MB();
+    conf.C = pd->C();
+    conf.SP = pd->D() * pd->H() * pd->W();
+    conf.blk = conf.blocked ? data_d.blocking_desc().inner_blks[0] : conf.C;
+    conf.stride_mb = data_d.blocking_desc().strides[0];
+    conf.sp_stride = conf.blocked ? conf.blk : conf.C;
+    conf.nvecs = utils::div_up(conf.C, conf.simd_w);
+    conf.tail = conf.C % conf.simd_w;
+
+    // the gather offsets and the offsets of an unrolled iteration are 32-bit
+    const dim_t C_padded = data_d.padded_dims()[1];
+    if (C_padded * conf.SP * sizeof(float) >= INT_MAX) return false;
+
+    // keep the threads busy even for a small batch and few channels, but do
+    // not split the spatial dimension further than needed
+    const dim_t nthr = dnnl_get_max_threads();
+    const dim_t work = conf.MB * conf.nvecs;
+    conf.nsp_blks = nstl::max(
+            (dim_t)1, nstl::min(conf.SP, utils::div_up(4 * nthr, work)));
+    conf.sp_blk = utils::div_up(conf.SP, conf.nsp_blks);
+    conf.nsp_blks = utils::div_up(conf.SP, conf.sp_blk);
+
+    return true;
+}
+
+using namespace Xbyak;
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+
+template <cpu_isa_t isa>
+struct jit_shuffle_kernel_t : public jit_generator {
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *in;
+        void *out;
+        const int *input_off, *tail_mask;
+        size_t work; // spatial points
+        size_t tail; // the vector is partial
+    };
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_shuffle_kernel_t)
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    jit_shuffle_kernel_t(const jit_shuffle_conf_t &conf)
+        : stride_((int)(conf.sp_stride * sizeof(float))) {
+        generate();
+        ker_ = (decltype(ker_))getCode();
+    }
+
+    void operator()(const call_params_t *p) { ker_(p); }
+
+private:
+    void (*ker_)(const call_params_t *);
+
+    const int stride_;
+    static constexpr int unroll_ = 4;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_in = r8;
+    Reg64 reg_out = r9;
+    Reg64 reg_work = r10;
+    Reg64 reg_tmp = r11;
+
+    // Vmm(0 .. unroll_ - 1) hold the data, avx2 gathers consume the
+    // Vmm(unroll_ .. 2 * unroll_ - 1) masks
+    Vmm vmm_idx = Vmm(2 * unroll_);
+    Vmm vmm_mask = Vmm(2 * unroll_ + 1);
+    Opmask k_mask = Opmask(unroll_ + 1);
+
+    Opmask k_gather(int u) { return Opmask(u + 1); }
+    Vmm vmm_gather_mask(int u) { return Vmm(unroll_ + u); }
+
+    void load_mask(bool tail) {
+        if (isa == avx512_common) {
+            if (tail) {
+                mov(reg_tmp, ptr[reg_param + PARAM_OFF(tail_mask)]);
+                vmovups(vmm_mask, ptr[reg_tmp]);
+                vptestmd(k_mask, vmm_mask, vmm_mask);
+            } else {
+                kxnorw(k_mask, k_mask, k_mask);
+            }
+        } else {
+            if (tail) {
+                mov(reg_tmp, ptr[reg_param + PARAM_OFF(tail_mask)]);
+                vmovups(vmm_mask, ptr[reg_tmp]);
+            } else {
+                vpcmpeqd(vmm_mask, vmm_mask, vmm_mask);
+            }
+        }
+    }
+
+    // the gathers of an iteration are independent, the unrolling hides
+    // their latency
+    void step(int nu, bool tail) {
+        for (int u = 0; u < nu; ++u) {
+            const auto addr = ptr[reg_in + vmm_idx + u * stride_];
+            if (isa == avx512_common) {
+                kmovw(k_gather(u), k_mask);
+                vpgatherdd(Vmm(u) | k_gather(u), addr);
+            } else {
+                vmovups(vmm_gather_mask(u), vmm_mask);
+                vpgatherdd(Vmm(u), addr, vmm_gather_mask(u));
+            }
+        }
+        for (int u = 0; u < nu; ++u) {
+            const auto addr = ptr[reg_out + u * stride_];
+            if (!tail)
+                vmovups(addr, Vmm(u));
+            else if (isa == avx512_common)
+                vmovups(addr | k_mask, Vmm(u));
+            else
+                vmaskmovps(addr, vmm_mask, Vmm(u));
+        }
+        add(reg_in, nu * stride_);
+        add(reg_out, nu * stride_);
+    }
+
+    void loop(bool tail) {
+        Label l_unroll, l_single, l_end;
+
+        load_mask(tail);
+
+        L(l_unroll);
+        {
+            cmp(reg_work, unroll_);
+            jl(l_single, T_NEAR);
+            step(unroll_, tail);
+            sub(reg_work, unroll_);
+            jmp(l_unroll);
+        }
+
+        L(l_single);
+        {
+            cmp(reg_work, 1);
+            jl(l_end, T_NEAR);
+            step(1, tail);
+            sub(reg_work, 1);
+            jmp(l_single);
+        }
+
+        L(l_end);
+    }
+
+    void generate() {
+        Label l_tail, l_end;
+
+        preamble();
+
+        mov(reg_in, ptr[reg_param + PARAM_OFF(in)]);
+        mov(reg_out, ptr[reg_param + PARAM_OFF(out)]);
+        mov(reg_work, ptr[reg_param + PARAM_OFF(work)]);
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(input_off)]);
+        vmovups(vmm_idx, ptr[reg_tmp]);
+
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(tail)]);
+        cmp(reg_tmp, 0);
+        jne(l_tail, T_NEAR);
+
+        loop(false);
+        jmp(l_end, T_NEAR);
+
+        L(l_tail);
+        loop(true);
+
+        L(l_end);
+        postamble();
+    }
+};
+
+#undef PARAM_OFF
+
+} // namespace shuffle_impl
+
+template <cpu_isa_t isa>
+jit_uni_shuffle_t<isa>::jit_uni_shuffle_t(const pd_t *apd)
+    : primitive_impl_t(apd) {
+    const auto &conf = pd()->conf_;
+    const dim_t C = conf.C;
+    const dim_t group_size = pd()->group_size();
+    const dim_t transpose_row = pd()->is_fwd() ? group_size : C / group_size;
+    const dim_t transpose_col = pd()->is_fwd() ? C / group_size : group_size;
+
+    input_off_ = (int *)malloc(conf.nvecs * conf.simd_w * sizeof(int), 64);
+    tail_mask_ = (int *)malloc(conf.simd_w * sizeof(int), 64);
+
+    // the output channel c is the input channel rev_transposed(c)
+    parallel_nd(conf.nvecs, conf.simd_w, [&](dim_t v, int l) {
+        const dim_t c = v * conf.simd_w + l;
+        dim_t off = 0;
+        if (c < C) {
+            const dim_t ic = (c % transpose_col) * transpose_row
+                    + c / transpose_col;
+            off = conf.blocked ? ic / conf.blk * conf.SP * conf.blk
+                            + ic % conf.blk
+                               : ic;
+        }
+        input_off_[v * conf.simd_w + l] = (int)(off * sizeof(float));
+    });
+    for (int l = 0; l < conf.simd_w; ++l)
+        tail_mask_[l] = l < conf.tail ? -1 : 0;
+
+    kernel_ = new shuffle_impl::jit_shuffle_kernel_t<isa>(conf);
+}
+
+template <cpu_isa_t isa>
+jit_uni_shuffle_t<isa>::~jit_uni_shuffle_t() {
+    delete kernel_;
+    free(input_off_);
+    free(tail_mask_);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_shuffle_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->conf_;
+
+    auto i_arg = pd()->is_fwd() ? DNNL_ARG_SRC : DNNL_ARG_DIFF_DST;
+    auto o_arg = pd()->is_fwd() ? DNNL_ARG_DST : DNNL_ARG_DIFF_SRC;
+    auto input = CTX_IN_MEM(const float *, i_arg);
+    auto output = CTX_OUT_MEM(float *, o_arg);
+
+    // consecutive work items share the spatial block, so the input cache
+    // lines are reused by the vectors of a thread
+    parallel_nd(conf.MB, conf.nsp_blks, conf.nvecs,
+            [&](dim_t mb, dim_t spb, dim_t v) {
+                const dim_t sp = spb * conf.sp_blk;
+                const dim_t c = v * conf.simd_w;
+                const dim_t c_off = conf.blocked
+                        ? c / conf.blk * conf.SP * conf.blk + c % conf.blk
+                        : c;
+                const dim_t off = mb * conf.stride_mb + sp * conf.sp_stride;
+
+                typename shuffle_impl::jit_shuffle_kernel_t<isa>::call_params_t
+                        p;
+                p.in = input + off;
+                p.out = output + off + c_off;
+                p.input_off = input_off_ + v * conf.simd_w;
+                p.tail_mask = tail_mask_;
+                p.work = nstl::min(conf.sp_blk, conf.SP - sp);
+                p.tail = v == conf.nvecs - 1 && conf.tail != 0;
+                (*kernel_)(&p);
+            });
+
+    return status::success;
+}
+
+/* struct instantiation */
+template bool shuffle_impl::init_conf<avx512_common>(
+        jit_shuffle_conf_t &conf, const shuffle_pd_t *pd);
+template bool shuffle_impl::init_conf<avx2>(
+        jit_shuffle_conf_t &conf, const shuffle_pd_t *pd);
+template struct jit_uni_shuffle_t<avx512_common>;
+template struct jit_uni_shuffle_t<avx2>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
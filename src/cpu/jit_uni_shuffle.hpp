@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_SHUFFLE_HPP
+#define JIT_UNI_SHUFFLE_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "cpu_shuffle_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Channel shuffle of 4-byte data in the nC[d]hw16c, nC[d]hw8c and n[d]hwc
+ * layouts.
+ *
+ * The output is written by vectors of simd_w channels that are contiguous in
+ * memory (a part of a channel block, or of a spatial point of n[d]hwc). The
+ * input offsets of the channels of each vector are computed once and loaded
+ * with a gather, so a kernel call walks along the spatial dimension with
+ * the sp_stride step for both the input and the output. */
+struct jit_shuffle_conf_t {
+    int simd_w;
+    bool blocked;
+
+    dim_t MB, C, SP;
+    dim_t blk; // channel block size (blocked) or C (n[d]hwc)
+    dim_t stride_mb; // elements between consecutive images
+    dim_t sp_stride; // elements between consecutive spatial points
+    dim_t nvecs; // output vectors along the channels
+    int tail; // channels in the last vector, 0 if it is full
+
+    // the spatial dimension is split into nsp_blks blocks of sp_blk points
+    dim_t sp_blk, nsp_blks;
+};
+
+namespace shuffle_impl {
+template <cpu_isa_t isa>
+struct jit_shuffle_kernel_t;
+
+template <cpu_isa_t isa>
+bool init_conf(jit_shuffle_conf_t &conf, const shuffle_pd_t *pd);
+} // namespace shuffle_impl
+
+template <cpu_isa_t isa>
+struct jit_uni_shuffle_t : public primitive_impl_t {
+    struct pd_t : public cpu_shuffle_pd_t {
+        using cpu_shuffle_pd_t::cpu_shuffle_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_shuffle_t);
+
+        status_t init() {
+            bool ok = true && mayiuse(isa)
+                    && IMPLICATION(!is_fwd(), set_default_formats_common())
+                    && attr()->has_default_values()
+                    && shuffle_impl::init_conf<isa>(conf_, this);
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+
+        jit_shuffle_conf_t conf_;
+    };
+
+    jit_uni_shuffle_t(const pd_t *apd);
+    ~jit_uni_shuffle_t();
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    shuffle_impl::jit_shuffle_kernel_t<isa> *kernel_;
+    int *input_off_; // byte offsets of the input channels, by output vector
+    int *tail_mask_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <limits.h>
+#include <math.h>
 
 #include "c_types_map.hpp"
 #include "dnnl_thread.hpp"
@@ -25,6 +27,7 @@
 
 #include "jit_generator.hpp"
 
+#include "jit_avx512_core_bf16cvt.hpp"
 #include "jit_uni_eltwise.hpp"
 #include "jit_uni_softmax.hpp"
 
@@ -32,9 +35,94 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
-namespace {
+namespace softmax_impl {
+
+template <cpu_isa_t isa>
+bool init_conf(jit_softmax_conf_t &conf, const softmax_pd_t *pd) {
+    using namespace data_type;
+
+    const memory_desc_wrapper data_d(
+            pd->is_fwd() ? pd->src_md() : pd->dst_md());
+    if (!data_d.is_blocking_desc()) return false;
+
+    conf.is_fwd = pd->is_fwd();
+    conf.is_logsoftmax = pd->is_logsoftmax();
+    conf.dt = data_d.data_type();
+
+    const bool dt_ok = conf.dt == f32
+            || (isa == avx512_common && conf.dt == bf16
+                    && mayiuse(avx512_core));
+    if (!dt_ok) return false;
+
+    conf.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    conf.nregs = 4;
+    conf.axis_size = pd->axis_size();
+
+    const auto &bd = data_d.blocking_desc();
+    const int axis = pd->axis();
+    const int ndims = data_d.ndims();
+    const dim_t dt_size = data_d.data_type_size();
+
+    int axis_nblks = 0;
+    for (int iblk = 0; iblk < bd.inner_nblks; ++iblk)
+        if (bd.inner_idxs[iblk] == axis) axis_nblks++;
+    const int last_blk = bd.inner_nblks - 1;
+
+    const bool dense_plain = true && bd.inner_nblks == 0
+            && bd.strides[axis] == 1 && data_d.is_dense(true)
+            && data_d.only_padded_dim(axis);
+    const bool dense_blocked = true && axis_nblks == 1 && last_blk >= 0
+            && bd.inner_idxs[last_blk] == axis
+            && bd.inner_blks[last_blk] == conf.simd_w
+            && data_d.is_dense(true) && data_d.only_padded_dim(axis);
+
+    if (dense_plain || dense_blocked) {
+        conf.dense = true;
+        conf.vec_stride = dense_plain ? conf.simd_w : bd.strides[axis];
+        conf.axis_step = 0;
+        conf.rem_nregs = 0;
+        conf.tail = conf.axis_size % conf.simd_w;
+
+        // the offsets of a loop iteration are immediates
+        if (conf.nregs * conf.vec_stride * dt_size >= INT_MAX) return false;
+
+        conf.inner_stride = dense_plain ? 1 : conf.simd_w;
+        conf.inner_size = bd.strides[axis] / conf.inner_stride;
+        conf.outer_stride = data_d.padded_dims()[axis] * conf.inner_size;
+        conf.outer_size = data_d.nelems(true) / conf.outer_stride;
+        return true;
+    }
 
-typedef float data_t;
+    // strided: the data is a dense [outer][axis][axis_step] array
+    const dim_t step = bd.strides[axis];
+    if (axis_nblks != 0 || !data_d.is_dense() || step <= 1) return false;
+    for (int d = 0; d < ndims; ++d) {
+        if (d == axis || data_d.dims()[d] == 1) continue;
+        if (bd.strides[d] >= step && bd.strides[d] < step * conf.axis_size)
+            return false;
+    }
+    if (step * dt_size >= INT_MAX) return false;
+
+    const dim_t block = conf.nregs * conf.simd_w;
+    conf.dense = false;
+    conf.vec_stride = conf.simd_w;
+    conf.axis_step = step;
+
+    conf.inner_stride = block;
+    conf.inner_size = utils::div_up(step, block);
+    conf.outer_stride = step * conf.axis_size;
+    conf.outer_size = data_d.nelems() / conf.outer_stride;
+
+    const dim_t rem = step - (conf.inner_size - 1) * block;
+    conf.rem_nregs = utils::div_up(rem, conf.simd_w);
+    conf.tail = rem % conf.simd_w;
+
+    return true;
+}
+
+} // namespace softmax_impl
+
+namespace {
 
 using namespace Xbyak;
 
@@ -42,90 +130,102 @@ template <cpu_isa_t isa>
 struct jit_softmax_base_t : public jit_generator {
     struct call_params_t {
         // keep all sizes at 8 bytes -- jit code expects this
-        const data_t *src, *dst;
-        size_t spat_offt_count;
+        const void *in, *diff_dst; // src (fwd) or dst (bwd), diff_dst (bwd)
+        void *out; // dst (fwd) or diff_src (bwd)
+        size_t last_block;
     };
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_t)
 
     // cpu specific part
     using Vmm = typename cpu_isa_traits<isa>::Vmm;
-    const AddressFrame &vmmword
-            = (isa == sse41) ? xword : (isa == avx2) ? yword : zword;
     const int vlen = cpu_isa_traits<isa>::vlen;
 
-    const softmax_pd_t *pd_;
+    const jit_softmax_conf_t &conf_;
+    const int dt_size_;
 
     void (*ker)(const call_params_t *);
     void operator()(const call_params_t *p) { (*ker)(p); }
-    jit_uni_eltwise_injector_f32<isa> *eltwise_injector_;
+    jit_uni_eltwise_injector_f32<isa> *exp_injector_;
 
     Reg64 reg_param = abi_param1;
 
     Reg64 reg_injector_table = rax;
-    Reg64 reg_src = r8;
-    Reg64 reg_dst = r9;
-    Reg64 reg_spat_offt = r10;
-    Reg64 reg_spat_offt_count = r11;
-    Reg64 reg_reverse_spat_offt = r12;
+    Reg64 reg_in = r8;
+    Reg64 reg_out = r9;
+    Reg64 reg_diff_dst = r10;
+    Reg64 reg_offt = r11;
+    Reg64 reg_count = r12;
     Reg64 reg_tmp = r13;
+    Reg64 reg_table = r14;
 
     Opmask injector_mask = Opmask(1);
 
-    Vmm vtmp; // assigned at placed where used
-    Vmm tail_vmask = Vmm(0);
-    Xmm xneg_flt_max = Xmm(12);
-    Vmm vneg_flt_max = Vmm(isa == avx512_common ? 28 : 12);
-    Xmm xone = Xmm(13);
-    Vmm vone = Vmm(isa == avx512_common ? 29 : 13);
-    Vmm vsum = Vmm(isa == avx512_common ? 30 : 14);
-    Vmm vmax = Vmm(isa == avx512_common ? 31 : 15);
-
-    size_t simd_w_ = vlen / sizeof(data_t);
-    size_t unroll_regs_ = 4;
-
-    size_t axis_simd_full_;
-    size_t axis_simd_tail_;
-    size_t n_loops_;
-    size_t loop_tail_;
-    size_t axis_stride_;
-
-    void compute_predefined_variables() {
-        axis_simd_full_ = pd_->axis_size() / simd_w_;
-        axis_simd_tail_ = pd_->axis_size() % simd_w_;
-        n_loops_ = axis_simd_full_ / unroll_regs_;
-        loop_tail_ = axis_simd_full_ - n_loops_ * unroll_regs_;
-        axis_stride_ = compute_axis_stride();
-    }
+    // Vmm(0) is the tail mask on avx2 and sse41 (blendvps requires xmm0)
+    Vmm vtail_mask = Vmm(0);
+    Vmm vneg_flt_max = Vmm(13);
+    Vmm vone = Vmm(14);
+    Vmm vscratch = Vmm(15);
+
+    // per vector of a loop iteration: a temporary and the max and the sum
+    // accumulators
+    Vmm vtmp(int i) const { return Vmm(1 + i); }
+    Vmm vmax(int i) const { return Vmm(1 + conf_.nregs + i); }
+    Vmm vsum(int i) const { return Vmm(1 + 2 * conf_.nregs + i); }
+
+    // the vectors and the tail of the rows being generated
+    int cur_nregs_;
+    bool cur_tail_;
+
+    Label l_table_;
+
+    enum {
+        tbl_exp_bias = 0,
+        tbl_mantissa_mask,
+        tbl_ln2,
+        tbl_log_coeff, // 2 / (2k + 1), k = 0 .. n_log_coeffs - 1
+        n_log_coeffs = 7,
+        tbl_size = tbl_log_coeff + n_log_coeffs
+    };
 
-    size_t compute_axis_stride() {
-        const memory_desc_wrapper data_d(pd_->src_md());
-        const auto &bd = data_d.blocking_desc();
+    Address table_val(int idx) { return ptr[reg_table + idx * vlen]; }
 
-        if (bd.inner_nblks) return sizeof(data_t) * bd.strides[pd_->axis()];
-        return vlen;
+    // the address of the i-th vector of the current loop iteration
+    Address data_ptr(const Reg64 &base, int i, int elem = 0) {
+        return ptr[base + reg_offt
+                + (i * conf_.vec_stride + elem) * dt_size_];
     }
 
     void load_common_params() {
         mov(reg_tmp, float2int(1.0f));
-        movq(xone, reg_tmp);
-        uni_vbroadcastss(vone, xone);
+        movq(Xmm(vone.getIdx()), reg_tmp);
+        uni_vbroadcastss(vone, Xmm(vone.getIdx()));
         mov(reg_tmp, float2int(-FLT_MAX));
-        movq(xneg_flt_max, reg_tmp);
-        uni_vbroadcastss(vneg_flt_max, xneg_flt_max);
+        movq(Xmm(vneg_flt_max.getIdx()), reg_tmp);
+        uni_vbroadcastss(vneg_flt_max, Xmm(vneg_flt_max.getIdx()));
 
 #define PARAM_OFF(x) offsetof(call_params_t, x)
-        mov(reg_spat_offt_count, ptr[reg_param + PARAM_OFF(spat_offt_count)]);
-        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
-        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_in, ptr[reg_param + PARAM_OFF(in)]);
+        mov(reg_out, ptr[reg_param + PARAM_OFF(out)]);
+        if (!conf_.is_fwd)
+            mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
 #undef PARAM_OFF
+        mov(reg_table, l_table_);
     }
 
-    Address src_ptr(size_t offt = 0) {
-        return vmmword[reg_src + reg_spat_offt + offt];
-    }
-
-    Address dst_ptr(size_t offt = 0) {
-        return vmmword[reg_dst + reg_spat_offt + offt];
+    void prepare_table() {
+        const float ln2 = 0.693147182f;
+        const int cvals[tbl_log_coeff]
+                = {float2int(127.f), 0x007fffff, float2int(ln2)};
+
+        align(64);
+        L(l_table_);
+        for (int i = 0; i < tbl_size; ++i) {
+            const int c = i < tbl_log_coeff
+                    ? cvals[i]
+                    : float2int(2.f / (2 * (i - tbl_log_coeff) + 1));
+            for (int d = 0; d < vlen / (int)sizeof(float); ++d)
+                dd(c);
+        }
     }
 
     enum class op_t : unsigned { max, sum };
@@ -137,82 +237,298 @@ struct jit_softmax_base_t : public jit_generator {
             uni_vaddps(v, v, vtmp);
     }
 
+    virtual void prepare_tail_mask() {
+        static const uint32_t mask_f32[16]
+                = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                        0xffffffff, 0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0,
+                        0, 0};
+        // the first tail lanes are set for both the 8- and 4-wide vectors
+        mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[8 - conf_.tail]));
+        uni_vmovups(vtail_mask, ptr[reg_tmp]);
+    }
+
+    virtual void prepare_bf16() {}
+
+    // loads a vector converting it to f32, the tail lanes are zeroed
+    virtual void load(const Vmm &v, const Reg64 &base, int i, bool tail) = 0;
+    // stores a vector (possibly destroying it), the tail lanes are skipped
+    virtual void store(const Reg64 &base, int i, const Vmm &v, bool tail) = 0;
+    virtual void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) = 0;
+
+    // accumulates the valid lanes of a tail vector along the axis
+    virtual void accumulate_tail(const Vmm &vacc, const Vmm &v, op_t op) {
+        if (op == op_t::max) {
+            uni_vmovups(vscratch, vneg_flt_max);
+            uni_vblendvps(vscratch, vscratch, v, vtail_mask);
+            uni_vmaxps(vacc, vacc, vscratch);
+        } else {
+            uni_vandps(v, v, vtail_mask);
+            uni_vaddps(vacc, vacc, v);
+        }
+    }
+
+    void accumulate(const Vmm &vacc, const Vmm &v, bool tail, op_t op) {
+        // the lanes are independent rows in the strided case
+        if (tail && conf_.dense)
+            accumulate_tail(vacc, v, op);
+        else
+            perform_op(vacc, v, op);
+    }
+
+    // Emits body(nregs, tail) for each portion of the axis: in the dense
+    // case the vectors go along the axis, in the strided case the same
+    // vectors are processed at each axis point. The tail flag means that
+    // the last of the nregs vectors is incomplete.
     template <typename body_t>
     void axis_loop(body_t body) {
-        Label main_loop, tail_loop, tail_axis;
-
-        // reverse_spat_offt to dispatch between labels
-        mov(reg_reverse_spat_offt, reg_spat_offt_count);
-        xor_(reg_spat_offt, reg_spat_offt); // spat_offt to get addr of src/dst
-        L(main_loop);
-        {
-            if (n_loops_) {
-                cmp(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
-                jl(tail_loop, T_NEAR);
-
-                body(unroll_regs_, false);
-                sub(reg_reverse_spat_offt, unroll_regs_ * axis_stride_);
-                add(reg_spat_offt, unroll_regs_ * axis_stride_);
-                jmp(main_loop);
+        xor_(reg_offt, reg_offt);
+
+        if (conf_.dense) {
+            const int nregs = conf_.nregs;
+            const dim_t nvecs = conf_.axis_size / conf_.simd_w;
+            const dim_t niters = nvecs / nregs;
+            const int rem = nvecs % nregs;
+            const size_t vec_stride = conf_.vec_stride * dt_size_;
+
+            if (niters > 0) {
+                Label l_loop;
+                mov(reg_count, niters);
+                L(l_loop);
+                {
+                    body(nregs, false);
+                    add(reg_offt, nregs * vec_stride);
+                    dec(reg_count);
+                    jnz(l_loop, T_NEAR);
+                }
             }
-        }
-
-        L(tail_loop);
-        {
-            if (loop_tail_) {
-                body(loop_tail_, false);
-                add(reg_spat_offt, loop_tail_ * axis_stride_);
+            if (rem) {
+                body(rem, false);
+                if (conf_.tail) add(reg_offt, rem * vec_stride);
+            }
+            if (conf_.tail) body(1, true);
+        } else {
+            Label l_loop;
+            mov(reg_count, conf_.axis_size);
+            L(l_loop);
+            {
+                body(cur_nregs_, cur_tail_);
+                add(reg_offt, conf_.axis_step * dt_size_);
+                dec(reg_count);
+                jnz(l_loop, T_NEAR);
             }
         }
+    }
 
-        L(tail_axis);
-        {
-            if (axis_simd_tail_) { body(1, true); }
-        }
+    // makes every accumulator hold the reduction of the row
+    void reduce(op_t op) {
+        if (!conf_.dense) return;
+
+        auto vacc = [&](int i) { return op == op_t::max ? vmax(i) : vsum(i); };
+        for (int i = 1; i < conf_.nregs; i++)
+            perform_op(vacc(0), vacc(i), op);
+        get_horizontal_op(vacc(0), vtmp(0), op);
+        for (int i = 1; i < conf_.nregs; i++)
+            uni_vmovups(vacc(i), vacc(0));
+    }
+
+    void exp_range(const Vmm &vstart, int n) {
+        exp_injector_->compute_vector_range(
+                vstart.getIdx(), vstart.getIdx() + n);
     }
 
-    virtual void prepare_tail_mask() {}
-    virtual void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) {};
-    virtual void accumulate_vmax() {};
-    virtual void accumulate_vsum() {};
-    virtual void compute_dst() {};
+    // v = log(v) for v >= 1: with v = 2^e * m, m in [1, 2), and
+    // s = (m - 1) / (m + 1), log(m) = 2 * atanh(s) = s * P(s^2) where
+    // P(z) = 2 + 2/3 z + 2/5 z^2 + ... converges fast as s < 1/3
+    void log_vector(const Vmm &v) {
+        const Vmm ve = vtmp(0), vz = vtmp(1), vp = vtmp(2);
+
+        uni_vmovups(ve, v);
+        uni_vpsrld(ve, ve, 23);
+        uni_vcvtdq2ps(ve, ve);
+        uni_vsubps(ve, ve, table_val(tbl_exp_bias));
+
+        uni_vandps(v, v, table_val(tbl_mantissa_mask));
+        uni_vorps(v, v, vone);
+        uni_vmovups(vz, v);
+        uni_vaddps(vz, vz, vone);
+        uni_vsubps(v, v, vone);
+        uni_vdivps(v, v, vz);
+
+        uni_vmovups(vz, v);
+        uni_vmulps(vz, vz, v);
+        uni_vmovups(vp, table_val(tbl_log_coeff + n_log_coeffs - 1));
+        for (int k = n_log_coeffs - 2; k >= 0; k--)
+            uni_vfmadd213ps(vp, vz, table_val(tbl_log_coeff + k));
+        uni_vmulps(v, v, vp);
+        uni_vfmadd231ps(v, ve, table_val(tbl_ln2));
+    }
 
     void forward() {
-        // flush to -FLT_MAX before accumulation
-        uni_vmovups(vmax, vneg_flt_max);
-        accumulate_vmax();
+        const bool is_log = conf_.is_logsoftmax;
+        // f32 softmax keeps exp(src - max) in dst between the passes
+        const bool keep_exp = !is_log && conf_.dt == data_type::f32;
+
+        for (int i = 0; i < cur_nregs_; i++)
+            uni_vmovups(vmax(i), vneg_flt_max);
+        axis_loop([&](int nregs, bool tail) {
+            for (int i = 0; i < nregs; i++) {
+                const bool is_tail = tail && i == nregs - 1;
+                load(vtmp(i), reg_in, i, is_tail);
+                accumulate(vmax(i), vtmp(i), is_tail, op_t::max);
+            }
+        });
+        reduce(op_t::max);
+
+        for (int i = 0; i < cur_nregs_; i++)
+            uni_vpxor(vsum(i), vsum(i), vsum(i));
+        axis_loop([&](int nregs, bool tail) {
+            for (int i = 0; i < nregs; i++) {
+                load(vtmp(i), reg_in, i, tail && i == nregs - 1);
+                uni_vsubps(vtmp(i), vtmp(i), vmax(i));
+            }
+            exp_range(vtmp(0), nregs);
+            for (int i = 0; i < nregs; i++) {
+                const bool is_tail = tail && i == nregs - 1;
+                accumulate(vsum(i), vtmp(i), is_tail, op_t::sum);
+                if (keep_exp) store(reg_out, i, vtmp(i), is_tail);
+            }
+        });
+        reduce(op_t::sum);
+
+        for (int i = 0; i < cur_nregs_; i++) {
+            if (is_log) {
+                // dst = src - (max + log(sum))
+                log_vector(vsum(i));
+                uni_vaddps(vmax(i), vmax(i), vsum(i));
+            } else
+                uni_vdivps(vsum(i), vone, vsum(i), vscratch);
+        }
 
-        get_horizontal_op(vmax, vtmp = vsum, op_t::max);
+        axis_loop([&](int nregs, bool tail) {
+            if (keep_exp) {
+                for (int i = 0; i < nregs; i++) {
+                    const bool is_tail = tail && i == nregs - 1;
+                    load(vtmp(i), reg_out, i, is_tail);
+                    uni_vmulps(vtmp(i), vtmp(i), vsum(i));
+                    store(reg_out, i, vtmp(i), is_tail);
+                }
+                return;
+            }
 
-        uni_vpxor(vsum, vsum, vsum); // flush to zero before accumulation
-        accumulate_vsum();
+            for (int i = 0; i < nregs; i++) {
+                load(vtmp(i), reg_in, i, tail && i == nregs - 1);
+                uni_vsubps(vtmp(i), vtmp(i), vmax(i));
+            }
+            if (!is_log) exp_range(vtmp(0), nregs);
+            for (int i = 0; i < nregs; i++) {
+                if (!is_log) uni_vmulps(vtmp(i), vtmp(i), vsum(i));
+                store(reg_out, i, vtmp(i), tail && i == nregs - 1);
+            }
+        });
+    }
 
-        get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+    void backward() {
+        const bool is_log = conf_.is_logsoftmax;
+
+        // softmax: sum(diff_dst * dst), logsoftmax: sum(diff_dst)
+        for (int i = 0; i < cur_nregs_; i++)
+            uni_vpxor(vsum(i), vsum(i), vsum(i));
+        axis_loop([&](int nregs, bool tail) {
+            for (int i = 0; i < nregs; i++) {
+                const bool is_tail = tail && i == nregs - 1;
+                load(vtmp(i), reg_diff_dst, i, is_tail);
+                if (is_log)
+                    uni_vaddps(vsum(i), vsum(i), vtmp(i));
+                else {
+                    load(vmax(i), reg_in, i, is_tail);
+                    uni_vfmadd231ps(vsum(i), vtmp(i), vmax(i));
+                }
+            }
+        });
+        reduce(op_t::sum);
+
+        axis_loop([&](int nregs, bool tail) {
+            if (is_log) {
+                // diff_src = diff_dst - exp(dst) * sum
+                for (int i = 0; i < nregs; i++)
+                    load(vmax(i), reg_in, i, tail && i == nregs - 1);
+                exp_range(vmax(0), nregs);
+                for (int i = 0; i < nregs; i++) {
+                    const bool is_tail = tail && i == nregs - 1;
+                    load(vtmp(i), reg_diff_dst, i, is_tail);
+                    uni_vfnmadd231ps(vtmp(i), vmax(i), vsum(i));
+                    store(reg_out, i, vtmp(i), is_tail);
+                }
+            } else {
+                // diff_src = dst * (diff_dst - sum)
+                for (int i = 0; i < nregs; i++) {
+                    const bool is_tail = tail && i == nregs - 1;
+                    load(vtmp(i), reg_diff_dst, i, is_tail);
+                    load(vmax(i), reg_in, i, is_tail);
+                    uni_vsubps(vtmp(i), vtmp(i), vsum(i));
+                    uni_vmulps(vtmp(i), vtmp(i), vmax(i));
+                    store(reg_out, i, vtmp(i), is_tail);
+                }
+            }
+        });
+    }
 
-        uni_vdivps(vsum, vone, vsum, vtmp = vmax);
-        compute_dst();
+    void compute() {
+        if (conf_.is_fwd)
+            forward();
+        else
+            backward();
     }
 
-    // either this stub or duplication at each jit_binary_t ctor due to methods
-    // that are participated are not defined at the moment of base ctor
-    // initialization.
+    // either this stub or duplication at each jit_softmax_t ctor due to
+    // methods that are participated are not defined at the moment of base
+    // ctor initialization.
     void get_code() {
-        eltwise_injector_ = new jit_uni_eltwise_injector_f32<isa>(this,
+        exp_injector_ = new jit_uni_eltwise_injector_f32<isa>(this,
                 alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, true,
                 reg_injector_table, injector_mask);
-        compute_predefined_variables();
+
         preamble();
-        eltwise_injector_->load_table_addr();
-        if (axis_simd_tail_) prepare_tail_mask();
+        exp_injector_->load_table_addr();
+        if (conf_.tail) prepare_tail_mask();
+        prepare_bf16();
         load_common_params();
-        forward();
+
+        cur_nregs_ = conf_.nregs;
+        cur_tail_ = false;
+        const bool has_rem = !conf_.dense
+                && (conf_.rem_nregs != conf_.nregs || conf_.tail);
+        if (has_rem) {
+            Label l_rem, l_end;
+            mov(reg_tmp, ptr[reg_param + offsetof(call_params_t, last_block)]);
+            cmp(reg_tmp, 0);
+            jne(l_rem, T_NEAR);
+            compute();
+            jmp(l_end, T_NEAR);
+
+            L(l_rem);
+            cur_nregs_ = conf_.rem_nregs;
+            cur_tail_ = conf_.tail != 0;
+            compute();
+            L(l_end);
+        } else
+            compute();
+
         postamble();
-        eltwise_injector_->prepare_table();
+        exp_injector_->prepare_table();
+        prepare_table();
 
         ker = reinterpret_cast<decltype(ker)>(const_cast<uint8_t *>(getCode()));
     }
 
-    jit_softmax_base_t(const softmax_pd_t *pd) : pd_(pd) {}
+    jit_softmax_base_t(const jit_softmax_conf_t &conf)
+        : conf_(conf)
+        , dt_size_(types::data_type_size(conf.dt))
+        , exp_injector_(nullptr) {
+        assert(conf_.nregs <= 4);
+    }
+
+    virtual ~jit_softmax_base_t() { delete exp_injector_; }
 };
 
 template <cpu_isa_t isa>
@@ -222,13 +538,48 @@ template <>
 struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
     Opmask tail_opmask = Opmask(2);
 
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+    Reg64 bf16_emu_scratch = r15;
+
+    bf16_emulation_t *bf16_emu_;
+
     void prepare_tail_mask() override {
-        const int mask_f32 = (1 << axis_simd_tail_) - 1;
+        const int mask_f32 = (1 << conf_.tail) - 1;
         Reg32 regw_tmp = reg_tmp.cvt32();
         mov(regw_tmp, mask_f32);
         kmovw(tail_opmask, regw_tmp);
     }
 
+    void prepare_bf16() override {
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+    }
+
+    void load(const Vmm &v, const Reg64 &base, int i, bool tail) override {
+        const Vmm v_masked = tail ? v | tail_opmask | T_z : v;
+        if (conf_.dt == data_type::bf16) {
+            vpmovzxwd(v_masked, data_ptr(base, i));
+            vpslld(v, v, 16);
+        } else
+            vmovups(v_masked, data_ptr(base, i));
+    }
+
+    void store(const Reg64 &base, int i, const Vmm &v, bool tail) override {
+        const Address addr = data_ptr(base, i);
+        const Address addr_masked = tail ? addr | tail_opmask : addr;
+        if (conf_.dt == data_type::bf16) {
+            const Ymm y = Ymm(v.getIdx());
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(y, v);
+            else
+                vcvtneps2bf16(y, v);
+            vmovdqu16(addr_masked, y);
+        } else
+            vmovups(addr_masked, v);
+    }
+
     void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) override {
         vshuff32x4(vtmp, v, v, 0x4E); // 256-bit shuffle
         perform_op(v, vtmp, op);
@@ -240,76 +591,39 @@ struct jit_softmax_t<avx512_common> : public jit_softmax_base_t<avx512_common> {
         perform_op(v, vtmp, op);
     }
 
-    void accumulate_vmax() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                if (!tail)
-                    uni_vmaxps(vmax, vmax, src_ptr(axis_stride_ * i));
-                else {
-                    uni_vmaxps(vmax | tail_opmask, vmax,
-                            src_ptr(axis_stride_ * i));
-                }
-            }
-        });
-    }
-
-    void accumulate_vsum() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    uni_vmovups(vreg_tmp_src, src_ptr(axis_stride_ * i));
-                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                    eltwise_injector_->compute_vector(vreg_tmp_src.getIdx());
-                    uni_vaddps(vsum, vsum, vreg_tmp_src);
-                    uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
-                } else {
-                    uni_vmovups_tail(vreg_tmp_src, tail_opmask,
-                            src_ptr(axis_stride_ * i));
-                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                    eltwise_injector_->compute_vector(vreg_tmp_src.getIdx());
-                    uni_vaddps(vsum | tail_opmask, vsum, vreg_tmp_src);
-                    uni_vmovups_tail(dst_ptr(axis_stride_ * i), tail_opmask,
-                            vreg_tmp_src);
-                }
-            }
-        });
-    }
-
-    void compute_dst() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    uni_vmulps(vreg_tmp_src, vsum, dst_ptr(axis_stride_ * i));
-                    uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
-                } else {
-                    uni_vmulps(vreg_tmp_src | tail_opmask, vsum,
-                            dst_ptr(axis_stride_ * i));
-                    uni_vmovups_tail(dst_ptr(axis_stride_ * i), tail_opmask,
-                            vreg_tmp_src);
-                }
-            }
-        });
+    void accumulate_tail(const Vmm &vacc, const Vmm &v, op_t op) override {
+        if (op == op_t::max)
+            vmaxps(vacc | tail_opmask, vacc, v);
+        else
+            vaddps(vacc | tail_opmask, vacc, v);
     }
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
+    jit_softmax_t(const jit_softmax_conf_t &conf)
+        : jit_softmax_base_t(conf), bf16_emu_(nullptr) {
+        if (conf_.dt == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                    bf16_emu_reserv_4);
         get_code();
     }
 
-    virtual ~jit_softmax_t() { delete eltwise_injector_; }
+    virtual ~jit_softmax_t() { delete bf16_emu_; }
 };
 
 template <>
 struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
-    Vmm tail_vmask = Vmm(0);
+    void load(const Vmm &v, const Reg64 &base, int i, bool tail) override {
+        if (tail)
+            uni_vmovups_tail(v, vtail_mask, data_ptr(base, i));
+        else
+            uni_vmovups(v, data_ptr(base, i));
+    }
 
-    void prepare_tail_mask() override {
-        static const uint32_t mask_f32[14]
-                = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
-                        0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0, 0};
-        mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - axis_simd_tail_]));
-        vmovups(tail_vmask, ptr[reg_tmp]);
+    void store(const Reg64 &base, int i, const Vmm &v, bool tail) override {
+        if (tail)
+            uni_vmovups_tail(data_ptr(base, i), vtail_mask, v);
+        else
+            uni_vmovups(data_ptr(base, i), v);
     }
 
     void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) override {
@@ -321,82 +635,28 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
         perform_op(v, vtmp, op);
     }
 
-    void accumulate_vmax() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                if (!tail)
-                    uni_vmaxps(vmax, vmax, src_ptr(axis_stride_ * i));
-                else {
-                    vtmp = Vmm(i + 1);
-                    uni_vmovups_tail(
-                            vtmp, tail_vmask, src_ptr(axis_stride_ * i));
-                    uni_vblendvps(vtmp, vneg_flt_max, vtmp, tail_vmask);
-                    uni_vmaxps(vmax, vmax, vtmp);
-                }
-            }
-        });
-    }
-
-    void accumulate_vsum() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    uni_vmovups(vreg_tmp_src, src_ptr(axis_stride_ * i));
-                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                    eltwise_injector_->compute_vector(vreg_tmp_src.getIdx());
-                    uni_vaddps(vsum, vsum, vreg_tmp_src);
-                    uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
-                } else {
-                    uni_vmovups_tail(vreg_tmp_src, tail_vmask,
-                            src_ptr(axis_stride_ * i));
-                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                    eltwise_injector_->compute_vector(vreg_tmp_src.getIdx());
-                    vtmp = Vmm(vreg_tmp_src.getIdx()
-                            + 1); // next after vreg_tmp_src
-                    uni_vpxor(vtmp, vtmp, vtmp);
-                    uni_vblendvps(vtmp, vtmp, vreg_tmp_src, tail_vmask);
-                    uni_vaddps(vsum, vsum, vtmp);
-                    uni_vmovups_tail(dst_ptr(axis_stride_ * i), tail_vmask,
-                            vreg_tmp_src);
-                }
-            }
-        });
-    }
-
-    void compute_dst() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    uni_vmulps(vreg_tmp_src, vsum, dst_ptr(axis_stride_ * i));
-                    uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
-                } else {
-                    uni_vmovups_tail(vreg_tmp_src, tail_vmask,
-                            dst_ptr(axis_stride_ * i));
-                    uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                    uni_vmovups_tail(dst_ptr(axis_stride_ * i), tail_vmask,
-                            vreg_tmp_src);
-                }
-            }
-        });
-    }
-
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
+    jit_softmax_t(const jit_softmax_conf_t &conf) : jit_softmax_base_t(conf) {
         get_code();
     }
-
-    virtual ~jit_softmax_t() { delete eltwise_injector_; }
 };
 
 template <>
 struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
-    Vmm tail_vmask = Vmm(0);
+    void load(const Vmm &v, const Reg64 &base, int i, bool tail) override {
+        if (tail) {
+            uni_vpxor(v, v, v);
+            for (int j = 0; j < conf_.tail; j++)
+                pinsrd(v, data_ptr(base, i, j), j);
+        } else
+            uni_vmovups(v, data_ptr(base, i));
+    }
 
-    void prepare_tail_mask() override {
-        static const uint32_t mask_f32[4] = {0xffffffff, 0, 0, 0};
-        mov(reg_tmp, reinterpret_cast<size_t>(mask_f32));
-        movups(tail_vmask, ptr[reg_tmp]);
+    void store(const Reg64 &base, int i, const Vmm &v, bool tail) override {
+        if (tail) {
+            for (int j = 0; j < conf_.tail; j++)
+                pextrd(data_ptr(base, i, j), v, j);
+        } else
+            uni_vmovups(data_ptr(base, i), v);
     }
 
     void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) override {
@@ -408,98 +668,52 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
         perform_op(v, vtmp, op);
     }
 
-    void accumulate_vmax() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    // SIGSEGV on unaligned addr if do maxps directly on memory
-                    uni_vmovups(vreg_tmp_src, src_ptr(axis_stride_ * i));
-                    uni_vmaxps(vmax, vmax, vreg_tmp_src);
-                } else {
-                    vtmp = Vmm(vreg_tmp_src.getIdx()
-                            + 1); // next after vreg_tmp_src
-
-                    for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovups(vreg_tmp_src, vneg_flt_max);
-                        uni_vmovss(vtmp,
-                                src_ptr(axis_stride_ * i + sizeof(data_t) * j));
-                        uni_vblendvps(
-                                vreg_tmp_src, vreg_tmp_src, vtmp, tail_vmask);
-                        uni_vmaxps(vmax, vmax, vreg_tmp_src);
-                    }
-                }
-            }
-        });
+    jit_softmax_t(const jit_softmax_conf_t &conf) : jit_softmax_base_t(conf) {
+        get_code();
     }
+};
 
-    void accumulate_vsum() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    uni_vmovups(vreg_tmp_src, src_ptr(axis_stride_ * i));
-                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                    eltwise_injector_->compute_vector(vreg_tmp_src.getIdx());
-                    uni_vaddps(vsum, vsum, vreg_tmp_src);
-                    uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
-                } else {
-                    vtmp = Vmm(vreg_tmp_src.getIdx()
-                            + 1); // next after vreg_tmp_src
-
-                    for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovss(vreg_tmp_src,
-                                src_ptr(axis_stride_ * i + sizeof(data_t) * j));
-                        uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                        eltwise_injector_->compute_vector(
-                                vreg_tmp_src.getIdx());
-                        uni_vpxor(vtmp, vtmp, vtmp);
-                        uni_vblendvps(vtmp, vtmp, vreg_tmp_src, tail_vmask);
-                        uni_vaddps(vsum, vsum, vtmp);
-                        uni_vmovss(
-                                dst_ptr(axis_stride_ * i + sizeof(data_t) * j),
-                                vreg_tmp_src);
-                    }
-                }
-            }
-        });
-    }
+} // namespace
 
-    void compute_dst() override {
-        axis_loop([&](int unroll, bool tail = false) {
-            for (int i = 0; i < unroll; i++) {
-                Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    uni_vmovups(vreg_tmp_src, dst_ptr(axis_stride_ * i));
-                    uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                    uni_vmovups(dst_ptr(axis_stride_ * i), vreg_tmp_src);
-                } else {
-                    for (size_t j = 0; j < axis_simd_tail_; j++) {
-                        uni_vmovss(vreg_tmp_src,
-                                dst_ptr(axis_stride_ * i + sizeof(data_t) * j));
-                        uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                        uni_vmovss(
-                                dst_ptr(axis_stride_ * i + sizeof(data_t) * j),
-                                vreg_tmp_src);
-                    }
-                }
-            }
-        });
-    }
+namespace softmax_impl {
 
-    jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {
-        get_code();
+template <cpu_isa_t isa>
+struct driver_t : public c_compatible {
+
+    driver_t(const jit_softmax_conf_t &conf) : conf_(conf), ker_(conf_) {}
+    ~driver_t() {}
+
+    // Computes the rows of the [outer][axis][inner] data at a given offset
+    void exec(const char *in, const char *diff_dst, char *out) {
+        const size_t dt_size = types::data_type_size(conf_.dt);
+
+        parallel_nd(conf_.outer_size, conf_.inner_size,
+                [&](dim_t ou, dim_t in_idx) {
+                    const size_t off = dt_size
+                            * (ou * conf_.outer_stride
+                                    + in_idx * conf_.inner_stride);
+
+                    typename jit_softmax_t<isa>::call_params_t p;
+                    p.in = in + off;
+                    p.diff_dst = diff_dst ? diff_dst + off : nullptr;
+                    p.out = out + off;
+                    p.last_block = in_idx == conf_.inner_size - 1;
+                    ker_(&p);
+                });
     }
 
-    virtual ~jit_softmax_t() { delete eltwise_injector_; }
+private:
+    const jit_softmax_conf_t &conf_;
+
+    jit_softmax_t<isa> ker_;
 };
 
-} // namespace
+} // namespace softmax_impl
 
 template <cpu_isa_t isa>
 jit_uni_softmax_fwd_t<isa>::jit_uni_softmax_fwd_t(const pd_t *apd)
     : primitive_impl_t(apd) {
-    softmax_driver_ = new softmax_impl::driver_t<isa>(pd());
+    softmax_driver_ = new softmax_impl::driver_t<isa>(pd()->conf_);
 }
 
 template <cpu_isa_t isa>
@@ -509,58 +723,52 @@ jit_uni_softmax_fwd_t<isa>::~jit_uni_softmax_fwd_t() {
 
 template <cpu_isa_t isa>
 status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
-
-    const memory_desc_wrapper data_d(pd()->src_md());
-    const auto &bd = data_d.blocking_desc();
-    const auto axis = pd()->axis();
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
 
-    const auto inner_stride
-            = bd.inner_nblks ? bd.inner_blks[bd.inner_nblks - 1] : (dim_t)1;
-    const auto inner_size = bd.strides[axis] / inner_stride;
-    const auto outer_stride = data_d.padded_dims()[axis] * inner_size;
-    const auto outer_size = data_d.nelems(true) / outer_stride;
-
-    parallel_nd(outer_size, inner_size, [&](dim_t ou, dim_t in) {
-        dim_t offset = ou * outer_stride + in * inner_stride;
-        const data_t *src_ptr = src + offset;
-        data_t *dst_ptr = dst + offset;
-        softmax_driver_->exec(src_ptr, dst_ptr, outer_stride);
-    });
+    softmax_driver_->exec(src, nullptr, dst);
 
     return status::success;
 }
 
-namespace softmax_impl {
-
 template <cpu_isa_t isa>
-struct driver_t : public c_compatible {
-
-    driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
-    ~driver_t() {}
+jit_uni_softmax_bwd_t<isa>::jit_uni_softmax_bwd_t(const pd_t *apd)
+    : primitive_impl_t(apd) {
+    softmax_driver_ = new softmax_impl::driver_t<isa>(pd()->conf_);
+}
 
-    void exec(const data_t *src, data_t *dst, const dim_t outer_stride) {
-        typename jit_softmax_t<isa>::call_params_t p;
-        p.spat_offt_count = outer_stride * sizeof(data_t);
-        p.src = src;
-        p.dst = dst;
-        ker_(&p);
-    }
+template <cpu_isa_t isa>
+jit_uni_softmax_bwd_t<isa>::~jit_uni_softmax_bwd_t() {
+    delete softmax_driver_;
+}
 
-private:
-    const softmax_pd_t *pd_;
+template <cpu_isa_t isa>
+status_t jit_uni_softmax_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto dst = CTX_IN_MEM(const char *, DNNL_ARG_DST);
+    auto diff_dst = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC);
 
-    jit_softmax_t<isa> ker_;
-};
+    softmax_driver_->exec(dst, diff_dst, diff_src);
 
-} // namespace softmax_impl
+    return status::success;
+}
 
 /* struct instantiation */
+template bool softmax_impl::init_conf<sse41>(
+        jit_softmax_conf_t &conf, const softmax_pd_t *pd);
+template bool softmax_impl::init_conf<avx2>(
+        jit_softmax_conf_t &conf, const softmax_pd_t *pd);
+template bool softmax_impl::init_conf<avx512_common>(
+        jit_softmax_conf_t &conf, const softmax_pd_t *pd);
 template struct jit_uni_softmax_fwd_t<sse41>;
 template struct jit_uni_softmax_fwd_t<avx2>;
 template struct jit_uni_softmax_fwd_t<avx512_common>;
+template struct jit_uni_softmax_bwd_t<sse41>;
+template struct jit_uni_softmax_bwd_t<avx2>;
+template struct jit_uni_softmax_bwd_t<avx512_common>;
 
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
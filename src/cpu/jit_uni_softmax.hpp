@@ -30,57 +30,99 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
+/* The data is processed by rows: a row is a set of points sharing all the
+ * indices but the axis one. A kernel call computes a row when the vectors go
+ * along the axis (dense: the axis is the innermost dimension or the last
+ * block), or simd_w * nregs rows at once when the axis is followed by
+ * contiguous points (strided: each vector lane is an independent row and
+ * the kernel walks along the axis with the axis_step stride). */
+struct jit_softmax_conf_t {
+    bool is_fwd, is_logsoftmax;
+    data_type_t dt;
+
+    bool dense;
+    int simd_w;
+    int nregs; // vectors per axis step (strided) or per loop iteration
+
+    dim_t axis_size;
+    dim_t vec_stride; // elements between consecutive vectors
+    dim_t axis_step; // elements between consecutive axis points (strided)
+
+    // strided: vectors and elements in the tail of the last block of rows
+    int rem_nregs;
+    // tail elements of the last vector of the axis (dense) or the last block
+    int tail;
+
+    // kernel calls are made at ou * outer_stride + in * inner_stride
+    dim_t outer_size, outer_stride, inner_size, inner_stride;
+};
+
 namespace softmax_impl {
 template <cpu_isa_t isa>
 struct driver_t;
-}
+
+template <cpu_isa_t isa>
+bool init_conf(jit_softmax_conf_t &conf, const softmax_pd_t *pd);
+} // namespace softmax_impl
 
 template <cpu_isa_t isa>
 struct jit_uni_softmax_fwd_t : public primitive_impl_t {
     struct pd_t : public cpu_softmax_fwd_pd_t {
-        pd_t(engine_t *engine, const softmax_desc_t *adesc,
-                const primitive_attr_t *attr,
-                const softmax_fwd_pd_t *hint_fwd_pd)
-            : cpu_softmax_fwd_pd_t(engine, adesc, attr, hint_fwd_pd) {}
+        using cpu_softmax_fwd_pd_t::cpu_softmax_fwd_pd_t;
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_softmax_fwd_t);
 
         status_t init() {
-            auto is_dense = [&]() {
-                const memory_desc_wrapper data_d(src_md());
-                const auto &bd = data_d.blocking_desc();
-
-                if (!data_d.is_dense(true) || !data_d.only_padded_dim(axis()))
-                    return false;
-
-                const auto blk_size = cpu_isa_traits<isa>::vlen / sizeof(float);
-                if (data_d.is_plain())
-                    return bd.strides[axis()] == 1;
-                else {
-                    // 31 is a general limit, 2 is for unroll_regs_ = 4;
-                    const size_t max_stride = (1LL << (31 - 2)) - 1;
-                    const int last_blk = bd.inner_nblks - 1;
-                    return true && bd.inner_blks[last_blk] == blk_size
-                            && bd.inner_idxs[last_blk] == axis()
-                            && sizeof(float) * bd.strides[axis()] < max_stride;
-                }
-            };
-
             bool ok = true && mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
-                    && src_md()->data_type == data_type::f32
-                    && is_dense() // not dense impl can be easily done
-                    && attr()->has_default_values();
+                    && attr()->has_default_values()
+                    && softmax_impl::init_conf<isa>(conf_, this);
             if (!ok) return status::unimplemented;
 
             return status::success;
         };
+
+        jit_softmax_conf_t conf_;
     };
 
     jit_uni_softmax_fwd_t(const pd_t *apd);
     ~jit_uni_softmax_fwd_t();
 
-    typedef float data_t;
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    softmax_impl::driver_t<isa> *softmax_driver_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_softmax_bwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_softmax_bwd_pd_t {
+        using cpu_softmax_bwd_pd_t::cpu_softmax_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_softmax_bwd_t);
+
+        status_t init() {
+            bool ok = true && mayiuse(isa) && !is_fwd()
+                    && !has_zero_dim_memory() && set_default_formats_common()
+                    && memory_desc_wrapper(diff_src_md())
+                            == memory_desc_wrapper(dst_md())
+                    && memory_desc_wrapper(diff_dst_md())
+                            == memory_desc_wrapper(dst_md())
+                    && attr()->has_default_values()
+                    && softmax_impl::init_conf<isa>(conf_, this);
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        };
+
+        jit_softmax_conf_t conf_;
+    };
+
+    jit_uni_softmax_bwd_t(const pd_t *apd);
+    ~jit_uni_softmax_bwd_t();
 
     virtual status_t execute(const exec_ctx_t &ctx) const override;
 
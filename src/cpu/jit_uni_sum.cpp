@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_generator.hpp"
+#include "simple_q10n.hpp"
+
+#include "jit_uni_sum.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace sum_impl {
+
+template <cpu_isa_t isa>
+bool init_conf(jit_uni_sum_conf_t &conf, const sum_pd_t *pd) {
+    using namespace data_type;
+
+    const memory_desc_wrapper o_d(pd->dst_md());
+    if (!utils::one_of(o_d.data_type(), f32, s8, u8) || !o_d.is_dense(true))
+        return false;
+
+    dim_t bytes_per_elem = o_d.data_type_size();
+    for (int i = 0; i < pd->n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(pd->src_md(i));
+        const bool ok = true && utils::one_of(i_d.data_type(), f32, s8, u8)
+                && o_d.similar_to(i_d, true, false, 0) && i_d.is_dense(true);
+        if (!ok) return false;
+        bytes_per_elem += i_d.data_type_size();
+    }
+
+    conf.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    conf.unroll = isa == avx512_common ? 8 : 4;
+    conf.num_srcs = pd->n_inputs();
+    conf.dst_dt = o_d.data_type();
+    conf.nelems = o_d.nelems(true);
+
+    // a work item keeps its part of all the inputs and dst in half of L1
+    const dim_t half_L1 = 16 * 1024; // bytes
+    const dim_t step = conf.unroll * conf.simd_w;
+    conf.block_size = nstl::max(step, half_L1 / bytes_per_elem / step * step);
+
+    return true;
+}
+
+using namespace Xbyak;
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_kernel_t : public jit_generator {
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *const *srcs;
+        const float *scales;
+        void *dst;
+        size_t off; // first element
+        size_t size; // elements, a multiple of simd_w
+    };
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_t)
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    jit_uni_sum_kernel_t(const jit_uni_sum_conf_t &conf,
+            const std::vector<data_type_t> &src_dts)
+        : conf_(conf), src_dts_(src_dts) {
+        generate();
+        ker_ = (decltype(ker_))getCode();
+    }
+
+    void operator()(const call_params_t *p) { ker_(p); }
+
+private:
+    void (*ker_)(const call_params_t *);
+
+    const jit_uni_sum_conf_t conf_;
+    const std::vector<data_type_t> src_dts_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_srcs = r8;
+    Reg64 reg_scales = r9;
+    Reg64 reg_dst = r10;
+    Reg64 reg_off = r11;
+    Reg64 reg_end = r12;
+    Reg64 reg_src = r13;
+    Reg64 reg_tmp = r14;
+
+    // Vmm(0 .. unroll - 1) accumulate, Vmm(unroll .. 2 * unroll - 1) hold
+    // the converted inputs
+    Vmm vmm_acc(int u) { return Vmm(u); }
+    Vmm vmm_src(int u) { return Vmm(conf_.unroll + u); }
+    Vmm vmm_scale = Vmm(2 * conf_.unroll);
+    Vmm vmm_lbound = Vmm(2 * conf_.unroll + 1);
+    Vmm vmm_ubound = Vmm(2 * conf_.unroll + 2);
+
+    Address addr(const Reg64 &base, data_type_t dt, int u) {
+        const int dt_size = (int)types::data_type_size(dt);
+        return ptr[base + reg_off * dt_size + u * conf_.simd_w * dt_size];
+    }
+
+    void load(const Vmm &v, data_type_t dt, const Address &a) {
+        switch (dt) {
+            case data_type::f32: vmovups(v, a); break;
+            case data_type::s8:
+                vpmovsxbd(v, a);
+                vcvtdq2ps(v, v);
+                break;
+            case data_type::u8:
+                vpmovzxbd(v, a);
+                vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void store(const Address &a, const Vmm &v) {
+        if (conf_.dst_dt == data_type::f32) {
+            vmovups(a, v);
+            return;
+        }
+
+        const bool is_s8 = conf_.dst_dt == data_type::s8;
+        vmaxps(v, v, vmm_lbound);
+        vminps(v, v, vmm_ubound);
+        vcvtps2dq(v, v);
+        if (isa == avx512_common) {
+            if (is_s8)
+                vpmovsdb(a, v);
+            else
+                vpmovusdb(a, v);
+        } else {
+            const Xmm x(v.getIdx());
+            vpackssdw(v, v, v);
+            vpermq(Ymm(v.getIdx()), Ymm(v.getIdx()), 0x08);
+            if (is_s8)
+                vpacksswb(x, x, x);
+            else
+                vpackuswb(x, x, x);
+            vmovq(a, x);
+        }
+    }
+
+    void broadcast_bound(const Vmm &v, float bound) {
+        mov(reg_tmp.cvt32(), float2int(bound));
+        vmovd(Xmm(v.getIdx()), reg_tmp.cvt32());
+        vbroadcastss(v, Xmm(v.getIdx()));
+    }
+
+    void step(int nu) {
+        for (int i = 0; i < conf_.num_srcs; ++i) {
+            mov(reg_src, ptr[reg_srcs + i * sizeof(void *)]);
+            vbroadcastss(vmm_scale, ptr[reg_scales + i * sizeof(float)]);
+            for (int u = 0; u < nu; ++u) {
+                load(vmm_src(u), src_dts_[i], addr(reg_src, src_dts_[i], u));
+                if (i == 0)
+                    vmulps(vmm_acc(u), vmm_src(u), vmm_scale);
+                else
+                    vfmadd231ps(vmm_acc(u), vmm_src(u), vmm_scale);
+            }
+        }
+        for (int u = 0; u < nu; ++u)
+            store(addr(reg_dst, conf_.dst_dt, u), vmm_acc(u));
+        add(reg_off, nu * conf_.simd_w);
+    }
+
+    void generate() {
+        Label l_unroll, l_single, l_end;
+
+        preamble();
+
+        mov(reg_srcs, ptr[reg_param + PARAM_OFF(srcs)]);
+        mov(reg_scales, ptr[reg_param + PARAM_OFF(scales)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_off, ptr[reg_param + PARAM_OFF(off)]);
+        mov(reg_end, ptr[reg_param + PARAM_OFF(size)]);
+        add(reg_end, reg_off);
+
+        if (conf_.dst_dt == data_type::s8) {
+            broadcast_bound(vmm_lbound, -128.f);
+            broadcast_bound(vmm_ubound, 127.f);
+        } else if (conf_.dst_dt == data_type::u8) {
+            broadcast_bound(vmm_lbound, 0.f);
+            broadcast_bound(vmm_ubound, 255.f);
+        }
+
+        L(l_unroll);
+        {
+            mov(reg_tmp, reg_end);
+            sub(reg_tmp, reg_off);
+            cmp(reg_tmp, conf_.unroll * conf_.simd_w);
+            jl(l_single, T_NEAR);
+            step(conf_.unroll);
+            jmp(l_unroll, T_NEAR);
+        }
+
+        L(l_single);
+        {
+            cmp(reg_off, reg_end);
+            jge(l_end, T_NEAR);
+            step(1);
+            jmp(l_single, T_NEAR);
+        }
+
+        L(l_end);
+        postamble();
+    }
+};
+
+#undef PARAM_OFF
+
+static float load_f32(const void *src, data_type_t dt, dim_t e) {
+    switch (dt) {
+        case data_type::f32: return ((const float *)src)[e];
+        case data_type::s8: return ((const int8_t *)src)[e];
+        case data_type::u8: return ((const uint8_t *)src)[e];
+        default: assert(!"unsupported data type");
+    }
+    return 0.f;
+}
+
+static void store_f32(void *dst, data_type_t dt, dim_t e, float v) {
+    switch (dt) {
+        case data_type::f32: ((float *)dst)[e] = v; break;
+        case data_type::s8:
+            ((int8_t *)dst)[e] = round_and_saturate<int8_t>(v);
+            break;
+        case data_type::u8:
+            ((uint8_t *)dst)[e] = round_and_saturate<uint8_t>(v);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+} // namespace sum_impl
+
+template <cpu_isa_t isa>
+jit_uni_sum_t<isa>::jit_uni_sum_t(const pd_t *apd) : primitive_impl_t(apd) {
+    std::vector<data_type_t> src_dts;
+    for (int i = 0; i < pd()->n_inputs(); ++i)
+        src_dts.push_back(pd()->src_md(i)->data_type);
+    kernel_ = new sum_impl::jit_uni_sum_kernel_t<isa>(pd()->conf_, src_dts);
+}
+
+template <cpu_isa_t isa>
+jit_uni_sum_t<isa>::~jit_uni_sum_t() {
+    delete kernel_;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->conf_;
+    const int n = conf.num_srcs;
+    const float *scales = pd()->scales();
+
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST)
+            + o_d.blk_off(0) * o_d.data_type_size();
+
+    std::vector<const void *> srcs(n);
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper i_d(pd()->src_md(i));
+        srcs[i] = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + i)
+                + i_d.blk_off(0) * i_d.data_type_size();
+    }
+
+    // the kernel handles whole vectors, the rest is summed up below
+    const dim_t nelems_vec = conf.nelems / conf.simd_w * conf.simd_w;
+    const dim_t nblocks = utils::div_up(nelems_vec, conf.block_size);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nblocks, nthr, ithr, start, end);
+
+        typename sum_impl::jit_uni_sum_kernel_t<isa>::call_params_t p;
+        p.srcs = srcs.data();
+        p.scales = scales;
+        p.dst = dst;
+        for (dim_t b = start; b < end; ++b) {
+            const dim_t off = b * conf.block_size;
+            p.off = off;
+            p.size = nstl::min(conf.block_size, nelems_vec - off);
+            (*kernel_)(&p);
+        }
+    });
+
+    for (dim_t e = nelems_vec; e < conf.nelems; ++e) {
+        float acc = 0.f;
+        for (int i = 0; i < n; ++i)
+            acc += scales[i]
+                    * sum_impl::load_f32(
+                            srcs[i], pd()->src_md(i)->data_type, e);
+        sum_impl::store_f32(dst, conf.dst_dt, e, acc);
+    }
+
+    return status::success;
+}
+
+/* struct instantiation */
+template bool sum_impl::init_conf<avx512_common>(
+        jit_uni_sum_conf_t &conf, const sum_pd_t *pd);
+template bool sum_impl::init_conf<avx2>(
+        jit_uni_sum_conf_t &conf, const sum_pd_t *pd);
+template struct jit_uni_sum_t<avx512_common>;
+template struct jit_uni_sum_t<avx2>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_UNI_SUM_HPP
+#define JIT_UNI_SUM_HPP
+
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "cpu_sum_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Sum of any number of f32, s8 or u8 inputs into an f32, s8 or u8 dst.
+ *
+ * The inputs and dst share the layout up to the data type, so the sum is
+ * computed over the padded elements as over a 1D array. The kernel is
+ * generated for the given list of input data types: for every dst vector
+ * it accumulates the scaled inputs one after another in f32 registers and
+ * stores the result once, so the whole sum is a single pass over memory
+ * whatever the number of inputs. */
+struct jit_uni_sum_conf_t {
+    int simd_w;
+    int unroll; // vectors per loop iteration
+    int num_srcs;
+    data_type_t dst_dt;
+    dim_t nelems; // padded elements
+    dim_t block_size; // elements per thread work item
+};
+
+namespace sum_impl {
+template <cpu_isa_t isa>
+struct jit_uni_sum_kernel_t;
+
+template <cpu_isa_t isa>
+bool init_conf(jit_uni_sum_conf_t &conf, const sum_pd_t *pd);
+} // namespace sum_impl
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_t : public primitive_impl_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_sum_t);
+
+        status_t init() {
+            bool ok = true && mayiuse(isa)
+                    && cpu_sum_pd_t::init() == status::success
+                    && sum_impl::init_conf<isa>(conf_, this);
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+
+        jit_uni_sum_conf_t conf_;
+    };
+
+    jit_uni_sum_t(const pd_t *apd);
+    ~jit_uni_sum_t();
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    sum_impl::jit_uni_sum_kernel_t<isa> *kernel_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,141 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_GEMM_BASED_COMMON_HPP
+#define CPU_MATMUL_GEMM_BASED_COMMON_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace gemm_based {
+
+/* Finds the transposition flag and the leading dimension the column-major
+ * gemm should use for the row-major matrix formed by the last two dimensions
+ * of @p md: 'N' if its rows are dense and 'T' if its columns are. Returns
+ * false if neither of them is. */
+inline bool get_gemm_layout(const memory_desc_t *md, char &trans, dim_t &ld) {
+    const memory_desc_wrapper mdw(md);
+    if (!mdw.is_plain()) return false;
+
+    const int ndims = mdw.ndims();
+    const dims_t &strides = mdw.blocking_desc().strides;
+    const dim_t rows = mdw.dims()[ndims - 2];
+    const dim_t cols = mdw.dims()[ndims - 1];
+
+    if (strides[ndims - 1] == 1
+            && strides[ndims - 2] >= nstl::max<dim_t>(1, cols)) {
+        trans = 'N';
+        ld = strides[ndims - 2];
+        return true;
+    }
+    if (strides[ndims - 2] == 1
+            && strides[ndims - 1] >= nstl::max<dim_t>(1, rows)) {
+        trans = 'T';
+        ld = strides[ndims - 1];
+        return true;
+    }
+    return false;
+}
+
+/* Returns the distance between two consecutive matrices of @p md along the
+ * batch dimension, 0 if the matrix is broadcast across the batch */
+inline dim_t get_batch_stride(const memory_desc_t *md) {
+    const memory_desc_wrapper mdw(md);
+    if (mdw.ndims() < 3 || mdw.dims()[0] == 1) return 0;
+    return mdw.blocking_desc().strides[0];
+}
+
+/* Returns true if the gemm can work directly on the user memory: src and
+ * weights matrices with dense rows or columns, a dense row-major dst and
+ * a bias dense along N. The sizes must fit the int-based gemm interfaces. */
+inline bool check_gemm_compatible_formats(const matmul_pd_t &pd) {
+    using namespace format_tag;
+
+    char trans;
+    dim_t lda, ldb;
+    bool ok = get_gemm_layout(pd.weights_md(), trans, lda)
+            && get_gemm_layout(pd.src_md(), trans, ldb)
+            && memory_desc_wrapper(pd.dst_md())
+                       .matches_tag(pd.batched() ? abc : ab);
+    if (!ok) return false;
+
+    if (pd.with_bias()) {
+        const memory_desc_wrapper bias_d(pd.weights_md(1));
+        if (!bias_d.is_plain()
+                || (pd.N() > 1
+                        && bias_d.blocking_desc().strides[pd.ndims() - 1]
+                                != 1))
+            return false;
+    }
+
+    const dim_t int_max = nstl::numeric_limits<int32_t>::max();
+    return utils::everyone_is(true, pd.M() <= int_max, pd.N() <= int_max,
+            pd.K() <= int_max, lda <= int_max, ldb <= int_max);
+}
+
+/* Returns true if the bias, the output scales and the post-ops can be
+ * applied by inner_product_utils::pp_kernel_t, which indexes them along N
+ * only and supports at most a sum followed by an eltwise */
+inline bool check_gemm_post_processing(const matmul_pd_t &pd) {
+    const int n_mask = 1 << (pd.ndims() - 1);
+
+    const bool bias_ok = IMPLICATION(pd.with_bias(),
+            pd.bias_mask() == (pd.N() > 1 ? n_mask : 0));
+
+    const int oscale_mask = pd.attr()->output_scales_.mask_;
+    const bool oscale_ok = oscale_mask == 0 || oscale_mask == n_mask;
+
+    const auto &po = pd.attr()->post_ops_;
+    auto is_eltwise = [&](int idx) { return po.entry_[idx].is_eltwise(false); };
+    auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(false); };
+    bool post_ops_ok = false;
+    switch (po.len_) {
+        case 0: post_ops_ok = true; break;
+        case 1: post_ops_ok = is_eltwise(0) || is_sum(0); break;
+        case 2: post_ops_ok = is_sum(0) && is_eltwise(1); break;
+        default: post_ops_ok = false;
+    }
+
+    return bias_ok && oscale_ok && post_ops_ok;
+}
+
+/* Returns true if the batch is large enough to give each thread whole
+ * matrices, so that every gemm runs sequentially */
+inline bool use_batch_parallelization(const matmul_pd_t &pd, int nthr) {
+    return pd.batch() > 1 && pd.batch() >= nthr;
+}
+
+} // namespace gemm_based
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
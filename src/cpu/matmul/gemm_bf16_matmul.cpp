@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "type_helpers.hpp"
+
+#include "cpu_primitive.hpp"
+
+#include "gemm_based_common.hpp"
+#include "gemm_bf16_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace data_type;
+
+template <data_type_t dst_type>
+status_t gemm_bf16_matmul_t<dst_type>::pd_t::init() {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    bool ok = mayiuse(avx512_core) && src_md()->data_type == bf16
+            && weights_md()->data_type == bf16
+            && desc()->accum_data_type == f32
+            && dst_md()->data_type == dst_type
+            && IMPLICATION(with_bias(),
+                    utils::one_of(weights_md(1)->data_type, f32, bf16))
+            && !has_zero_dim_memory()
+            && attr()->has_default_values(
+                    smask_t::oscale | smask_t::post_ops)
+            && set_default_params() == status::success
+            && gemm_based::check_gemm_compatible_formats(*this)
+            && gemm_based::check_gemm_post_processing(*this);
+    if (!ok) return status::unimplemented;
+
+    // an f32 dst can hold the accumulator, the sum being folded into the
+    // gemm if the accumulator is not scaled before it
+    const bool do_sum = attr()->post_ops_.find(primitive_kind::sum) >= 0;
+    dst_is_acc_ = dst_type == f32
+            && IMPLICATION(
+                    do_sum, attr()->output_scales_.has_default_values());
+
+    nthr_ = dnnl_get_max_threads();
+    parallel_over_batch_ = gemm_based::use_batch_parallelization(*this, nthr_);
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <data_type_t dst_type>
+void gemm_bf16_matmul_t<dst_type>::pd_t::init_scratchpad() {
+    if (!dst_is_acc_) {
+        const size_t nbufs = parallel_over_batch_ ? nthr_ : 1;
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.book(memory_tracking::names::key_matmul_dst_in_acc_dt,
+                sizeof(acc_data_t) * nbufs * M() * N());
+    }
+}
+
+template <data_type_t dst_type>
+gemm_bf16_matmul_t<dst_type>::gemm_bf16_matmul_t(const pd_t *apd)
+    : primitive_impl_t(apd), pp_kernel_(nullptr), beta_(0.f) {
+    const auto &po = pd()->attr()->post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    if (pd()->dst_is_acc_ && sum_idx >= 0) beta_ = po.entry_[sum_idx].sum.scale;
+
+    // the bf16 gemm has no bias, so it is always applied by the kernel
+    const bool has_eltwise = po.find(primitive_kind::eltwise) >= 0;
+    const bool do_pp = !pd()->dst_is_acc_ || pd()->with_bias() || has_eltwise
+            || !pd()->attr()->output_scales_.has_default_values();
+    if (do_pp)
+        pp_kernel_ = new inner_product_utils::pp_kernel_t<f32, dst_type>(
+                pd()->N(), pd()->attr(),
+                pd()->with_bias() ? pd()->weights_md(1)->data_type
+                                  : data_type::undef,
+                pd()->attr()->output_scales_.mask_ != 0, pd()->dst_is_acc_);
+}
+
+template <data_type_t dst_type>
+status_t gemm_bf16_matmul_t<dst_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper bias_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    src += src_d.offset0();
+    weights += weights_d.offset0();
+    if (bias) bias += bias_d.offset0() * bias_d.data_type_size();
+    dst += dst_d.offset0();
+
+    // the row-major dst = src * weights is computed by the column-major gemm
+    // as dst^T = weights^T * src^T
+    char transa, transb;
+    dim_t lda, ldb;
+    gemm_based::get_gemm_layout(pd()->weights_md(), transa, lda);
+    gemm_based::get_gemm_layout(pd()->src_md(), transb, ldb);
+
+    const dim_t M = pd()->N(), N = pd()->M(), K = pd()->K();
+    const dim_t ldc = M;
+    const dim_t batch = pd()->batch();
+    const dim_t src_batch_stride = gemm_based::get_batch_stride(pd()->src_md());
+    const dim_t wei_batch_stride
+            = gemm_based::get_batch_stride(pd()->weights_md());
+    const dim_t dst_batch_stride = M * N;
+
+    acc_data_t *acc_base = pd()->dst_is_acc_
+            ? nullptr
+            : ctx.get_scratchpad_grantor().template get<acc_data_t>(
+                    memory_tracking::names::key_matmul_dst_in_acc_dt);
+
+    const float alpha = 1.f;
+    auto gemm = [&](dim_t mb, acc_data_t *acc) {
+        gemm_bf16bf16f32(&transa, &transb, &M, &N, &K, &alpha,
+                weights + mb * wei_batch_stride, &lda,
+                src + mb * src_batch_stride, &ldb, &beta_, acc, &ldc);
+    };
+
+    auto post_process = [&](dim_t mb, const acc_data_t *acc, int ithr,
+                                int nthr) {
+        size_t start, end;
+        balance211((size_t)(M * N), nthr, ithr, start, end);
+        (*pp_kernel_)(dst + mb * dst_batch_stride, acc, bias, scales, start,
+                end);
+    };
+
+    // acc aliases dst only if dst_type is f32, hence the casts below
+    if (pd()->parallel_over_batch_) {
+        parallel(pd()->nthr_, [&](int ithr, int nthr) {
+            dim_t mb_start {0}, mb_end {0};
+            balance211(batch, nthr, ithr, mb_start, mb_end);
+            for (dim_t mb = mb_start; mb < mb_end; ++mb) {
+                acc_data_t *acc = pd()->dst_is_acc_
+                        ? (acc_data_t *)(dst + mb * dst_batch_stride)
+                        : acc_base + ithr * dst_batch_stride;
+                gemm(mb, acc);
+                if (pp_kernel_) post_process(mb, acc, 0, 1);
+            }
+        });
+    } else {
+        for (dim_t mb = 0; mb < batch; ++mb) {
+            acc_data_t *acc = pd()->dst_is_acc_
+                    ? (acc_data_t *)(dst + mb * dst_batch_stride)
+                    : acc_base;
+            gemm(mb, acc);
+            if (pp_kernel_) {
+                const bool force_sequential = M * N < 2000;
+                parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+                    post_process(mb, acc, ithr, nthr);
+                });
+            }
+        }
+    }
+
+    return status::success;
+}
+
+template struct gemm_bf16_matmul_t<f32>;
+template struct gemm_bf16_matmul_t<bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "type_helpers.hpp"
+
+#include "cpu_primitive.hpp"
+
+#include "gemm_based_common.hpp"
+#include "gemm_f32_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace data_type;
+
+status_t gemm_f32_matmul_t::pd_t::init() {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    bool ok = src_md()->data_type == f32 && weights_md()->data_type == f32
+            && desc()->accum_data_type == f32 && dst_md()->data_type == f32
+            && IMPLICATION(with_bias(), weights_md(1)->data_type == f32)
+            && !has_zero_dim_memory()
+            && attr()->has_default_values(
+                    smask_t::oscale | smask_t::post_ops)
+            && set_default_params() == status::success
+            && gemm_based::check_gemm_compatible_formats(*this)
+            && gemm_based::check_gemm_post_processing(*this);
+    if (!ok) return status::unimplemented;
+
+    // the sum can only be folded into the gemm if the accumulator is not
+    // scaled before it
+    const bool do_sum = attr()->post_ops_.find(primitive_kind::sum) >= 0;
+    dst_is_acc_ = IMPLICATION(
+            do_sum, attr()->output_scales_.has_default_values());
+
+    nthr_ = dnnl_get_max_threads();
+    parallel_over_batch_ = gemm_based::use_batch_parallelization(*this, nthr_);
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void gemm_f32_matmul_t::pd_t::init_scratchpad() {
+    if (!dst_is_acc_) {
+        const size_t nbufs = parallel_over_batch_ ? nthr_ : 1;
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.book(memory_tracking::names::key_matmul_dst_in_acc_dt,
+                sizeof(data_t) * nbufs * M() * N());
+    }
+}
+
+gemm_f32_matmul_t::gemm_f32_matmul_t(const pd_t *apd)
+    : primitive_impl_t(apd), pp_kernel_(nullptr), beta_(0.f) {
+    const auto &po = pd()->attr()->post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    if (pd()->dst_is_acc_ && sum_idx >= 0) beta_ = po.entry_[sum_idx].sum.scale;
+
+    const bool has_eltwise = po.find(primitive_kind::eltwise) >= 0;
+    const bool do_pp = !pd()->dst_is_acc_ || pd()->with_bias() || has_eltwise
+            || !pd()->attr()->output_scales_.has_default_values();
+    if (do_pp)
+        pp_kernel_ = new inner_product_utils::pp_kernel_t<f32, f32>(pd()->N(),
+                pd()->attr(), pd()->with_bias() ? f32 : data_type::undef,
+                pd()->attr()->output_scales_.mask_ != 0, pd()->dst_is_acc_);
+}
+
+status_t gemm_f32_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper bias_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    src += src_d.offset0();
+    weights += weights_d.offset0();
+    if (bias) bias += bias_d.offset0() * sizeof(data_t);
+    dst += dst_d.offset0();
+
+    // the row-major dst = src * weights is computed by the column-major gemm
+    // as dst^T = weights^T * src^T
+    char transa, transb;
+    dim_t lda, ldb;
+    gemm_based::get_gemm_layout(pd()->weights_md(), transa, lda);
+    gemm_based::get_gemm_layout(pd()->src_md(), transb, ldb);
+
+    const int M = pd()->N(), N = pd()->M(), K = pd()->K();
+    const int LDA = lda, LDB = ldb, LDC = M;
+    const dim_t batch = pd()->batch();
+    const dim_t src_batch_stride = gemm_based::get_batch_stride(pd()->src_md());
+    const dim_t wei_batch_stride
+            = gemm_based::get_batch_stride(pd()->weights_md());
+    const dim_t dst_batch_stride = (dim_t)M * N;
+
+    data_t *acc_base = pd()->dst_is_acc_
+            ? nullptr
+            : ctx.get_scratchpad_grantor().get<data_t>(
+                    memory_tracking::names::key_matmul_dst_in_acc_dt);
+    const bool bias_in_gemm = pp_kernel_ == nullptr;
+
+    const float alpha = 1.f;
+    auto gemm = [&](dim_t mb, data_t *acc) {
+        extended_sgemm(&transa, &transb, &M, &N, &K, &alpha,
+                weights + mb * wei_batch_stride, &LDA,
+                src + mb * src_batch_stride, &LDB, &beta_, acc, &LDC,
+                bias_in_gemm ? (const data_t *)bias : nullptr);
+    };
+
+    auto post_process = [&](dim_t mb, const data_t *acc, int ithr, int nthr) {
+        size_t start, end;
+        balance211((size_t)M * N, nthr, ithr, start, end);
+        (*pp_kernel_)(dst + mb * dst_batch_stride, acc, bias, scales, start,
+                end);
+    };
+
+    if (pd()->parallel_over_batch_) {
+        parallel(pd()->nthr_, [&](int ithr, int nthr) {
+            dim_t mb_start {0}, mb_end {0};
+            balance211(batch, nthr, ithr, mb_start, mb_end);
+            for (dim_t mb = mb_start; mb < mb_end; ++mb) {
+                data_t *acc = pd()->dst_is_acc_
+                        ? dst + mb * dst_batch_stride
+                        : acc_base + ithr * dst_batch_stride;
+                gemm(mb, acc);
+                if (pp_kernel_) post_process(mb, acc, 0, 1);
+            }
+        });
+    } else {
+        for (dim_t mb = 0; mb < batch; ++mb) {
+            data_t *acc = pd()->dst_is_acc_ ? dst + mb * dst_batch_stride
+                                            : acc_base;
+            gemm(mb, acc);
+            if (pp_kernel_) {
+                const bool force_sequential = M * N < 2000;
+                parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+                    post_process(mb, acc, ithr, nthr);
+                });
+            }
+        }
+    }
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
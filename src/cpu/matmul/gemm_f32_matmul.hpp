@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_F32_MATMUL_HPP
+#define CPU_GEMM_F32_MATMUL_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "gemm/gemm.hpp"
+#include "gemm_inner_product_utils.hpp"
+
+#include "cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct gemm_f32_matmul_t : public primitive_impl_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_f32_matmul_t);
+
+        status_t init();
+
+        // the gemm writes to dst directly, the sum being done through beta
+        bool dst_is_acc_;
+        // every thread computes whole matrices of the batch
+        bool parallel_over_batch_;
+        int nthr_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    gemm_f32_matmul_t(const pd_t *apd);
+    ~gemm_f32_matmul_t() { delete pp_kernel_; }
+
+    typedef prec_traits<data_type::f32>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    inner_product_utils::pp_kernel_t<data_type::f32, data_type::f32>
+            *pp_kernel_;
+    float beta_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,288 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "type_helpers.hpp"
+
+#include "cpu_primitive.hpp"
+#include "simple_q10n.hpp"
+
+#include "gemm_based_common.hpp"
+#include "gemm_x8s8s32x_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace data_type;
+using math::get_bias;
+
+template <data_type_t src_type, data_type_t dst_type>
+status_t gemm_x8s8s32x_matmul_t<src_type, dst_type>::pd_t::init() {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    bool ok = src_md()->data_type == src_type
+            && weights_md()->data_type == s8
+            && desc()->accum_data_type == s32
+            && dst_md()->data_type == dst_type
+            && IMPLICATION(with_bias(),
+                    utils::one_of(weights_md(1)->data_type, f32, s32, s8, u8))
+            && !has_zero_dim_memory()
+            && attr()->has_default_values(smask_t::oscale
+                    | smask_t::zero_points | smask_t::post_ops)
+            && set_default_params() == status::success
+            && gemm_based::check_gemm_compatible_formats(*this)
+            && gemm_based::check_gemm_post_processing(*this);
+    if (!ok) return status::unimplemented;
+
+    const bool do_sum = attr()->post_ops_.find(primitive_kind::sum) >= 0;
+    dst_is_acc_ = utils::one_of(dst_type, s32, f32) && !do_sum;
+    with_zero_points_ = !attr()->zero_points_.has_default_values();
+
+    nthr_ = dnnl_get_max_threads();
+    parallel_over_batch_ = gemm_based::use_batch_parallelization(*this, nthr_);
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+void gemm_x8s8s32x_matmul_t<src_type, dst_type>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+
+    const size_t nbufs = parallel_over_batch_ ? nthr_ : 1;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!dst_is_acc_)
+        scratchpad.book(key_matmul_dst_in_acc_dt,
+                sizeof(acc_data_t) * nbufs * M() * N());
+    if (with_zero_points_)
+        scratchpad.book(key_matmul_zp_compensation,
+                sizeof(int32_t) * nbufs * (M() + N()));
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+gemm_x8s8s32x_matmul_t<src_type, dst_type>::gemm_x8s8s32x_matmul_t(
+        const pd_t *apd)
+    : primitive_impl_t(apd), pp_kernel_(nullptr), eltwise_(nullptr) {
+    const auto &po = pd()->attr()->post_ops_;
+    const int eltwise_idx = po.find(primitive_kind::eltwise);
+
+    if (pd()->with_zero_points_) {
+        if (eltwise_idx >= 0)
+            eltwise_ = new ref_eltwise_scalar_fwd_t(
+                    po.entry_[eltwise_idx].eltwise);
+        return;
+    }
+
+    const bool do_pp = !pd()->dst_is_acc_ || pd()->with_bias()
+            || eltwise_idx >= 0
+            || !pd()->attr()->output_scales_.has_default_values();
+    if (do_pp)
+        pp_kernel_ = new inner_product_utils::pp_kernel_t<s32, dst_type>(
+                pd()->N(), pd()->attr(),
+                pd()->with_bias() ? pd()->weights_md(1)->data_type
+                                  : data_type::undef,
+                pd()->attr()->output_scales_.mask_ != 0, false);
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+status_t gemm_x8s8s32x_matmul_t<src_type, dst_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+    DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINT_VALUE(weights_zero_point, DNNL_ARG_WEIGHTS);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper bias_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    src += src_d.offset0();
+    weights += weights_d.offset0();
+    if (bias) bias += bias_d.offset0() * bias_d.data_type_size();
+    dst += dst_d.offset0();
+
+    const dim_t batch = pd()->batch();
+    const dim_t M = pd()->M(), N = pd()->N(), K = pd()->K();
+    const dim_t src_batch_stride = gemm_based::get_batch_stride(pd()->src_md());
+    const dim_t wei_batch_stride
+            = gemm_based::get_batch_stride(pd()->weights_md());
+    const dim_t dst_batch_stride = M * N;
+
+    // the row-major dst = src * weights is computed by the column-major gemm
+    // as dst^T = weights^T * src^T
+    char transa, transb;
+    dim_t lda, ldb;
+    gemm_based::get_gemm_layout(pd()->weights_md(), transa, lda);
+    gemm_based::get_gemm_layout(pd()->src_md(), transb, ldb);
+
+    const int gemm_M = N, gemm_N = M, gemm_K = K;
+    const int LDA = lda, LDB = ldb, LDC = gemm_M;
+    const int8_t off_a = 0;
+    const src_data_t off_b = 0;
+    const int32_t off_c = 0;
+
+    acc_data_t *acc_base = pd()->dst_is_acc_
+            ? nullptr
+            : ctx.get_scratchpad_grantor().template get<acc_data_t>(
+                    key_matmul_dst_in_acc_dt);
+    int32_t *comp_base = pd()->with_zero_points_
+            ? ctx.get_scratchpad_grantor().template get<int32_t>(
+                    key_matmul_zp_compensation)
+            : nullptr;
+
+    const float onef = 1.f, zerof = 0.f;
+    auto gemm = [&](dim_t mb, acc_data_t *acc) {
+        gemm_s8x8s32(&transa, &transb, "F", &gemm_M, &gemm_N, &gemm_K, &onef,
+                weights + mb * wei_batch_stride, &LDA, &off_a,
+                src + mb * src_batch_stride, &LDB, &off_b, &zerof, acc, &LDC,
+                &off_c);
+    };
+
+    auto post_process = [&](dim_t mb, const acc_data_t *acc, int ithr,
+                                int nthr) {
+        size_t start, end;
+        balance211((size_t)(M * N), nthr, ithr, start, end);
+        (*pp_kernel_)(dst + mb * dst_batch_stride, acc, bias, scales, start,
+                end);
+    };
+
+    // The zero points are taken into account after the gemm:
+    //   sum_k (src - zp_src) * (wei - zp_wei) = sum_k src * wei
+    //           - zp_src * sum_k wei - zp_wei * sum_k src + K * zp_src * zp_wei
+    // the first N entries of comp hold the sums of the weights columns and
+    // the next M ones the sums of the src rows.
+    const int ndims = pd()->ndims();
+    const dim_t wei_stride_k = weights_d.blocking_desc().strides[ndims - 2];
+    const dim_t wei_stride_n = weights_d.blocking_desc().strides[ndims - 1];
+    const dim_t src_stride_m = src_d.blocking_desc().strides[ndims - 2];
+    const dim_t src_stride_k = src_d.blocking_desc().strides[ndims - 1];
+
+    auto compute_compensation = [&](dim_t mb, int32_t *comp, int ithr,
+                                        int nthr) {
+        dim_t start {0}, end {0};
+        balance211(N + M, nthr, ithr, start, end);
+        const wei_data_t *w = weights + mb * wei_batch_stride;
+        const src_data_t *s = src + mb * src_batch_stride;
+        for (dim_t idx = start; idx < end; ++idx) {
+            int32_t sum = 0;
+            if (idx < N && src_zero_point != 0) {
+                for (dim_t k = 0; k < K; ++k)
+                    sum += w[k * wei_stride_k + idx * wei_stride_n];
+            } else if (idx >= N && weights_zero_point != 0) {
+                for (dim_t k = 0; k < K; ++k)
+                    sum += s[(idx - N) * src_stride_m + k * src_stride_k];
+            }
+            comp[idx] = sum;
+        }
+    };
+
+    const auto &po = pd()->attr()->post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    const float sum_scale = sum_idx >= 0 ? po.entry_[sum_idx].sum.scale : 0.f;
+    const dim_t scale_n_mult = pd()->attr()->output_scales_.mask_ ? 1 : 0;
+    const data_type_t bias_dt = pd()->weights_md(1)->data_type;
+    const int32_t zp_comp = (int32_t)K * src_zero_point * weights_zero_point;
+
+    auto post_process_with_zero_points = [&](dim_t mb, const acc_data_t *acc,
+                                                 const int32_t *comp, int ithr,
+                                                 int nthr) {
+        size_t start, end;
+        balance211((size_t)(M * N), nthr, ithr, start, end);
+        dst_data_t *d = dst + mb * dst_batch_stride;
+        for (size_t i = start; i < end; ++i) {
+            const dim_t m = i / N, n = i % N;
+            const int32_t a = acc[i] - src_zero_point * comp[n]
+                    - weights_zero_point * comp[N + m] + zp_comp;
+            float v = (float)a;
+            if (bias) v += get_bias(bias, n, bias_dt);
+            v *= scales[scale_n_mult * n];
+            if (sum_idx >= 0) v += sum_scale * (float)d[i];
+            if (eltwise_) v = eltwise_->compute_scalar(v);
+            v += (float)dst_zero_point;
+            d[i] = qz_a1b0<float, dst_data_t>()(v);
+        }
+    };
+
+    if (pd()->parallel_over_batch_) {
+        parallel(pd()->nthr_, [&](int ithr, int nthr) {
+            dim_t mb_start {0}, mb_end {0};
+            balance211(batch, nthr, ithr, mb_start, mb_end);
+            for (dim_t mb = mb_start; mb < mb_end; ++mb) {
+                acc_data_t *acc = pd()->dst_is_acc_
+                        ? (acc_data_t *)(dst + mb * dst_batch_stride)
+                        : acc_base + ithr * dst_batch_stride;
+                gemm(mb, acc);
+                if (pd()->with_zero_points_) {
+                    int32_t *comp = comp_base + ithr * (M + N);
+                    compute_compensation(mb, comp, 0, 1);
+                    post_process_with_zero_points(mb, acc, comp, 0, 1);
+                } else if (pp_kernel_) {
+                    post_process(mb, acc, 0, 1);
+                }
+            }
+        });
+    } else {
+        const bool force_sequential = M * N < 2000;
+        for (dim_t mb = 0; mb < batch; ++mb) {
+            acc_data_t *acc = pd()->dst_is_acc_
+                    ? (acc_data_t *)(dst + mb * dst_batch_stride)
+                    : acc_base;
+            gemm(mb, acc);
+            if (pd()->with_zero_points_) {
+                parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+                    compute_compensation(mb, comp_base, ithr, nthr);
+                });
+                parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+                    post_process_with_zero_points(
+                            mb, acc, comp_base, ithr, nthr);
+                });
+            } else if (pp_kernel_) {
+                parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+                    post_process(mb, acc, ithr, nthr);
+                });
+            }
+        }
+    }
+
+    return status::success;
+}
+
+template struct gemm_x8s8s32x_matmul_t<u8, f32>;
+template struct gemm_x8s8s32x_matmul_t<u8, s32>;
+template struct gemm_x8s8s32x_matmul_t<u8, s8>;
+template struct gemm_x8s8s32x_matmul_t<u8, u8>;
+template struct gemm_x8s8s32x_matmul_t<s8, f32>;
+template struct gemm_x8s8s32x_matmul_t<s8, s32>;
+template struct gemm_x8s8s32x_matmul_t<s8, s8>;
+template struct gemm_x8s8s32x_matmul_t<s8, u8>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
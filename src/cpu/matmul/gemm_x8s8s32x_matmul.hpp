@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_X8S8S32X_MATMUL_HPP
+#define CPU_GEMM_X8S8S32X_MATMUL_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "gemm/gemm.hpp"
+#include "gemm_inner_product_utils.hpp"
+#include "ref_eltwise.hpp"
+
+#include "cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+struct gemm_x8s8s32x_matmul_t : public primitive_impl_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(src_type == data_type::u8 ? IGEMM_S8U8S32_IMPL_STR
+                                                      : IGEMM_S8S8S32_IMPL_STR,
+                gemm_x8s8s32x_matmul_t, USE_GLOBAL_SCRATCHPAD);
+
+        status_t init();
+
+        // the gemm writes to dst directly
+        bool dst_is_acc_;
+        // the zero points are applied with the scalar post-processing
+        bool with_zero_points_;
+        // every thread computes whole matrices of the batch
+        bool parallel_over_batch_;
+        int nthr_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    gemm_x8s8s32x_matmul_t(const pd_t *apd);
+    ~gemm_x8s8s32x_matmul_t() {
+        delete pp_kernel_;
+        delete eltwise_;
+    }
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<data_type::s8>::type wei_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+    typedef typename prec_traits<data_type::s32>::type acc_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    inner_product_utils::pp_kernel_t<data_type::s32, dst_type> *pp_kernel_;
+    ref_eltwise_scalar_fwd_t *eltwise_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
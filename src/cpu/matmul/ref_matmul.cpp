@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "dnnl_traits.hpp"
+#include "math_utils.hpp"
+#include "type_helpers.hpp"
+
+#include "cpu_primitive.hpp"
+#include "simple_q10n.hpp"
+
+#include "ref_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using math::get_bias;
+
+template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type,
+        data_type_t acc_type>
+status_t ref_matmul_t<src_type, wei_type, dst_type, acc_type>::execute_ref(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    DEFINE_SCALES_BUFFER(scales);
+    DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINT_VALUE(weights_zero_point, DNNL_ARG_WEIGHTS);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper bias_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const bool batched = pd()->batched();
+    const dim_t MB = pd()->batch();
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t K = pd()->K();
+
+    // broadcast batch dimensions are indexed with 0
+    const dim_t src_mb_mult = pd()->src_batch_broadcast() ? 0 : 1;
+    const dim_t wei_mb_mult = pd()->wei_batch_broadcast() ? 0 : 1;
+
+    // the bias may be broadcast along any of the dimensions
+    const int ndims = pd()->ndims();
+    const int bias_mask = pd()->bias_mask();
+    const dim_t bias_mb_mult = (batched && (bias_mask & 1)) ? 1 : 0;
+    const dim_t bias_m_mult = (bias_mask & (1 << (ndims - 2))) ? 1 : 0;
+    const dim_t bias_n_mult = (bias_mask & (1 << (ndims - 1))) ? 1 : 0;
+    const data_type_t bias_dt = pd()->weights_md(1)->data_type;
+
+    const dim_t scale_n_mult = pd()->attr()->output_scales_.mask_ ? 1 : 0;
+    const auto &post_ops = pd()->attr()->post_ops_;
+
+    auto off = [=](const memory_desc_wrapper &d, dim_t mb, dim_t m, dim_t n) {
+        return batched ? d.off(mb, m, n) : d.off(m, n);
+    };
+
+    auto ker = [&](dim_t mb, dim_t m, dim_t n) {
+        acc_data_t acc = 0;
+        for (dim_t k = 0; k < K; ++k) {
+            const acc_data_t s = (acc_data_t)src[off(
+                                         src_d, src_mb_mult * mb, m, k)]
+                    - (acc_data_t)src_zero_point;
+            const acc_data_t w = (acc_data_t)weights[off(
+                                         weights_d, wei_mb_mult * mb, k, n)]
+                    - (acc_data_t)weights_zero_point;
+            acc += s * w;
+        }
+        return acc;
+    };
+
+    parallel_nd(MB, M, N, [&](dim_t mb, dim_t m, dim_t n) {
+        const auto dst_off = off(dst_d, mb, m, n);
+
+        float d = (float)ker(mb, m, n);
+        if (bias)
+            d += get_bias(bias,
+                    off(bias_d, bias_mb_mult * mb, bias_m_mult * m,
+                            bias_n_mult * n),
+                    bias_dt);
+        d *= scales[scale_n_mult * n];
+
+        for (int idx = 0; idx < post_ops.len_; ++idx) {
+            const auto &e = post_ops.entry_[idx];
+            if (e.is_sum(false))
+                d += e.sum.scale * (float)dst[dst_off];
+            else
+                d = eltwises_[idx]->compute_scalar(d);
+        }
+
+        d += (float)dst_zero_point;
+        dst[dst_off] = qz_a1b0<float, dst_data_t>()(d);
+    });
+
+    return status::success;
+}
+
+using namespace data_type;
+template struct ref_matmul_t<f32>;
+template struct ref_matmul_t<bf16, bf16, f32, f32>;
+template struct ref_matmul_t<bf16, bf16, bf16, f32>;
+template struct ref_matmul_t<u8, s8, f32, s32>;
+template struct ref_matmul_t<u8, s8, s32, s32>;
+template struct ref_matmul_t<u8, s8, s8, s32>;
+template struct ref_matmul_t<u8, s8, u8, s32>;
+template struct ref_matmul_t<s8, s8, f32, s32>;
+template struct ref_matmul_t<s8, s8, s32, s32>;
+template struct ref_matmul_t<s8, s8, s8, s32>;
+template struct ref_matmul_t<s8, s8, u8, s32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
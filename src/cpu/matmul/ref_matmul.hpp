@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_MATMUL_HPP
+#define CPU_REF_MATMUL_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_matmul_pd.hpp"
+#include "ref_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <impl::data_type_t src_type, impl::data_type_t wei_type = src_type,
+        impl::data_type_t dst_type = src_type,
+        impl::data_type_t acc_type = dst_type>
+struct ref_matmul_t : public primitive_impl_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_matmul_t);
+
+        status_t init() {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+
+            bool ok = src_md()->data_type == src_type
+                    && weights_md()->data_type == wei_type
+                    && desc()->accum_data_type == acc_type
+                    && dst_md()->data_type == dst_type
+                    && IMPLICATION(with_bias(),
+                            utils::one_of(weights_md(1)->data_type, f32, bf16,
+                                    s32, s8, u8))
+                    && attr()->has_default_values(smask_t::oscale
+                            | smask_t::zero_points | smask_t::post_ops)
+                    && attr_oscale_ok() && attr_zero_points_ok()
+                    && post_ops_ok() && set_default_params() == status::success;
+            return ok ? status::success : status::unimplemented;
+        }
+
+    private:
+        bool attr_oscale_ok() const {
+            const int mask = attr()->output_scales_.mask_;
+            return mask == 0 || mask == (1 << (ndims() - 1));
+        }
+
+        bool attr_zero_points_ok() const {
+            return IMPLICATION(!attr()->zero_points_.has_default_values(),
+                    utils::one_of(src_type, data_type::u8, data_type::s8));
+        }
+
+        bool post_ops_ok() const {
+            const auto &p = attr()->post_ops_;
+            for (int idx = 0; idx < p.len_; ++idx)
+                if (!p.entry_[idx].is_sum(false)
+                        && !p.entry_[idx].is_eltwise(false))
+                    return false;
+            return true;
+        }
+    };
+
+    ref_matmul_t(const pd_t *apd) : primitive_impl_t(apd) {
+        const auto &p = pd()->attr()->post_ops_;
+        for (int idx = 0; idx < post_ops_t::capacity; ++idx)
+            eltwises_[idx] = idx < p.len_ && p.entry_[idx].is_eltwise(false)
+                    ? new ref_eltwise_scalar_fwd_t(p.entry_[idx].eltwise)
+                    : nullptr;
+    }
+
+    ~ref_matmul_t() {
+        for (int idx = 0; idx < post_ops_t::capacity; ++idx)
+            delete eltwises_[idx];
+    }
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<wei_type>::type wei_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+    typedef typename prec_traits<acc_type>::type acc_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_ref(ctx);
+    }
+
+private:
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    ref_eltwise_scalar_fwd_t *eltwises_[post_ops_t::capacity];
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -20,33 +20,49 @@
 
 #include "c_types_map.hpp"
 #include "dnnl_thread.hpp"
+#include "nstl.hpp"
 #include "type_helpers.hpp"
 
+#include "cpu_primitive.hpp"
+#include "simple_q10n.hpp"
+
 #include "ref_binary.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
-template <impl::data_type_t data_type>
-void ref_binary_t<data_type>::execute_ref(const exec_ctx_t &ctx) const {
-    const auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
-    const auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+namespace {
+float compute_binary_scalar(alg_kind_t alg, float x, float y) {
+    using namespace alg_kind;
+    switch (alg) {
+        case binary_add: return x + y;
+        case binary_mul: return x * y;
+        case binary_max: return nstl::max(x, y);
+        case binary_min: return nstl::min(x, y);
+        case binary_sub: return x - y;
+        case binary_div: return x / y;
+        default: assert(!"not supported operation!");
+    }
+    return NAN;
+}
+} // namespace
+
+template <data_type_t src0_type, data_type_t src1_type, data_type_t dst_type>
+status_t ref_binary_t<src0_type, src1_type, dst_type>::execute_ref(
+        const exec_ctx_t &ctx) const {
+    const auto src0 = CTX_IN_MEM(const src0_data_t *, DNNL_ARG_SRC_0);
+    const auto src1 = CTX_IN_MEM(const src1_data_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
 
     const memory_desc_wrapper src0_d(pd()->src_md(0));
     const memory_desc_wrapper src1_d(pd()->src_md(1));
 
     const auto alg = pd()->desc()->alg_kind;
-    auto perform_op = [&](data_t *d, data_t x, data_t y) {
-        if (alg == alg_kind::binary_add) {
-            *d = x + y;
-        } else if (alg == alg_kind::binary_mul) {
-            *d = x * y;
-        } else {
-            assert(!"not supported operation!");
-        }
-    };
+    const auto &post_ops = pd()->attr()->post_ops_;
+    const float scale = scales[0];
 
     const dims_t &dims_bcast = pd()->broadcast_dims();
     const dims_t &dims_A = src0_d.dims();
@@ -71,12 +87,34 @@ void ref_binary_t<data_type>::execute_ref(const exec_ctx_t &ctx) const {
     parallel_nd(nelems_A, [&](dim_t i) {
         auto off_A = src0_d.off_l(i);
         auto off_B = pd()->is_tensor_op() ? src1_d.off_l(i) : map_idx_B(i);
-        perform_op(&dst[off_A], src0[off_A], src1[off_B]);
+
+        float d = scale
+                * compute_binary_scalar(
+                        alg, (float)src0[off_A], (float)src1[off_B]);
+
+        for (int idx = 0; idx < post_ops.len_; ++idx) {
+            const auto &e = post_ops.entry_[idx];
+            if (e.is_sum(false))
+                d += e.sum.scale * (float)dst[off_A];
+            else
+                d = eltwises_[idx]->compute_scalar(d);
+        }
+
+        dst[off_A] = qz_a1b0<float, dst_data_t>()(d);
     });
+
+    return status::success;
 }
 
-template struct ref_binary_t<data_type::f32>;
-template struct ref_binary_t<data_type::bf16>;
+using namespace data_type;
+template struct ref_binary_t<f32>;
+template struct ref_binary_t<bf16>;
+template struct ref_binary_t<u8, u8, u8>;
+template struct ref_binary_t<u8, s8, u8>;
+template struct ref_binary_t<u8, f32, u8>;
+template struct ref_binary_t<s8, s8, s8>;
+template struct ref_binary_t<s8, u8, s8>;
+template struct ref_binary_t<s8, f32, s8>;
 
 } // namespace cpu
 } // namespace impl
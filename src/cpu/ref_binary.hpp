@@ -25,12 +25,15 @@
 #include "utils.hpp"
 
 #include "cpu_binary_pd.hpp"
+#include "ref_eltwise.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
-template <impl::data_type_t data_type>
+template <impl::data_type_t src0_type,
+        impl::data_type_t src1_type = src0_type,
+        impl::data_type_t dst_type = src0_type>
 struct ref_binary_t : public primitive_impl_t {
     struct pd_t : public cpu_binary_pd_t {
         using cpu_binary_pd_t::cpu_binary_pd_t;
@@ -40,29 +43,45 @@ struct ref_binary_t : public primitive_impl_t {
         status_t init() {
             using namespace data_type;
             bool ok = true && set_default_params() == status::success
-                    && utils::everyone_is(data_type, src_md(0)->data_type,
-                            src_md(1)->data_type, dst_md()->data_type)
-                    && IMPLICATION(data_type == bf16, mayiuse(avx512_core));
+                    && src_md(0)->data_type == src0_type
+                    && src_md(1)->data_type == src1_type
+                    && dst_md()->data_type == dst_type
+                    && IMPLICATION(
+                            utils::one_of(bf16, src0_type, src1_type, dst_type),
+                            mayiuse(avx512_core))
+                    && attr_ok();
             if (!ok) return status::unimplemented;
 
             return status::success;
         }
     };
 
-    ref_binary_t(const pd_t *apd) : primitive_impl_t(apd) {}
+    ref_binary_t(const pd_t *apd) : primitive_impl_t(apd) {
+        const auto &p = pd()->attr()->post_ops_;
+        for (int idx = 0; idx < post_ops_t::capacity; ++idx)
+            eltwises_[idx] = idx < p.len_ && p.entry_[idx].is_eltwise(false)
+                    ? new ref_eltwise_scalar_fwd_t(p.entry_[idx].eltwise)
+                    : nullptr;
+    }
 
-    ~ref_binary_t() {}
+    ~ref_binary_t() {
+        for (int idx = 0; idx < post_ops_t::capacity; ++idx)
+            delete eltwises_[idx];
+    }
 
-    typedef typename prec_traits<data_type>::type data_t;
+    typedef typename prec_traits<src0_type>::type src0_data_t;
+    typedef typename prec_traits<src1_type>::type src1_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_ref(ctx);
-        return status::success;
+        return execute_ref(ctx);
     }
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
-    void execute_ref(const exec_ctx_t &ctx) const;
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+
+    ref_eltwise_scalar_fwd_t *eltwises_[post_ops_t::capacity];
 };
 
 } // namespace cpu
@@ -160,12 +160,20 @@ struct ref_deconvolution_fwd_t : public primitive_impl_t {
                                                 ndims() - 3, ncw, nchw, ncdhw),
                                         utils::pick(ndims() - 3, nCw16c,
                                                 nChw16c, nCdhw16c)));
+                /* the post-ops are applied by the convolution, so the bias
+                 * has to be added there as well */
+                const bool conv_supports_post_ops
+                        = static_cast<cpu_convolution_bwd_data_pd_t *>(conv_pd_)
+                                  ->support_post_ops()
+                        && IMPLICATION(with_bias(), conv_supports_bias_);
                 bool ok = true
                         && conv_pd_->weights_md()->extra.flags == 0
                         /* deconv reference code can process only f32 bias */
                         && IMPLICATION(with_bias(),
                                 conv_supports_bias_
-                                        || ref_deconv_supports_bias);
+                                        || ref_deconv_supports_bias)
+                        && IMPLICATION(!attr()->post_ops_.has_default_values(),
+                                conv_supports_post_ops);
                 if (ok) return status::success;
 
                 delete conv_pd_;
@@ -179,8 +187,7 @@ struct ref_deconvolution_fwd_t : public primitive_impl_t {
             bool ok = true && is_fwd()
                     && utils::one_of(desc()->alg_kind,
                             alg_kind::deconvolution_direct,
-                            alg_kind::deconvolution_winograd)
-                    && attr()->post_ops_.has_default_values();
+                            alg_kind::deconvolution_winograd);
 
             if (ok) {
                 CHECK(init_convolution());
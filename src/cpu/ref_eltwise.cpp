@@ -89,8 +89,10 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_nCspBc_padded(
             case eltwise_linear: d = linear_fwd(s, alpha, beta); break;
             case eltwise_bounded_relu: d = bounded_relu_fwd(s, alpha); break;
             case eltwise_soft_relu: d = soft_relu_fwd(s); break;
-            case eltwise_logistic: d = logistic_fwd(s); break;
-            case eltwise_exp: d = exp_fwd(s); break;
+            case eltwise_logistic:
+            case eltwise_logistic_use_dst_for_bwd: d = logistic_fwd(s); break;
+            case eltwise_exp:
+            case eltwise_exp_use_dst_for_bwd: d = exp_fwd(s); break;
             default: assert(!"unknown eltwise alg_kind");
         }
     };
@@ -136,17 +138,23 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic(
         data_t s = src[d_off];
         data_t &d = dst[d_off];
         switch (alg_kind) {
-            case eltwise_relu: d = relu_fwd(s, alpha); break;
-            case eltwise_tanh: d = tanh_fwd(s); break;
-            case eltwise_elu: d = elu_fwd(s, alpha); break;
+            case eltwise_relu:
+            case eltwise_relu_use_dst_for_bwd: d = relu_fwd(s, alpha); break;
+            case eltwise_tanh:
+            case eltwise_tanh_use_dst_for_bwd: d = tanh_fwd(s); break;
+            case eltwise_elu:
+            case eltwise_elu_use_dst_for_bwd: d = elu_fwd(s, alpha); break;
             case eltwise_square: d = square_fwd(s); break;
             case eltwise_abs: d = abs_fwd(s); break;
-            case eltwise_sqrt: d = sqrt_fwd(s); break;
+            case eltwise_sqrt:
+            case eltwise_sqrt_use_dst_for_bwd: d = sqrt_fwd(s); break;
             case eltwise_linear: d = linear_fwd(s, alpha, beta); break;
             case eltwise_bounded_relu: d = bounded_relu_fwd(s, alpha); break;
             case eltwise_soft_relu: d = soft_relu_fwd(s); break;
-            case eltwise_logistic: d = logistic_fwd(s); break;
-            case eltwise_exp: d = exp_fwd(s); break;
+            case eltwise_logistic:
+            case eltwise_logistic_use_dst_for_bwd: d = logistic_fwd(s); break;
+            case eltwise_exp:
+            case eltwise_exp_use_dst_for_bwd: d = exp_fwd(s); break;
             case eltwise_gelu: d = gelu_fwd(s); break;
             case eltwise_swish: d = swish_fwd(s, alpha); break;
             default: assert(!"unknown eltwise alg_kind");
@@ -170,7 +178,7 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense(
     src += data_d.offset0();
     dst += data_d.offset0();
 
-    if (alg_kind == eltwise_relu) {
+    if (utils::one_of(alg_kind, eltwise_relu, eltwise_relu_use_dst_for_bwd)) {
         // a fast path for relu as the most popular activation
         parallel_nd(
                 nelems, [&](ptrdiff_t e) { dst[e] = relu_fwd(src[e], alpha); });
@@ -182,16 +190,21 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense(
         data_t &d = dst[e];
 
         switch (alg_kind) {
-            case eltwise_tanh: d = tanh_fwd(s); break;
-            case eltwise_elu: d = elu_fwd(s, alpha); break;
+            case eltwise_tanh:
+            case eltwise_tanh_use_dst_for_bwd: d = tanh_fwd(s); break;
+            case eltwise_elu:
+            case eltwise_elu_use_dst_for_bwd: d = elu_fwd(s, alpha); break;
             case eltwise_square: d = square_fwd(s); break;
             case eltwise_abs: d = abs_fwd(s); break;
-            case eltwise_sqrt: d = sqrt_fwd(s); break;
+            case eltwise_sqrt:
+            case eltwise_sqrt_use_dst_for_bwd: d = sqrt_fwd(s); break;
             case eltwise_linear: d = linear_fwd(s, alpha, beta); break;
             case eltwise_bounded_relu: d = bounded_relu_fwd(s, alpha); break;
             case eltwise_soft_relu: d = soft_relu_fwd(s); break;
-            case eltwise_logistic: d = logistic_fwd(s); break;
-            case eltwise_exp: d = exp_fwd(s); break;
+            case eltwise_logistic:
+            case eltwise_logistic_use_dst_for_bwd: d = logistic_fwd(s); break;
+            case eltwise_exp:
+            case eltwise_exp_use_dst_for_bwd: d = exp_fwd(s); break;
             case eltwise_gelu: d = gelu_fwd(s); break;
             case eltwise_swish: d = swish_fwd(s, alpha); break;
             default: assert(!"unknown eltwise alg_kind");
@@ -205,11 +218,12 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_generic(
     /* fast return */
     if (pd()->has_zero_dim_memory()) return;
 
-    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto src = CTX_IN_MEM(
+            const data_t *, pd()->use_dst() ? DNNL_ARG_DST : DNNL_ARG_SRC);
     auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
-    const memory_desc_wrapper data_d(pd()->src_md());
+    const memory_desc_wrapper data_d(pd()->data_md());
     const memory_desc_wrapper diff_data_d(pd()->diff_src_md());
 
     const int MB = pd()->MB();
@@ -246,6 +260,24 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_generic(
             case eltwise_exp: ds = exp_bwd(dd, s); break;
             case eltwise_gelu: ds = gelu_bwd(dd, s); break;
             case eltwise_swish: ds = swish_bwd(dd, s, alpha); break;
+            case eltwise_relu_use_dst_for_bwd:
+                ds = relu_bwd_use_dst(dd, s, alpha);
+                break;
+            case eltwise_tanh_use_dst_for_bwd:
+                ds = tanh_bwd_use_dst(dd, s);
+                break;
+            case eltwise_elu_use_dst_for_bwd:
+                ds = elu_bwd_use_dst(dd, s, alpha);
+                break;
+            case eltwise_sqrt_use_dst_for_bwd:
+                ds = sqrt_bwd_use_dst(dd, s);
+                break;
+            case eltwise_logistic_use_dst_for_bwd:
+                ds = logistic_bwd_use_dst(dd, s);
+                break;
+            case eltwise_exp_use_dst_for_bwd:
+                ds = exp_bwd_use_dst(dd, s);
+                break;
             default: assert(!"unknown eltwise alg_kind");
         }
     });
@@ -254,11 +286,12 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_generic(
 template <impl::data_type_t data_type>
 void ref_eltwise_bwd_t<data_type>::execute_backward_dense(
         const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto src = CTX_IN_MEM(
+            const data_t *, pd()->use_dst() ? DNNL_ARG_DST : DNNL_ARG_SRC);
     auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
-    const memory_desc_wrapper data_d(pd()->src_md());
+    const memory_desc_wrapper data_d(pd()->data_md());
     const memory_desc_wrapper diff_data_d(pd()->diff_src_md());
 
     const ptrdiff_t nelems = static_cast<ptrdiff_t>(data_d.nelems(true));
@@ -291,6 +324,24 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_dense(
             case eltwise_exp: ds = exp_bwd(dd, s); break;
             case eltwise_gelu: ds = gelu_bwd(dd, s); break;
             case eltwise_swish: ds = swish_bwd(dd, s, alpha); break;
+            case eltwise_relu_use_dst_for_bwd:
+                ds = relu_bwd_use_dst(dd, s, alpha);
+                break;
+            case eltwise_tanh_use_dst_for_bwd:
+                ds = tanh_bwd_use_dst(dd, s);
+                break;
+            case eltwise_elu_use_dst_for_bwd:
+                ds = elu_bwd_use_dst(dd, s, alpha);
+                break;
+            case eltwise_sqrt_use_dst_for_bwd:
+                ds = sqrt_bwd_use_dst(dd, s);
+                break;
+            case eltwise_logistic_use_dst_for_bwd:
+                ds = logistic_bwd_use_dst(dd, s);
+                break;
+            case eltwise_exp_use_dst_for_bwd:
+                ds = exp_bwd_use_dst(dd, s);
+                break;
             default: assert(!"unknown eltwise alg_kind");
         }
     });
@@ -127,7 +127,7 @@ struct ref_eltwise_bwd_t : public primitive_impl_t {
             if (!ok) return status::unimplemented;
 
             auto diff_dst_d = memory_desc_wrapper(diff_dst_md());
-            const bool same_fmt_ = diff_dst_d == memory_desc_wrapper(src_md());
+            const bool same_fmt_ = diff_dst_d == memory_desc_wrapper(data_md());
 
             use_dense_ = true && same_fmt_ && diff_dst_d.is_dense(true)
                     && is_zero_preserved() && !has_zero_dim_memory();
@@ -69,6 +69,7 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const auto &post_ops = pd()->attr()->post_ops_;
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -109,7 +110,15 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
             const size_t dst_off = dst_d.off_l(n * C + c),
                          src_off = src_d.off_l(n * C + c);
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            float d = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            for (int idx = 0; idx < post_ops.len_; ++idx) {
+                const auto &e = post_ops.entry_[idx];
+                if (e.is_sum(false))
+                    d += e.sum.scale * maybe_up_convert(dst[dst_off]);
+                else
+                    d = eltwises_[idx]->compute_scalar(d);
+            }
+            dst[dst_off] = d;
         }
 
         if (calculate_stats) {
@@ -171,7 +180,7 @@ void ref_layer_normalization_bwd_t<d_type>::execute_backward(
                          s_off = stat_d.off_l(n);
             float inv_sqrt_variance
                     = static_cast<float>(1.0f / sqrtf(variance[s_off] + eps));
-            data_t dd = maybe_up_convert(diff_dst[diff_dst_off]);
+            float dd = maybe_up_convert(diff_dst[diff_dst_off]);
             diff_gamma += (maybe_up_convert(src[src_off]) - mean[s_off]) * dd
                     * inv_sqrt_variance;
             diff_beta += dd;
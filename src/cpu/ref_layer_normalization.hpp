@@ -25,6 +25,7 @@
 
 #include "cpu_isa_traits.hpp"
 #include "cpu_layer_normalization_pd.hpp"
+#include "ref_eltwise.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -49,14 +50,25 @@ struct ref_layer_normalization_fwd_t : public primitive_impl_t {
                     && stat_md()->data_type == f32
                     && IMPLICATION(
                             use_scaleshift(), weights_md()->data_type == f32)
-                    && attr()->has_default_values();
+                    && attr_ok();
             if (!ok) return status::unimplemented;
 
             return status::success;
         }
     };
 
-    ref_layer_normalization_fwd_t(const pd_t *apd) : primitive_impl_t(apd) {}
+    ref_layer_normalization_fwd_t(const pd_t *apd) : primitive_impl_t(apd) {
+        const auto &p = pd()->attr()->post_ops_;
+        for (int idx = 0; idx < post_ops_t::capacity; ++idx)
+            eltwises_[idx] = idx < p.len_ && p.entry_[idx].is_eltwise(false)
+                    ? new ref_eltwise_scalar_fwd_t(p.entry_[idx].eltwise)
+                    : nullptr;
+    }
+
+    ~ref_layer_normalization_fwd_t() {
+        for (int idx = 0; idx < post_ops_t::capacity; ++idx)
+            delete eltwises_[idx];
+    }
 
     typedef typename prec_traits<d_type>::type data_t;
 
@@ -68,6 +80,8 @@ struct ref_layer_normalization_fwd_t : public primitive_impl_t {
 private:
     void execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    ref_eltwise_scalar_fwd_t *eltwises_[post_ops_t::capacity];
 };
 
 template <data_type_t d_type>
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+
+#include "simple_q10n.hpp"
+
+#include "ref_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+float init_value(alg_kind_t alg) {
+    using namespace alg_kind;
+    switch (alg) {
+        case reduction_max: return nstl::numeric_limits<float>::lowest();
+        case reduction_min: return nstl::numeric_limits<float>::max();
+        case reduction_mul: return 1.f;
+        default: return 0.f;
+    }
+}
+
+float accumulate(alg_kind_t alg, float acc, float x, float p) {
+    using namespace alg_kind;
+    switch (alg) {
+        case reduction_max: return nstl::max(acc, x);
+        case reduction_min: return nstl::min(acc, x);
+        case reduction_sum:
+        case reduction_mean: return acc + x;
+        case reduction_mul: return acc * x;
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum: {
+            const float ax = fabsf(x);
+            return acc + (p == 1.f ? ax : p == 2.f ? ax * ax : powf(ax, p));
+        }
+        default: assert(!"unknown reduction algorithm");
+    }
+    return NAN;
+}
+
+float finalize(alg_kind_t alg, float acc, dim_t reduce_size, float p,
+        float eps) {
+    using namespace alg_kind;
+    auto root_p = [&](float x) {
+        return p == 1.f ? x : p == 2.f ? sqrtf(x) : powf(x, 1.f / p);
+    };
+    switch (alg) {
+        case reduction_mean: return acc / reduce_size;
+        case reduction_norm_lp_max: return root_p(nstl::max(acc, eps));
+        case reduction_norm_lp_sum: return root_p(acc + eps);
+        case reduction_norm_lp_power_p_max: return nstl::max(acc, eps);
+        case reduction_norm_lp_power_p_sum: return acc + eps;
+        default: return acc;
+    }
+}
+} // namespace
+
+template <data_type_t src_type, data_type_t dst_type>
+void ref_reduction_t<src_type, dst_type>::execute_ref(
+        const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto alg = pd()->desc()->alg_kind;
+    const float p = pd()->desc()->p;
+    const float eps = pd()->desc()->eps;
+
+    const int ndims = pd()->ndims();
+    const dim_t reduce_size = pd()->reduce_size();
+
+    // the dst point is the origin of the reduced sub-tensor of src
+    dims_t reduce_dims;
+    for (int d = 0; d < ndims; ++d)
+        reduce_dims[d] = pd()->is_reduced(d) ? src_d.dims()[d] : 1;
+
+    auto l_to_pos = [&](dim_t l, const dims_t &dims, dims_t &pos) {
+        for (int d = ndims - 1; d >= 0; --d) {
+            pos[d] = l % dims[d];
+            l /= dims[d];
+        }
+    };
+
+    parallel_nd(dst_d.nelems(), [&](dim_t l) {
+        dims_t dst_pos, src_pos;
+        l_to_pos(l, dst_d.dims(), dst_pos);
+
+        float acc = init_value(alg);
+        for (dim_t r = 0; r < reduce_size; ++r) {
+            l_to_pos(r, reduce_dims, src_pos);
+            for (int d = 0; d < ndims; ++d)
+                src_pos[d] += dst_pos[d];
+            acc = accumulate(alg, acc, (float)src[src_d.off_v(src_pos)], p);
+        }
+
+        dst[dst_d.off_v(dst_pos)] = qz_a1b0<float, dst_data_t>()(
+                finalize(alg, acc, reduce_size, p, eps));
+    });
+}
+
+using namespace data_type;
+template struct ref_reduction_t<f32>;
+template struct ref_reduction_t<bf16>;
+template struct ref_reduction_t<bf16, f32>;
+template struct ref_reduction_t<s8>;
+template struct ref_reduction_t<s8, f32>;
+template struct ref_reduction_t<u8>;
+template struct ref_reduction_t<u8, f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "nstl.hpp"
+#include "resampling_utils.hpp"
+#include "type_helpers.hpp"
+
+#include "ref_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace resampling_utils;
+
+namespace {
+/* Returns the weight of the input point i in the output point o along a
+ * dimension with I input and O output points */
+float weight(alg_kind_t alg, dim_t o, dim_t i, dim_t O, dim_t I) {
+    if (alg == alg_kind::resampling_nearest)
+        return nearest_idx(o, O, I) == i ? 1.f : 0.f;
+
+    const linear_coeffs_t c(o, O, I);
+    return (c.idx[0] == i ? c.wei[0] : 0.f) + (c.idx[1] == i ? c.wei[1] : 0.f);
+}
+
+/* Returns a (conservative) range of the output points that may use the input
+ * point i, so that the backward pass can gather instead of scatter */
+void out_range(dim_t i, dim_t O, dim_t I, dim_t &beg, dim_t &end) {
+    beg = nstl::max((dim_t)0, (i - 1) * O / I - 1);
+    end = nstl::min(O, (i + 2) * O / I + 2);
+}
+} // namespace
+
+template <data_type_t data_type>
+void ref_resampling_fwd_t<data_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto alg = pd()->desc()->alg_kind;
+    const int ndims = pd()->ndims();
+
+    const dim_t MB = pd()->MB(), C = pd()->C();
+    const dim_t ID = pd()->ID(), IH = pd()->IH(), IW = pd()->IW();
+    const dim_t OD = pd()->OD(), OH = pd()->OH(), OW = pd()->OW();
+
+    auto get_off = [=](const memory_desc_wrapper &md, dim_t n, dim_t c,
+                           dim_t d, dim_t h, dim_t w) {
+        switch (ndims) {
+            case 5: return md.off(n, c, d, h, w);
+            case 4: return md.off(n, c, h, w);
+            default: return md.off(n, c, w);
+        }
+    };
+
+    parallel_nd(MB, C, OD, OH, OW,
+            [&](dim_t n, dim_t c, dim_t od, dim_t oh, dim_t ow) {
+                float res = 0.f;
+                if (alg == alg_kind::resampling_nearest) {
+                    const dim_t id = nearest_idx(od, OD, ID);
+                    const dim_t ih = nearest_idx(oh, OH, IH);
+                    const dim_t iw = nearest_idx(ow, OW, IW);
+                    res = src[get_off(src_d, n, c, id, ih, iw)];
+                } else {
+                    const linear_coeffs_t cd(od, OD, ID);
+                    const linear_coeffs_t ch(oh, OH, IH);
+                    const linear_coeffs_t cw(ow, OW, IW);
+                    for_(int i = 0; i < 2; ++i)
+                    for_(int j = 0; j < 2; ++j)
+                    for (int k = 0; k < 2; ++k) {
+                        const float s = src[get_off(src_d, n, c, cd.idx[i],
+                                ch.idx[j], cw.idx[k])];
+                        res += s * cd.wei[i] * ch.wei[j] * cw.wei[k];
+                    }
+                }
+                dst[get_off(dst_d, n, c, od, oh, ow)] = res;
+            });
+}
+
+template <data_type_t data_type>
+void ref_resampling_bwd_t<data_type>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    const auto alg = pd()->desc()->alg_kind;
+    const int ndims = pd()->ndims();
+
+    const dim_t MB = pd()->MB(), C = pd()->C();
+    const dim_t ID = pd()->ID(), IH = pd()->IH(), IW = pd()->IW();
+    const dim_t OD = pd()->OD(), OH = pd()->OH(), OW = pd()->OW();
+
+    auto get_off = [=](const memory_desc_wrapper &md, dim_t n, dim_t c,
+                           dim_t d, dim_t h, dim_t w) {
+        switch (ndims) {
+            case 5: return md.off(n, c, d, h, w);
+            case 4: return md.off(n, c, h, w);
+            default: return md.off(n, c, w);
+        }
+    };
+
+    parallel_nd(MB, C, ID, IH, IW,
+            [&](dim_t n, dim_t c, dim_t id, dim_t ih, dim_t iw) {
+                dim_t od_beg, od_end, oh_beg, oh_end, ow_beg, ow_end;
+                out_range(id, OD, ID, od_beg, od_end);
+                out_range(ih, OH, IH, oh_beg, oh_end);
+                out_range(iw, OW, IW, ow_beg, ow_end);
+
+                float res = 0.f;
+                for (dim_t od = od_beg; od < od_end; ++od) {
+                    const float wd = weight(alg, od, id, OD, ID);
+                    if (wd == 0.f) continue;
+                    for (dim_t oh = oh_beg; oh < oh_end; ++oh) {
+                        const float wh = weight(alg, oh, ih, OH, IH);
+                        if (wh == 0.f) continue;
+                        for (dim_t ow = ow_beg; ow < ow_end; ++ow) {
+                            const float ww = weight(alg, ow, iw, OW, IW);
+                            if (ww == 0.f) continue;
+                            const float dd = diff_dst[get_off(
+                                    diff_dst_d, n, c, od, oh, ow)];
+                            res += dd * wd * wh * ww;
+                        }
+                    }
+                }
+                diff_src[get_off(diff_src_d, n, c, id, ih, iw)] = res;
+            });
+}
+
+using namespace data_type;
+template struct ref_resampling_fwd_t<f32>;
+template struct ref_resampling_fwd_t<bf16>;
+template struct ref_resampling_bwd_t<f32>;
+template struct ref_resampling_bwd_t<bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_RESAMPLING_HPP
+#define CPU_REF_RESAMPLING_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "cpu_resampling_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <impl::data_type_t data_type>
+struct ref_resampling_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_resampling_fwd_t);
+
+        status_t init() {
+            bool ok = true
+                    && IMPLICATION(
+                            data_type == data_type::bf16, mayiuse(avx512_core))
+                    && set_default_params() == status::success && is_fwd()
+                    && utils::everyone_is(
+                            data_type, src_md()->data_type, dst_md()->data_type)
+                    && !has_zero_dim_memory() && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    ref_resampling_fwd_t(const pd_t *apd) : primitive_impl_t(apd) {}
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+};
+
+template <impl::data_type_t data_type>
+struct ref_resampling_bwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_resampling_bwd_t);
+
+        status_t init() {
+            bool ok = true
+                    && IMPLICATION(
+                            data_type == data_type::bf16, mayiuse(avx512_core))
+                    && set_default_params() == status::success && !is_fwd()
+                    && utils::everyone_is(data_type, diff_dst_md()->data_type,
+                            diff_src_md()->data_type)
+                    && !has_zero_dim_memory() && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    ref_resampling_bwd_t(const pd_t *apd) : primitive_impl_t(apd) {}
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
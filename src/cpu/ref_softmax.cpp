@@ -28,6 +28,9 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
+// The values are accumulated in f32. Logsoftmax computes
+// dst = src - max - log(sum(exp(src - max))) and
+// diff_src = diff_dst - exp(dst) * sum(diff_dst).
 template <impl::data_type_t data_type>
 void ref_softmax_fwd_t<data_type>::execute_forward_dense(
         const exec_ctx_t &ctx) const {
@@ -35,17 +38,30 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense(
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
     const auto ou_stride = pd()->outer_stride();
+    const bool is_log = pd()->is_logsoftmax();
 
     parallel_nd(outer_size_, [&](int ou) {
         const data_t *src_data = src + ou * ou_stride;
         data_t *dst_data = dst + ou * ou_stride;
-        data_t scalar = 0;
 
-        _max(channels_, src_data, &scalar);
-        _sub(channels_, scalar, src_data, dst_data);
-        _exp(channels_, dst_data, dst_data);
-        _sum(channels_, dst_data, &scalar);
-        _scal(channels_, data_t(1) / scalar, dst_data);
+        float max = -FLT_MAX;
+        for (int c = 0; c < channels_; c++)
+            max = nstl::max(max, (float)src_data[c]);
+
+        float sum = 0;
+        PRAGMA_OMP_SIMD(reduction(+ : sum))
+        for (int c = 0; c < channels_; c++)
+            sum += expf((float)src_data[c] - max);
+
+        if (is_log) {
+            const float shift = max + logf(sum);
+            for (int c = 0; c < channels_; c++)
+                dst_data[c] = (float)src_data[c] - shift;
+        } else {
+            const float scale = 1.f / sum;
+            for (int c = 0; c < channels_; c++)
+                dst_data[c] = expf((float)src_data[c] - max) * scale;
+        }
     });
 }
 
@@ -57,13 +73,14 @@ void ref_softmax_fwd_t<data_type>::execute_forward_generic(
 
     const memory_desc_wrapper data_d(pd()->src_md());
     const size_t dim = channels_ * inner_size_;
+    const bool is_log = pd()->is_logsoftmax();
 
     parallel_nd(outer_size_, [&](int ou) {
-        data_t space_max_val = 0, space_denom_val = 0;
-        data_t *space_max = &space_max_val, *space_denom = &space_denom_val;
+        float space_max_val = 0, space_denom_val = 0;
+        float *space_max = &space_max_val, *space_denom = &space_denom_val;
         if (inner_size_ > 1) {
             using namespace memory_tracking::names;
-            space_max = ctx.get_scratchpad_grantor().template get<data_t>(
+            space_max = ctx.get_scratchpad_grantor().template get<float>(
                                 key_softmax_reduction)
                     + ou * 2 * inner_size_;
             space_denom = space_max + inner_size_;
@@ -75,108 +92,35 @@ void ref_softmax_fwd_t<data_type>::execute_forward_generic(
         for (int c = 0; c < channels_; c++) {
             for (int in = 0; in < inner_size_; in++) {
                 size_t off = data_d.off_l(ou * dim + c * inner_size_ + in);
-                space_max[in] = nstl::max(space_max[in], src[off]);
+                space_max[in] = nstl::max(space_max[in], (float)src[off]);
             }
         }
 
         for (int c = 0; c < channels_; c++) {
             for (int in = 0; in < inner_size_; in++) {
                 size_t off = data_d.off_l(ou * dim + c * inner_size_ + in);
-                space_denom[in] += dst[off] = exp(src[off] - space_max[in]);
+                space_denom[in] += expf((float)src[off] - space_max[in]);
             }
         }
 
+        // the log (logsoftmax) or the inverse (softmax) of the denominator
+        for (int in = 0; in < inner_size_; in++)
+            space_denom[in] = is_log ? logf(space_denom[in])
+                                     : 1.f / space_denom[in];
+
         for (int c = 0; c < channels_; c++) {
             for (int in = 0; in < inner_size_; in++) {
                 size_t off = data_d.off_l(ou * dim + c * inner_size_ + in);
-                dst[off] /= space_denom[in];
+                const float s = (float)src[off] - space_max[in];
+                dst[off] = is_log ? s - space_denom[in]
+                                  : expf(s) * space_denom[in];
             }
         }
     });
 }
 
-template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::_max(
-        int n, const data_t *x, data_t *max_data) const {
-// Intel(R) C++ Compiler generates the maxps + shuffle pattern
-// for the max search which works faster
-#if !defined(__INTEL_COMPILER)
-    // The code below makes a compiler to generate maxps instruction
-    // rather than maxss, which is generated for the 'else' code path
-    auto max_wrapper = [](data_t a, data_t b) { return nstl::max(a, b); };
-    auto min_wrapper = [](int a, int b) { return nstl::min(a, b); };
-
-    constexpr int unroll_factor = 32;
-    data_t max_values[unroll_factor];
-
-    if (n < unroll_factor) {
-        data_t max_val = x[0];
-        for (int i = 1; i < n; i++) {
-            max_val = max_wrapper(max_val, x[i]);
-        }
-        max_data[0] = max_val;
-        return;
-    }
-    for (int i = 0; i < unroll_factor; i++) {
-        max_values[i] = x[i];
-    }
-    for (int i = unroll_factor; i < n; i += unroll_factor) {
-        int offset = min_wrapper(i, n - unroll_factor);
-        for (int j = 0; j < unroll_factor; j++) {
-            max_values[j] = max_wrapper(max_values[j], x[offset + j]);
-        }
-    }
-    data_t max_val = max_values[0];
-    for (int i = 1; i < unroll_factor; i++) {
-        max_val = max_wrapper(max_val, max_values[i]);
-    }
-    max_data[0] = max_val;
-#else
-    max_data[0] = x[0];
-    for (int c = 1; c < n; ++c)
-        max_data[0] = nstl::max(max_data[0], x[c]);
-#endif
-}
-
-template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::_sub(
-        int n, data_t alpha, const data_t *x, data_t *y) const {
-    constexpr int unroll_factor = 32;
-    int tail = n % unroll_factor;
-    for (int i = 0; i < n - tail; i += unroll_factor) {
-        PRAGMA_OMP_SIMD()
-        for (int j = 0; j < unroll_factor; j++) {
-            y[i + j] = x[i + j] - alpha;
-        }
-    }
-    PRAGMA_OMP_SIMD()
-    for (int i = n - tail; i < n; i++) {
-        y[i] = x[i] - alpha;
-    }
-}
-
-template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::_exp(
-        int n, const data_t *a, data_t *r) const {
-    parallel_nd(n, [&](int c) { r[c] = expf(a[c]); });
-}
-
-template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::_sum(
-        int n, const data_t *x, data_t *sum_data) const {
-    data_t tsum = static_cast<data_t>(0);
-    PRAGMA_OMP_SIMD(reduction(+ : tsum))
-    for (int c = 0; c < n; ++c)
-        tsum += x[c];
-    sum_data[0] = tsum;
-}
-
-template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::_scal(int n, data_t alpha, data_t *x) const {
-    parallel_nd(n, [&](int c) { x[c] *= alpha; });
-}
-
 template struct ref_softmax_fwd_t<data_type::f32>;
+template struct ref_softmax_fwd_t<data_type::bf16>;
 
 // softmax along last physical dimension
 template <impl::data_type_t data_type>
@@ -187,20 +131,21 @@ void ref_softmax_bwd_t<data_type>::execute_backward_dense(
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
 
     const auto ou_stride = pd()->outer_stride();
+    const bool is_log = pd()->is_logsoftmax();
 
     parallel_nd(outer_size_, [&](int ou) {
-        data_t sbr = 0;
+        float sbr = 0;
         size_t off = ou * ou_stride;
         for (int c = 0; c < channels_; ++c) {
             size_t loff = off + c;
-            data_t ldata = dst[loff];
-            sbr += diff_dst[loff] * ldata;
-            diff_src[loff] = ldata;
+            const float dd = diff_dst[loff];
+            sbr += is_log ? dd : dd * (float)dst[loff];
         }
 
         for (int c = 0; c < channels_; ++c) {
             size_t loff = off + c;
-            diff_src[loff] *= (diff_dst[loff] - sbr);
+            const float d = dst[loff], dd = diff_dst[loff];
+            diff_src[loff] = is_log ? dd - expf(d) * sbr : d * (dd - sbr);
         }
     });
 }
@@ -216,24 +161,29 @@ void ref_softmax_bwd_t<data_type>::execute_backward_generic(
     const memory_desc_wrapper data_d(pd()->dst_md());
 
     const size_t dim = channels_ * inner_size_;
+    const bool is_log = pd()->is_logsoftmax();
 
     parallel_nd(outer_size_, inner_size_, [&](int ou, int in) {
-        data_t sbr = 0;
+        float sbr = 0;
         for (int c = 0; c < channels_; ++c) {
             size_t off_diff = diff_d.off_l(ou * dim + c * inner_size_ + in);
             size_t off_data = data_d.off_l(ou * dim + c * inner_size_ + in);
-            sbr += diff_dst[off_diff] * dst[off_data];
+            const float dd = diff_dst[off_diff];
+            sbr += is_log ? dd : dd * (float)dst[off_data];
         }
 
         for (int c = 0; c < channels_; ++c) {
             size_t off_diff = diff_d.off_l(ou * dim + c * inner_size_ + in);
             size_t off_data = data_d.off_l(ou * dim + c * inner_size_ + in);
-            diff_src[off_diff] = dst[off_data] * (diff_dst[off_diff] - sbr);
+            const float d = dst[off_data], dd = diff_dst[off_diff];
+            diff_src[off_diff]
+                    = is_log ? dd - expf(d) * sbr : d * (dd - sbr);
         }
     });
 }
 
 template struct ref_softmax_bwd_t<data_type::f32>;
+template struct ref_softmax_bwd_t<data_type::bf16>;
 
 } // namespace cpu
 } // namespace impl
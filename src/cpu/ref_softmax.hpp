@@ -24,6 +24,7 @@
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
+#include "cpu_isa_traits.hpp"
 #include "cpu_softmax_pd.hpp"
 
 namespace dnnl {
@@ -39,6 +40,9 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
 
         status_t init() {
             bool ok = true && is_fwd() && src_md()->data_type == data_type
+                    /*bf16<->f32 cvt operators don't work on non-avx512_core*/
+                    && IMPLICATION(data_type == data_type::bf16,
+                            mayiuse(avx512_core))
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
@@ -55,7 +59,7 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
             if (in_s > 1) {
                 auto scratchpad = scratchpad_registry().registrar();
                 scratchpad.book(memory_tracking::names::key_softmax_reduction,
-                        sizeof(data_t) * 2 * in_s * ou_s);
+                        sizeof(float) * 2 * in_s * ou_s);
             }
         }
     };
@@ -93,12 +97,6 @@ private:
     void execute_forward_dense(const exec_ctx_t &ctx) const;
     void execute_forward_generic(const exec_ctx_t &ctx) const;
 
-    void _max(int n, const data_t *x, data_t *max_data) const;
-    void _sub(int n, data_t alpha, const data_t *x, data_t *y) const;
-    void _exp(int n, const data_t *a, data_t *r) const;
-    void _sum(int n, const data_t *x, data_t *sum_data) const;
-    void _scal(int n, data_t alpha, data_t *x) const;
-
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 
     bool use_dense_;
@@ -116,6 +114,9 @@ struct ref_softmax_bwd_t : public primitive_impl_t {
             bool ok = true && !is_fwd()
                     && utils::everyone_is(data_type, dst_md()->data_type,
                             diff_src_md()->data_type)
+                    /*bf16<->f32 cvt operators don't work on non-avx512_core*/
+                    && IMPLICATION(data_type == data_type::bf16,
+                            mayiuse(avx512_core))
                     && set_default_formats_common()
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
@@ -37,10 +37,39 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             1.0, w_iter_[0], rnn.weights_iter_ld, states_tm1_l_,
             rnn.states_ws_ld, 1.0, scratch_gates_, rnn.gates_ws_ld);
 
-    rnn_postgemm_->execute(rnn, ws_gates_, scratch_gates_, states_t_l_,
+    if (!rnn.is_lstm_projection) {
+        rnn_postgemm_->execute(rnn, ws_gates_, scratch_gates_, states_t_l_,
+                c_states_t_l_, states_tm1_l_, c_states_tm1_l_,
+                diff_states_t_l_, diff_states_t_lp1_, diff_states_tp1_l_,
+                bias_[0], ws_grid_, scratch_cell_, weights_peephole_);
+        return;
+    }
+
+    // With projection the postgemm writes the dic wide cell output to the
+    // scratch cell, and the projection GEMM computes the dhc wide hidden
+    // state from it. The f32 GEMM writes the hidden state directly, other
+    // data types go through an f32 buffer placed after the cell output.
+    src_data_t *proj_ht_ = (src_data_t *)scratch_cell_;
+    acc_data_t *proj_dst_ = src_type == data_type::f32
+            ? (acc_data_t *)states_t_l_
+            : (acc_data_t *)scratch_cell_ + rnn.states_nld * rnn.states_ws_ld;
+
+    rnn_postgemm_->execute(rnn, ws_gates_, scratch_gates_, proj_ht_,
             c_states_t_l_, states_tm1_l_, c_states_tm1_l_, diff_states_t_l_,
             diff_states_t_lp1_, diff_states_tp1_l_, bias_[0], ws_grid_,
-            scratch_cell_);
+            scratch_cell_, weights_peephole_);
+
+    gemm('N', 'N', rnn.dhc, rnn.mb, rnn.dic, 1.0, w_projection_, rnn.dhc,
+            proj_ht_, rnn.states_ws_ld, 0.0, proj_dst_, rnn.states_ws_ld);
+
+    if (src_type != data_type::f32) {
+        ws_states_aoc<src_data_t> states_t_l(rnn, states_t_l_);
+        ws_states_aoc<const acc_data_t> proj_dst(rnn, proj_dst_);
+        parallel_nd(rnn.mb, [&](int i) {
+            for (int j = 0; j < rnn.dhc; j++)
+                states_t_l(i, j) = proj_dst(i, j);
+        });
+    }
 }
 template rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution);
 template rnn_cell_execution_sig(ref_rnn_fwd_bf16_t::cell_execution);
@@ -64,7 +93,7 @@ void common_bwd_cell_exec_template(T1 gemm_layer_f, T2 gemm_iter_f,
     rnn_postgemm->execute(rnn, ws_gates_, scratch_gates_, states_t_l_,
             c_states_t_l_, states_tm1_l_, c_states_tm1_l_, diff_states_t_l_,
             diff_states_t_lp1_, diff_states_tp1_l_, bias_[0], ws_grid_,
-            scratch_cell_);
+            scratch_cell_, nullptr);
 
     /// bwd by data on the cell
     gemm_iter_f(w_iter_[0], scratch_gates_, diff_states_t_l_);
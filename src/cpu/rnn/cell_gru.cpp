@@ -57,7 +57,8 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     // 3. activation zt and rt + elemwise multiplication rt,ht-1
     rnn_postgemm_->execute(rnn, ws_gates_, scratch_gates_, states_t_l_,
             c_states_t_l_, states_tm1_l_, c_states_tm1_l_, diff_states_t_l_,
-            diff_states_t_lp1_, diff_states_tp1_l_, bias_[0], nullptr, nullptr);
+            diff_states_t_lp1_, diff_states_tp1_l_, bias_[0], nullptr, nullptr,
+            nullptr);
 
     // 4. gemm Wh[2],h~t
     (this->*gemm_iter_func)('N', 'N', rnn.dic, rnn.mb, rnn.sic, 1.0, w_iter_[1],
@@ -67,15 +68,13 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     // 5. activation h~t + calculate ht
     rnn_postgemm_->execute_part2(rnn, ws_gates_, scratch_gates_, states_t_l_,
             c_states_t_l_, states_tm1_l_, c_states_tm1_l_, diff_states_t_l_,
-            diff_states_t_lp1_, diff_states_tp1_l_, bias_[0], nullptr, nullptr);
+            diff_states_t_lp1_, diff_states_tp1_l_, bias_[0], nullptr, nullptr,
+            nullptr);
 }
 
 template rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution_gru);
 template rnn_cell_execution_sig(ref_rnn_fwd_bf16_t::cell_execution_gru);
-template <>
-rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru) {
-    assert(!"GRU int8 is not supported");
-}
+template rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru);
 
 template <typename T1, typename T2, typename T3, typename T4, typename T5,
         typename weights_data_t, typename src_data_t, typename acc_data_t,
@@ -108,7 +107,7 @@ void gru_bwd_cell_exec_template(T1 gemm_layer_f, T2 gemm_iter_f,
     // 1. calculate dG2, dG1, and part of dht-1
     rnn_postgemm_->execute(rnn, ws_gates_, scratch_gates_, states_t_l_, nullptr,
             states_tm1_l_, nullptr, diff_states_t_l_, diff_states_t_lp1_,
-            diff_states_tp1_l_, nullptr, nullptr, scratch_cell_);
+            diff_states_tp1_l_, nullptr, nullptr, scratch_cell_, nullptr);
 
     // 2. calculate intermediate d(hG1)
     // d(hG1) = dG2 * W2h^t
@@ -119,7 +118,7 @@ void gru_bwd_cell_exec_template(T1 gemm_layer_f, T2 gemm_iter_f,
     rnn_postgemm_->execute_part2(rnn, ws_gates_, scratch_gates_, states_t_l_,
             nullptr, states_tm1_l_, nullptr, diff_states_t_l_,
             diff_states_t_lp1_, diff_states_tp1_l_, nullptr, nullptr,
-            scratch_cell_);
+            scratch_cell_, nullptr);
 
     // 4. calculate diff weights
     // dWh1 += dG1 * h, dWh2 += dG2 * h, dWh3 += dG3 * (G1(*)h)
@@ -48,15 +48,12 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     rnn_postgemm_->execute(rnn, ws_gates_, scratch_gates_, states_t_l_,
             c_states_t_l_, states_tm1_l_, c_states_tm1_l_, diff_states_t_l_,
             diff_states_t_lp1_, diff_states_tp1_l_, bias_[0], ws_grid_,
-            scratch_cell_);
+            scratch_cell_, nullptr);
 }
 
 template rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution_gru_lbr);
 template rnn_cell_execution_sig(ref_rnn_fwd_bf16_t::cell_execution_gru_lbr);
-template <>
-rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru_lbr) {
-    assert(!"GRU LBR int8 is not supported");
-}
+template rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru_lbr);
 
 template <typename T1, typename T2, typename T3, typename T4, typename T5,
         typename weights_data_t, typename src_data_t, typename acc_data_t,
@@ -76,7 +73,7 @@ void common_bwd_cell_exec_template(T1 gemm_layer_f, T2 gemm_iter_f,
 
     rnn_postgemm->execute(rnn, ws_gates_, scratch_gates_, states_t_l_, nullptr,
             states_tm1_l_, nullptr, diff_states_t_l_, diff_states_t_lp1_,
-            diff_states_tp1_l_, bias_[0], ws_grid_, scratch_cell_);
+            diff_states_tp1_l_, bias_[0], ws_grid_, scratch_cell_, nullptr);
 
     if (!rnn.merge_gemm_layer) {
         //  dx = dG * Wx^t
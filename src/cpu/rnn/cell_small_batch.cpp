@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+ * Cell execution of LSTM and GRU for small batch inference
+ */
+
+#include "ref_rnn.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace rnn_utils;
+
+template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
+        data_type_t acc_type>
+rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
+        acc_type>::cell_execution_small_batch)) {
+    if (!rnn.merge_gemm_layer) {
+        (this->*gemm_layer_func)('N', 'N', rnn.n_gates * rnn.dic, rnn.mb,
+                rnn.slc, 1.0, w_layer_[0], rnn.weights_layer_ld, states_t_lm1_,
+                rnn.states_ws_ld, 0.0, scratch_gates_, rnn.gates_ws_ld);
+    }
+
+    if (pd()->cell_kind() == alg_kind::vanilla_lstm) {
+        small_batch_cell_->execute(rnn, 0, w_iter_[0], states_tm1_l_,
+                scratch_gates_, bias_[0], c_states_tm1_l_, states_t_l_,
+                c_states_t_l_);
+        return;
+    }
+
+    // GRU: the reset hidden state goes through the scratch cell, as the
+    // threads read all of it while the new hidden state is written
+    src_data_t *reset_states_ = (src_data_t *)scratch_cell_;
+    small_batch_cell_->execute(rnn, 0, w_iter_[0], states_tm1_l_,
+            scratch_gates_, bias_[0], states_tm1_l_, reset_states_, nullptr);
+    small_batch_cell_->execute(rnn, 1, w_iter_[1], reset_states_,
+            scratch_gates_, bias_[0], states_tm1_l_, states_t_l_, nullptr);
+}
+
+template rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution_small_batch);
+template rnn_cell_execution_sig(
+        ref_rnn_fwd_bf16_t::cell_execution_small_batch);
+
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_small_batch) {
+    assert(!"unsupported");
+}
+
+template <>
+rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_small_batch) {
+    assert(!"unsupported");
+}
+
+template <>
+rnn_cell_execution_sig(ref_rnn_bwd_bf16_t::cell_execution_small_batch) {
+    assert(!"unsupported");
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -33,6 +33,19 @@ namespace cpu {
 struct cpu_rnn_fwd_pd_t : public rnn_fwd_pd_t {
     using rnn_fwd_pd_t::rnn_fwd_pd_t;
 
+    virtual arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SEQ_LENGTHS && !is_training())
+            return arg_usage_t::input;
+
+        return rnn_fwd_pd_t::arg_usage(arg);
+    }
+
+    virtual bool is_optional_arg(int arg) const override {
+        if (arg == DNNL_ARG_SEQ_LENGTHS && !is_training()) return true;
+
+        return rnn_fwd_pd_t::is_optional_arg(arg);
+    }
+
 protected:
     status_t set_default_params() {
         using namespace format_tag;
@@ -48,6 +61,12 @@ protected:
             CHECK(memory_desc_init_by_tag(src_iter_c_md_, ldnc));
         if (with_bias() && bias_md_.format_kind == format_kind::any)
             CHECK(memory_desc_init_by_tag(bias_md_, ldgo));
+        if (with_peephole()
+                && weights_peephole_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(weights_peephole_md_, ldgo));
+        if (with_projection()
+                && weights_projection_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(weights_projection_md_, ldio));
         if (with_dst_iter() && dst_iter_md_.format_kind == format_kind::any)
             CHECK(memory_desc_init_by_tag(dst_iter_md_, ldnc));
         if (with_dst_iter_c() && dst_iter_c_md_.format_kind == format_kind::any)
@@ -97,7 +116,11 @@ protected:
 
         ok = ok
                 && IMPLICATION(!is_zero_md(&bias_md_),
-                        memory_desc_matches_tag(bias_md_, ldgo));
+                        memory_desc_matches_tag(bias_md_, ldgo))
+                && IMPLICATION(with_peephole(),
+                        memory_desc_matches_tag(weights_peephole_md_, ldgo))
+                && IMPLICATION(with_projection(),
+                        memory_desc_matches_tag(weights_projection_md_, ldio));
 
         /* Int8 is supported only for packed weights */
         data_type_t weights_iter_dt = weights_iter_md_.data_type;
@@ -0,0 +1,454 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_AVX512_CORE_RNN_SMALL_BATCH_CELL_HPP
+#define CPU_JIT_AVX512_CORE_RNN_SMALL_BATCH_CELL_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "utils.hpp"
+
+#include "../jit_avx512_core_bf16cvt.hpp"
+#include "../jit_generator.hpp"
+#include "../jit_uni_eltwise.hpp"
+
+#include "rnn_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Forward inference cell for a batch of a few rows.
+ *
+ * With such a batch the recurrent GEMM degenerates to a few GEMVs, and the
+ * time of a cell goes to the GEMM call overhead and to the round trip of the
+ * gates through the scratch gates. The kernel computes the recurrent product
+ * for a block of 16 columns of all the gates at once, keeps the accumulators
+ * in registers and applies the cell non-linearities before writing the new
+ * states. The accumulators start from the scratch gates, which hold the
+ * layer GEMM result.
+ *
+ * The vanilla GRU candidate gate needs the complete r * h_{t-1} vector, so
+ * that cell runs in two passes: the first one computes the update and reset
+ * gates, stores the update gate back to the scratch gates and r * h_{t-1}
+ * to the scratch cell, the second one computes the candidate gate and the
+ * new hidden state. */
+template <data_type_t src_type>
+struct jit_avx512_core_rnn_small_batch_cell_fwd_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_rnn_small_batch_cell_fwd_t)
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef jit_uni_eltwise_injector_f32<avx512_common> injector_t;
+
+    enum pass_t { lstm, gru_part1, gru_part2 };
+
+    static constexpr int simd_w = 16;
+    static constexpr int max_mb = rnn_utils::small_batch_cell_max_mb;
+
+    struct call_params_t {
+        const void *weights; // recurrent weights, first column of the block
+        const void *src_iter; // GEMV input, first element of the first row
+        float *gates; // scratch gates, first column of the block in gate 0
+        const float *bias; // bias, first column of the block in gate 0
+        const void *src_iter_j; // h_{t-1}, first column of the block (GRU)
+        void *dst_iter; // output state, first column of the block
+        const float *src_iter_c; // c_{t-1}, first column of the block (LSTM)
+        float *dst_iter_c; // c_t, first column of the block (LSTM)
+        size_t n_blocks; // number of full blocks
+        size_t tail; // non zero if the tail block has to be computed
+    };
+
+    jit_avx512_core_rnn_small_batch_cell_fwd_t(
+            const rnn_utils::rnn_conf_t &rnn, pass_t pass, int mb)
+        : pass_(pass)
+        , mb_(mb)
+        , dic_(rnn.dic)
+        , sic_(rnn.sic)
+        , tail_(rnn.dic % simd_w)
+        , weights_row_(rnn.weights_iter_ld * sizeof(src_data_t))
+        , states_row_(rnn.states_ws_ld * sizeof(src_data_t))
+        , c_states_row_(rnn.states_ws_ld * sizeof(float))
+        , gates_row_(rnn.gates_ws_ld * sizeof(float))
+        , sigmoid_injector_(nullptr)
+        , tanh_injector_(nullptr)
+        , bf16_emu_(nullptr) {
+        assert(mb > 0 && mb <= max_mb);
+        if (pass != gru_part2)
+            sigmoid_injector_ = new injector_t(this, alg_kind::eltwise_logistic,
+                    0.0f, 0.0f, 1.0f, false, rax);
+        if (pass != gru_part1)
+            tanh_injector_ = new injector_t(
+                    this, alg_kind::eltwise_tanh, 0.0f, 0.0f, 1.0f, false, rax);
+        if (src_type == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, reg_bf16_scratch,
+                    bf16_emu_reserv_4);
+        generate();
+        jit_ker = (void (*)(const call_params_t *))getCode();
+    }
+
+    ~jit_avx512_core_rnn_small_batch_cell_fwd_t() {
+        delete sigmoid_injector_;
+        delete tanh_injector_;
+        delete bf16_emu_;
+    }
+
+    void (*jit_ker)(const call_params_t *);
+
+private:
+    using Zmm = Xbyak::Zmm;
+    using Ymm = Xbyak::Ymm;
+    using Reg64 = Xbyak::Reg64;
+    using Address = Xbyak::Address;
+
+    const pass_t pass_;
+    const int mb_, dic_, sic_, tail_;
+    const size_t weights_row_, states_row_, c_states_row_, gates_row_;
+
+    injector_t *sigmoid_injector_;
+    injector_t *tanh_injector_;
+    bf16_emulation_t *bf16_emu_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_weights = r8;
+    Reg64 reg_src_iter = r9;
+    Reg64 reg_gates = r10;
+    Reg64 reg_bias = r11;
+    Reg64 reg_dst_iter = r12;
+    Reg64 reg_src_iter_j = r13; // h_{t-1} for GRU, c_{t-1} for LSTM
+    Reg64 reg_dst_iter_c = r14;
+    Reg64 reg_n_blocks = r15;
+    Reg64 reg_w = rsi;
+    Reg64 reg_h = rdx;
+    Reg64 reg_k = rbx;
+    Reg64 reg_bf16_scratch = abi_not_param1;
+    // rax holds the address of the eltwise injectors table
+
+    Xbyak::Opmask k_tail = k2;
+
+    /* Zmm0-4 are left to the injectors, the weights and the broadcasted
+     * states of the GEMV use Zmm0-7 */
+    Zmm vmm_tmp0 = Zmm(24);
+    Zmm vmm_tmp1 = Zmm(25);
+    Ymm ymm_bf16 = Ymm(26);
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+
+    static constexpr bool is_bf16 = src_type == data_type::bf16;
+
+    int n_gemv_gates() const {
+        return pass_ == lstm ? 4 : (pass_ == gru_part1 ? 2 : 1);
+    }
+    int first_gate() const { return pass_ == gru_part2 ? 2 : 0; }
+
+    Zmm vmm_wei(int g) const { return Zmm(g); }
+    Zmm vmm_src(int b) const { return Zmm(4 + b); }
+    int acc_idx(int g, int b) const { return 8 + g * max_mb + b; }
+    Zmm vmm_acc(int g, int b) const { return Zmm(acc_idx(g, b)); }
+
+    Zmm maybe_mask(Zmm z, bool is_tail) {
+        return is_tail ? z | k_tail | T_z : z;
+    }
+
+    void load_f32(Zmm z, const Address &addr, bool is_tail) {
+        vmovups(maybe_mask(z, is_tail), addr);
+    }
+
+    void store_f32(const Address &addr, Zmm z, bool is_tail) {
+        if (is_tail)
+            vmovups(addr | k_tail, z);
+        else
+            vmovups(addr, z);
+    }
+
+    void load_src(Zmm z, const Address &addr, bool is_tail) {
+        if (is_bf16) {
+            vpmovzxwd(maybe_mask(z, is_tail), addr);
+            vpslld(z, z, 16);
+        } else
+            load_f32(z, addr, is_tail);
+    }
+
+    void store_src(const Address &addr, Zmm z, bool is_tail) {
+        if (is_bf16) {
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(ymm_bf16, z);
+            else
+                vcvtneps2bf16(ymm_bf16, z);
+            if (is_tail)
+                vmovdqu16(addr | k_tail, ymm_bf16);
+            else
+                vmovups(addr, ymm_bf16);
+        } else
+            store_f32(addr, z, is_tail);
+    }
+
+    void apply(injector_t *injector, int g) {
+        injector->compute_vector_range(acc_idx(g, 0), acc_idx(g, 0) + mb_);
+    }
+
+    void compute_block(bool is_tail) {
+        using namespace Xbyak;
+        const int n_gates = n_gemv_gates();
+        const size_t gate_off = dic_ * sizeof(float);
+        const size_t wei_gate_off = dic_ * sizeof(src_data_t);
+        const size_t src_dt_size = sizeof(src_data_t);
+
+        // the accumulators start from the layer GEMM result
+        for (int g = 0; g < n_gates; g++)
+            for (int b = 0; b < mb_; b++)
+                load_f32(vmm_acc(g, b),
+                        ptr[reg_gates + b * gates_row_
+                                + (first_gate() + g) * gate_off],
+                        is_tail);
+
+        // recurrent GEMV
+        Label k_loop;
+        mov(reg_w, reg_weights);
+        mov(reg_h, reg_src_iter);
+        mov(reg_k, sic_);
+        L(k_loop);
+        {
+            for (int g = 0; g < n_gates; g++)
+                load_src(vmm_wei(g), ptr[reg_w + g * wei_gate_off], is_tail);
+            for (int b = 0; b < mb_; b++) {
+                if (is_bf16) {
+                    vpbroadcastw(vmm_src(b), ptr[reg_h + b * states_row_]);
+                    vpslld(vmm_src(b), vmm_src(b), 16);
+                    for (int g = 0; g < n_gates; g++)
+                        vfmadd231ps(vmm_acc(g, b), vmm_wei(g), vmm_src(b));
+                } else {
+                    for (int g = 0; g < n_gates; g++)
+                        vfmadd231ps(vmm_acc(g, b), vmm_wei(g),
+                                ptr_b[reg_h + b * states_row_]);
+                }
+            }
+            add(reg_w, weights_row_);
+            add(reg_h, src_dt_size);
+            dec(reg_k);
+            jnz(k_loop, T_NEAR);
+        }
+
+        // bias
+        for (int g = 0; g < n_gates; g++) {
+            load_f32(vmm_tmp0, ptr[reg_bias + (first_gate() + g) * gate_off],
+                    is_tail);
+            for (int b = 0; b < mb_; b++)
+                vaddps(vmm_acc(g, b), vmm_acc(g, b), vmm_tmp0);
+        }
+
+        switch (pass_) {
+            case lstm:
+                apply(sigmoid_injector_, 0);
+                apply(sigmoid_injector_, 1);
+                apply(tanh_injector_, 2);
+                apply(sigmoid_injector_, 3);
+                // c_t = f * c_{t-1} + i * c~
+                for (int b = 0; b < mb_; b++) {
+                    load_f32(vmm_tmp0, ptr[reg_src_iter_j + b * c_states_row_],
+                            is_tail);
+                    vmulps(vmm_acc(1, b), vmm_acc(1, b), vmm_tmp0);
+                    vfmadd231ps(vmm_acc(1, b), vmm_acc(0, b), vmm_acc(2, b));
+                    store_f32(ptr[reg_dst_iter_c + b * c_states_row_],
+                            vmm_acc(1, b), is_tail);
+                }
+                // h_t = o * tanh(c_t)
+                apply(tanh_injector_, 1);
+                for (int b = 0; b < mb_; b++) {
+                    vmulps(vmm_acc(3, b), vmm_acc(3, b), vmm_acc(1, b));
+                    store_src(ptr[reg_dst_iter + b * states_row_],
+                            vmm_acc(3, b), is_tail);
+                }
+                break;
+            case gru_part1:
+                apply(sigmoid_injector_, 0);
+                apply(sigmoid_injector_, 1);
+                for (int b = 0; b < mb_; b++) {
+                    // the update gate is kept for the second pass
+                    store_f32(ptr[reg_gates + b * gates_row_], vmm_acc(0, b),
+                            is_tail);
+                    load_src(vmm_tmp0, ptr[reg_src_iter_j + b * states_row_],
+                            is_tail);
+                    vmulps(vmm_acc(1, b), vmm_acc(1, b), vmm_tmp0);
+                    store_src(ptr[reg_dst_iter + b * states_row_],
+                            vmm_acc(1, b), is_tail);
+                }
+                break;
+            case gru_part2:
+                apply(tanh_injector_, 0);
+                // h_t = u * h_{t-1} + (1 - u) * c~ = c~ + u * (h_{t-1} - c~)
+                for (int b = 0; b < mb_; b++) {
+                    load_f32(vmm_tmp0, ptr[reg_gates + b * gates_row_],
+                            is_tail);
+                    load_src(vmm_tmp1, ptr[reg_src_iter_j + b * states_row_],
+                            is_tail);
+                    vsubps(vmm_tmp1, vmm_tmp1, vmm_acc(0, b));
+                    vfmadd231ps(vmm_acc(0, b), vmm_tmp0, vmm_tmp1);
+                    store_src(ptr[reg_dst_iter + b * states_row_],
+                            vmm_acc(0, b), is_tail);
+                }
+                break;
+            default: assert(!"unsupported pass");
+        }
+    }
+
+    void generate() {
+        using namespace Xbyak;
+#define GET_OFF(field) offsetof(call_params_t, field)
+        preamble();
+
+        mov(reg_weights, ptr[reg_param + GET_OFF(weights)]);
+        mov(reg_src_iter, ptr[reg_param + GET_OFF(src_iter)]);
+        mov(reg_gates, ptr[reg_param + GET_OFF(gates)]);
+        mov(reg_bias, ptr[reg_param + GET_OFF(bias)]);
+        mov(reg_dst_iter, ptr[reg_param + GET_OFF(dst_iter)]);
+        if (pass_ == lstm) {
+            mov(reg_src_iter_j, ptr[reg_param + GET_OFF(src_iter_c)]);
+            mov(reg_dst_iter_c, ptr[reg_param + GET_OFF(dst_iter_c)]);
+        } else
+            mov(reg_src_iter_j, ptr[reg_param + GET_OFF(src_iter_j)]);
+        mov(reg_n_blocks, ptr[reg_param + GET_OFF(n_blocks)]);
+
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+        // sigmoid and tanh share the same table
+        if (sigmoid_injector_)
+            sigmoid_injector_->load_table_addr();
+        else
+            tanh_injector_->load_table_addr();
+
+        Label block_loop, block_loop_end, tail_end;
+        L(block_loop);
+        {
+            cmp(reg_n_blocks, 0);
+            je(block_loop_end, T_NEAR);
+
+            compute_block(false);
+
+            const size_t c_step = simd_w * sizeof(float);
+            const size_t s_step = simd_w * sizeof(src_data_t);
+            add(reg_weights, s_step);
+            add(reg_gates, c_step);
+            add(reg_bias, c_step);
+            add(reg_dst_iter, s_step);
+            add(reg_src_iter_j, pass_ == lstm ? c_step : s_step);
+            if (pass_ == lstm) add(reg_dst_iter_c, c_step);
+
+            dec(reg_n_blocks);
+            jmp(block_loop, T_NEAR);
+        }
+        L(block_loop_end);
+
+        if (tail_ > 0) {
+            cmp(qword[reg_param + GET_OFF(tail)], 0);
+            je(tail_end, T_NEAR);
+            mov(reg_k.cvt32(), (1 << tail_) - 1);
+            kmovw(k_tail, reg_k.cvt32());
+            compute_block(true);
+            L(tail_end);
+        }
+
+        postamble();
+
+        if (sigmoid_injector_ && tanh_injector_) {
+            sigmoid_injector_->prepare_table(false);
+            tanh_injector_->prepare_table(true);
+        } else if (sigmoid_injector_)
+            sigmoid_injector_->prepare_table(true);
+        else
+            tanh_injector_->prepare_table(true);
+#undef GET_OFF
+    }
+};
+
+/* Owns the small batch kernels for every batch size up to rnn.mb, as the
+ * per-sample sequence lengths may shrink the batch of a cell, and splits the
+ * dic columns between the threads */
+template <data_type_t src_type>
+struct rnn_small_batch_cell_t {
+    typedef jit_avx512_core_rnn_small_batch_cell_fwd_t<src_type> kernel_t;
+    typedef typename kernel_t::src_data_t src_data_t;
+    typedef typename kernel_t::pass_t pass_t;
+
+    rnn_small_batch_cell_t(
+            const rnn_utils::rnn_conf_t &rnn, alg_kind_t cell_kind)
+        : n_passes_(cell_kind == alg_kind::vanilla_gru ? 2 : 1) {
+        for (int mb = 1; mb <= rnn.mb; mb++)
+            for (int p = 0; p < n_passes_; p++) {
+                pass_t pass = n_passes_ == 1 ? kernel_t::lstm
+                                             : (p == 0 ? kernel_t::gru_part1
+                                                       : kernel_t::gru_part2);
+                kernels_[mb - 1][p] = new kernel_t(rnn, pass, mb);
+            }
+    }
+
+    ~rnn_small_batch_cell_t() {
+        for (int mb = 0; mb < kernel_t::max_mb; mb++)
+            for (int p = 0; p < 2; p++)
+                delete kernels_[mb][p];
+    }
+
+    /* Runs the pass @p pass of the cell on the rnn.mb first rows.
+     * @p src_iter is the input of the GEMV, @p src_iter_j is h_{t-1}
+     * (GRU) or c_{t-1} (LSTM) and @p dst_iter_c is c_t (LSTM) */
+    void execute(const rnn_utils::rnn_conf_t &rnn, int pass,
+            const src_data_t *weights, const src_data_t *src_iter,
+            float *gates, const float *bias, const void *src_iter_j,
+            src_data_t *dst_iter, float *dst_iter_c) const {
+        const kernel_t *ker = kernels_[rnn.mb - 1][pass];
+        assert(ker != nullptr);
+        const bool is_lstm = n_passes_ == 1;
+        const size_t c_dt_size = is_lstm ? sizeof(float) : sizeof(src_data_t);
+        const int simd_w = kernel_t::simd_w;
+        const int n_full = rnn.dic / simd_w;
+        const int n_blocks = utils::div_up(rnn.dic, simd_w);
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            int start {0}, end {0};
+            balance211(n_blocks, nthr, ithr, start, end);
+            if (start >= end) return;
+
+            const size_t off = (size_t)start * simd_w;
+            typename kernel_t::call_params_t p;
+            p.weights = weights + off;
+            p.src_iter = src_iter;
+            p.gates = gates + off;
+            p.bias = bias + off;
+            p.src_iter_j = (const char *)src_iter_j + off * c_dt_size;
+            p.src_iter_c = (const float *)p.src_iter_j;
+            p.dst_iter = dst_iter + off;
+            p.dst_iter_c = is_lstm ? dst_iter_c + off : nullptr;
+            p.n_blocks = nstl::min(end, n_full) - start;
+            p.tail = end > n_full;
+            ker->jit_ker(&p);
+        });
+    }
+
+private:
+    int n_passes_;
+    kernel_t *kernels_[kernel_t::max_mb][2] = {{nullptr}};
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_GRU_CELL_POSTGEMM_PART1_BWD
+#define CPU_JIT_GRU_CELL_POSTGEMM_PART1_BWD
+
+#include "jit_uni_rnn_common_postgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <cpu_isa_t isa, impl::data_type_t src_data_t,
+        impl::data_type_t scratch_data_t>
+struct jit_uni_gru_cell_postgemm_part1_bwd : public jit_uni_rnn_postgemm {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gru_cell_postgemm_part1_bwd)
+
+    jit_uni_gru_cell_postgemm_part1_bwd(
+            const rnn_utils::rnn_conf_t &rnn, const rnn_pd_t *pd)
+        : jit_uni_rnn_postgemm(rnn, pd) {}
+
+    void init(data_type_t sdt) override {
+        jit_uni_rnn_postgemm::init(src_data_t);
+        generate();
+        kernel_ = (kernel_t)this->getCode();
+    }
+
+protected:
+    // register size in bytes
+    using Vmm = typename jit_uni_eltwise_injector_f32<isa>::Vmm;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+    size_t gate_dt_size = types::data_type_size(src_data_t);
+    size_t hstate_dt_size = types::data_type_size(src_data_t);
+    size_t scratch_dt_size = types::data_type_size(scratch_data_t);
+
+    Xbyak::Label table_label;
+
+    void generate() {
+        using namespace Xbyak;
+
+        // Labels declaration
+        Label vector_loop_start_label, vector_loop_end_label;
+        Label rem_loop_start_label, rem_loop_end_label;
+
+        // Register map
+        Reg64 loop_cnt(r11); // loop counter
+        Reg64 table_reg(rbx); // table of constants
+        Vmm dHt(1), G0(2), G2(3), h(4), tmp1_vmm(5), tmp2_vmm(6), one_vmm(7);
+
+        // We start code generations here
+        preamble();
+
+        // extract addresses passed as parameter
+        auto addr_ws_gates_reg = abi_param1;
+        auto addr_scratch_gates_reg = abi_param2;
+        auto addr_diff_states_t_lp1_reg = abi_param3;
+        auto addr_diff_states_tp1_l_reg = abi_param4;
+#ifdef _WIN32
+        auto addr_diff_states_t_l_reg = r12;
+        auto addr_states_tm1_l_reg = r10;
+        // Here we cannot use rbp to have initial stack pointer so we
+        // use rsp and offset it with the size of pushed registers in
+        // preamble
+        mov(addr_diff_states_t_l_reg,
+                ptr[rsp + get_size_of_abi_save_regs() + 40]);
+        mov(addr_states_tm1_l_reg, ptr[rsp + get_size_of_abi_save_regs() + 48]);
+#else
+        auto addr_diff_states_t_l_reg = abi_param5;
+        auto addr_states_tm1_l_reg = abi_param6;
+#endif
+
+        // helper lambda to address the gates
+        auto sg_addr = [&](int i) {
+            return ptr[addr_scratch_gates_reg + i * rnn_.dic * scratch_dt_size];
+        };
+        auto wg_addr = [&](int i) {
+            return ptr[addr_ws_gates_reg + i * rnn_.dic * gate_dt_size];
+        };
+
+        // initialize registers with addresses and constants
+        init_regs(vlen);
+        mov(table_reg, table_label);
+        uni_vmovups(one_vmm, ptr[table_reg]);
+
+        // the body of the loop, in_len is the size of the float data
+        // accessed at once
+        auto compute = [&](int in_len) {
+            // we have 2 incoming diffs on Ht
+            to_scratch<data_type::f32>(
+                    dHt, ptr[addr_diff_states_tp1_l_reg], in_len);
+            to_scratch<data_type::f32>(
+                    tmp1_vmm, ptr[addr_diff_states_t_lp1_reg], in_len);
+            uni_vaddps(dHt, dHt, tmp1_vmm);
+
+            to_scratch<src_data_t>(G0, wg_addr(0), in_len);
+            to_scratch<src_data_t>(G2, wg_addr(2), in_len);
+            to_scratch<src_data_t>(h, ptr[addr_states_tm1_l_reg], in_len);
+
+            // dG2 = (1 - G0) * dHt * (1 - G2^2)
+            uni_vmovups(tmp1_vmm, G2);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, G2);
+            uni_vmovups(tmp2_vmm, one_vmm);
+            uni_vsubps(tmp2_vmm, tmp2_vmm, tmp1_vmm);
+            uni_vmovups(tmp1_vmm, one_vmm);
+            uni_vsubps(tmp1_vmm, tmp1_vmm, G0);
+            uni_vmulps(tmp2_vmm, tmp2_vmm, tmp1_vmm);
+            uni_vmulps(tmp2_vmm, tmp2_vmm, dHt);
+            to_src<scratch_data_t>(sg_addr(2), tmp2_vmm, in_len);
+
+            // dG0 = (h - G2) * dHt * G0 * (1 - G0)
+            uni_vmulps(tmp1_vmm, tmp1_vmm, G0);
+            uni_vsubps(h, h, G2);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, h);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, dHt);
+            to_src<scratch_data_t>(sg_addr(0), tmp1_vmm, in_len);
+
+            // dht-1 (part) = dHt * G0
+            uni_vmulps(dHt, dHt, G0);
+            to_src<data_type::f32>(
+                    ptr[addr_diff_states_t_l_reg], dHt, in_len);
+        };
+
+        auto increment_addresses = [&](int n_elems) {
+            add(addr_ws_gates_reg, n_elems * gate_dt_size);
+            add(addr_scratch_gates_reg, n_elems * scratch_dt_size);
+            add(addr_diff_states_t_lp1_reg, n_elems * sizeof(float));
+            add(addr_diff_states_tp1_l_reg, n_elems * sizeof(float));
+            add(addr_diff_states_t_l_reg, n_elems * sizeof(float));
+            add(addr_states_tm1_l_reg, n_elems * hstate_dt_size);
+        };
+
+        mov(loop_cnt, rnn_.dic * sizeof(float));
+        cmp(loop_cnt, vlen);
+        jl(vector_loop_end_label, Xbyak::CodeGenerator::T_NEAR);
+
+        L(vector_loop_start_label);
+        {
+            compute(vlen);
+            increment_addresses(vlen / sizeof(float));
+
+            // increment loop counter
+            sub(loop_cnt, vlen);
+            cmp(loop_cnt, vlen);
+            jge(vector_loop_start_label);
+        }
+        L(vector_loop_end_label);
+
+        cmp(loop_cnt, 0);
+        je(rem_loop_end_label, Xbyak::CodeGenerator::T_NEAR);
+        // Same code as above, we just use vmovss for accessing inputs
+        L(rem_loop_start_label);
+        {
+            compute(sizeof(float));
+            increment_addresses(1);
+
+            // increment loop counter
+            sub(loop_cnt, sizeof(float));
+            cmp(loop_cnt, 0);
+            jg(rem_loop_start_label);
+        }
+        L(rem_loop_end_label);
+
+        postamble();
+
+        init_table(vlen);
+
+        align(64);
+        L(table_label);
+        {
+            for (size_t i = 0; i < vlen / sizeof(float); i++)
+                dd(float2int(1.0f));
+        }
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
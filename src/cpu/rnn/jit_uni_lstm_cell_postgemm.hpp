@@ -94,15 +94,23 @@ protected:
 #ifdef _WIN32
         auto addr_c_states_tm1_l_reg = r12;
         auto addr_c_states_t_l_reg = r10;
+        auto addr_weights_peephole_reg = rdi;
         // Here we cannot use rbp to have initial stack pointer so we
         // use rsp and offset it with the size of pushed registers in
         // preamble
         mov(addr_c_states_tm1_l_reg,
                 ptr[rsp + get_size_of_abi_save_regs() + 40]);
         mov(addr_c_states_t_l_reg, ptr[rsp + get_size_of_abi_save_regs() + 48]);
+        if (rnn_.is_lstm_peephole)
+            mov(addr_weights_peephole_reg,
+                    ptr[rsp + get_size_of_abi_save_regs() + 56]);
 #else
         auto addr_c_states_tm1_l_reg = abi_param5;
         auto addr_c_states_t_l_reg = abi_param6;
+        auto addr_weights_peephole_reg = r10;
+        if (rnn_.is_lstm_peephole)
+            mov(addr_weights_peephole_reg,
+                    ptr[rsp + get_size_of_abi_save_regs() + 8]);
 #endif
 
         // helper lambda to address the gates and biases
@@ -116,6 +124,10 @@ protected:
         auto B_addr = [&](int i) {
             return ptr[addr_bias_reg + i * rnn_.dic * bias_dt_size];
         };
+        auto wp_addr = [&](int i) {
+            return ptr[addr_weights_peephole_reg
+                    + i * rnn_.dic * sizeof(float)];
+        };
 
         // initialize registers with addresses and constants
         init_regs(vlen);
@@ -153,18 +165,30 @@ protected:
             uni_vmovups(tmp1_vmm, B_addr(3));
             uni_vaddps(G3, G3, tmp1_vmm);
 
-            // inject eltwise code
+            // add the peephole contributions of c_tm1 to the i and f gates
+            if (rnn_.is_lstm_peephole) {
+                uni_vmovups(tmp1_vmm, ptr[addr_c_states_tm1_l_reg]);
+                uni_vmovups(tmp2_vmm, wp_addr(0));
+                uni_vfmadd231ps(G0, tmp1_vmm, tmp2_vmm);
+                uni_vmovups(tmp2_vmm, wp_addr(1));
+                uni_vfmadd231ps(G1, tmp1_vmm, tmp2_vmm);
+            }
+
+            // inject eltwise code, the output gate waits for c_t with
+            // peephole
             sigmoid_injector_->compute_vector(G0.getIdx());
             sigmoid_injector_->compute_vector(G1.getIdx());
             tanh_injector_->compute_vector(G2.getIdx());
-            sigmoid_injector_->compute_vector(G3.getIdx());
+            if (!rnn_.is_lstm_peephole)
+                sigmoid_injector_->compute_vector(G3.getIdx());
 
             // if training we write back the gates
             if (is_training) {
                 to_src<src_data_t>(wg_addr(0), G0, vlen);
                 to_src<src_data_t>(wg_addr(1), G1, vlen);
                 to_src<src_data_t>(wg_addr(2), G2, vlen);
-                to_src<src_data_t>(wg_addr(3), G3, vlen);
+                if (!rnn_.is_lstm_peephole)
+                    to_src<src_data_t>(wg_addr(3), G3, vlen);
             }
 
             // compute c_states_t_l = G1 * c_tm1_l + G0 * G2
@@ -173,6 +197,14 @@ protected:
             uni_vfmadd231ps(tmp1_vmm, G0, G2);
             uni_vmovups(ptr[addr_c_states_t_l_reg], tmp1_vmm);
 
+            // with peephole the output gate depends on c_states_t_l
+            if (rnn_.is_lstm_peephole) {
+                uni_vmovups(tmp2_vmm, wp_addr(2));
+                uni_vfmadd231ps(G3, tmp1_vmm, tmp2_vmm);
+                sigmoid_injector_->compute_vector(G3.getIdx());
+                if (is_training) to_src<src_data_t>(wg_addr(3), G3, vlen);
+            }
+
             // states_t_l = G3 * tanh(c_states_t_l)
             tanh_injector_->compute_vector(tmp1_vmm.getIdx());
             uni_vmulps(tmp1_vmm, tmp1_vmm, G3);
@@ -186,6 +218,7 @@ protected:
             add(addr_states_t_l_reg, vlen_dst);
             add(addr_c_states_tm1_l_reg, vlen);
             add(addr_c_states_t_l_reg, vlen);
+            if (rnn_.is_lstm_peephole) add(addr_weights_peephole_reg, vlen);
             if (is_training) add(addr_ws_gates_reg, vlen_dst);
             inc_regs(vlen);
 
@@ -225,18 +258,30 @@ protected:
             uni_vmovss(tmp1_vmm, B_addr(3));
             uni_vaddps(G3, G3, tmp1_vmm);
 
-            // inject eltwise code
+            // add the peephole contributions of c_tm1 to the i and f gates
+            if (rnn_.is_lstm_peephole) {
+                uni_vmovss(tmp1_vmm, ptr[addr_c_states_tm1_l_reg]);
+                uni_vmovss(tmp2_vmm, wp_addr(0));
+                uni_vfmadd231ps(G0, tmp1_vmm, tmp2_vmm);
+                uni_vmovss(tmp2_vmm, wp_addr(1));
+                uni_vfmadd231ps(G1, tmp1_vmm, tmp2_vmm);
+            }
+
+            // inject eltwise code, the output gate waits for c_t with
+            // peephole
             sigmoid_injector_->compute_vector(G0.getIdx());
             sigmoid_injector_->compute_vector(G1.getIdx());
             tanh_injector_->compute_vector(G2.getIdx());
-            sigmoid_injector_->compute_vector(G3.getIdx());
+            if (!rnn_.is_lstm_peephole)
+                sigmoid_injector_->compute_vector(G3.getIdx());
 
             // if training we write back the gates
             if (is_training) {
                 to_src<src_data_t>(wg_addr(0), G0, scratch_dt_size);
                 to_src<src_data_t>(wg_addr(1), G1, scratch_dt_size);
                 to_src<src_data_t>(wg_addr(2), G2, scratch_dt_size);
-                to_src<src_data_t>(wg_addr(3), G3, scratch_dt_size);
+                if (!rnn_.is_lstm_peephole)
+                    to_src<src_data_t>(wg_addr(3), G3, scratch_dt_size);
             }
 
             // compute c_states_t_l = G1 * c_tm1_l + G0 * G2
@@ -245,6 +290,15 @@ protected:
             uni_vfmadd231ps(tmp1_vmm, G0, G2);
             uni_vmovss(ptr[addr_c_states_t_l_reg], tmp1_vmm);
 
+            // with peephole the output gate depends on c_states_t_l
+            if (rnn_.is_lstm_peephole) {
+                uni_vmovss(tmp2_vmm, wp_addr(2));
+                uni_vfmadd231ps(G3, tmp1_vmm, tmp2_vmm);
+                sigmoid_injector_->compute_vector(G3.getIdx());
+                if (is_training)
+                    to_src<src_data_t>(wg_addr(3), G3, scratch_dt_size);
+            }
+
             // states_t_l = G3 * tanh(c_states_t_l)
             tanh_injector_->compute_vector(tmp1_vmm.getIdx());
             uni_vmulps(tmp1_vmm, tmp1_vmm, G3);
@@ -259,6 +313,8 @@ protected:
             add(addr_states_t_l_reg, hstate_dt_size);
             add(addr_c_states_tm1_l_reg, cstate_dt_size);
             add(addr_c_states_t_l_reg, cstate_dt_size);
+            if (rnn_.is_lstm_peephole)
+                add(addr_weights_peephole_reg, sizeof(float));
             if (is_training) add(addr_ws_gates_reg, gate_dt_size);
             inc_regs(qscale_dt_size);
 
@@ -0,0 +1,250 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_LSTM_CELL_POSTGEMM_BWD
+#define CPU_JIT_LSTM_CELL_POSTGEMM_BWD
+
+#include "jit_uni_rnn_common_postgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <cpu_isa_t isa, impl::data_type_t src_data_t,
+        impl::data_type_t scratch_data_t>
+struct jit_uni_lstm_cell_postgemm_bwd : public jit_uni_rnn_postgemm {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_lstm_cell_postgemm_bwd)
+
+    typedef typename utils::conditional<isa == avx512_core,
+            jit_uni_eltwise_injector_f32<avx512_common>,
+            jit_uni_eltwise_injector_f32<isa>>::type injector_t;
+
+    jit_uni_lstm_cell_postgemm_bwd(
+            const rnn_utils::rnn_conf_t &rnn, const rnn_pd_t *pd)
+        : jit_uni_rnn_postgemm(rnn, pd) {}
+
+    ~jit_uni_lstm_cell_postgemm_bwd() { delete tanh_injector_; }
+
+    void init(data_type_t sdt) override {
+        jit_uni_rnn_postgemm::init(src_data_t);
+        tanh_injector_ = new injector_t(
+                this, alg_kind::eltwise_tanh, 0.0f, 0.0f, 1.0f, true, rax);
+        generate();
+        kernel_ = (kernel_t)this->getCode();
+    }
+
+protected:
+    injector_t *tanh_injector_;
+
+    // register size in bytes
+    using Vmm = typename jit_uni_eltwise_injector_f32<isa>::Vmm;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+    size_t gate_dt_size = types::data_type_size(src_data_t);
+    size_t scratch_dt_size = types::data_type_size(scratch_data_t);
+
+    Xbyak::Label table_label;
+
+    void generate() {
+        using namespace Xbyak;
+
+        // Labels declaration
+        Label vector_loop_start_label, vector_loop_end_label;
+        Label rem_loop_start_label, rem_loop_end_label;
+
+        // Register map
+        Reg64 loop_cnt(r11); // loop counter
+        Reg64 table_reg(rbx); // table of constants
+        Reg64 diff_states_stride_reg(r15);
+        // We skip vmm0 as it can be used by the injector for masks on sse4.1
+        Vmm dHt(1), dCt(2), tanhCt(3), G(4), G2(5), tmp1_vmm(6), tmp2_vmm(7),
+                one_vmm(8);
+
+        // We start code generations here
+        preamble();
+
+        // extract addresses passed as parameter
+        auto addr_ws_gates_reg = abi_param1;
+        auto addr_scratch_gates_reg = abi_param2;
+        auto addr_diff_states_t_lp1_reg = abi_param3;
+        auto addr_diff_states_tp1_l_reg = abi_param4;
+#ifdef _WIN32
+        auto addr_diff_states_t_l_reg = r12;
+        auto addr_c_states_tm1_l_reg = r10;
+        auto addr_c_states_t_l_reg = rdi;
+        // Here we cannot use rbp to have initial stack pointer so we
+        // use rsp and offset it with the size of pushed registers in
+        // preamble
+        mov(addr_diff_states_t_l_reg,
+                ptr[rsp + get_size_of_abi_save_regs() + 40]);
+        mov(addr_c_states_tm1_l_reg,
+                ptr[rsp + get_size_of_abi_save_regs() + 48]);
+        mov(addr_c_states_t_l_reg, ptr[rsp + get_size_of_abi_save_regs() + 56]);
+#else
+        auto addr_diff_states_t_l_reg = abi_param5;
+        auto addr_c_states_tm1_l_reg = abi_param6;
+        auto addr_c_states_t_l_reg = r10;
+        mov(addr_c_states_t_l_reg, ptr[rsp + get_size_of_abi_save_regs() + 8]);
+#endif
+
+        // helper lambda to address the gates
+        auto sg_addr = [&](int i) {
+            return ptr[addr_scratch_gates_reg + i * rnn_.dic * scratch_dt_size];
+        };
+        auto wg_addr = [&](int i) {
+            return ptr[addr_ws_gates_reg + i * rnn_.dic * gate_dt_size];
+        };
+
+        // the diff of the cell state follows the diff of the hidden state
+        auto dHt_tp1_addr = ptr[addr_diff_states_tp1_l_reg];
+        auto dCt_tp1_addr
+                = ptr[addr_diff_states_tp1_l_reg + diff_states_stride_reg];
+        auto dCt_tm1_addr
+                = ptr[addr_diff_states_t_l_reg + diff_states_stride_reg];
+
+        // initialize registers with addresses and constants
+        init_regs(vlen);
+        tanh_injector_->load_table_addr();
+        mov(diff_states_stride_reg, diff_states_stride());
+        mov(table_reg, table_label);
+        uni_vmovups(one_vmm, ptr[table_reg]);
+
+        // the body of the loop, in_len is the size of the float data
+        // accessed at once
+        auto compute = [&](int in_len) {
+            // we have 2 incoming diffs on Ht
+            to_scratch<data_type::f32>(dHt, dHt_tp1_addr, in_len);
+            to_scratch<data_type::f32>(
+                    tmp1_vmm, ptr[addr_diff_states_t_lp1_reg], in_len);
+            uni_vaddps(dHt, dHt, tmp1_vmm);
+
+            // TODO: save tanh(Ct) in the workspace in fwd pass
+            to_scratch<data_type::f32>(
+                    tanhCt, ptr[addr_c_states_t_l_reg], in_len);
+            tanh_injector_->compute_vector(tanhCt.getIdx());
+
+            // dCt = dCt_tp1 + (1 - tanhCt^2) * G3 * dHt
+            to_scratch<src_data_t>(G, wg_addr(3), in_len);
+            uni_vmovups(tmp1_vmm, tanhCt);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, tanhCt);
+            uni_vmovups(tmp2_vmm, one_vmm);
+            uni_vsubps(tmp2_vmm, tmp2_vmm, tmp1_vmm);
+            uni_vmulps(tmp2_vmm, tmp2_vmm, G);
+            uni_vmulps(tmp2_vmm, tmp2_vmm, dHt);
+            to_scratch<data_type::f32>(dCt, dCt_tp1_addr, in_len);
+            uni_vaddps(dCt, dCt, tmp2_vmm);
+
+            // dG3 = tanhCt * dHt * G3 * (1 - G3)
+            uni_vmovups(tmp1_vmm, one_vmm);
+            uni_vsubps(tmp1_vmm, tmp1_vmm, G);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, G);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, tanhCt);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, dHt);
+            to_src<scratch_data_t>(sg_addr(3), tmp1_vmm, in_len);
+
+            // dCt_tm1 = dCt * G1
+            // dG1 = c_tm1 * dCt * G1 * (1 - G1)
+            to_scratch<src_data_t>(G, wg_addr(1), in_len);
+            uni_vmovups(tmp1_vmm, G);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, dCt);
+            uni_vmovups(tmp2_vmm, one_vmm);
+            uni_vsubps(tmp2_vmm, tmp2_vmm, G);
+            uni_vmulps(tmp2_vmm, tmp2_vmm, tmp1_vmm);
+            to_src<data_type::f32>(dCt_tm1_addr, tmp1_vmm, in_len);
+            to_scratch<data_type::f32>(
+                    tmp1_vmm, ptr[addr_c_states_tm1_l_reg], in_len);
+            uni_vmulps(tmp2_vmm, tmp2_vmm, tmp1_vmm);
+            to_src<scratch_data_t>(sg_addr(1), tmp2_vmm, in_len);
+
+            // dG0 = G2 * dCt * G0 * (1 - G0)
+            to_scratch<src_data_t>(G, wg_addr(0), in_len);
+            to_scratch<src_data_t>(G2, wg_addr(2), in_len);
+            uni_vmovups(tmp1_vmm, one_vmm);
+            uni_vsubps(tmp1_vmm, tmp1_vmm, G);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, G);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, G2);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, dCt);
+            to_src<scratch_data_t>(sg_addr(0), tmp1_vmm, in_len);
+
+            // dG2 = G0 * dCt * (1 - G2^2)
+            uni_vmulps(G2, G2, G2);
+            uni_vmovups(tmp1_vmm, one_vmm);
+            uni_vsubps(tmp1_vmm, tmp1_vmm, G2);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, G);
+            uni_vmulps(tmp1_vmm, tmp1_vmm, dCt);
+            to_src<scratch_data_t>(sg_addr(2), tmp1_vmm, in_len);
+        };
+
+        auto increment_addresses = [&](int n_elems) {
+            add(addr_ws_gates_reg, n_elems * gate_dt_size);
+            add(addr_scratch_gates_reg, n_elems * scratch_dt_size);
+            add(addr_diff_states_t_lp1_reg, n_elems * sizeof(float));
+            add(addr_diff_states_tp1_l_reg, n_elems * sizeof(float));
+            add(addr_diff_states_t_l_reg, n_elems * sizeof(float));
+            add(addr_c_states_tm1_l_reg, n_elems * sizeof(float));
+            add(addr_c_states_t_l_reg, n_elems * sizeof(float));
+        };
+
+        mov(loop_cnt, rnn_.dic * sizeof(float));
+        cmp(loop_cnt, vlen);
+        jl(vector_loop_end_label, Xbyak::CodeGenerator::T_NEAR);
+
+        L(vector_loop_start_label);
+        {
+            compute(vlen);
+            increment_addresses(vlen / sizeof(float));
+
+            // increment loop counter
+            sub(loop_cnt, vlen);
+            cmp(loop_cnt, vlen);
+            jge(vector_loop_start_label);
+        }
+        L(vector_loop_end_label);
+
+        cmp(loop_cnt, 0);
+        je(rem_loop_end_label, Xbyak::CodeGenerator::T_NEAR);
+        // Same code as above, we just use vmovss for accessing inputs
+        L(rem_loop_start_label);
+        {
+            compute(sizeof(float));
+            increment_addresses(1);
+
+            // increment loop counter
+            sub(loop_cnt, sizeof(float));
+            cmp(loop_cnt, 0);
+            jg(rem_loop_start_label);
+        }
+        L(rem_loop_end_label);
+
+        postamble();
+
+        tanh_injector_->prepare_table();
+
+        init_table(vlen);
+
+        align(64);
+        L(table_label);
+        {
+            for (size_t i = 0; i < vlen / sizeof(float); i++)
+                dd(float2int(1.0f));
+        }
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -86,6 +86,37 @@ struct jit_uni_rnn_postgemm : public jit_generator {
         utils::array_offset_calculator<src_data_t, 2> ws_Wh_b(
                 ws_grid_, rnn.mb, rnn.dic);
 
+        if (!pd_->is_fwd()) {
+            rnn_utils::ws_diff_states_aoc<acc_data_t> diff_states_t_l(
+                    rnn, diff_states_t_l_);
+            rnn_utils::ws_diff_states_aoc<acc_data_t> diff_states_t_lp1(
+                    rnn, diff_states_t_lp1_);
+            rnn_utils::ws_diff_states_aoc<acc_data_t> diff_states_tp1_l(
+                    rnn, diff_states_tp1_l_);
+            rnn_utils::ws_states_aoc<scratch_data_t> hG1(rnn, scratch_cell_);
+
+            // The kernels reach the other states of the diff states
+            // through a stride, see diff_states_stride()
+            parallel_nd(rnn.mb, [&](int i) {
+                void *param1_ = &ws_gates(i, 0, 0);
+                void *param2_ = &scratch_gates(i, 0, 0);
+                const void *param3_ = &diff_states_t_lp1(rnn.n_states, i, 0);
+                void *param4_ = &diff_states_tp1_l(0, i, 0);
+                void *param5_ = &diff_states_t_l(0, i, 0);
+                void *param6_, *param7_;
+                if (pd_->cell_kind() == alg_kind::vanilla_lstm) {
+                    param6_ = &c_states_tm1_l(i, 0);
+                    param7_ = &c_states_t_l(i, 0);
+                } else {
+                    param6_ = &states_tm1_l(i, 0);
+                    param7_ = &hG1(i, 0);
+                }
+                kernel_(param1_, param2_, param3_, param4_, param5_, param6_,
+                        param7_);
+            });
+            return;
+        }
+
         // Todo: add parallelization on dic for the batch 1 case
         // Assumption: the kernel runs a loop on dic elements
         parallel_nd(rnn.mb, [&](int i) {
@@ -98,7 +129,7 @@ struct jit_uni_rnn_postgemm : public jit_generator {
                 case alg_kind::vanilla_lstm:
                     param5_ = &c_states_tm1_l(i, 0);
                     param6_ = &c_states_t_l(i, 0);
-                    param7_ = nullptr;
+                    param7_ = (void *)weights_peephole_;
                     break;
                 case alg_kind::lbr_gru:
                     param5_ = &states_tm1_l(i, 0);
@@ -195,6 +226,12 @@ protected:
         }
     }
 
+    // distance in bytes between two consecutive states of the diff states
+    size_t diff_states_stride() const {
+        return (size_t)(rnn_.n_iter + 1) * rnn_.states_nld * rnn_.states_ws_ld
+                * sizeof(float);
+    }
+
     void inc_regs(size_t vlen) {
         if (pd_->weights_md()->data_type == data_type::s8) {
             int mask = pd_->attr()->rnn_weights_qparams_.mask_;
@@ -280,6 +317,27 @@ protected:
 #endif
     }
 
+    // dequantize from u8 to float
+    template <typename Vmm>
+    void deq_h(Vmm dst, Xbyak::Address src, int in_len) {
+        if (in_len == 4) {
+            Xbyak::Xmm dst_xmm(dst.getIdx());
+            if (mayiuse(avx)) {
+                vpinsrb(dst_xmm, dst_xmm, src, 0x0);
+                vpmovzxbd(dst_xmm, dst_xmm);
+            } else {
+                pinsrb(dst_xmm, src, 0x0);
+                pmovzxbd(dst_xmm, dst_xmm);
+            }
+        } else if (mayiuse(avx))
+            vpmovzxbd(dst, src);
+        else
+            pmovzxbd(dst, src);
+        uni_vcvtdq2ps(dst, dst);
+        uni_vsubps(dst, dst, dshift_off_addr);
+        uni_vdivps(dst, dst, dscale_off_addr);
+    }
+
     // upconvert from bf16 to float
     template <typename Vmm>
     void bf16_uc(Vmm dst, Xbyak::Address src, int in_len) {
@@ -342,6 +400,7 @@ protected:
                     assert(!"unsupported");
                 break;
             case data_type::bf16: bf16_uc(dst, src, in_len); break;
+            case data_type::u8: deq_h(dst, src, in_len); break;
             default: assert(!"unsupported");
         }
     }
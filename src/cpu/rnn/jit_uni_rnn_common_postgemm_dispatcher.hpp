@@ -21,9 +21,12 @@
 #include "rnn_utils.hpp"
 
 #include "jit_uni_gru_cell_postgemm_1.hpp"
+#include "jit_uni_gru_cell_postgemm_1_bwd.hpp"
 #include "jit_uni_gru_cell_postgemm_2.hpp"
+#include "jit_uni_gru_cell_postgemm_2_bwd.hpp"
 #include "jit_uni_gru_lbr_cell_postgemm.hpp"
 #include "jit_uni_lstm_cell_postgemm.hpp"
+#include "jit_uni_lstm_cell_postgemm_bwd.hpp"
 #include "jit_uni_rnn_cell_postgemm.hpp"
 #include "jit_uni_rnn_common_postgemm.hpp"
 
@@ -68,6 +71,9 @@ struct rnn_postgemm_dispatcher {
                 && utils::one_of(src_type, data_type::f32, data_type::u8,
                         data_type::bf16)
                 && !pd->attr()->rnn_tparams_.test_mode_;
+        bool jit_bwd_path = pd->desc()->prop_kind == prop_kind::backward
+                && utils::one_of(src_type, data_type::f32, data_type::bf16)
+                && !pd->attr()->rnn_tparams_.test_mode_;
 
         switch (pd->cell_kind()) {
             case alg_kind::vanilla_lstm:
@@ -85,6 +91,17 @@ struct rnn_postgemm_dispatcher {
                         rnn_postgemm_
                                 = new jit_uni_lstm_cell_postgemm_fwd<sse41,
                                         src_type, scratch_type>(rnn, pd);
+                } else if (jit_bwd_path) {
+                    if (mayiuse(avx512_core))
+                        rnn_postgemm_ = new jit_uni_lstm_cell_postgemm_bwd<
+                                avx512_core, src_type, scratch_type>(rnn, pd);
+                    else if (mayiuse(avx2))
+                        rnn_postgemm_ = new jit_uni_lstm_cell_postgemm_bwd<avx2,
+                                src_type, scratch_type>(rnn, pd);
+                    else if (mayiuse(sse41))
+                        rnn_postgemm_
+                                = new jit_uni_lstm_cell_postgemm_bwd<sse41,
+                                        src_type, scratch_type>(rnn, pd);
                 }
                 break;
             case alg_kind::vanilla_rnn:
@@ -148,6 +165,29 @@ struct rnn_postgemm_dispatcher {
                                 = new jit_uni_gru_cell_postgemm_part2_fwd<sse41,
                                         src_type, scratch_type>(rnn, pd);
                     }
+                } else if (jit_bwd_path) {
+                    if (mayiuse(avx512_core)) {
+                        rnn_postgemm_ = new jit_uni_gru_cell_postgemm_part1_bwd<
+                                avx512_core, src_type, scratch_type>(rnn, pd);
+                        rnn_postgemm_part2_
+                                = new jit_uni_gru_cell_postgemm_part2_bwd<
+                                        avx512_core, src_type, scratch_type>(
+                                        rnn, pd);
+                    } else if (mayiuse(avx2)) {
+                        rnn_postgemm_
+                                = new jit_uni_gru_cell_postgemm_part1_bwd<avx2,
+                                        src_type, scratch_type>(rnn, pd);
+                        rnn_postgemm_part2_
+                                = new jit_uni_gru_cell_postgemm_part2_bwd<avx2,
+                                        src_type, scratch_type>(rnn, pd);
+                    } else if (mayiuse(sse41)) {
+                        rnn_postgemm_
+                                = new jit_uni_gru_cell_postgemm_part1_bwd<sse41,
+                                        src_type, scratch_type>(rnn, pd);
+                        rnn_postgemm_part2_
+                                = new jit_uni_gru_cell_postgemm_part2_bwd<sse41,
+                                        src_type, scratch_type>(rnn, pd);
+                    }
                 }
                 break;
             case alg_kind::lbr_gru:
@@ -186,12 +226,12 @@ struct rnn_postgemm_dispatcher {
             rnn_postgemm_->execute(rnn, ws_gates_, scratch_gates_, states_t_l_,
                     c_states_t_l_, states_tm1_l_, c_states_tm1_l_,
                     diff_states_t_l_, diff_states_t_lp1_, diff_states_tp1_l_,
-                    bias_, ws_grid_, scratch_cell_);
+                    bias_, ws_grid_, scratch_cell_, weights_peephole_);
         else
             (this->*postgemm_func)(rnn, ws_gates_, scratch_gates_, states_t_l_,
                     c_states_t_l_, states_tm1_l_, c_states_tm1_l_,
                     diff_states_t_l_, diff_states_t_lp1_, diff_states_tp1_l_,
-                    bias_, ws_grid_, scratch_cell_);
+                    bias_, ws_grid_, scratch_cell_, weights_peephole_);
     }
 
     // template <typename src_data_t, typename acc_data_t>
@@ -200,12 +240,12 @@ struct rnn_postgemm_dispatcher {
             rnn_postgemm_part2_->execute(rnn, ws_gates_, scratch_gates_,
                     states_t_l_, c_states_t_l_, states_tm1_l_, c_states_tm1_l_,
                     diff_states_t_l_, diff_states_t_lp1_, diff_states_tp1_l_,
-                    bias_, ws_grid_, scratch_cell_);
+                    bias_, ws_grid_, scratch_cell_, weights_peephole_);
         else
             (this->*postgemm_part2_func)(rnn, ws_gates_, scratch_gates_,
                     states_t_l_, c_states_t_l_, states_tm1_l_, c_states_tm1_l_,
                     diff_states_t_l_, diff_states_t_lp1_, diff_states_tp1_l_,
-                    bias_, ws_grid_, scratch_cell_);
+                    bias_, ws_grid_, scratch_cell_, weights_peephole_);
     }
 
 private:
@@ -21,6 +21,7 @@
 #include "dnnl_thread.hpp"
 #include "math_utils.hpp"
 
+#include "../simple_q10n.hpp"
 #include "jit_uni_rnn_common_postgemm_dispatcher.hpp"
 
 namespace dnnl {
@@ -32,14 +33,19 @@ using namespace dnnl::impl::math;
 using namespace rnn_utils;
 #define AOC array_offset_calculator
 
-template <typename T1, typename T2, typename src_data_t,
-        typename scratch_data_t>
-void gru_fwd_part1_postgemm_template(T1 func1, T2 to_src, const float *scales,
-        const rnn_utils::rnn_conf_t &rnn, src_data_t *ws_gates_,
-        scratch_data_t *scratch_gates_, src_data_t *states_t_l_,
-        src_data_t *states_tm1_l_, float *bias_) {
+template <typename T1, typename T2, typename T3, typename T4,
+        typename src_data_t, typename scratch_data_t>
+void gru_fwd_part1_postgemm_template(T1 func1, T2 to_src, T3 to_float,
+        T4 to_float_h, const float *scales, const rnn_utils::rnn_conf_t &rnn,
+        src_data_t *ws_gates_, scratch_data_t *scratch_gates_,
+        src_data_t *states_t_l_, src_data_t *states_tm1_l_, float *bias_) {
+    static_assert(sizeof(scratch_data_t) == sizeof(float),
+            "the scratch gates must be able to hold the f32 gates");
     ws_gates_aoc<src_data_t> ws_gates(rnn, ws_gates_);
     ws_gates_aoc<scratch_data_t> scratch_gates(rnn, scratch_gates_);
+    // the activated gates are kept in f32 for the second part
+    ws_gates_aoc<float> scratch_gates_f32(
+            rnn, reinterpret_cast<float *>(scratch_gates_));
     bias_aoc_t bias(rnn, bias_);
     ws_states_aoc<src_data_t> states_t_l(rnn, states_t_l_);
     ws_states_aoc<src_data_t> states_tm1_l(rnn, states_tm1_l_);
@@ -47,14 +53,18 @@ void gru_fwd_part1_postgemm_template(T1 func1, T2 to_src, const float *scales,
     parallel_nd(rnn.mb, [&](int i) {
         PRAGMA_OMP_SIMD()
         for (int j = 0; j < rnn.dic; j++) {
-            auto G0 // default func1 is sigmoid
-                    = func1(scales, scratch_gates(i, 0, j) + bias(0, j));
-            auto G1 // default func1 is sigmoid
-                    = func1(scales + 1, scratch_gates(i, 1, j) + bias(1, j));
+            float G0 // default func1 is sigmoid
+                    = func1(scales,
+                            to_float(scratch_gates(i, 0, j), 0, j)
+                                    + bias(0, j));
+            float G1 // default func1 is sigmoid
+                    = func1(scales + 1,
+                            to_float(scratch_gates(i, 1, j), 1, j)
+                                    + bias(1, j));
             /* TODO: Can be optimized for fwd_training by using ws_gates instead of scratch_gates in p2 */
-            scratch_gates(i, 0, j) = to_src(G0);
-            scratch_gates(i, 1, j) = to_src(G1);
-            states_t_l(i, j) = to_src(states_tm1_l(i, j) * G1);
+            scratch_gates_f32(i, 0, j) = G0;
+            scratch_gates_f32(i, 1, j) = G1;
+            states_t_l(i, j) = to_src(to_float_h(states_tm1_l(i, j)) * G1);
 
             if (rnn.is_training) {
                 ws_gates(i, 0, j) = to_src(G0);
@@ -64,14 +74,16 @@ void gru_fwd_part1_postgemm_template(T1 func1, T2 to_src, const float *scales,
     });
 }
 
-template <typename T1, typename T2, typename src_data_t,
-        typename scratch_data_t>
-void gru_fwd_part2_postgemm_template(T1 func1, T2 to_src, const float *scales,
-        const rnn_utils::rnn_conf_t &rnn, src_data_t *ws_gates_,
-        scratch_data_t *scratch_gates_, src_data_t *states_t_l_,
-        src_data_t *states_tm1_l_, float *bias_) {
+template <typename T1, typename T2, typename T3, typename T4,
+        typename src_data_t, typename scratch_data_t>
+void gru_fwd_part2_postgemm_template(T1 func1, T2 to_src, T3 to_float,
+        T4 to_float_h, const float *scales, const rnn_utils::rnn_conf_t &rnn,
+        src_data_t *ws_gates_, scratch_data_t *scratch_gates_,
+        src_data_t *states_t_l_, src_data_t *states_tm1_l_, float *bias_) {
     ws_gates_aoc<src_data_t> ws_gates(rnn, ws_gates_);
     ws_gates_aoc<scratch_data_t> scratch_gates(rnn, scratch_gates_);
+    ws_gates_aoc<float> scratch_gates_f32(
+            rnn, reinterpret_cast<float *>(scratch_gates_));
     bias_aoc_t bias(rnn, bias_);
     ws_states_aoc<src_data_t> states_t_l(rnn, states_t_l_);
     ws_states_aoc<src_data_t> states_tm1_l(rnn, states_tm1_l_);
@@ -79,12 +91,14 @@ void gru_fwd_part2_postgemm_template(T1 func1, T2 to_src, const float *scales,
     parallel_nd(rnn.mb, [&](int i) {
         PRAGMA_OMP_SIMD()
         for (int j = 0; j < rnn.dic; j++) {
-            auto G0 = scratch_gates(i, 0, j);
-            auto G2 // default func1 is tanh
-                    = func1(scales + 2, scratch_gates(i, 2, j) + bias(2, j));
+            float G0 = scratch_gates_f32(i, 0, j);
+            float G2 // default func1 is tanh
+                    = func1(scales + 2,
+                            to_float(scratch_gates(i, 2, j), 2, j)
+                                    + bias(2, j));
 
-            states_t_l(i, j)
-                    = to_src(states_tm1_l(i, j) * G0 + (1.0f - G0) * G2);
+            states_t_l(i, j) = to_src(to_float_h(states_tm1_l(i, j)) * G0
+                    + (1.0f - G0) * G2);
 
             if (rnn.is_training) { ws_gates(i, 2, j) = to_src(G2); }
         }
@@ -99,13 +113,17 @@ rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::gru_part1_postgemm) {
         return logistic_fwd<float>(a);
     };
     auto to_src = [](float a) { return a; };
+    auto deq_id = [](float a, int gate, int j) { return a; };
+    auto deq_h_id = [](float a) { return a; };
 
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        gru_fwd_part1_postgemm_template(logistic_f, to_src, scales, rnn,
-                ws_gates_, scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part1_postgemm_template(logistic_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
     else
-        gru_fwd_part1_postgemm_template(linear_f, to_src, scales, rnn,
-                ws_gates_, scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part1_postgemm_template(linear_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
 }
 
 template <>
@@ -115,13 +133,17 @@ rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::gru_part2_postgemm) {
     auto tanh_f
             = [](const float *scale, float a) { return tanh_fwd<float>(a); };
     auto to_src = [](float a) { return a; };
+    auto deq_id = [](float a, int gate, int j) { return a; };
+    auto deq_h_id = [](float a) { return a; };
 
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        gru_fwd_part2_postgemm_template(tanh_f, to_src, scales, rnn, ws_gates_,
-                scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part2_postgemm_template(tanh_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
     else
-        gru_fwd_part2_postgemm_template(linear_f, to_src, scales, rnn,
-                ws_gates_, scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part2_postgemm_template(linear_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
 }
 
 template <>
@@ -132,13 +154,17 @@ rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_part1_postgemm) {
     auto logistic_f = [](const float *scale, float a) {
         return logistic_fwd<float>(a);
     };
+    auto deq_id = [](float a, int gate, int j) { return a; };
+    auto deq_h_id = [](bfloat16_t a) { return float(a); };
 
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        gru_fwd_part1_postgemm_template(logistic_f, to_src, scales, rnn,
-                ws_gates_, scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part1_postgemm_template(logistic_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
     else
-        gru_fwd_part1_postgemm_template(linear_f, to_src, scales, rnn,
-                ws_gates_, scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part1_postgemm_template(linear_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
 }
 template <>
 rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_part2_postgemm) {
@@ -147,23 +173,90 @@ rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_part2_postgemm) {
     auto tanh_f
             = [](const float *scale, float a) { return tanh_fwd<float>(a); };
     auto to_src = [](float a) { return bfloat16_t(a); };
+    auto deq_id = [](float a, int gate, int j) { return a; };
+    auto deq_h_id = [](bfloat16_t a) { return float(a); };
 
     if (!pd_->attr()->rnn_tparams_.test_mode_)
-        gru_fwd_part2_postgemm_template(tanh_f, to_src, scales, rnn, ws_gates_,
-                scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part2_postgemm_template(tanh_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
     else
-        gru_fwd_part2_postgemm_template(linear_f, to_src, scales, rnn,
-                ws_gates_, scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+        gru_fwd_part2_postgemm_template(linear_f, to_src, deq_id, deq_h_id,
+                scales, rnn, ws_gates_, scratch_gates_, states_t_l_,
+                states_tm1_l_, bias_);
 }
 
 template <>
 rnn_postgemm_sig(rnn_postgemm_fwd_u8_t::gru_part1_postgemm) {
-    assert(!"GRU int8 is not supported");
+    const float *scales = pd_->attr()->rnn_tparams_.scales_;
+    float *weights_scales = pd_->attr()->rnn_weights_qparams_.scales_;
+    float data_shift = pd_->attr()->rnn_data_qparams_.shift_;
+    float data_scale = pd_->attr()->rnn_data_qparams_.scale_;
+
+    auto linear_f = [](const float *scale, float a) { return *scale * a; };
+    auto logistic_f = [](const float *scale, float a) {
+        return logistic_fwd<float>(a);
+    };
+    auto quantize_f32_u8 = [&](float f) {
+        float qf = f * data_scale + data_shift;
+        return qz_a1b0<float, src_data_t>()(qf);
+    };
+    auto dequantize_s32_f32 = [&](acc_data_t s, int gate, int j) {
+        return pd_->attr()->rnn_weights_qparams_.mask_ == 0
+                ? saturate<float>(s) * (1.f / (weights_scales[0] * data_scale))
+                : saturate<float>(s)
+                        * (1.f
+                                / (weights_scales[gate * rnn.dic + j]
+                                        * data_scale));
+    };
+    auto dequantize_u8_f32 = [&](src_data_t s) {
+        return (static_cast<float>(s) - data_shift) * (1.f / data_scale);
+    };
+
+    if (!pd_->attr()->rnn_tparams_.test_mode_)
+        gru_fwd_part1_postgemm_template(logistic_f, quantize_f32_u8,
+                dequantize_s32_f32, dequantize_u8_f32, scales, rnn, ws_gates_,
+                scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+    else
+        gru_fwd_part1_postgemm_template(linear_f, quantize_f32_u8,
+                dequantize_s32_f32, dequantize_u8_f32, scales, rnn, ws_gates_,
+                scratch_gates_, states_t_l_, states_tm1_l_, bias_);
 }
 
 template <>
 rnn_postgemm_sig(rnn_postgemm_fwd_u8_t::gru_part2_postgemm) {
-    assert(!"GRU int8 is not supported");
+    const float *scales = pd_->attr()->rnn_tparams_.scales_;
+    float *weights_scales = pd_->attr()->rnn_weights_qparams_.scales_;
+    float data_shift = pd_->attr()->rnn_data_qparams_.shift_;
+    float data_scale = pd_->attr()->rnn_data_qparams_.scale_;
+
+    auto linear_f = [](const float *scale, float a) { return *scale * a; };
+    auto tanh_f
+            = [](const float *scale, float a) { return tanh_fwd<float>(a); };
+    auto quantize_f32_u8 = [&](float f) {
+        float qf = f * data_scale + data_shift;
+        return qz_a1b0<float, src_data_t>()(qf);
+    };
+    auto dequantize_s32_f32 = [&](acc_data_t s, int gate, int j) {
+        return pd_->attr()->rnn_weights_qparams_.mask_ == 0
+                ? saturate<float>(s) * (1.f / (weights_scales[0] * data_scale))
+                : saturate<float>(s)
+                        * (1.f
+                                / (weights_scales[gate * rnn.dic + j]
+                                        * data_scale));
+    };
+    auto dequantize_u8_f32 = [&](src_data_t s) {
+        return (static_cast<float>(s) - data_shift) * (1.f / data_scale);
+    };
+
+    if (!pd_->attr()->rnn_tparams_.test_mode_)
+        gru_fwd_part2_postgemm_template(tanh_f, quantize_f32_u8,
+                dequantize_s32_f32, dequantize_u8_f32, scales, rnn, ws_gates_,
+                scratch_gates_, states_t_l_, states_tm1_l_, bias_);
+    else
+        gru_fwd_part2_postgemm_template(linear_f, quantize_f32_u8,
+                dequantize_s32_f32, dequantize_u8_f32, scales, rnn, ws_gates_,
+                scratch_gates_, states_t_l_, states_tm1_l_, bias_);
 }
 
 template <typename T, typename src_data_t, typename acc_data_t,
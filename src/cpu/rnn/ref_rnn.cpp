@@ -120,6 +120,24 @@ rnn_gemm_sig(ref_rnn_bwd_f32_t::packed_gemm) {
     MAYBE_UNUSED(st);
 }
 
+template <>
+rnn_gemm_sig(ref_rnn_fwd_bf16_t::packed_gemm) {
+    assert(transA == 'N' && transB == 'N' && alpha == 1.);
+    auto st = gemm_bf16bf16f32_compute(
+            "P", "N", &m, &n, &k, a_, &ldA, b_, &ldB, &beta, c_, &ldC);
+    assert(st == dnnl_success);
+    MAYBE_UNUSED(st);
+}
+
+template <>
+rnn_gemm_sig(ref_rnn_bwd_bf16_t::packed_gemm) {
+    assert(transA == 'N' && transB == 'N' && alpha == 1.);
+    auto st = gemm_bf16bf16f32_compute(
+            "P", "N", &m, &n, &k, a_, &ldA, b_, &ldB, &beta, c_, &ldC);
+    assert(st == dnnl_success);
+    MAYBE_UNUSED(st);
+}
+
 template <>
 rnn_gemm_sig(ref_rnn_fwd_u8s8_t::packed_gemm) {
     assert(transA == 'N' && transB == 'N' && alpha == 1.);
@@ -128,6 +146,53 @@ rnn_gemm_sig(ref_rnn_fwd_u8s8_t::packed_gemm) {
             c_, &ldC, &offsetc);
 }
 
+//************ Grid computations: variable-length sequences ************//
+/* A sample of length len is running at iteration iter of direction dir if
+ * the corresponding input time step is below len. The right-to-left direction
+ * starts at the last time step, so its padding comes first and the initial
+ * state is carried over it. */
+static inline bool seq_is_active(const rnn_conf_t &rnn,
+        const int32_t *seq_lengths, int dir, int iter, int b) {
+    const bool reverse = rnn.exec_dir == r2l || dir == 1;
+    return reverse ? iter >= rnn.n_iter - seq_lengths[b]
+                   : iter < seq_lengths[b];
+}
+
+/* Returns the minibatch size to compute a cell with: samples past their
+ * length at the end of the minibatch are skipped, so sorting the samples by
+ * decreasing length shrinks the GEMMs as sequences end. Packed GEMMs keep the
+ * minibatch they were packed for. */
+static inline int seq_cell_mb(const rnn_conf_t &rnn,
+        const int32_t *seq_lengths, int dir, int iter) {
+    if (seq_lengths == nullptr || rnn.use_layer_packed_gemm
+            || rnn.use_iter_packed_gemm)
+        return rnn.mb;
+    int mb = rnn.mb;
+    while (mb > 0 && !seq_is_active(rnn, seq_lengths, dir, iter, mb - 1))
+        mb--;
+    return mb;
+}
+
+/* Samples that are not running keep their previous state */
+template <typename src_data_t>
+void seq_carry_states(const rnn_conf_t &rnn, const int32_t *seq_lengths,
+        int dir, int iter, src_data_t *states_t_l_, float *c_states_t_l_,
+        const src_data_t *states_tm1_l_, const float *c_states_tm1_l_) {
+    if (seq_lengths == nullptr) return;
+    ws_states_aoc<src_data_t> states_t_l(rnn, states_t_l_);
+    ws_states_aoc<const src_data_t> states_tm1_l(rnn, states_tm1_l_);
+    ws_states_aoc<float> c_states_t_l(rnn, c_states_t_l_);
+    ws_states_aoc<const float> c_states_tm1_l(rnn, c_states_tm1_l_);
+    for (int b = 0; b < rnn.mb; b++) {
+        if (seq_is_active(rnn, seq_lengths, dir, iter, b)) continue;
+        for (int s = 0; s < rnn.dhc; s++)
+            states_t_l(b, s) = states_tm1_l(b, s);
+        if (rnn.n_states == 2)
+            for (int s = 0; s < rnn.dic; s++)
+                c_states_t_l(b, s) = c_states_tm1_l(b, s);
+    }
+}
+
 //*************** Grid computations strategy: linear ***************//
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
         data_type_t acc_type>
@@ -147,6 +212,10 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     AOC<weights_data_t *, 3> weights_iter(
             weights_iter_, rnn.n_layer, rnn.n_dir, rnn.n_parts_weights_iter);
     AOC<float *, 3> bias(bias_, rnn.n_layer, rnn.n_dir, rnn.n_parts_bias);
+    AOC<const float, 3> weights_peephole(
+            weights_peephole_, rnn.n_layer, rnn.n_dir, 3 * rnn.dic);
+    AOC<const weights_data_t, 3> weights_projection(
+            weights_projection_, rnn.n_layer, rnn.n_dir, rnn.dic * rnn.dhc);
     AOC<acc_data_t, 3> diff_weights_layer(diff_weights_layer_, rnn.n_layer,
             rnn.n_dir, rnn.diff_weights_layer_nld * rnn.diff_weights_layer_ld);
     AOC<acc_data_t, 3> diff_weights_iter(diff_weights_iter_, rnn.n_layer,
@@ -172,25 +241,42 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             for (int i = 0; i < rnn.n_iter; i++) {
                 int iter = (aprop == prop_kind::forward) ? i
                                                          : rnn.n_iter - i - 1;
-                (this->*cell_func)(rnn, &(ws_states(lay + 1, dir, iter + 1, 0)),
+                rnn_conf_t rnn_cell = rnn;
+                rnn_cell.mb = seq_cell_mb(rnn, seq_lengths_, dir, iter);
+                if (rnn_cell.mb > 0) {
+                    (this->*cell_func)(rnn_cell,
+                            &(ws_states(lay + 1, dir, iter + 1, 0)),
+                            &(ws_c_states(lay + 1, dir, iter + 1, 0)),
+                            &(ws_diff_states(lay, dir, 0, iter, 0)),
+                            &(weights_layer(lay, dir, 0)),
+                            &(weights_iter(lay, dir, 0)),
+                            &(bias(lay, dir, 0)),
+                            &(ws_states(lay, dir, iter + 1, 0)),
+                            &(ws_states(lay + 1, dir, iter, 0)),
+                            &(ws_c_states(lay + 1, dir, iter, 0)),
+                            &(ws_diff_states(lay + 1, dir, 0, iter, 0)),
+                            &(ws_diff_states(lay, dir, 0, iter + 1, 0)),
+                            &(diff_weights_layer(lay, dir, 0)),
+                            &(diff_weights_iter(lay, dir, 0)),
+                            &(diff_bias(lay, dir, 0)),
+                            &(ws_gates(lay, dir, iter, 0)),
+                            rnn.n_iter_scratch_gates == 1 ? scratch_gates_
+                                                          : scratch_gates_
+                                            + iter * rnn.gates_nld
+                                                    * rnn.gates_ws_ld,
+                            &(ws_grid(lay, dir, iter, 0)), scratch_cell_,
+                            rnn.is_lstm_peephole
+                                    ? &(weights_peephole(lay, dir, 0))
+                                    : nullptr,
+                            rnn.is_lstm_projection
+                                    ? &(weights_projection(lay, dir, 0))
+                                    : nullptr);
+                }
+                seq_carry_states(rnn, seq_lengths_, dir, iter,
+                        &(ws_states(lay + 1, dir, iter + 1, 0)),
                         &(ws_c_states(lay + 1, dir, iter + 1, 0)),
-                        &(ws_diff_states(lay, dir, 0, iter, 0)),
-                        &(weights_layer(lay, dir, 0)),
-                        &(weights_iter(lay, dir, 0)), &(bias(lay, dir, 0)),
-                        &(ws_states(lay, dir, iter + 1, 0)),
                         &(ws_states(lay + 1, dir, iter, 0)),
-                        &(ws_c_states(lay + 1, dir, iter, 0)),
-                        &(ws_diff_states(lay + 1, dir, 0, iter, 0)),
-                        &(ws_diff_states(lay, dir, 0, iter + 1, 0)),
-                        &(diff_weights_layer(lay, dir, 0)),
-                        &(diff_weights_iter(lay, dir, 0)),
-                        &(diff_bias(lay, dir, 0)),
-                        &(ws_gates(lay, dir, iter, 0)),
-                        rnn.n_iter_scratch_gates == 1 ? scratch_gates_
-                                                      : scratch_gates_
-                                        + iter * rnn.gates_nld
-                                                * rnn.gates_ws_ld,
-                        &(ws_grid(lay, dir, iter, 0)), scratch_cell_);
+                        &(ws_c_states(lay + 1, dir, iter, 0)));
             }
 
             if ((aprop == prop_kind::backward) && rnn.merge_gemm_layer) {
@@ -219,6 +305,104 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     }
 }
 
+//************* Grid computations strategy: wavefront *************//
+/* Cell (lay, iter) only depends on cells (lay - 1, iter) and (lay, iter - 1)
+ * of the same direction, so the cells on an anti-diagonal of the grid and
+ * the cells of different directions are independent. Each thread owns a set
+ * of (layer, direction) chains, walks them in the layer order and, before
+ * computing a cell, waits for the chain below to have completed the same
+ * iteration. As every chain only waits on chains with a smaller index, the
+ * schedule is deadlock free for any number of threads. The GEMMs of a cell
+ * are called from within the parallel region and hence run sequentially. */
+template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
+        data_type_t acc_type>
+rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
+        acc_type>::wavefront_execution)) {
+    assert(aprop == prop_kind::forward && !rnn.merge_gemm_layer
+            && !rnn.merge_gemm_iter);
+    AOC<src_data_t, 4> ws_states(ws_states_, rnn.n_layer + 1, rnn.n_dir,
+            rnn.n_iter + 1, rnn.states_nld * rnn.states_ws_ld);
+    AOC<float, 4> ws_c_states(ws_c_states_, rnn.n_layer + 1, rnn.n_dir,
+            rnn.n_iter + 1, rnn.states_nld * rnn.states_ws_ld);
+    AOC<acc_data_t, 5> ws_diff_states(ws_diff_states_, rnn.n_layer + 1,
+            rnn.n_dir, (rnn.n_states + 1), rnn.n_iter + 1,
+            rnn.states_nld * rnn.states_ws_ld);
+    AOC<src_data_t, 4> ws_gates(ws_gates_, rnn.n_layer, rnn.n_dir, rnn.n_iter,
+            rnn.gates_nld * rnn.gates_ws_ld);
+    AOC<weights_data_t *, 3> weights_layer(
+            weights_layer_, rnn.n_layer, rnn.n_dir, rnn.n_parts_weights_layer);
+    AOC<weights_data_t *, 3> weights_iter(
+            weights_iter_, rnn.n_layer, rnn.n_dir, rnn.n_parts_weights_iter);
+    AOC<float *, 3> bias(bias_, rnn.n_layer, rnn.n_dir, rnn.n_parts_bias);
+    AOC<const float, 3> weights_peephole(
+            weights_peephole_, rnn.n_layer, rnn.n_dir, 3 * rnn.dic);
+    AOC<const weights_data_t, 3> weights_projection(
+            weights_projection_, rnn.n_layer, rnn.n_dir, rnn.dic * rnn.dhc);
+    AOC<src_data_t, 4> ws_grid(
+            ws_grid_, rnn.n_layer, rnn.n_dir, rnn.n_iter, (int)rnn.ws_per_cell);
+
+    const int n_chains = rnn.n_layer * rnn.n_dir;
+    int32_t *progress = (int32_t *)((char *)scratch_gates_
+            + rnn.wavefront_nthr * rnn.scratch_gates_size);
+    for (int c = 0; c < n_chains; c++)
+        progress[c * wavefront_progress_stride] = 0;
+
+    parallel(rnn.wavefront_nthr, [&](const int ithr, const int nthr) {
+        scratch_data_t *scratch_gates_thr = (scratch_data_t *)((char *)
+                                                    scratch_gates_
+                + ithr * rnn.scratch_gates_size);
+        scratch_data_t *scratch_cell_thr = (scratch_data_t *)((char *)
+                                                   scratch_cell_
+                + ithr * rnn.scratch_cell_size);
+
+        for (int c = ithr; c < n_chains; c += nthr) {
+            const int lay = c / rnn.n_dir;
+            const int dir = c % rnn.n_dir;
+            int32_t *below = lay > 0
+                    ? &progress[(c - rnn.n_dir) * wavefront_progress_stride]
+                    : nullptr;
+
+            for (int iter = 0; iter < rnn.n_iter; iter++) {
+                if (below)
+                    while (fetch_and_add(below, 0) <= iter)
+                        ;
+                rnn_conf_t rnn_cell = rnn;
+                rnn_cell.mb = seq_cell_mb(rnn, seq_lengths_, dir, iter);
+                if (rnn_cell.mb > 0) {
+                    (this->*cell_func)(rnn_cell,
+                            &(ws_states(lay + 1, dir, iter + 1, 0)),
+                            &(ws_c_states(lay + 1, dir, iter + 1, 0)),
+                            &(ws_diff_states(lay, dir, 0, iter, 0)),
+                            &(weights_layer(lay, dir, 0)),
+                            &(weights_iter(lay, dir, 0)),
+                            &(bias(lay, dir, 0)),
+                            &(ws_states(lay, dir, iter + 1, 0)),
+                            &(ws_states(lay + 1, dir, iter, 0)),
+                            &(ws_c_states(lay + 1, dir, iter, 0)),
+                            &(ws_diff_states(lay + 1, dir, 0, iter, 0)),
+                            &(ws_diff_states(lay, dir, 0, iter + 1, 0)),
+                            nullptr, nullptr, nullptr,
+                            &(ws_gates(lay, dir, iter, 0)),
+                            scratch_gates_thr, &(ws_grid(lay, dir, iter, 0)),
+                            scratch_cell_thr,
+                            rnn.is_lstm_peephole
+                                    ? &(weights_peephole(lay, dir, 0))
+                                    : nullptr,
+                            rnn.is_lstm_projection
+                                    ? &(weights_projection(lay, dir, 0))
+                                    : nullptr);
+                }
+                seq_carry_states(rnn, seq_lengths_, dir, iter,
+                        &(ws_states(lay + 1, dir, iter + 1, 0)),
+                        &(ws_c_states(lay + 1, dir, iter + 1, 0)),
+                        &(ws_states(lay + 1, dir, iter, 0)),
+                        &(ws_c_states(lay + 1, dir, iter, 0)));
+                fetch_and_add(&progress[c * wavefront_progress_stride], 1);
+            }
+        }
+    });
+}
+
 //********* GRID computations strategy: utility functions **********//
 
 template <typename src_data_t>
@@ -461,7 +645,7 @@ RNN_DECL_COPY_INIT_ITER_BWD(ref_rnn_bwd_bf16_t)
 template <typename src_data_t, typename dst_data_t>
 void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_data_t *dst_layer_, memory_desc_wrapper &dst_layer_d,
-        const src_data_t *ws_states_) {
+        const src_data_t *ws_states_, const int32_t *seq_lengths) {
 
     AOC<const src_data_t, 5> ws_states(ws_states_, rnn.n_layer + 1, rnn.n_dir,
             rnn.n_iter + 1, rnn.mb, rnn.states_ws_ld);
@@ -480,11 +664,19 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
     parallel_nd(rnn.n_iter, rnn.mb, [&](int it, int b) {
         int dir = 0;
 
+        // the time steps past the sample length are zero padded
+        if (seq_lengths && it >= seq_lengths[b]) {
+            auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
+            for (int s = 0; s < rnn.dlc; s++)
+                dd[s] = (dst_data_t)0;
+            return;
+        }
+
         if (rnn.exec_dir != r2l) {
             const auto *ss = &ws_states(rnn.n_layer, dir, it + 1, b, 0);
-            auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, dir * rnn.dic)];
+            auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, dir * rnn.dhc)];
             PRAGMA_OMP_SIMD()
-            for (int s = 0; s < rnn.dic; s++)
+            for (int s = 0; s < rnn.dhc; s++)
                 dd[s] = maybe_deq(ss[s]);
 
             dir = 1;
@@ -497,13 +689,13 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
             if (rnn.exec_dir == bi_sum) {
                 auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
                 PRAGMA_OMP_SIMD()
-                for (int s = 0; s < rnn.dic; s++)
+                for (int s = 0; s < rnn.dhc; s++)
                     dd[s] += maybe_deq(ss[s]);
             } else {
                 auto *dd = &dst_layer_[dst_layer_d.blk_off(
-                        it, b, dir * rnn.dic)];
+                        it, b, dir * rnn.dhc)];
                 PRAGMA_OMP_SIMD()
-                for (int s = 0; s < rnn.dic; s++)
+                for (int s = 0; s < rnn.dhc; s++)
                     dd[s] = maybe_deq(ss[s]);
             }
         }
@@ -539,10 +731,11 @@ void copy_res_layer_bwd_template(const rnn_conf_t &rnn,
     template <typename dst_data_t> \
     void cname::copy_res_layer(const rnn_conf_t &rnn, dst_data_t *dst_layer_, \
             acc_data_t *diff_src_layer, const src_data_t *ws_states_, \
-            const acc_data_t *ws_diff_states_) const { \
+            const acc_data_t *ws_diff_states_, const int32_t *seq_lengths) \
+            const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
-        copy_res_layer_fwd_template( \
-                rnn, pd(), dst_layer_, dst_layer_d, ws_states_); \
+        copy_res_layer_fwd_template(rnn, pd(), dst_layer_, dst_layer_d, \
+                ws_states_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_fwd_f32_t)
@@ -554,7 +747,8 @@ RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_fwd_u8s8_t)
     template <typename dst_data_t> \
     void cname::copy_res_layer(const rnn_conf_t &rnn, dst_data_t *dst_layer_, \
             acc_data_t *diff_src_layer_, const src_data_t *ws_states_, \
-            const acc_data_t *ws_diff_states_) const { \
+            const acc_data_t *ws_diff_states_, const int32_t *seq_lengths) \
+            const { \
         auto diff_src_layer_d = memory_desc_wrapper(pd()->diff_src_md(0)); \
         copy_res_layer_bwd_template( \
                 rnn, diff_src_layer_, diff_src_layer_d, ws_diff_states_); \
@@ -563,6 +757,45 @@ RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_fwd_u8s8_t)
 RNN_DECL_COPY_RES_LAYER_BWD(ref_rnn_bwd_f32_t)
 RNN_DECL_COPY_RES_LAYER_BWD(ref_rnn_bwd_bf16_t)
 
+/* The resident states of a stateful primitive are kept in the workspace
+ * layout, so that they are restored to and saved from the first and last
+ * iterations of the workspace with plain copies, whatever the layout and data
+ * type of src_iter and dst_iter */
+template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
+        data_type_t acc_type>
+void _ref_rnn_common_t<aprop, src_type, weights_type,
+        acc_type>::copy_resident_states(const rnn_conf_t &rnn,
+        src_data_t *ws_states_, float *ws_c_states_, bool restore) const {
+    const int states_nelems = rnn.mb * rnn.states_ws_ld;
+    AOC<src_data_t, 4> ws_states(ws_states_, rnn.n_layer + 1, rnn.n_dir,
+            rnn.n_iter + 1, states_nelems);
+    AOC<float, 4> ws_c_states(ws_c_states_, rnn.n_layer + 1, rnn.n_dir,
+            rnn.n_iter + 1, states_nelems);
+    AOC<src_data_t, 3> states(
+            resident_states_, rnn.n_layer, rnn.n_dir, states_nelems);
+    AOC<float, 3> c_states(
+            resident_c_states_, rnn.n_layer, rnn.n_dir, states_nelems);
+    const bool is_lstm = pd()->cell_kind() == alg_kind::vanilla_lstm;
+    const int iter = restore ? 0 : rnn.n_iter;
+
+    parallel_nd(rnn.n_layer, rnn.n_dir, [&](int lay, int dir) {
+        src_data_t *ws_h = &ws_states(lay + 1, dir, iter, 0);
+        src_data_t *h = &states(lay, dir, 0);
+        if (restore)
+            array_copy(ws_h, h, states_nelems);
+        else
+            array_copy(h, ws_h, states_nelems);
+
+        if (!is_lstm) return;
+        float *ws_c = &ws_c_states(lay + 1, dir, iter, 0);
+        float *c = &c_states(lay, dir, 0);
+        if (restore)
+            array_copy(ws_c, c, states_nelems);
+        else
+            array_copy(c, ws_c, states_nelems);
+    });
+}
+
 template <typename src_data_t, typename output_data_t>
 void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         output_data_t *dst_iter_, memory_desc_wrapper &dst_iter_d,
@@ -591,7 +824,7 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         const auto *ss = &ws_states(lay + 1, dir, rnn.n_iter, b, 0);
         auto *dd = &dst_iter_[dst_iter_d.blk_off(lay, dir, b, 0)];
         PRAGMA_OMP_SIMD()
-        for (int s = 0; s < rnn.dic; s++)
+        for (int s = 0; s < rnn.dhc; s++)
             dd[s] = maybe_deq(ss[s]);
 
         if (pd->cell_kind() == alg_kind::vanilla_lstm) {
@@ -700,12 +933,26 @@ rnn_bias_finalize_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
         float data_scale = pd()->attr()->rnn_data_qparams_.scale_;
         float *weights_scales = pd()->attr()->rnn_weights_qparams_.scales_;
         bool scale_per_oc = pd()->attr()->rnn_weights_qparams_.mask_ != 0;
+        // The compensations are computed per gate. With linear before reset
+        // the iteration GEMM of the last gate is compensated through the
+        // extra bias, as it does not share a bias with the layer GEMM.
+        const int last_gate = rnn.n_gates - 1;
         for (int i = 0; i < rnn.n_layer * rnn.n_dir; i++)
             for (int j = 0; j < rnn.n_bias * rnn.dic; j++) {
-                size_t off = i * rnn.n_bias * rnn.dic + j;
+                const int gate = nstl::min(j / rnn.dic, last_gate);
+                const int oc = gate * rnn.dic + j % rnn.dic;
+                const size_t off_comp = i * rnn.n_gates * rnn.dic + oc;
+                const bool with_layer_comp
+                        = !rnn.is_lbr || j < rnn.n_gates * rnn.dic;
+                const bool with_iter_comp
+                        = !rnn.is_lbr || j < last_gate * rnn.dic
+                        || j >= rnn.n_gates * rnn.dic;
+                float comp = 0.f;
+                if (with_layer_comp) comp += w_layer_comp[off_comp];
+                if (with_iter_comp) comp += w_iter_comp[off_comp];
                 float weights_scale
-                        = scale_per_oc ? weights_scales[j] : weights_scales[0];
-                scratch_bias_[off] -= (w_iter_comp[off] + w_layer_comp[off])
+                        = scale_per_oc ? weights_scales[oc] : weights_scales[0];
+                scratch_bias_[i * rnn.n_bias * rnn.dic + j] -= comp
                         * data_shift / (weights_scale * data_scale);
             }
     }
@@ -754,6 +1001,27 @@ rnn_weights_assign_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 }
 
 //********************* Execution function *********************//
+template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
+        data_type_t acc_type>
+bool _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::seq_lengths_ok(
+        const exec_ctx_t &ctx) const {
+    const memory_t *seq_lengths_mem = ctx.input(DNNL_ARG_SEQ_LENGTHS);
+    if (seq_lengths_mem == nullptr) return true;
+
+    const rnn_conf_t &rnn = this->pd()->rnn_;
+    const memory_desc_wrapper seq_lengths_d(seq_lengths_mem->md());
+    if (!(seq_lengths_d.data_type() == data_type::s32
+                && seq_lengths_d.ndims() == 1
+                && seq_lengths_d.dims()[0] == rnn.mb
+                && seq_lengths_d.is_dense()))
+        return false;
+
+    auto seq_lengths = CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS);
+    for (int b = 0; b < rnn.mb; b++)
+        if (seq_lengths[b] < 0 || seq_lengths[b] > rnn.n_iter) return false;
+    return true;
+}
+
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
         data_type_t acc_type>
 void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
@@ -766,6 +1034,11 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
             = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_LAYER);
     auto iter_weights_n_comp = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_ITER);
     auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto weights_peephole
+            = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_PEEPHOLE);
+    auto weights_projection
+            = CTX_IN_MEM(const weights_data_t *, DNNL_ARG_WEIGHTS_PROJECTION);
+    auto seq_lengths = CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS);
 
     auto dst_last_layer = rnn.is_fwd
             ? CTX_OUT_MEM(char *, DNNL_ARG_DST_LAYER)
@@ -864,7 +1137,11 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
 
     // we first need to copy the initial states and input into ws
     copy_init_layer(rnn, ws_states, ws_diff_states, input, diff_dst_layer);
-    if (pd()->src_md(1)->data_type == data_type::f32)
+    // a stateful primitive continues from its resident states unless new
+    // ones are passed
+    if (pd()->is_stateful() && states == nullptr)
+        copy_resident_states(rnn, ws_states, ws_c_states, true);
+    else if (pd()->src_md(1)->data_type == data_type::f32)
         copy_init_iter(rnn, ws_states, ws_c_states, ws_diff_states,
                 (const float *)states, c_states, diff_dst_iter,
                 diff_dst_iter_c);
@@ -877,15 +1154,18 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
     (this->*grid_computation)(rnn, ptr_wei_layer, ptr_wei_iter, ptr_bias,
             ws_states, ws_c_states, ws_diff_states, ws_gates, ws_grid,
             scratch_gates, scratch_cell, diff_weights_layer, diff_weights_iter,
-            diff_bias);
+            diff_bias, seq_lengths, weights_peephole, weights_projection);
+
+    if (pd()->is_stateful())
+        copy_resident_states(rnn, ws_states, ws_c_states, false);
 
     // Finally we copy the results to the result buffers
     if (pd()->dst_md(0)->data_type == data_type::f32)
         copy_res_layer(rnn, (float *)dst_last_layer, diff_src_layer, ws_states,
-                ws_diff_states);
+                ws_diff_states, seq_lengths);
     else
         copy_res_layer(rnn, (src_data_t *)dst_last_layer, diff_src_layer,
-                ws_states, ws_diff_states);
+                ws_states, ws_diff_states, seq_lengths);
 
     if (pd()->dst_md(1)->data_type == data_type::f32)
         copy_res_iter(rnn, (float *)dst_last_iter, dst_last_iter_c,
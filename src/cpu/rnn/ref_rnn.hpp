@@ -29,6 +29,7 @@
 #include "../gemm/os_blas.hpp"
 
 #include "cpu_rnn_pd.hpp"
+#include "jit_avx512_core_rnn_small_batch_cell.hpp"
 #include "jit_uni_rnn_common_postgemm_dispatcher.hpp"
 #include "rnn_utils.hpp"
 
@@ -115,7 +116,12 @@ struct _ref_rnn_common_t : public primitive_impl_t {
                     && everyone_is(
                             weights_type, weights_iter_dt, weights_layer_dt)
                     && this->set_default_params() == status::success
-                    && this->with_bias();
+                    && this->with_bias()
+                    && IMPLICATION(
+                            this->with_peephole() || this->with_projection(),
+                            aprop == prop_kind::forward)
+                    && IMPLICATION(this->with_projection(),
+                            weights_type != data_type::s8);
             if (!ok) return status::unimplemented;
 
             init_conf(rnn_, *this->desc(), this->src_md(0), this->src_md(1),
@@ -162,6 +168,9 @@ struct _ref_rnn_common_t : public primitive_impl_t {
             set_conf(rnn_, *this->desc(), this->weights_md(0),
                     this->weights_md(1), this->diff_weights_md(0),
                     this->diff_weights_md(1));
+            // the test mode replaces the non-linearities of the cell
+            if (this->attr()->rnn_tparams_.test_mode_)
+                rnn_.use_small_batch_cell = false;
 
             size_t scratchpad_sz {0}, ws_sz {0};
             get_scratchpad_and_workspace_sizes(rnn_, scratchpad_sz, ws_sz);
@@ -194,14 +203,21 @@ struct _ref_rnn_common_t : public primitive_impl_t {
                     key_rnn_ptrs_wei_iter, sizeof(float *) * ptr_wei_sz);
             scratchpad.book(key_rnn_ptrs_bia, sizeof(float *) * ptr_wei_sz);
             scratchpad.book(key_rnn_gates,
-                    sizeof(scratch_data_t) * rnn_.scratch_gates_size);
-            scratchpad.book(
-                    key_rnn_cell, sizeof(acc_data_t) * rnn_.scratch_cell_size);
+                    sizeof(scratch_data_t) * rnn_.scratch_gates_size
+                                    * rnn_.wavefront_nthr
+                            + rnn_.wavefront_progress_size);
+            scratchpad.book(key_rnn_cell,
+                    sizeof(acc_data_t) * rnn_.scratch_cell_size
+                            * rnn_.wavefront_nthr);
         }
     };
 
     _ref_rnn_common_t(const pd_t *apd)
-        : primitive_impl_t(apd), rnn_postgemm_(nullptr) {
+        : primitive_impl_t(apd)
+        , rnn_postgemm_(nullptr)
+        , small_batch_cell_(nullptr)
+        , resident_states_(nullptr)
+        , resident_c_states_(nullptr) {
         /// @todo set max_feature_size assuming that we limit the number of
         /// iterations and layer to one if slc != dic and sic != dic
         /// respectively
@@ -242,8 +258,15 @@ struct _ref_rnn_common_t : public primitive_impl_t {
                 break;
             default: break;
         }
+        if (pd()->rnn_.use_small_batch_cell) {
+            small_batch_cell_ = new rnn_small_batch_cell_t<src_type>(
+                    pd()->rnn_, pd()->cell_kind());
+            cell_func = &class_name::cell_execution_small_batch;
+        }
 
-        grid_computation = &class_name::linear_execution;
+        grid_computation = pd()->rnn_.use_wavefront
+                ? &class_name::wavefront_execution
+                : &class_name::linear_execution;
 
         size_t scratchpad_size, workspace_size;
         rnn_utils::set_offsets(pd()->rnn_, ws_gates_offset_, ws_states_offset_,
@@ -252,21 +275,49 @@ struct _ref_rnn_common_t : public primitive_impl_t {
                 scratch_cell_offset_, scratchpad_size, workspace_size);
     }
 
-    ~_ref_rnn_common_t() { delete rnn_postgemm_; }
+    ~_ref_rnn_common_t() {
+        delete rnn_postgemm_;
+        delete small_batch_cell_;
+        free(resident_states_);
+        free(resident_c_states_);
+    }
+
+    virtual status_t init() override {
+        if (!pd()->is_stateful()) return status::success;
+
+        // the resident states start from zero, as if no src_iter were
+        // passed to the first execution
+        const rnn_utils::rnn_conf_t &rnn = pd()->rnn_;
+        const size_t states_nelems
+                = (size_t)rnn.n_layer * rnn.n_dir * rnn.mb * rnn.states_ws_ld;
+        resident_states_ = (src_data_t *)malloc(
+                sizeof(src_data_t) * states_nelems, 64);
+        resident_c_states_
+                = (float *)malloc(sizeof(float) * states_nelems, 64);
+        if (utils::any_null(resident_states_, resident_c_states_))
+            return status::out_of_memory;
+        utils::array_set(resident_states_, (src_data_t)0, states_nelems);
+        utils::array_set(resident_c_states_, 0.f, states_nelems);
+        return status::success;
+    }
 
     // typedef typename prec_traits::type data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
+        if (!seq_lengths_ok(ctx)) return status::invalid_arguments;
         execute_(ctx);
         return status::success;
     }
 
 private:
     void execute_(const exec_ctx_t &ctx) const;
+    bool seq_lengths_ok(const exec_ctx_t &ctx) const;
     rnn_grid_execution_sig(linear_execution);
+    rnn_grid_execution_sig(wavefront_execution);
     rnn_cell_execution_sig(cell_execution);
     rnn_cell_execution_sig(cell_execution_gru);
     rnn_cell_execution_sig(cell_execution_gru_lbr);
+    rnn_cell_execution_sig(cell_execution_small_batch);
     rnn_gemm_sig(gemm);
     rnn_gemm_sig(packed_gemm);
     rnn_bias_prepare_sig(bias_prepare);
@@ -290,8 +341,11 @@ private:
     template <typename dst_data_t>
     void copy_res_layer(const rnn_utils::rnn_conf_t &rnn,
             dst_data_t *dst_layer_, acc_data_t *diff_src_layer_,
-            const src_data_t *ws_states_,
-            const acc_data_t *ws_diff_states_) const;
+            const src_data_t *ws_states_, const acc_data_t *ws_diff_states_,
+            const int32_t *seq_lengths) const;
+
+    void copy_resident_states(const rnn_utils::rnn_conf_t &rnn,
+            src_data_t *ws_states_, float *ws_c_states_, bool restore) const;
 
     template <typename output_data_t>
     void copy_res_iter(const rnn_utils::rnn_conf_t &rnn,
@@ -311,6 +365,10 @@ private:
     size_t scratch_gates_offset_;
     size_t scratch_cell_offset_;
     rnn_postgemm_dispatcher<aprop, src_type, scratch_type> *rnn_postgemm_;
+    rnn_small_batch_cell_t<src_type> *small_batch_cell_;
+    // states kept between the executions of a stateful primitive
+    src_data_t *resident_states_;
+    float *resident_c_states_;
 
     grid_execution_f grid_computation;
     cell_execution_f cell_func;
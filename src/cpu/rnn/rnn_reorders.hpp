@@ -19,6 +19,7 @@
 
 #include <assert.h>
 
+#include "cpu_isa_traits.hpp"
 #include "cpu_reorder_pd.hpp"
 #include "dnnl_thread.hpp"
 #include "gemm/gemm_pack.hpp"
@@ -428,6 +429,166 @@ private:
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 };
 
+/* Packs f32 or bf16 weights into the bf16 packed format used by the bf16
+ * packed gemm. The conversion to bf16 and the transposition (when the
+ * source and the packed formats do not match) are done together in the
+ * scratchpad prior to packing. */
+template <data_type_t type_i>
+struct rnn_weights_reorder_t<type_i, data_type::bf16>
+    : public primitive_impl_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("rnn_weights_reorder", rnn_weights_reorder_t);
+
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            using namespace status;
+
+            const memory_desc_wrapper id(src_md), od(dst_md);
+            bool args_ok = true && id.data_type() == type_i
+                    && od.data_type() == data_type::bf16
+                    && od.format_kind() == format_kind::rnn_packed
+                    && utils::one_of(od.rnn_packed_desc().format, dnnl_ldigo_p,
+                            dnnl_ldgoi_p)
+                    && attr->has_default_values();
+            if (!args_ok) return invalid_arguments;
+
+            format_tag_t itag = id.matches_one_of_tag(
+                    format_tag::ldigo, format_tag::ldgoi);
+            if (itag == format_tag::undef) return invalid_arguments;
+
+            if (!mayiuse(avx512_core)) return unimplemented;
+
+            auto _pd = new pd_t(
+                    engine, attr, src_engine, src_md, dst_engine, dst_md);
+            if (_pd == nullptr) return out_of_memory;
+            if (_pd->init() != success) {
+                delete _pd;
+                return unimplemented;
+            }
+            _pd->itag_ = itag;
+            _pd->init_info();
+            _pd->init_scratchpad_md();
+            return safe_ptr_assign<reorder_pd_t>(*reorder_pd, _pd);
+        }
+
+        format_tag_t itag_;
+
+        status_t init() {
+            status_t status = cpu_reorder_pd_t::init();
+            if (status != status::success) return status;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+    private:
+        void init_scratchpad() {
+            const memory_desc_wrapper id(src_md());
+            const memory_desc_wrapper od(dst_md());
+            const rnn_packed_desc_t &rnn_pdata = od.rnn_packed_desc();
+
+            format_tag_t itag = id.matches_one_of_tag(
+                    format_tag::ldigo, format_tag::ldgoi);
+            bool cross_case
+                    = (itag == format_tag::ldigo
+                              && rnn_pdata.format == rnn_packed_format::ldgoi_p)
+                    || (itag == format_tag::ldgoi
+                            && rnn_pdata.format == rnn_packed_format::ldigo_p);
+            const bool need_copy = cross_case || type_i != data_type::bf16;
+            const size_t sz
+                    = need_copy ? id.nelems() * sizeof(bfloat16_t) : 0;
+
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(key_reorder_rnn_weights_transposition, sz);
+        }
+    };
+
+    rnn_weights_reorder_t(const pd_t *apd) : primitive_impl_t(apd) {}
+
+private:
+    typedef typename prec_traits<type_i>::type in_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        auto input = CTX_IN_MEM(const in_data_t *, DNNL_ARG_FROM);
+        auto output = CTX_OUT_MEM(bfloat16_t *, DNNL_ARG_TO);
+        const memory_desc_wrapper &input_d = pd()->src_md();
+        const memory_desc_wrapper &output_d = pd()->dst_md();
+        const auto &dims = input_d.dims();
+        const rnn_packed_desc_t &rnn_pdata = output_d.rnn_packed_desc();
+        const int L = dims[0];
+        const int D = dims[1];
+        const int I = dims[2];
+        const int G = dims[3];
+        const int O = dims[4];
+
+        /* Pack */
+        const bool from_igo = pd()->itag_ == format_tag::ldigo;
+        const bool to_igo = rnn_pdata.format == dnnl_ldigo_p;
+        int n_parts = rnn_pdata.n_parts;
+        const size_t *size_packed_cell = rnn_pdata.part_pack_size;
+        const int *parts = rnn_pdata.parts;
+        const int n = rnn_pdata.n;
+
+        /* Convert to bf16 and transpose weights prior to packing to ensure
+         * that packed GEMM algorithm will be dispatched */
+        bfloat16_t *input_tr = (bfloat16_t *)input;
+        if (from_igo != to_igo || type_i != data_type::bf16) {
+            using namespace memory_tracking::names;
+            input_tr = ctx.get_scratchpad_grantor().template get<bfloat16_t>(
+                    key_reorder_rnn_weights_transposition);
+            const int M = to_igo ? G * O : I;
+            const int N = to_igo ? I : G * O;
+            if (from_igo != to_igo) {
+                parallel_nd(L * D, N, [&](int ld, int i) {
+                    for (int j = 0; j < M; j++) {
+                        input_tr[ld * M * N + i * M + j]
+                                = (float)input[ld * M * N + j * N + i];
+                    }
+                });
+            } else {
+                parallel_nd(L * D * M * N, [&](int i) {
+                    input_tr[i] = (float)input[i];
+                });
+            }
+        }
+
+        auto off_igo = [&](int l, int d, int i, int g, int o) {
+            return l * D * I * G * O + d * I * G * O + i * G * O + g * O + o;
+        };
+        auto off_goi = [&](int l, int d, int i, int g, int o) {
+            return l * D * G * O * I + d * G * O * I + g * O * I + o * I + i;
+        };
+        const int lda = to_igo ? G * O : I;
+        const int ldb = rnn_pdata.ldb;
+        for (int l = 0; l < L; l++) {
+            for (int d = 0; d < D; d++) {
+                for (int p = 0; p < n_parts; p++) {
+                    int g = (p > 0) ? parts[p - 1] : 0;
+                    int m_p = to_igo ? parts[p] * O : I;
+                    int k_p = to_igo ? I : parts[p] * O;
+                    auto st = gemm_bf16bf16f32_pack("A", "N", "N", &m_p, &n,
+                            &k_p, &lda, &ldb,
+                            &input_tr[to_igo ? off_igo(l, d, 0, g, 0)
+                                             : off_goi(l, d, 0, g, 0)],
+                            output);
+                    assert(st == dnnl_success);
+                    MAYBE_UNUSED(st);
+                    output += size_packed_cell[p] / sizeof(bfloat16_t);
+                }
+            }
+        }
+        return status::success;
+    }
+
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+};
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
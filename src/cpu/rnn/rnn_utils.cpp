@@ -67,6 +67,10 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.is_training = utils::one_of(
             rd.prop_kind, prop_kind::forward_training, prop_kind::backward);
     rnn.is_lbr = rd.cell_kind == dnnl_lbr_gru;
+    rnn.is_lstm_peephole = rd.cell_kind == dnnl_vanilla_lstm
+            && !memory_desc_wrapper(rd.weights_peephole_desc).is_zero();
+    rnn.is_lstm_projection = rd.cell_kind == dnnl_vanilla_lstm
+            && !memory_desc_wrapper(rd.weights_projection_desc).is_zero();
 
     switch (rd.direction) {
         case dnnl_unidirectional_left2right: rnn.exec_dir = l2r; break;
@@ -105,6 +109,8 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.slc = weights_layer_d.dims()[2];
     rnn.dic = weights_layer_d.dims()[4];
     rnn.dlc = dst_layer_d.dims()[2];
+    rnn.dhc = rnn.is_lstm_projection ? rd.weights_projection_desc.dims[3]
+                                     : rnn.dic;
 
     rnn.gates_ld = rnn.dic * rnn.n_gates;
     rnn.gates_nld = rnn.mb;
@@ -127,6 +133,7 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     /* Decide wich gemm implementation to use: packed/nonpacked jit/cblas
      * and if to mergre gemm across iterations */
     bool is_f32 = rnn.dt_conf == all_f32;
+    bool is_bf16 = rnn.dt_conf == all_bf16;
     bool is_gru = utils::one_of(
             rd.cell_kind, alg_kind::vanilla_gru, alg_kind::lbr_gru);
     bool is_inference = !rnn.is_training;
@@ -134,6 +141,22 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.merge_gemm_layer
             = ((rnn.is_fwd && rnn.mb < 128) || !rnn.is_fwd) || rnn.is_int8();
     rnn.merge_gemm_iter = !(rnn.is_fwd || is_gru);
+
+    /* With a small batch a single cell GEMM cannot keep all the threads busy,
+     * so the cells of different layers on the same wavefront and the cells of
+     * the two directions are run concurrently instead. Each cell then
+     * computes its own layer GEMM, as the input of layer l at iteration t is
+     * produced while layer l runs at earlier iterations. The scheduling spins
+     * on progress counters, hence it requires all the threads to be
+     * running at the same time. */
+    const int n_chains = rnn.n_layer * rnn.n_dir;
+    rnn.use_wavefront = rnn.is_fwd && !rnn.is_int8() && rnn.mb <= 8
+            && n_chains > 1 && dnnl_thr_syncable()
+            && dnnl_get_max_threads() > 1;
+    rnn.wavefront_nthr = rnn.use_wavefront
+            ? nstl::min(dnnl_get_max_threads(), n_chains)
+            : 1;
+    if (rnn.use_wavefront) rnn.merge_gemm_layer = false;
     rnn.force_nocopy = !mayiuse(avx512_mic) && mayiuse(avx)
             && ((is_inference && (rnn.n_layer > 1 || rnn.mb < 100))
                     || (rnn.is_training && rnn.dic < 500));
@@ -141,23 +164,30 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     /* Decide to copy bias */
     rnn.copy_bias = rnn.is_int8();
 
+    /* The bf16 weights are packed for training as well: the packing is
+     * fused with the f32 -> bf16 conversion that a training step has to do
+     * anyway after each update of the master f32 weights */
+    const bool pack_bf16 = is_bf16 && mayiuse(avx512_core);
     rnn.use_layer_packed_gemm
-            = (is_f32 && pack_sgemm_supported()
-                      && (utils::one_of(weights_layer_d.format_kind(),
-                                  format_kind::any, format_kind::rnn_packed)
-                              && is_inference && rnn.n_iter == 1))
+            = (((is_f32 && pack_sgemm_supported() && is_inference)
+                       || pack_bf16)
+                      && utils::one_of(weights_layer_d.format_kind(),
+                              format_kind::any, format_kind::rnn_packed)
+                      && rnn.n_iter == 1)
             || rnn.is_int8();
     rnn.use_iter_packed_gemm
-            = (is_f32 && pack_sgemm_supported()
-                      && (utils::one_of(weights_iter_d.format_kind(),
-                                  format_kind::any, format_kind::rnn_packed)
-                              && is_inference && rnn.mb >= 16))
+            = (((is_f32 && pack_sgemm_supported() && is_inference)
+                       || pack_bf16)
+                      && utils::one_of(weights_iter_d.format_kind(),
+                              format_kind::any, format_kind::rnn_packed)
+                      && rnn.mb >= 16)
             || rnn.is_int8();
 
     // Assumption: weights datatype size is the same as state datatype size
     int sizeof_states_dt = types::data_type_size(weights_layer_d.data_type());
     rnn.states_ws_ld = get_good_ld(
-            nstl::max(rnn.slc, nstl::max(rnn.sic, rnn.dic)), sizeof_states_dt);
+            nstl::max(nstl::max(rnn.slc, rnn.sic), nstl::max(rnn.dic, rnn.dhc)),
+            sizeof_states_dt);
 
     /* Set packed gemm sizes */
     /* TODO: investigate the benefit of mixing packed and non-packed weights parts */
@@ -178,6 +208,11 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                     sgemm_pack_get_size("A", "N", "N", &m_p, &n_p, &k_p, &m_p,
                             &rnn.states_ws_ld, &parts_pack_size[p], &pack_part);
                     break;
+                case all_bf16:
+                    gemm_bf16bf16f32_pack_get_size("A", "N", "N", &m_p, &n_p,
+                            &k_p, &m_p, &rnn.states_ws_ld, &parts_pack_size[p],
+                            &pack_part);
+                    break;
                 case u8u8u8f32:
                 case f32u8f32f32:
                 case u8u8u8u8:
@@ -192,8 +227,8 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             weights_pack_size += rnn.n_layer * rnn.n_dir * parts_pack_size[p];
         }
 
-        // NOTE: pack is updated only for f32. We force pack for int8
-        do_pack = (rnn.dt_conf == all_f32) ? pack : true;
+        // NOTE: pack is updated only for f32 and bf16. We force pack for int8
+        do_pack = utils::one_of(rnn.dt_conf, all_f32, all_bf16) ? pack : true;
         comp_offset = weights_pack_size;
         const bool need_compensation = rnn.is_int8();
         weights_pack_size += (need_compensation ? rnn.n_layer * rnn.n_dir : 0)
@@ -209,6 +244,18 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                 rnn.weights_iter_pack_size, rnn.n_parts_weights_iter,
                 rnn.parts_weights_iter, rnn.part_weights_iter_pack_size,
                 rnn.weights_iter_comp_offset, rnn.sic);
+
+    /* With a few rows the recurrent GEMM is a handful of GEMVs, so for LSTM
+     * and GRU inference the GEMV is fused with the non-linearities of the
+     * cell, which saves the GEMM call and the round trip of the gates
+     * through memory */
+    rnn.use_small_batch_cell = is_inference && rnn.is_fwd
+            && rnn.mb <= small_batch_cell_max_mb && mayiuse(avx512_core)
+            && utils::one_of(rnn.dt_conf, all_f32, all_bf16)
+            && utils::one_of(
+                    rd.cell_kind, alg_kind::vanilla_lstm, alg_kind::vanilla_gru)
+            && !rnn.is_lstm_peephole && !rnn.is_lstm_projection
+            && !rnn.use_iter_packed_gemm;
 }
 
 void rnn_utils::set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
@@ -235,6 +282,8 @@ void rnn_utils::set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     };
     set_dims(weights_layer_d, rnn.weights_layer_ld, rnn.weights_layer_nld);
     set_dims(weights_iter_d, rnn.weights_iter_ld, rnn.weights_iter_nld);
+    // the small batch cell reads the recurrent weights by rows
+    if (!is_ldigo(weights_iter_d)) rnn.use_small_batch_cell = false;
     if (!rnn.is_fwd) {
         set_dims(diff_weights_layer_d, rnn.diff_weights_layer_ld,
                 rnn.diff_weights_layer_nld);
@@ -279,6 +328,10 @@ void rnn_utils::set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
     rnn.scratch_gates_size = rnn.n_iter_scratch_gates * rnn.gates_nld
             * rnn.gates_ws_ld * sizeof_scratch_dt;
+    rnn.wavefront_progress_size = rnn.use_wavefront
+            ? (size_t)rnn.n_layer * rnn.n_dir * wavefront_progress_stride
+                    * sizeof(int32_t)
+            : (size_t)0;
 
     /* set other sizes */
     /// scratchpad buffer for each cell to hold intermediate data in gru/lbr_gru
@@ -287,6 +340,11 @@ void rnn_utils::set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             : (rd.cell_kind == alg_kind::vanilla_gru ? (size_t)rnn.states_nld
                                     * rnn.states_ws_ld * sizeof_acc_dt
                                                      : 0);
+    /// LSTM projection needs the unprojected cell output and the f32
+    /// projection result
+    if (rnn.is_lstm_projection)
+        rnn.scratch_cell_size
+                = (size_t)2 * rnn.states_nld * rnn.states_ws_ld * sizeof_acc_dt;
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dic * sizeof_acc_dt;
     rnn.ws_grid_comp_size = (size_t)rnn.is_lbr * rnn.is_training * rnn.n_layer
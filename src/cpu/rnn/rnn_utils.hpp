@@ -27,8 +27,8 @@
             float *c_states_t_l_, src_data_t *states_tm1_l_, \
             float *c_states_tm1_l_, acc_data_t *diff_states_t_l_, \
             acc_data_t *diff_states_t_lp1_, acc_data_t *diff_states_tp1_l_, \
-            float *bias_, src_data_t *ws_grid_, scratch_data_t *scratch_cell_) \
-            const
+            float *bias_, src_data_t *ws_grid_, scratch_data_t *scratch_cell_, \
+            const float *weights_peephole_) const
 
 #define rnn_cell_execution_sig(f) \
     void f(const rnn_utils::rnn_conf_t &rnn, src_data_t *states_t_l_, \
@@ -40,7 +40,8 @@
             acc_data_t *diff_w_layer_, acc_data_t *diff_w_iter_, \
             acc_data_t *diff_bias_, src_data_t *ws_gates_, \
             scratch_data_t *scratch_gates_, src_data_t *ws_grid_, \
-            scratch_data_t *scratch_cell_) const
+            scratch_data_t *scratch_cell_, const float *weights_peephole_, \
+            const weights_data_t *w_projection_) const
 
 #define rnn_grid_execution_sig(f) \
     void f(const rnn_utils::rnn_conf_t &rnn, weights_data_t **weights_layer_, \
@@ -49,7 +50,9 @@
             acc_data_t *ws_diff_states_, src_data_t *ws_gates_, \
             src_data_t *ws_grid_, scratch_data_t *scratch_gates_, \
             scratch_data_t *scratch_cell_, acc_data_t *diff_weights_layer_, \
-            acc_data_t *diff_weights_iter_, acc_data_t *diff_bias_) const
+            acc_data_t *diff_weights_iter_, acc_data_t *diff_bias_, \
+            const int32_t *seq_lengths_, const float *weights_peephole_, \
+            const weights_data_t *weights_projection_) const
 
 #define rnn_gemm_sig(f) \
     void f(const char transA, const char transB, int m, int n, int k, \
@@ -78,6 +81,12 @@ namespace cpu {
 
 namespace rnn_utils {
 
+/* Progress counters of the wavefront execution are one cache line apart */
+const int wavefront_progress_stride = 64 / sizeof(int32_t);
+
+/* Largest batch computed by the small batch cell */
+const int small_batch_cell_max_mb = 4;
+
 enum execution_direction_t {
     l2r,
     r2l,
@@ -100,6 +109,9 @@ struct rnn_conf_t {
     int n_layer, n_iter, n_dir, n_gates, n_states;
     int mb;
     int slc, sic, dic, dlc;
+    /* Width of the hidden state, differs from dic only for LSTM with
+     * projection */
+    int dhc;
     int gates_ld, gates_nld, gates_ws_ld;
     int n_parts_weights_layer, parts_weights_layer[DNNL_RNN_MAX_N_PARTS];
     int n_parts_weights_iter, parts_weights_iter[DNNL_RNN_MAX_N_PARTS];
@@ -117,7 +129,7 @@ struct rnn_conf_t {
     int diff_weights_iter_ld, diff_weights_iter_nld;
     int states_nld, states_ws_ld;
     int weights_iter_compensation_size, weights_layer_compensation_size;
-    bool is_fwd, is_training, is_lbr;
+    bool is_fwd, is_training, is_lbr, is_lstm_peephole, is_lstm_projection;
     bool use_workspace;
 
     /* Size of workspace for each tensor in bytes */
@@ -128,6 +140,18 @@ struct rnn_conf_t {
             use_iter_packed_gemm;
     int n_iter_scratch_gates;
 
+    /* Wavefront execution: independent cells are run concurrently by
+     * wavefront_nthr threads, each one with its own scratch gates and cell
+     * buffers. Progress of each (layer, direction) chain is tracked with a
+     * counter placed after the per-thread scratch gates. */
+    bool use_wavefront;
+    int wavefront_nthr;
+    size_t wavefront_progress_size;
+
+    /* Small batch inference: the recurrent GEMM and the non-linearities of
+     * the cell are computed by a single jitted kernel */
+    bool use_small_batch_cell;
+
     inline bool is_int8() const {
         return utils::one_of(
                 dt_conf, u8u8u8f32, f32u8f32f32, u8u8u8u8, f32u8f32u8);
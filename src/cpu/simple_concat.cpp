@@ -41,10 +41,13 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
         const memory_desc_wrapper i_d(pd()->src_md(a));
         const memory_desc_wrapper o_d(pd()->src_image_md(a));
 
-        iptrs[a] = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a)
-                + i_d.blk_off(0);
+        auto i_base_ptr
+                = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a);
+        iptrs[a] = i_base_ptr + i_d.blk_off(0);
         optrs[a] = o_base_ptr + o_d.blk_off(0);
-        nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
+        nelems_to_copy[a] = pd()->is_in_place(a, i_base_ptr, o_base_ptr)
+                ? 0
+                : pd()->nelems_to_concat(i_d);
         for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
             if (i < perm[concat_dim])
                 is[a][i] = size_t(i_d.blocking_desc().strides[iperm[i]]);
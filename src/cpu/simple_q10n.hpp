@@ -53,6 +53,11 @@ struct qz_a1b0<in_t, out_t,
     out_t operator()(in_t in) { return (out_t)in; }
 };
 
+template <>
+struct qz_a1b0<float, bfloat16_t> {
+    bfloat16_t operator()(float in) { return (bfloat16_t)in; }
+};
+
 /* Quantization with alpha == 1 */
 template <typename in_t, typename out_t>
 struct qz_a1 {
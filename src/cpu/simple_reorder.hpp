@@ -18,6 +18,7 @@
 #define CPU_SIMPLE_REORDER_HPP
 
 #include <assert.h>
+#include <type_traits>
 
 #include "bfloat16.hpp"
 #include "c_types_map.hpp"
@@ -30,7 +31,9 @@
 #include "tag_traits.hpp"
 
 #include "cpu_isa_traits.hpp"
+#include "cpu_primitive.hpp"
 #include "simple_q10n.hpp"
+#include "weights_cache.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -70,7 +73,7 @@ struct conv_s8s8 {};
 #define DECLARE_COMMON_PARAMS() \
     const memory_desc_wrapper &input_d = pd->src_md(); \
     const memory_desc_wrapper &output_d = pd->dst_md(); \
-    const float alpha = pd->alpha(); \
+    const float alpha = scales[0]; \
     MAYBE_UNUSED(alpha); \
     const float beta = pd->beta(); \
     MAYBE_UNUSED(beta);
@@ -125,7 +128,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
 
         static constexpr bool w_groups = tag_o == format_tag::hwigo;
@@ -139,7 +142,6 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const int H = dims[w_groups + 2];
         const int W = dims[w_groups + 3];
 
-        const float *scales = pd->attr()->output_scales_.scales_;
         const size_t D_mask = utils::array_product(input_d.dims(),
                 math::ilog2q(pd->attr()->output_scales_.mask_ + 1));
 
@@ -186,6 +188,12 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                                         format_tag::gOIhw2i8o4i,
                                         format_tag::gOIhw4i16o4i)),
                 spec::conv_s8s8>::type> {
+    static constexpr int blk_size() {
+        return tag_traits<tag_o>::inner_blks == ib::_4b4c
+                ? 4
+                : tag_traits<tag_o>::inner_blks == ib::_2c8b4c ? 8 : 16;
+    }
+
     static bool is_applicable(const memory_desc_wrapper &input_d,
             const memory_desc_wrapper &output_d, const primitive_attr_t *attr) {
         using namespace format_tag;
@@ -204,20 +212,42 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 && (D_mask == 1 || D_mask == (size_t)g * oc);
     }
 
-    GET_SCRATCHPAD_SIZE_ZERO();
+    /* With fewer output channel blocks than threads the input channel blocks
+     * are split between the threads as well. Each thread then accumulates
+     * the compensation in its own copy, the copies are summed up at the
+     * end. */
+    static bool split_ic(const memory_desc_wrapper &output_d) {
+        using namespace format_tag;
+        const bool w_groups = !utils::one_of(tag_o, OIw4i16o4i, OIhw4i16o4i);
+        const auto &pdims = output_d.padded_dims();
+        const dim_t G = w_groups ? pdims[0] : 1;
+        const dim_t NB_OC = pdims[w_groups + 0] / blk_size();
+        const dim_t NB_IC = pdims[w_groups + 1] / blk_size();
+        return order_keep && NB_IC > 1
+                && G * NB_OC < (dim_t)dnnl_get_max_threads();
+    }
+
+    static size_t get_scratchpad_size(const memory_desc_wrapper &input_d,
+            const memory_desc_wrapper &output_d) {
+        if (!split_ic(output_d)) return 0;
+        const bool w_groups = !utils::one_of(
+                tag_o, format_tag::OIw4i16o4i, format_tag::OIhw4i16o4i);
+        const auto &pdims = output_d.padded_dims();
+        const dim_t G = w_groups ? pdims[0] : 1;
+        return sizeof(int32_t) * G * pdims[w_groups + 0]
+                * dnnl_get_max_threads();
+    }
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
         using namespace format_tag;
 
         static constexpr bool w_groups
                 = !utils::one_of(tag_o, OIw4i16o4i, OIhw4i16o4i);
         constexpr int is_1d = utils::one_of(tag_o, gOIw4i16o4i, OIw4i16o4i);
-        constexpr int blksize = tag_traits<tag_o>::inner_blks == ib::_4b4c
-                ? 4
-                : tag_traits<tag_o>::inner_blks == ib::_2c8b4c ? 8 : 16;
+        constexpr int blksize = blk_size();
 
         const auto &plain_d = order_keep ? input_d : output_d;
         const auto &dims = input_d.dims();
@@ -232,7 +262,6 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const int H = is_1d ? 1 : dims[w_groups + 2];
         const int W = dims[w_groups + 3 - is_1d];
 
-        const float *scales = pd->attr()->output_scales_.scales_;
         const size_t D_mask = utils::array_product(input_d.dims(),
                 math::ilog2q(pd->attr()->output_scales_.mask_ + 1));
 
@@ -270,9 +299,8 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
     (is_1d ? (md).blk_off<!w_groups>(g, o, i, w) \
            : (md).blk_off<!w_groups>(g, o, i, h, w))
 
-        parallel_nd(G, NB_OC, [&](int g, int O) {
-            for (int I = 0; I < NB_IC; I++)
-                for_(int h = 0; h < H; h++)
+        auto ker_blk = [&](int32_t *c, int g, int O, int I) {
+            for_(int h = 0; h < H; h++)
             for (int w = 0; w < W; w++) {
                 auto i = &input[wei_blk_off(
                         input_d, g, i_mult * O, i_mult * I, h, w)];
@@ -282,11 +310,35 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 const int ic_block = nstl::min(blksize, IC - I * blksize);
 
                 int _offset = (g * NB_OC + O) * blksize;
-                ker(i, o, (order_keep) ? &cp[_offset] : nullptr,
+                ker(i, o, (order_keep) ? &c[_offset] : nullptr,
                         &scales[(D_mask == 1) ? 0 : _offset], oc_block,
                         ic_block);
             }
-        });
+        };
+
+        if (!split_ic(output_d)) {
+            parallel_nd(G, NB_OC, [&](int g, int O) {
+                for (int I = 0; I < NB_IC; I++)
+                    ker_blk(cp, g, O, I);
+            });
+        } else {
+            const int cp_size = G * NB_OC * blksize;
+            const int nthr_max = dnnl_get_max_threads();
+            int32_t *cp_thr = scratchpad.template get<int32_t>(
+                    memory_tracking::names::key_reorder_space);
+            parallel_nd(nthr_max * cp_size, [&](int i) { cp_thr[i] = 0; });
+
+            parallel(0, [&](const int ithr, const int nthr) {
+                for_nd(ithr, nthr, G, NB_OC, NB_IC, [&](int g, int O, int I) {
+                    ker_blk(cp_thr + ithr * cp_size, g, O, I);
+                });
+            });
+
+            parallel_nd(cp_size, [&](int i) {
+                for (int ithr = 0; ithr < nthr_max; ++ithr)
+                    cp[i] += cp_thr[ithr * cp_size + i];
+            });
+        }
 
 #undef wei_blk_off
 
@@ -325,7 +377,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
 
         constexpr bool is_1d = tag_i == format_tag::goiw;
@@ -342,7 +394,6 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
         const size_t D_mask = utils::array_product(input_d.dims(),
                 math::ilog2q(pd->attr()->output_scales_.mask_ + 1));
-        const float *scales = pd->attr()->output_scales_.scales_;
 
         assert(output_d.extra().flags
                 & memory_extra_flags::compensation_conv_s8s8);
@@ -426,7 +477,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
         using namespace format_tag;
 
@@ -532,7 +583,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
 
         constexpr int blksize = 16;
@@ -605,7 +656,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
         using namespace format_tag;
 
@@ -707,7 +758,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
 
         const auto &flat_d = order_keep ? input_d : output_d;
@@ -829,7 +880,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
 
         const auto &flat_d = order_keep ? input_d : output_d;
@@ -974,7 +1025,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
 
         assert(input_d.is_dense());
@@ -1073,7 +1124,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
         using namespace utils;
 
@@ -1181,7 +1232,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd,
             const data_t<type_i> *input, data_t<type_o> *output,
-            const memory_tracking::grantor_t &scratchpad) {
+            const float *scales, const memory_tracking::grantor_t &scratchpad) {
         DECLARE_COMMON_PARAMS();
 
         const size_t nelems = input_d.nelems();
@@ -1200,7 +1251,6 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 input_d.dims() + ndims_start, ndims_mask);
         const ptrdiff_t D_rest = nelems / D_start / D_mask;
 
-        const float *scales = pd->attr()->output_scales_.scales_;
 
         parallel_nd(D_start, D_mask, D_rest,
                 [&](ptrdiff_t ds, ptrdiff_t dm, ptrdiff_t dr) {
@@ -1261,9 +1311,19 @@ struct simple_reorder_t : public primitive_impl_t {
     virtual status_t execute(const exec_ctx_t &ctx) const override {
         auto input = CTX_IN_MEM(const data_t<type_i> *, DNNL_ARG_FROM);
         auto output = CTX_OUT_MEM(data_t<type_o> *, DNNL_ARG_TO);
-        simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL, spec>::execute(
-                pd(), input, output, ctx.get_scratchpad_grantor());
-        return status::success;
+        DEFINE_SCALES_BUFFER(scales);
+
+        auto compute = [&]() {
+            return simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
+                    spec>::execute(pd(), input, output, scales,
+                    ctx.get_scratchpad_grantor());
+        };
+
+        // the weights with s8s8 compensation are computed once per model
+        if (std::is_same<spec, cpu::spec::conv_s8s8>::value)
+            return weights_cache::execute(
+                    pd(), input, output, scales, compute);
+        return compute();
     }
 
 private:
@@ -0,0 +1,394 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+#include "cpu_primitive.hpp"
+#include "weights_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace weights_cache {
+
+namespace {
+
+int cache_flag = 0;
+std::once_flag cache_flag_once;
+
+/* An entry holds the reordered weights either in a heap buffer or in a
+ * read-only mapping of the entry file */
+struct entry_t {
+    std::shared_ptr<const char> data;
+    size_t size;
+};
+
+std::mutex cache_mutex;
+std::unordered_map<std::string, entry_t> cache;
+
+const char *cache_dir() {
+    static char path[1024] = {'\0'};
+    static std::once_flag once;
+    std::call_once(once, [&]() {
+        if (getenv("DNNL_WEIGHTS_CACHE_DIR", path, sizeof(path)) <= 0)
+            path[0] = '\0';
+    });
+    return path[0] != '\0' ? path : nullptr;
+}
+
+void print_verbose(const char *what, const reorder_pd_t *pd) {
+    if (dnnl_verbose()->level < 2) return;
+    printf("dnnl_verbose,weights_cache,%s,%s\n", what, pd->info());
+    fflush(0);
+}
+
+/* The hash of the source data is computed over 64 KB chunks in parallel. The
+ * chunk hashes are combined in order, so the result does not depend on the
+ * number of threads and may be compared across processes. */
+const size_t hash_chunk_size = 64 * 1024;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// the 64-bit finalizer of MurmurHash3
+inline uint64_t fmix(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+const uint64_t c1 = 0x87c37b91114253d5ULL;
+const uint64_t c2 = 0x4cf5ad432745937fULL;
+
+void hash_chunk(const char *data, size_t size, uint64_t &h0, uint64_t &h1) {
+    h0 = size;
+    h1 = ~(uint64_t)size;
+
+    // two independent lanes keep the multipliers busy
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t w;
+        memcpy(&w, data + i, sizeof(w));
+        h0 = rotl(h0 ^ (w * c1), 31) * c2;
+        h1 = rotl(h1 + (w * c2), 29) * c1;
+    }
+    if (i < size) {
+        uint64_t w = 0;
+        memcpy(&w, data + i, size - i);
+        h0 = rotl(h0 ^ (w * c1), 31) * c2;
+        h1 = rotl(h1 + (w * c2), 29) * c1;
+    }
+
+    h0 = fmix(h0);
+    h1 = fmix(h1 ^ h0);
+}
+
+void hash_data(const char *data, size_t size, uint64_t &h0, uint64_t &h1) {
+    const size_t nchunks = utils::div_up(size, hash_chunk_size);
+    std::vector<uint64_t> chunk_h(2 * nchunks);
+
+    parallel_nd((dim_t)nchunks, [&](dim_t c) {
+        const size_t off = c * hash_chunk_size;
+        hash_chunk(data + off, nstl::min(hash_chunk_size, size - off),
+                chunk_h[2 * c], chunk_h[2 * c + 1]);
+    });
+
+    h0 = size;
+    h1 = nchunks;
+    for (size_t c = 0; c < nchunks; ++c) {
+        h0 = fmix(rotl(h0, 27) ^ chunk_h[2 * c]) * c1;
+        h1 = fmix(rotl(h1, 31) ^ chunk_h[2 * c + 1]) * c2;
+    }
+    h0 = fmix(h0 + h1);
+    h1 = fmix(h1 + h0);
+}
+
+void append_int(std::string &key, const char *prefix, int64_t v) {
+    key += prefix;
+    key += std::to_string(v);
+}
+
+void append_hex(std::string &key, uint64_t v) {
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)v);
+    key += buf;
+}
+
+void append_float(std::string &key, const char *prefix, float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    key += prefix;
+    append_hex(key, bits);
+}
+
+void append_dims(std::string &key, const char *prefix, const dim_t *dims,
+        int ndims) {
+    key += prefix;
+    for (int d = 0; d < ndims; ++d) {
+        key += d ? "x" : "";
+        key += std::to_string(dims[d]);
+    }
+}
+
+/* Describes all the fields of @p md that affect the layout. The memory
+ * descriptor is not hashed as a whole since it may hold uninitialized
+ * padding and reserved fields. */
+void append_md(std::string &key, const char *prefix, const memory_desc_t &md) {
+    const memory_desc_wrapper mdw(&md);
+    const int ndims = mdw.ndims();
+
+    key += prefix;
+    append_int(key, ":dt", mdw.data_type());
+    append_dims(key, ":d", mdw.dims(), ndims);
+    append_dims(key, ":pd", mdw.padded_dims(), ndims);
+    append_dims(key, ":po", mdw.padded_offsets(), ndims);
+    append_int(key, ":off", mdw.offset0());
+    append_int(key, ":fk", mdw.format_kind());
+
+    if (mdw.is_blocking_desc()) {
+        const auto &bd = mdw.blocking_desc();
+        append_dims(key, ":s", bd.strides, ndims);
+        append_dims(key, ":ib", bd.inner_blks, bd.inner_nblks);
+        append_dims(key, ":ii", bd.inner_idxs, bd.inner_nblks);
+    } else if (mdw.is_wino_desc()) {
+        const auto &wd = mdw.wino_desc();
+        append_int(key, ":wf", wd.wino_format);
+        append_int(key, ":r", wd.r);
+        append_int(key, ":a", wd.alpha);
+        append_int(key, ":ic", wd.ic);
+        append_int(key, ":oc", wd.oc);
+        append_int(key, ":icb", wd.ic_block);
+        append_int(key, ":ocb", wd.oc_block);
+        append_int(key, ":ic2b", wd.ic2_block);
+        append_int(key, ":oc2b", wd.oc2_block);
+        append_float(key, ":as", wd.adj_scale);
+        append_int(key, ":sz", (int64_t)wd.size);
+    }
+
+    append_int(key, ":xf", (int64_t)md.extra.flags);
+    append_int(key, ":xm", md.extra.compensation_mask);
+    append_float(key, ":xs", md.extra.scale_adjust);
+    key += ",";
+}
+
+#ifndef _WIN32
+// the 64-bit FNV-1a hash of the key names the entry file
+uint64_t fnv1a(const std::string &s) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (char c : s) {
+        h ^= (uint8_t)c;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/* An entry file holds the key, a terminating zero and the reordered weights.
+ * The key is compared on load, so a hash collision is a mere miss. */
+std::string entry_path(const char *dir, const std::string &key) {
+    std::string path = dir;
+    path += "/dnnl_weights_";
+    append_hex(path, fnv1a(key));
+    path += ".bin";
+    return path;
+}
+
+bool map_entry(const char *dir, const std::string &key, size_t size,
+        entry_t &entry) {
+    const std::string path = entry_path(dir, key);
+    const size_t header_size = key.size() + 1;
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    void *ptr = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size == header_size + size)
+        ptr = mmap(nullptr, header_size + size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) return false;
+
+    const char *base = (const char *)ptr;
+    if (memcmp(base, key.c_str(), header_size) != 0) {
+        munmap(ptr, header_size + size);
+        return false;
+    }
+
+    const size_t map_size = header_size + size;
+    entry.data = std::shared_ptr<const char>(base + header_size,
+            [=](const char *) { munmap(ptr, map_size); });
+    entry.size = size;
+    return true;
+}
+
+/* The entry is written to a temporary file and renamed, so that concurrent
+ * readers never see a partially written entry */
+bool write_entry(const char *dir, const std::string &key, const void *data,
+        size_t size) {
+    static std::atomic<int> counter(0);
+
+    const std::string path = entry_path(dir, key);
+    std::string tmp_path = path + ".tmp";
+    append_int(tmp_path, ".", (int64_t)getpid());
+    append_int(tmp_path, ".", counter++);
+
+    FILE *fp = fopen(tmp_path.c_str(), "wb");
+    if (fp == nullptr) return false;
+    bool ok = fwrite(key.c_str(), 1, key.size() + 1, fp) == key.size() + 1
+            && fwrite(data, 1, size, fp) == size;
+    ok = fclose(fp) == 0 && ok;
+    ok = ok && rename(tmp_path.c_str(), path.c_str()) == 0;
+    if (!ok) remove(tmp_path.c_str());
+    return ok;
+}
+#endif
+
+} // namespace
+
+bool enabled() {
+    std::call_once(cache_flag_once, []() {
+        cache_flag = getenv_int("DNNL_WEIGHTS_CACHE", 0);
+    });
+    return cache_flag != 0;
+}
+
+bool make_key(std::string &key, const reorder_pd_t *pd, const void *src,
+        const float *scales) {
+    const memory_desc_wrapper src_d(pd->src_md());
+    const memory_desc_wrapper dst_d(pd->dst_md());
+    const auto *attr = pd->attr();
+
+    // the source data must be hashed as a whole, and the result must not
+    // depend on the previous content of the destination
+    const size_t src_size = src_d.size();
+    const bool ok = src_size != 0 && dst_d.size() != 0
+            && attr->post_ops_.len_ == 0
+            && attr->zero_points_.has_default_values();
+    if (!ok) return false;
+
+    uint64_t h0, h1;
+    hash_data((const char *)src, src_size, h0, h1);
+
+    // a new build of the library may produce another layout
+    const dnnl_version_t *version = dnnl_version();
+    key = "dnnl";
+    append_int(key, "_", version->major);
+    append_int(key, ".", version->minor);
+    append_int(key, ".", version->patch);
+    key += "_";
+    key += version->hash;
+    key += ",reorder,";
+    append_md(key, "src", *pd->src_md());
+    append_md(key, "dst", *pd->dst_md());
+
+    const int mask = attr->output_scales_.mask_;
+    const dim_t scales_count = oscales_count(attr, pd->dst_md());
+    append_int(key, "oscale", mask);
+    key += ":";
+    for (dim_t i = 0; i < scales_count; ++i)
+        append_float(key, i ? "," : "", scales[i]);
+
+    key += ",data:";
+    append_hex(key, h0);
+    append_hex(key, h1);
+    return true;
+}
+
+bool fetch(const reorder_pd_t *pd, const std::string &key, void *dst,
+        size_t size) {
+    entry_t entry;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(key);
+        if (it != cache.end()) entry = it->second;
+    }
+
+#ifndef _WIN32
+    const char *dir = cache_dir();
+    if (!entry.data && dir != nullptr && map_entry(dir, key, size, entry)) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache.emplace(key, entry);
+    }
+#endif
+
+    if (!entry.data || entry.size != size) return false;
+    print_verbose("hit", pd);
+
+    const char *src = entry.data.get();
+    char *d = (char *)dst;
+    const size_t nchunks = utils::div_up(size, hash_chunk_size);
+    parallel_nd((dim_t)nchunks, [&](dim_t c) {
+        const size_t off = c * hash_chunk_size;
+        memcpy(d + off, src + off, nstl::min(hash_chunk_size, size - off));
+    });
+    return true;
+}
+
+void store(const reorder_pd_t *pd, const std::string &key, const void *dst,
+        size_t size) {
+    entry_t entry;
+
+#ifndef _WIN32
+    const char *dir = cache_dir();
+    if (dir != nullptr && write_entry(dir, key, dst, size))
+        map_entry(dir, key, size, entry);
+#endif
+
+    if (!entry.data) {
+        char *data = (char *)malloc(size, 64);
+        if (data == nullptr) return;
+        memcpy(data, dst, size);
+        entry.data = std::shared_ptr<const char>(
+                data, [](const char *p) { free((void *)p); });
+        entry.size = size;
+    }
+
+    print_verbose("store", pd);
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache.emplace(key, entry);
+}
+
+} // namespace weights_cache
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_WEIGHTS_CACHE_HPP
+#define CPU_WEIGHTS_CACHE_HPP
+
+#include <string>
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "reorder_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Cache of reordered weights.
+ *
+ * Reorders of weights into the Winograd domain or into the int8 layouts with
+ * s8s8 compensation are expensive, and the same model loaded into several
+ * engines or processes reorders the same weights again and again. When the
+ * cache is enabled with the DNNL_WEIGHTS_CACHE environment variable, the
+ * result of such a reorder is stored under a key made of the reorder problem
+ * (memory descriptors and output scales) and of a 128-bit hash of the source
+ * data, and later reorders of the same data are replaced with a copy.
+ *
+ * If DNNL_WEIGHTS_CACHE_DIR names a directory, the entries are also stored
+ * there, one file per entry, and are mapped into memory on lookup, so that
+ * processes on the same machine share both the reordered weights and the
+ * pages holding them. */
+namespace weights_cache {
+
+/** Returns true if the reordered weights cache is enabled */
+bool enabled();
+
+/** Builds the key of the reorder @p pd of @p src with @p scales. Returns false
+ * if the reorder result cannot be cached. */
+bool make_key(std::string &key, const reorder_pd_t *pd, const void *src,
+        const float *scales);
+
+/** Copies the entry @p key of the reorder @p pd into @p dst if it is
+ * cached */
+bool fetch(const reorder_pd_t *pd, const std::string &key, void *dst,
+        size_t size);
+
+/** Stores @p size bytes of @p dst as the entry @p key of the reorder @p pd */
+void store(const reorder_pd_t *pd, const std::string &key, const void *dst,
+        size_t size);
+
+/** Executes the reorder @p pd of @p src into @p dst with @p scales, either by
+ * calling @p compute or by copying the cached result */
+template <typename compute_t>
+status_t execute(const reorder_pd_t *pd, const void *src, void *dst,
+        const float *scales, const compute_t &compute) {
+    std::string key;
+    if (!enabled() || !make_key(key, pd, src, scales)) return compute();
+
+    const size_t size = memory_desc_wrapper(pd->dst_md()).size();
+    if (fetch(pd, key, dst, size)) return status::success;
+
+    status_t status = compute();
+    if (status == status::success) store(pd, key, dst, size);
+    return status;
+}
+
+} // namespace weights_cache
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -22,6 +22,7 @@
 
 #include "cpu_reorder_pd.hpp"
 #include "simple_q10n.hpp"
+#include "weights_cache.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -48,7 +49,8 @@ struct wino_reorder_t : public primitive_impl_t {
                     && od.format_kind() == format_kind::wino
                     && utils::one_of(od.wino_desc().wino_format,
                             dnnl_wino_wei_aaOIoi, dnnl_wino_wei_aaOio,
-                            dnnl_wino_wei_aaOBiOo, dnnl_wino_wei_OBaaIBOIio);
+                            dnnl_wino_wei_aaOBiOo, dnnl_wino_wei_OBaaIBOIio)
+                    && attr->output_scales_.defined();
             if (!args_ok) return status::invalid_arguments;
 
             auto _pd = new pd_t(
@@ -75,7 +77,9 @@ struct wino_reorder_t : public primitive_impl_t {
     private:
         void init_scratchpad() {
             auto &o = memory_desc_wrapper(dst_md()).wino_desc();
-            size_t transform_space_size = (size_t)o.r * o.alpha * o.oc_block;
+            // every thread transforms its own blocks
+            size_t transform_space_size = (size_t)o.r * o.alpha * o.oc_block
+                    * dnnl_get_max_threads();
             size_t plain_size = (size_t)o.alpha * o.alpha * o.oc * o.ic;
 
             using namespace memory_tracking::names;
@@ -178,74 +182,71 @@ private:
         const int or_ioc_ = or_ic_ * or_oc_;
         assert(r_ == kh_ && r_ == kw_);
 
-        for_(int iic = 0; iic < ic_; iic++)
-        for (int ob = 0; ob < nb_oc_; ob++) {
-
-            const in_data_t *__restrict _inp = has_oihw_format
-                    ? input + (ob * oc_block_ * or_ic_ + iic) * kh_ * kw_
-                    : input + iic * or_oc_ + ob * oc_block_;
-            out_data_t *__restrict _out
-                    = tmp_wei + (iic * nb_oc_ + ob) * oc_block_;
-
-            parallel_nd(size_wspace_, [&](int i) { wspace[i] = 0.f; });
-
-            if (has_oihw_format) {
-                parallel_nd(
-                        r_, w_alpha_, oc_block_, [&](int ih, int j, int ioc) {
-                            for (int iw = 0; iw < r_; ++iw) {
-                                int inp_oc = ob * oc_block_ + ioc;
-                                int inp_ic = iic;
-                                in_data_t inp_v
-                                        = (inp_ic < or_ic_ && inp_oc < or_oc_)
-                                        ? _inp[ioc * or_ic_ * kh_ * kw_
-                                                + ih * kw_ + iw]
-                                        : 0.f;
-                                wspace[(ih * w_alpha_ + j) * oc_block_ + ioc]
-                                        += inp_v * g[j * r_ + iw];
-                            }
-                        });
-            } else { // hwio format case
-                parallel_nd(r_, w_alpha_, [&](int ih, int j) {
+        // the blocks are independent, so they are distributed between the
+        // threads rather than the steps of a single block transformation
+        parallel(0, [&](const int ithr, const int nthr) {
+            in_data_t *__restrict ws = wspace + ithr * size_wspace_;
+
+            for_nd(ithr, nthr, ic_, nb_oc_, [&](int iic, int ob) {
+                const in_data_t *__restrict _inp = has_oihw_format
+                        ? input + (ob * oc_block_ * or_ic_ + iic) * kh_ * kw_
+                        : input + iic * or_oc_ + ob * oc_block_;
+                out_data_t *__restrict _out
+                        = tmp_wei + (iic * nb_oc_ + ob) * oc_block_;
+
+                for (int i = 0; i < size_wspace_; ++i)
+                    ws[i] = 0.f;
+
+                if (has_oihw_format) {
+                    for_(int ih = 0; ih < r_; ++ih)
+                    for_(int j = 0; j < w_alpha_; ++j)
+                    for (int ioc = 0; ioc < oc_block_; ++ioc) {
+                        const int inp_oc = ob * oc_block_ + ioc;
+                        if (iic >= or_ic_ || inp_oc >= or_oc_) continue;
+                        for (int iw = 0; iw < r_; ++iw)
+                            ws[(ih * w_alpha_ + j) * oc_block_ + ioc]
+                                    += _inp[ioc * or_ic_ * kh_ * kw_ + ih * kw_
+                                               + iw]
+                                    * g[j * r_ + iw];
+                    }
+                } else { // hwio format case
+                    for_(int ih = 0; ih < r_; ++ih)
+                    for_(int j = 0; j < w_alpha_; ++j)
                     for (int iw = 0; iw < kw_; ++iw) {
                         const float g_multiplier = g[j * r_ + iw];
                         const in_data_t *__restrict inp_base
                                 = _inp + or_ioc_ * (iw + ih * kw_);
-                        in_data_t *__restrict wspace_base
-                                = wspace + (ih * w_alpha_ + j) * oc_block_;
+                        in_data_t *__restrict ws_base
+                                = ws + (ih * w_alpha_ + j) * oc_block_;
 
                         for (int ioc = 0; ioc < oc_block_; ++ioc) {
-                            int inp_oc = ob * oc_block_ + ioc;
-                            int inp_ic = iic;
-                            in_data_t inp_v
-                                    = (inp_ic < or_ic_ && inp_oc < or_oc_)
-                                    ? inp_base[ioc]
-                                    : 0.f;
-
-                            wspace_base[ioc] += inp_v * g_multiplier;
+                            const int inp_oc = ob * oc_block_ + ioc;
+                            if (iic >= or_ic_ || inp_oc >= or_oc_) continue;
+                            ws_base[ioc] += inp_base[ioc] * g_multiplier;
                         }
                     }
-                });
-            }
+                }
 
-            parallel_nd(
-                    w_alpha_, w_alpha_, oc_block_, [&](int i, int j, int ioc) {
-                        float t = 0;
-                        for (int k = 0; k < r_; ++k)
-                            t += g[i * r_ + k]
-                                    * wspace[(k * w_alpha_ + j) * oc_block_
-                                            + ioc];
-                        if (type_o == data_type::s8) {
-                            const float scale = (D_mask == 1)
-                                    ? scales[0]
-                                    : scales[ob * oc_block_ + ioc];
-                            _out[(i * w_alpha_ + j) * Z + ioc]
-                                    = qz_b0<in_data_t, out_data_t>()(
-                                            (in_data_t)t, scale * adj_scale_);
-                        } else {
-                            _out[(i * w_alpha_ + j) * Z + ioc] = (out_data_t)t;
-                        }
-                    });
-        }
+                for_(int i = 0; i < w_alpha_; ++i)
+                for_(int j = 0; j < w_alpha_; ++j)
+                for (int ioc = 0; ioc < oc_block_; ++ioc) {
+                    float t = 0;
+                    for (int k = 0; k < r_; ++k)
+                        t += g[i * r_ + k]
+                                * ws[(k * w_alpha_ + j) * oc_block_ + ioc];
+                    if (type_o == data_type::s8) {
+                        const float scale = (D_mask == 1)
+                                ? scales[0]
+                                : scales[ob * oc_block_ + ioc];
+                        _out[(i * w_alpha_ + j) * Z + ioc]
+                                = qz_b0<in_data_t, out_data_t>()(
+                                        (in_data_t)t, scale * adj_scale_);
+                    } else {
+                        _out[(i * w_alpha_ + j) * Z + ioc] = (out_data_t)t;
+                    }
+                }
+            });
+        });
     }
 
     void reorder_to_aaOIoi(out_data_t *__restrict output,
@@ -253,45 +254,40 @@ private:
         int32_t *__restrict dst_bias = nullptr;
         if (type_o == data_type::s8) {
             const auto bias_shift = sizeof(out_data_t) * size_wino_wei_;
-            const size_t bias_size = w_alpha_ * w_alpha_ * oc_;
-
             dst_bias = (int32_t *)(output + bias_shift);
-            utils::array_set((int32_t *)dst_bias, 0, bias_size);
         }
-        int index = 0;
-        for_(int u_h = 0; u_h < w_alpha_; u_h++)
-        for (int u_w = 0; u_w < w_alpha_; u_w++) {
-            parallel_nd(nb_oc_, oc_block_, [&](int ob, int o) {
-                int u_h_shift = u_h * w_alpha_ * ic_ * oc_;
-                int u_w_shift = u_w * ic_ * oc_;
-                int u_h_shift_b = u_h * w_alpha_ * oc_;
-                int u_w_shift_b = u_w * oc_;
-                int oc_block_shift = ob * oc_block_ * ic_ + o * ic_block_;
+        // every output channel owns its compensation entries, so the whole
+        // reorder is a single parallel region over the output channels
+        parallel_nd(nb_oc_, oc_block_, [&](int ob, int o) {
+            const int _o = ob * oc_block_;
+            const int oc_shift = _o + o;
+            const int oc_block_shift = ob * oc_block_ * ic_ + o * ic_block_;
+            for_(int u_h = 0; u_h < w_alpha_; u_h++)
+            for (int u_w = 0; u_w < w_alpha_; u_w++) {
+                const int index = u_h * w_alpha_ + u_w;
+                const int u_h_shift = u_h * w_alpha_ * ic_ * oc_;
+                const int u_w_shift = u_w * ic_ * oc_;
+                const int bias_offset
+                        = u_h * w_alpha_ * oc_ + u_w * oc_ + oc_shift;
+                int32_t bias = 0;
                 for_(int ib = 0; ib < nb_ic_; ib++)
                 for (int i = 0; i < ic_block_; i++) {
-                    int _i = ib * ic_block_;
-                    int _o = ob * oc_block_;
-                    int ic_shift = (_i + i) * oc_;
-                    int oc_shift = (_o + o);
-                    int ic_block_shift = ib * oc_block_ * ic_block_ + i;
-                    int src_offset
+                    const int _i = ib * ic_block_;
+                    const int ic_shift = (_i + i) * oc_;
+                    const int ic_block_shift = ib * oc_block_ * ic_block_ + i;
+                    const int src_offset
                             = u_h_shift + u_w_shift + ic_shift + oc_shift;
-                    int dst_offset = u_h_shift + u_w_shift + oc_block_shift
-                            + ic_block_shift;
+                    const int dst_offset = u_h_shift + u_w_shift
+                            + oc_block_shift + ic_block_shift;
 
                     output[dst_offset] = tmp_wei[src_offset];
-                    if (type_o == data_type::s8) {
-                        int bias_offset = u_h_shift_b + u_w_shift_b + oc_shift;
-                        if (index != unsign_val_in_wino_domain_)
-                            dst_bias[bias_offset]
-                                    -= (128 * (int32_t)output[dst_offset]);
-                        else
-                            dst_bias[bias_offset] = 0;
-                    }
+                    if (type_o == data_type::s8
+                            && index != unsign_val_in_wino_domain_)
+                        bias -= (128 * (int32_t)output[dst_offset]);
                 }
-            });
-            index++;
-        }
+                if (type_o == data_type::s8) dst_bias[bias_offset] = bias;
+            }
+        });
     }
 
     void reorder_to_aaOio(out_data_t *__restrict output,
@@ -386,24 +382,31 @@ private:
                                .template get<void>(memory_tracking::names::
                                                key_reorder_wino_plain);
 
-        transform(tmp_wei, input, wspace);
-
-        /* reorder to winograd domain */
-        switch (wino_format_) {
-            case dnnl_wino_wei_aaOIoi:
-                reorder_to_aaOIoi(output, tmp_wei);
-                break;
-            case dnnl_wino_wei_aaOio: reorder_to_aaOio(output, tmp_wei); break;
-            case dnnl_wino_wei_aaOBiOo:
-                reorder_to_aaOBiOo(output, tmp_wei);
-                break;
-            case dnnl_wino_wei_OBaaIBOIio:
-                reorder_to_OBaaIBOIio(output, tmp_wei);
-                break;
-            default: assert(!"Unknown wino format"); break;
-        }
+        auto compute = [&]() {
+            transform(tmp_wei, input, wspace);
+
+            /* reorder to winograd domain */
+            switch (wino_format_) {
+                case dnnl_wino_wei_aaOIoi:
+                    reorder_to_aaOIoi(output, tmp_wei);
+                    break;
+                case dnnl_wino_wei_aaOio:
+                    reorder_to_aaOio(output, tmp_wei);
+                    break;
+                case dnnl_wino_wei_aaOBiOo:
+                    reorder_to_aaOBiOo(output, tmp_wei);
+                    break;
+                case dnnl_wino_wei_OBaaIBOIio:
+                    reorder_to_OBaaIBOIio(output, tmp_wei);
+                    break;
+                default: assert(!"Unknown wino format"); break;
+            }
+
+            return status::success;
+        };
 
-        return status::success;
+        return weights_cache::execute(pd(), input, output,
+                pd()->attr()->output_scales_.scales_, compute);
     }
 
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
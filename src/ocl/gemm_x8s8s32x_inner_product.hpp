@@ -109,6 +109,7 @@ struct gemm_x8s8s32x_inner_product_fwd_t : public primitive_impl_t {
                     && dense_gemm_consitency_check(
                             src_md(), weights_md(), dst_md())
                     && attr()->has_default_values(attr_skip_mask)
+                    && attr()->output_scales_.defined()
                     && IMPLICATION(!attr()->output_scales_.has_default_values(),
                             attr()->scratchpad_mode_ == scratchpad_mode::library
                                     && one_of(attr()->output_scales_.mask_, 0,
@@ -49,6 +49,7 @@ struct ref_convolution_fwd_t : public primitive_impl_t {
                                     weights_md_.data_type, dst_md_.data_type),
                             compute_engine->mayiuse(
                                     compute::device_ext_t::khr_fp16))
+                    && attr()->output_scales_.defined()
                     && this->set_default_formats();
             if (!ok) return status::unimplemented;
 
@@ -77,6 +77,7 @@ struct ref_inner_product_fwd_t : public primitive_impl_t {
                             utils::one_of(desc()->bias_desc.data_type, u8, s8,
                                     bf16, f16, f32))
                     && attr()->output_scales_.count_ == 1
+                    && attr()->output_scales_.defined()
                     && dense_consitency_check(src_md(), weights_md(), dst_md())
                     && IMPLICATION(desc()->src_desc.data_type == f16,
                             compute_engine->mayiuse(
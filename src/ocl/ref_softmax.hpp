@@ -44,7 +44,7 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
             auto *compute_engine
                     = utils::downcast<compute::compute_engine_t *>(engine());
 
-            bool ok = true
+            bool ok = true && !is_logsoftmax()
                     && utils::one_of(desc()->prop_kind,
                             prop_kind::forward_inference,
                             prop_kind::forward_training)
@@ -112,7 +112,8 @@ struct ref_softmax_bwd_t : public primitive_impl_t {
         DECLARE_COMMON_PD_T("ref:any", ref_softmax_bwd_t);
 
         status_t init() {
-            bool ok = true && desc()->prop_kind == prop_kind::backward_data
+            bool ok = true && !is_logsoftmax()
+                    && desc()->prop_kind == prop_kind::backward_data
                     && utils::one_of(desc()->data_desc.data_type,
                             data_type::f32, data_type::bf16)
                     && set_default_formats_common()
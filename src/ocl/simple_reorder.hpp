@@ -55,6 +55,7 @@ struct simple_reorder_t : public primitive_impl_t {
                             utils::downcast<compute::compute_engine_t *>(
                                     src_engine())
                                     ->mayiuse(compute::device_ext_t::khr_fp16))
+                    && attr()->output_scales_.defined()
                     && (attr()->has_default_values()
                             || IMPLICATION(post_ops.len_ != 0,
                                     post_ops.len_ == 1
@@ -25,6 +25,10 @@ alg_t str2alg(const char *str) {
     if (!strcasecmp(STRINGIFY(_alg), str)) return _alg
     CASE(ADD);
     CASE(MUL);
+    CASE(MAX);
+    CASE(MIN);
+    CASE(SUB);
+    CASE(DIV);
 #undef CASE
     assert(!"unknown algorithm");
     return ADD;
@@ -33,6 +37,10 @@ alg_t str2alg(const char *str) {
 const char *alg2str(alg_t alg) {
     if (alg == ADD) return "ADD";
     if (alg == MUL) return "MUL";
+    if (alg == MAX) return "MAX";
+    if (alg == MIN) return "MIN";
+    if (alg == SUB) return "SUB";
+    if (alg == DIV) return "DIV";
     assert(!"unknown algorithm");
     return "unknown algorithm";
 }
@@ -40,6 +48,10 @@ const char *alg2str(alg_t alg) {
 dnnl_alg_kind_t alg2alg_kind(alg_t alg) {
     if (alg == ADD) return dnnl_binary_add;
     if (alg == MUL) return dnnl_binary_mul;
+    if (alg == MAX) return dnnl_binary_max;
+    if (alg == MIN) return dnnl_binary_min;
+    if (alg == SUB) return dnnl_binary_sub;
+    if (alg == DIV) return dnnl_binary_div;
     assert(!"unknown algorithm");
     return dnnl_alg_kind_undef;
 }
@@ -53,9 +65,8 @@ std::ostream &operator<<(std::ostream &s, const prb_t &p) {
     if (!(p.stag[0] == dnnl_nchw && p.stag[1] == dnnl_nchw))
         s << "--stag=" << p.stag << " ";
     if (p.alg != ADD) s << "--alg=" << alg2str(p.alg) << " ";
-    if (p.scale_policy != policy_t::NONE)
-        s << "--scaling=" << attr_t::scale_t::policy2str(p.scale_policy) << " ";
     if (p.inplace != true) s << "--inplace=" << bool2str(p.inplace) << " ";
+    if (!p.attr.is_def()) s << "--attr=\"" << p.attr << "\" ";
 
     s << p.sdims;
 
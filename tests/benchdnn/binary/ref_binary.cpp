@@ -25,6 +25,14 @@ void perform_op(const prb_t *p, float *d, float x, float y) {
         *d = x + y;
     } else if (p->alg == MUL) {
         *d = x * y;
+    } else if (p->alg == MAX) {
+        *d = MAX2(x, y);
+    } else if (p->alg == MIN) {
+        *d = MIN2(x, y);
+    } else if (p->alg == SUB) {
+        *d = x - y;
+    } else if (p->alg == DIV) {
+        *d = x / y;
     } else {
         assert(!"operation not supported!");
     }
@@ -37,23 +45,22 @@ int64_t map_idx_B(const prb_t *p, int64_t idx) {
     return dims_off(p->sdims[1], dims);
 }
 
-void compute_ref(const prb_t *p, const std::vector<dnn_mem_t> &src,
-        const std::vector<dnn_mem_t> &scale, dnn_mem_t &dst) {
+void compute_ref(
+        const prb_t *p, const std::vector<dnn_mem_t> &src, dnn_mem_t &dst) {
     float *dst_ptr = (float *)dst;
     const float *A = (const float *)src[0];
     const float *B = (const float *)src[1];
-    const float alpha = p->scale_policy == policy_t::NONE
-            ? 1
-            : ((const float *)scale[0])[0];
-    const float beta = p->scale_policy == policy_t::NONE
-            ? 1
-            : ((const float *)scale[1])[0];
+    const float scale = p->attr.oscale.scale;
     const auto nelems_A = src[0].nelems();
     const auto nelems_B = src[1].nelems();
 
     dnnl::impl::parallel_nd(nelems_A, [&](int64_t i) {
         int64_t idx_B = nelems_B == nelems_A ? i : map_idx_B(p, i);
-        perform_op(p, &dst_ptr[i], alpha * A[i], beta * B[idx_B]);
+        float res;
+        perform_op(p, &res, A[i], B[idx_B]);
+        res *= scale;
+        maybe_post_ops(res, dst_ptr[i], p->attr);
+        dst_ptr[i] = res;
     });
 }
 
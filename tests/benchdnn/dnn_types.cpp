@@ -209,6 +209,12 @@ attr_t::post_ops_t::kind_t attr_t::post_ops_t::str2kind(const char *str) {
     CASE(EXP);
     CASE(GELU);
     CASE(SWISH);
+    CASE(RELU_DST);
+    CASE(TANH_DST);
+    CASE(ELU_DST);
+    CASE(SQRT_DST);
+    CASE(LOGISTIC_DST);
+    CASE(EXP_DST);
 #undef CASE
     assert(!"unknown attr::post_ops::kind");
     return KIND_TOTAL;
@@ -231,6 +237,12 @@ const char *attr_t::post_ops_t::kind2str(attr_t::post_ops_t::kind_t kind) {
     CASE(EXP, "exp");
     CASE(GELU, "gelu");
     CASE(SWISH, "swish");
+    CASE(RELU_DST, "relu_dst");
+    CASE(TANH_DST, "tanh_dst");
+    CASE(ELU_DST, "elu_dst");
+    CASE(SQRT_DST, "sqrt_dst");
+    CASE(LOGISTIC_DST, "logistic_dst");
+    CASE(EXP_DST, "exp_dst");
 #undef CASE
     assert(!"unknown attr::post_ops::kind");
     return "unknown attr::post_ops::kind";
@@ -253,6 +265,12 @@ dnnl_alg_kind_t attr_t::post_ops_t::kind2dnnl_kind(
     CASE(EXP, dnnl_eltwise_exp);
     CASE(GELU, dnnl_eltwise_gelu);
     CASE(SWISH, dnnl_eltwise_swish);
+    CASE(RELU_DST, dnnl_eltwise_relu_use_dst_for_bwd);
+    CASE(TANH_DST, dnnl_eltwise_tanh_use_dst_for_bwd);
+    CASE(ELU_DST, dnnl_eltwise_elu_use_dst_for_bwd);
+    CASE(SQRT_DST, dnnl_eltwise_sqrt_use_dst_for_bwd);
+    CASE(LOGISTIC_DST, dnnl_eltwise_logistic_use_dst_for_bwd);
+    CASE(EXP_DST, dnnl_eltwise_exp_use_dst_for_bwd);
 #undef CASE
     assert(!"unknown attr::post_ops::kind");
     return dnnl_alg_kind_undef;
@@ -544,17 +562,23 @@ float compute_eltwise_fwd(attr_t::post_ops_t::kind_t kind, float src,
     using pk = attr_t::post_ops_t::kind_t;
 
     switch (kind) {
-        case pk::RELU: return scale * relu_fwd(src, alpha);
-        case pk::TANH: return scale * tanh_fwd(src);
-        case pk::ELU: return scale * elu_fwd(src, alpha);
+        case pk::RELU:
+        case pk::RELU_DST: return scale * relu_fwd(src, alpha);
+        case pk::TANH:
+        case pk::TANH_DST: return scale * tanh_fwd(src);
+        case pk::ELU:
+        case pk::ELU_DST: return scale * elu_fwd(src, alpha);
         case pk::SQUARE: return scale * square_fwd(src);
         case pk::ABS: return scale * abs_fwd(src);
-        case pk::SQRT: return scale * sqrt_fwd(src);
+        case pk::SQRT:
+        case pk::SQRT_DST: return scale * sqrt_fwd(src);
         case pk::LINEAR: return scale * linear_fwd(src, alpha, beta);
         case pk::BRELU: return scale * bounded_relu_fwd(src, alpha);
         case pk::SRELU: return scale * soft_relu_fwd(src);
-        case pk::LOGISTIC: return scale * logistic_fwd(src);
-        case pk::EXP: return scale * exp_fwd(src);
+        case pk::LOGISTIC:
+        case pk::LOGISTIC_DST: return scale * logistic_fwd(src);
+        case pk::EXP:
+        case pk::EXP_DST: return scale * exp_fwd(src);
         case pk::GELU: return scale * gelu_fwd(src);
         case pk::SWISH: return scale * swish_fwd(src, alpha);
         default: assert(!"unknown attr::post_ops::kind");
@@ -581,6 +605,12 @@ float compute_eltwise_bwd(attr_t::post_ops_t::kind_t kind, float d_dst,
         case pk::EXP: return exp_bwd(d_dst, src);
         case pk::GELU: return gelu_bwd(d_dst, src);
         case pk::SWISH: return swish_bwd(d_dst, src, alpha);
+        case pk::RELU_DST: return relu_bwd_use_dst(d_dst, src, alpha);
+        case pk::TANH_DST: return tanh_bwd_use_dst(d_dst, src);
+        case pk::ELU_DST: return elu_bwd_use_dst(d_dst, src, alpha);
+        case pk::SQRT_DST: return sqrt_bwd_use_dst(d_dst, src);
+        case pk::LOGISTIC_DST: return logistic_bwd_use_dst(d_dst, src);
+        case pk::EXP_DST: return exp_bwd_use_dst(d_dst, src);
         default: assert(!"unknown attr::post_ops::kind");
     }
     return NAN;
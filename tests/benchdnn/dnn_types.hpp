@@ -106,6 +106,12 @@ struct attr_t {
             EXP,
             GELU,
             SWISH,
+            RELU_DST,
+            TANH_DST,
+            ELU_DST,
+            SQRT_DST,
+            LOGISTIC_DST,
+            EXP_DST,
             KIND_TOTAL
         };
         static kind_t str2kind(const char *str);
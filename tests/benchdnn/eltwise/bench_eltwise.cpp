@@ -75,17 +75,23 @@ void check_correctness() {
         switch (i_alg) {
             case pk::ABS:
             case pk::EXP:
+            case pk::EXP_DST:
             case pk::GELU:
             case pk::LOGISTIC:
+            case pk::LOGISTIC_DST:
             case pk::SQRT:
+            case pk::SQRT_DST:
             case pk::SQUARE:
             case pk::SRELU:
             case pk::TANH:
+            case pk::TANH_DST:
                 // Skip everything except single alpha and beta value
                 if (i_alpha != 0 || i_beta != 0) continue;
             case pk::BRELU:
             case pk::ELU:
+            case pk::ELU_DST:
             case pk::RELU:
+            case pk::RELU_DST:
             case pk::SWISH:
                 // Test several alpha values but single beta
                 if (i_beta != 0) continue;
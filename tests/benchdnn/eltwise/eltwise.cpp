@@ -97,6 +97,7 @@ static bool check_abs_err(const prb_t *p, const float &s, const float &trh) {
                                         <= (approx_machine_eps / trh));
         }
         case alg_t::TANH:
+        case alg_t::TANH_DST:
             // catch catastrophic cancellation,
             // which occurs when err in tanh(s) is high
             // and tanh(s) is close to 1.
@@ -258,13 +259,23 @@ int doit(const prb_t *p, res_t *r) {
 
         SAFE(fill_data_bwd(p, d_dst_dt, d_dst_fp), WARN);
 
+        if (p->use_dst()) {
+            // the reference takes dst rounded to the tested data type
+            compute_ref_fwd(p, src_fp, dst_fp);
+            dst_dt = dnn_mem_t(data_desc, engine_tgt);
+            SAFE(dst_dt.reorder(dst_fp), WARN);
+            SAFE(dst_fp.reorder(dst_dt), WARN);
+            args.set(DNNL_ARG_DST, dst_dt);
+        }
+
         args.set(DNNL_ARG_DIFF_DST, d_dst_dt);
         args.set(DNNL_ARG_DIFF_SRC, p->inplace ? d_dst_dt : d_src_dt);
 
         DNN_SAFE(execute_and_wait(e, stream_tgt, args), WARN);
 
         if (bench_mode & CORR) {
-            compute_ref_bwd(p, src_fp, d_dst_fp, d_src_fp);
+            compute_ref_bwd(
+                    p, p->use_dst() ? dst_fp : src_fp, d_dst_fp, d_src_fp);
             dnn_mem_t d_src(
                     p->inplace ? d_dst_dt : d_src_dt, fp, tag, engine_tgt);
             SAFE(compare(p, src_fp, d_src_fp, d_src, r), WARN);
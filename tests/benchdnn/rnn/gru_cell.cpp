@@ -34,11 +34,14 @@ void gru_fwd_postgemm_part1_template(T func1, const prb_t &p, float *gates_,
 
     for (int64_t i = 0; i < p.mb; i++)
         for (int64_t k = 0; k < p.dic; k++) {
-            auto G0 = func1(p.linear_scales[0], gates(i, 0, k) + bias(0, k));
-            auto G1 = func1(p.linear_scales[1], gates(i, 1, k) + bias(1, k));
+            auto G0 = func1(p.linear_scales[0],
+                    maybe_deq_w(p, gates(i, 0, k), 0 * p.dic + k) + bias(0, k));
+            auto G1 = func1(p.linear_scales[1],
+                    maybe_deq_w(p, gates(i, 1, k), 1 * p.dic + k) + bias(1, k));
             gates(i, 0, k) = G0;
             gates(i, 1, k) = G1;
-            dst_iter_h(i, k) = src_iter_h(i, k) * G1;
+            dst_iter_h(i, k)
+                    = maybe_q_d(p, maybe_deq_h(p, src_iter_h(i, k)) * G1);
         }
 }
 
@@ -64,8 +67,10 @@ void gru_fwd_postgemm_part2_template(T func1, const prb_t &p, float *gates_,
     for (int64_t i = 0; i < p.mb; i++)
         for (int64_t k = 0; k < p.dic; k++) {
             double G0 = gates(i, 0, k);
-            double G2 = func1(p.linear_scales[2], gates(i, 2, k) + bias(2, k));
-            dst_iter_h(i, k) = (float)(G0 * src_iter_h(i, k) + (1.0 - G0) * G2);
+            double G2 = func1(p.linear_scales[2],
+                    maybe_deq_w(p, gates(i, 2, k), 2 * p.dic + k) + bias(2, k));
+            double h = maybe_deq_h(p, src_iter_h(i, k));
+            dst_iter_h(i, k) = maybe_q_d(p, (float)(G0 * h + (1.0 - G0) * G2));
 
             gates(i, 2, k) = G2;
         }
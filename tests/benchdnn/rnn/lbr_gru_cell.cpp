@@ -37,21 +37,26 @@ void lbr_gru_fwd_postgemm_template(T1 func1, T2 func2, const prb_t &p,
         for (int64_t j = 0; j < p.n_gates() - 1; j++)
             for (int64_t k = 0; k < p.dic; k++) {
                 gates(i, j, k) = func1(p.linear_scales[j],
-                        gates(i, j, k) + tmp_ws(i, j, k) + bias(j, k));
+                        maybe_deq_w(p, gates(i, j, k), j * p.dic + k)
+                                + maybe_deq_w(p, tmp_ws(i, j, k), j * p.dic + k)
+                                + bias(j, k));
             }
 
     for (int64_t i = 0; i < p.mb; i++)
         for (int64_t k = 0; k < p.dic; k++) {
+            const float Wh_b
+                    = maybe_deq_w(p, tmp_ws(i, 2, k), 2 * p.dic + k)
+                    + bias(3, k);
             gates(i, 2, k) = func2(p.linear_scales[2],
-                    gates(i, 2, k)
-                            + gates(i, 1, k) * (tmp_ws(i, 2, k) + bias(3, k))
-                            + bias(2, k));
+                    maybe_deq_w(p, gates(i, 2, k), 2 * p.dic + k)
+                            + gates(i, 1, k) * Wh_b + bias(2, k));
         }
 
     for (int64_t i = 0; i < p.mb; i++)
         for (int64_t k = 0; k < p.dic; k++) {
-            h_dst(i, k) = gates(i, 0, k) * src_iter_h(i, k)
-                    + (1 - gates(i, 0, k)) * gates(i, 2, k);
+            h_dst(i, k) = maybe_q_d(p,
+                    gates(i, 0, k) * maybe_deq_h(p, src_iter_h(i, k))
+                            + (1 - gates(i, 0, k)) * gates(i, 2, k));
         }
 }
 
@@ -39,42 +39,20 @@ void lstm_fwd_postgemm_template(T1 func1, T2 func2, const prb_t &p,
     const int64_t ohc = 2;
     const int64_t oho = 3;
 
-    auto maybe_deq_w = [&](float g, int64_t oc) {
-        if (!is_cfg_u8(p.cfg)) return g;
-        float scale = 1.;
-        if (p.scale_policy == policy_t::PER_OC)
-            scale = p.wei_oc_scales[oc];
-        else if (p.scale_policy == policy_t::COMMON)
-            scale = p.wei_scale;
-        scale *= p.data_scale;
-        return g / scale;
-    };
-
-    auto maybe_q_d = [&](float h) {
-        if (!is_cfg_u8(p.cfg)) return h;
-        float fp = p.data_scale * h;
-        fp = mxcsr_round(fp);
-        if (fp + p.data_shift > p.cfg[input].max)
-            fp = p.cfg[input].max - p.data_shift;
-        if (fp + p.data_shift < p.cfg[input].min)
-            fp = p.cfg[input].min - p.data_shift;
-        return fp;
-    };
-
     // run the eltwise
     dnnl::impl::parallel_nd(p.mb, [&](int64_t ib) {
         for (int64_t ih = 0; ih < p.dic; ih++) {
             gates(ib, 0, ih) = func1(p.linear_scales[0],
-                    maybe_deq_w(gates(ib, 0, ih), 0 * p.dic + ih)
+                    maybe_deq_w(p, gates(ib, 0, ih), 0 * p.dic + ih)
                             + bias(0, ih));
             gates(ib, 1, ih) = func1(p.linear_scales[1],
-                    maybe_deq_w(gates(ib, 1, ih), 1 * p.dic + ih)
+                    maybe_deq_w(p, gates(ib, 1, ih), 1 * p.dic + ih)
                             + bias(1, ih));
             gates(ib, 2, ih) = func2(p.linear_scales[2],
-                    maybe_deq_w(gates(ib, 2, ih), 2 * p.dic + ih)
+                    maybe_deq_w(p, gates(ib, 2, ih), 2 * p.dic + ih)
                             + bias(2, ih));
             gates(ib, 3, ih) = func1(p.linear_scales[3],
-                    maybe_deq_w(gates(ib, 3, ih), 3 * p.dic + ih)
+                    maybe_deq_w(p, gates(ib, 3, ih), 3 * p.dic + ih)
                             + bias(3, ih));
             for (int64_t ig = 0; ig < 4; ig++) {
                 print(80,
@@ -86,7 +64,7 @@ void lstm_fwd_postgemm_template(T1 func1, T2 func2, const prb_t &p,
             float tmp = gates(ib, ohf, ih) * src_iter_c(ib, ih)
                     + gates(ib, ohi, ih) * gates(ib, ohc, ih);
             dst_iter_c(ib, ih) = tmp;
-            h_dst(ib, ih) = maybe_q_d(
+            h_dst(ib, ih) = maybe_q_d(p,
                     gates(ib, oho, ih) * func2(p.linear_cscale, tmp));
             print(80, "recomp tmp(%a) cin(%a) ht(%a)\n", tmp,
                     src_iter_c(ib, ih), h_dst(ib, ih));
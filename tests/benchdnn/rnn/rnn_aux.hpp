@@ -80,6 +80,10 @@ void scale(int64_t dimc, int64_t dimr, int64_t ld_src, float *src_, float scale,
         bool round = false);
 void gates_reduction(const prb_t &p, const float *b_gates_, float *diff_bias_);
 
+float maybe_deq_w(const prb_t &p, float g, int64_t oc);
+float maybe_deq_h(const prb_t &p, float h);
+float maybe_q_d(const prb_t &p, float h);
+
 int compare_dat(const prb_t &p, rnn_data_kind_t kind, dnn_mem_t &mem_dt,
         dnn_mem_t &mem_fp, res_t *r, bool final_compare);
 
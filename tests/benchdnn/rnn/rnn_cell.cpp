@@ -47,9 +47,11 @@ void rnn_fwd_postgemm(
     for (int64_t i = 0; i < p.mb; i++)
         for (int64_t j = 0; j < p.n_gates(); j++)
             for (int64_t k = 0; k < p.dic; k++) {
-                const auto tmp = activation(p, gates(i, j, k) + bias(j, k));
+                const auto tmp = activation(p,
+                        maybe_deq_w(p, gates(i, j, k), j * p.dic + k)
+                                + bias(j, k));
                 gates(i, j, k) = tmp;
-                dst_iter_h(i, j, k) = tmp;
+                dst_iter_h(i, j, k) = maybe_q_d(p, tmp);
             }
 }
 
@@ -54,4 +54,34 @@ void scale(int64_t dimc, int64_t dimr, int64_t ld_src, float *src_, float scale,
     });
 }
 
+/* int8 helpers: the reference keeps the states in the shifted s8 domain,
+ * i.e. h_s8 = data_scale * h, and the gates accumulate
+ * data_scale * weights_scale * (W * x) */
+float maybe_deq_w(const prb_t &p, float g, int64_t oc) {
+    if (!is_cfg_u8(p.cfg)) return g;
+    float scale = 1.;
+    if (p.scale_policy == policy_t::PER_OC)
+        scale = p.wei_oc_scales[oc];
+    else if (p.scale_policy == policy_t::COMMON)
+        scale = p.wei_scale;
+    scale *= p.data_scale;
+    return g / scale;
+}
+
+float maybe_deq_h(const prb_t &p, float h) {
+    if (!is_cfg_u8(p.cfg)) return h;
+    return h / p.data_scale;
+}
+
+float maybe_q_d(const prb_t &p, float h) {
+    if (!is_cfg_u8(p.cfg)) return h;
+    float fp = p.data_scale * h;
+    fp = mxcsr_round(fp);
+    if (fp + p.data_shift > p.cfg[input].max)
+        fp = p.cfg[input].max - p.data_shift;
+    if (fp + p.data_shift < p.cfg[input].min)
+        fp = p.cfg[input].min - p.data_shift;
+    return fp;
+}
+
 } // namespace rnn
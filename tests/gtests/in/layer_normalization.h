@@ -69,7 +69,7 @@ CPU_INST_TEST_CASE(
         Simple_NC, PARAMS_NC({1, 100}), PARAMS_NC({20, 8}), PARAMS_NC({2, 10}));
 
 CPU_INST_TEST_CASE(Simple_TNC, PARAMS_TNC({6, 32, 8}), PARAMS_TNC({2, 10, 4}),
-        PARAMS_TNC({2, 8, 16}));
+        PARAMS_TNC({2, 8, 16}), PARAMS_TNC({2, 8, 19}));
 
 CPU_INST_TEST_CASE(CrossCase_TNC, PARAMS_TNC_CROSS_CASE({6, 32, 8}),
         PARAMS_TNC_CROSS_CASE({2, 10, 4}), PARAMS_TNC_CROSS_CASE({2, 8, 16}));
@@ -83,3 +83,21 @@ CPU_INST_TEST_CASE(Simple_LDSNC, PARAMS_LDSNC({6, 2, 2, 32, 8}),
 CPU_INST_TEST_CASE(CrossCase_LDSNC, PARAMS_LDSNC_CROSS_CASE({6, 2, 2, 32, 8}),
         PARAMS_LDSNC_CROSS_CASE({2, 2, 2, 10, 4}),
         PARAMS_LDSNC_CROSS_CASE({2, 2, 2, 8, 16}));
+
+#define CPU_INST_TEST_CASE_BF16(str, ...) \
+    CPU_INSTANTIATE_TEST_SUITE_P( \
+            str, lnorm_test_bf16, ::testing::Values(__VA_ARGS__));
+
+CPU_INST_TEST_CASE_BF16(SimpleZeroDim, PARAMS_NC({0, 9}), PARAMS_NC({1, 0}));
+
+CPU_INST_TEST_CASE_BF16(Simple_NC, PARAMS_NC({1, 100}), PARAMS_NC({20, 8}),
+        PARAMS_NC({2, 10}), PARAMS_NC({4, 768}));
+
+CPU_INST_TEST_CASE_BF16(Simple_TNC, PARAMS_TNC({6, 32, 8}),
+        PARAMS_TNC({2, 10, 4}), PARAMS_TNC({2, 8, 19}));
+
+CPU_INST_TEST_CASE_BF16(CrossCase_TNC, PARAMS_TNC_CROSS_CASE({6, 32, 8}),
+        PARAMS_TNC_CROSS_CASE({2, 10, 4}), PARAMS_TNC_CROSS_CASE({2, 8, 19}));
+
+CPU_INST_TEST_CASE_BF16(Simple_LDSNC, PARAMS_LDSNC({6, 2, 2, 32, 8}),
+        PARAMS_LDSNC({2, 2, 2, 10, 4}));
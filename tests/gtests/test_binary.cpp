@@ -31,6 +31,10 @@ struct binary_test_params {
     memory::dims dims;
     bool expect_to_fail;
     dnnl_status_t expected_status;
+    // common output scale (0 means no scale), sum and relu post-ops
+    float oscale;
+    bool with_sum;
+    bool with_relu;
 };
 
 template <typename src_data_t, typename dst_data_t = src_data_t>
@@ -39,6 +43,65 @@ private:
     memory::data_type src_data_type;
     memory::data_type dst_data_type;
 
+    float compute_ref(const binary_test_params &p, float x, float y,
+            float dst_prev) const {
+        float d = 0;
+        switch (p.aalgorithm) {
+            case algorithm::binary_add: d = x + y; break;
+            case algorithm::binary_mul: d = x * y; break;
+            case algorithm::binary_max: d = (std::max)(x, y); break;
+            case algorithm::binary_min: d = (std::min)(x, y); break;
+            case algorithm::binary_sub: d = x - y; break;
+            case algorithm::binary_div: d = x / y; break;
+            default: assert(!"unknown algorithm");
+        }
+        if (p.oscale != 0) d *= p.oscale;
+        if (p.with_sum) d += dst_prev;
+        if (p.with_relu) d = (std::max)(d, 0.f);
+        if (dst_data_type == memory::data_type::u8
+                || dst_data_type == memory::data_type::s8) {
+            const float lbound
+                    = dst_data_type == memory::data_type::u8 ? 0 : -128;
+            const float ubound
+                    = dst_data_type == memory::data_type::u8 ? 255 : 127;
+            d = (std::min)((std::max)(nearbyintf(d), lbound), ubound);
+        }
+        return d;
+    }
+
+    void check_data(const binary_test_params &p, const memory &A,
+            const memory &B, const std::vector<float> &dst_prev,
+            const memory &C) {
+        auto A_data = map_memory<const src_data_t>(A);
+        auto B_data = map_memory<const src_data_t>(B);
+        auto C_data = map_memory<const dst_data_t>(C);
+
+        const memory::desc desc_A = A.get_desc(), desc_B = B.get_desc(),
+                           desc_C = C.get_desc();
+        const dnnl::impl::memory_desc_wrapper A_mdw(desc_A.data),
+                B_mdw(desc_B.data), C_mdw(desc_C.data);
+        const auto &dims = desc_A.data.dims;
+        const auto &dims_B = desc_B.data.dims;
+
+        const float eps = dst_data_type == memory::data_type::bf16 ? 1e-2
+                                                                   : 1e-6;
+
+        dnnl::impl::parallel_nd(dims[0], dims[1], dims[2], dims[3],
+                [&](memory::dim n, memory::dim c, memory::dim h,
+                        memory::dim w) {
+                    if (is_current_test_failed()) return;
+
+                    const auto C_off = C_mdw.off(n, c, h, w);
+                    const float x = A_data[A_mdw.off(n, c, h, w)];
+                    const float y = B_data[B_mdw.off(dims_B[0] == 1 ? 0 : n,
+                            dims_B[1] == 1 ? 0 : c, dims_B[2] == 1 ? 0 : h,
+                            dims_B[3] == 1 ? 0 : w)];
+                    const float ref = compute_ref(p, x, y, dst_prev[C_off]);
+                    const float got = C_data[C_off];
+                    ASSERT_NEAR(got, ref, eps * (std::max)(1.f, fabsf(ref)));
+                });
+    }
+
 protected:
     virtual void SetUp() {
         src_data_type = data_traits<src_data_t>::data_type;
@@ -49,9 +112,10 @@ protected:
         SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
                 "GPU does not support binary yet.");
         // TODO: remove me
-        SKIP_IF(src_data_type != memory::data_type::f32
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu
+                        && src_data_type != memory::data_type::f32
                         && src_data_type != memory::data_type::bf16,
-                "Non-f32 data types are not supported yet.");
+                "GPU supports f32 and bfloat16 data types only.");
 
         SKIP_IF(get_test_engine_kind() == engine::kind::gpu
                         && src_data_type == memory::data_type::bf16,
@@ -71,64 +135,81 @@ protected:
         auto eng = engine(get_test_engine_kind(), 0);
         auto strm = stream(eng);
 
-        std::vector<memory::desc> srcs_md;
-        std::vector<memory> srcs;
-
-        memory::dims dims_B;
-        for (int i_case = 0;; ++i_case) {
-            if (i_case == 0) {
-                dims_B = p.dims;
-            } else if (i_case == 1) {
-                dims_B[0] = p.dims[0];
-            } else if (i_case == 2) {
-                dims_B[0] = 1;
-                dims_B[1] = p.dims[1];
-            } else if (i_case == 3) {
-                dims_B[1] = p.dims[1];
-                dims_B[2] = p.dims[2];
-            } else if (i_case == 4) {
-                dims_B[0] = p.dims[0];
-                dims_B[2] = p.dims[2];
-                dims_B[3] = p.dims[3];
-            } else if (i_case == 5) {
-                dims_B[0] = 1;
-            } else {
-                break;
-            }
+        primitive_attr attr;
+        if (p.oscale != 0) attr.set_output_scales(0, {p.oscale});
+        post_ops ops;
+        if (p.with_sum) ops.append_sum(1.f);
+        if (p.with_relu)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        attr.set_post_ops(ops);
+
+        // tensor, scalar, per-channel, per-spatial and partial broadcasts
+        const memory::dims &dims = p.dims;
+        const std::vector<memory::dims> all_dims_B = {dims, {1, 1, 1, 1},
+                {1, dims[1], 1, 1}, {1, 1, dims[2], dims[3]},
+                {dims[0], dims[1], 1, 1}, {1, dims[1], dims[2], dims[3]}};
 
-            auto desc_A = memory::desc(p.dims, src_data_type, p.srcs_format[0]);
+        for (const auto &dims_B : all_dims_B) {
+            auto desc_A = memory::desc(dims, src_data_type, p.srcs_format[0]);
             auto mem_A = memory(desc_A, eng);
 
             auto desc_B = memory::desc(dims_B, src_data_type, p.srcs_format[1]);
             auto mem_B = memory(desc_B, eng);
-            if (dims_B.size() < p.dims.size()) {
-                for (size_t d = dims_B.size(); d < p.dims.size(); ++d)
-                    dims_B[d] = 1;
-                desc_B = desc_B.reshape(dims_B);
-            }
 
-            auto desc_C = memory::desc(p.dims, dst_data_type, p.dst_format);
+            auto desc_C = memory::desc(dims, dst_data_type, p.dst_format);
 
 #define ASSIGN_PD(desc, pd) \
     { \
         if (p.expect_to_fail) \
-            (pd) = binary::primitive_desc((desc), eng); \
+            (pd) = binary::primitive_desc((desc), attr, eng); \
         else \
-            ASSERT_NO_THROW((pd) = binary::primitive_desc((desc), eng)); \
+            ASSERT_NO_THROW( \
+                    (pd) = binary::primitive_desc((desc), attr, eng)); \
     }
             binary::primitive_desc binary_pd;
             binary::desc binary_desc(p.aalgorithm, desc_A, desc_B, desc_C);
             ASSIGN_PD(binary_desc, binary_pd);
+#undef ASSIGN_PD
 
             desc_C = binary_pd.dst_desc();
             auto mem_C = memory(desc_C, eng);
 
+            fill_data<src_data_t>(
+                    desc_A.get_size() / sizeof(src_data_t), mem_A);
+            fill_data<src_data_t>(
+                    desc_B.get_size() / sizeof(src_data_t), mem_B);
+            fill_data<dst_data_t>(
+                    desc_C.get_size() / sizeof(dst_data_t), mem_C);
+            check_zero_tail<src_data_t>(1, mem_A);
+            check_zero_tail<src_data_t>(1, mem_B);
+            check_zero_tail<dst_data_t>(1, mem_C);
+
+            if (p.aalgorithm == algorithm::binary_div) {
+                // avoid division by zero
+                auto B_data = map_memory<src_data_t>(mem_B);
+                const auto nelems = desc_B.get_size() / sizeof(src_data_t);
+                for (size_t i = 0; i < nelems; ++i)
+                    if ((float)B_data[i] == 0) B_data[i] = src_data_t(1);
+                check_zero_tail<src_data_t>(1, mem_B);
+            }
+
+            std::vector<float> dst_prev;
+            {
+                auto C_data = map_memory<const dst_data_t>(mem_C);
+                const auto nelems = desc_C.get_size() / sizeof(dst_data_t);
+                for (size_t i = 0; i < nelems; ++i)
+                    dst_prev.push_back(C_data[i]);
+            }
+
             std::unordered_map<int, memory> args = {{DNNL_ARG_SRC_0, mem_A},
                     {DNNL_ARG_SRC_1, mem_B}, {DNNL_ARG_DST, mem_C}};
 
             binary prim(binary_pd);
             prim.execute(strm, args);
             strm.wait();
+
+            check_data(p, mem_A, mem_B, dst_prev, mem_C);
+            check_zero_tail<dst_data_t>(0, mem_C);
         }
     }
 };
@@ -173,19 +254,49 @@ static auto simple_cases = []() {
                     algorithm::binary_mul, {5, 16, 7, 6}});
 };
 
+static auto algs_and_attrs = []() {
+    return ::testing::Values(
+            binary_test_params {{fmt::nchw, fmt::nchw}, fmt::nchw,
+                    algorithm::binary_max, {2, 16, 5, 7}, false, dnnl_success,
+                    0.f, false, false},
+            binary_test_params {{fmt::nhwc, fmt::nhwc}, fmt::nhwc,
+                    algorithm::binary_min, {2, 19, 5, 3}, false, dnnl_success,
+                    0.f, false, false},
+            binary_test_params {{fmt::nChw16c, fmt::nchw}, fmt::nChw16c,
+                    algorithm::binary_sub, {2, 32, 3, 5}, false, dnnl_success,
+                    0.5f, false, true},
+            binary_test_params {{fmt::nChw8c, fmt::nchw}, fmt::any,
+                    algorithm::binary_div, {3, 24, 4, 3}, false, dnnl_success,
+                    2.f, true, false},
+            binary_test_params {{fmt::nchw, fmt::nchw}, fmt::nchw,
+                    algorithm::binary_add, {2, 17, 9, 11}, false, dnnl_success,
+                    0.25f, true, true},
+            binary_test_params {{fmt::nhwc, fmt::nchw}, fmt::nhwc,
+                    algorithm::binary_mul, {1, 35, 3, 3}, false, dnnl_success,
+                    1.5f, false, true},
+            binary_test_params {{fmt::nchw, fmt::nhwc}, fmt::nchw,
+                    algorithm::binary_sub, {4, 3, 31, 7}, false, dnnl_success,
+                    0.f, true, true});
+};
+
 #define CPU_INST_TEST_CASE(test) \
     CPU_TEST_P(test, Testsbinary) {} \
     CPU_INSTANTIATE_TEST_SUITE_P(TestbinaryEF, test, expected_failures()); \
     CPU_INSTANTIATE_TEST_SUITE_P(TestbinaryZero, test, zero_dim()); \
-    CPU_INSTANTIATE_TEST_SUITE_P(TestbinarySimple, test, simple_cases());
+    CPU_INSTANTIATE_TEST_SUITE_P(TestbinarySimple, test, simple_cases()); \
+    CPU_INSTANTIATE_TEST_SUITE_P(TestbinaryAttr, test, algs_and_attrs());
 
 #define INST_TEST_CASE(test) CPU_INST_TEST_CASE(test)
 
 using binary_test_float = binary_test<float>;
 using binary_test_bfloat16 = binary_test<bfloat16_t>;
+using binary_test_u8 = binary_test<uint8_t>;
+using binary_test_s8 = binary_test<int8_t>;
 
 INST_TEST_CASE(binary_test_float)
 INST_TEST_CASE(binary_test_bfloat16)
+INST_TEST_CASE(binary_test_u8)
+INST_TEST_CASE(binary_test_s8)
 
 #undef CPU_INST_TEST_CASE
 } // namespace dnnl
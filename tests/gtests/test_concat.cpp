@@ -388,4 +388,94 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+TEST(concat_test_mixed, TestMixedDataTypes) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Mixed data types are tested on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    using dt = memory::data_type;
+    const memory::dim N = 2, C0 = 8, C1 = 16, H = 3, W = 4;
+    std::vector<memory::desc> srcs_md = {
+            memory::desc({N, C0, H, W}, dt::s8, fmt::nchw),
+            memory::desc({N, C1, H, W}, dt::u8, fmt::nChw8c)};
+    auto dst_md = memory::desc({N, C0 + C1, H, W}, dt::f32, fmt::nhwc);
+
+    memory src0(srcs_md[0], eng), src1(srcs_md[1], eng), dst(dst_md, eng);
+    fill_data<int8_t>(N * C0 * H * W, src0);
+    fill_data<uint8_t>(N * C1 * H * W, src1);
+
+    auto concat_pd = concat::primitive_desc(dst_md, 1, srcs_md, eng);
+    concat(concat_pd).execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, src0}, {DNNL_ARG_MULTIPLE_SRC + 1, src1},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto src0_data = map_memory<const int8_t>(src0);
+    auto src1_data = map_memory<const uint8_t>(src1);
+    auto dst_data = map_memory<const float>(dst);
+    const dnnl::impl::memory_desc_wrapper src0_mdw(srcs_md[0].data);
+    const dnnl::impl::memory_desc_wrapper src1_mdw(srcs_md[1].data);
+    const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.data);
+    for_(memory::dim n = 0; n < N; n++)
+    for_(memory::dim c = 0; c < C0 + C1; c++)
+    for_(memory::dim h = 0; h < H; h++)
+    for (memory::dim w = 0; w < W; w++) {
+        float ref = c < C0
+                ? src0_data[src0_mdw.off(n, c, h, w)]
+                : src1_data[src1_mdw.off(n, c - C0, h, w)];
+        ASSERT_EQ(dst_data[dst_mdw.off(n, c, h, w)], ref);
+    }
+}
+
+TEST(concat_test_in_place, TestInPlaceInput) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "In-place concat is tested on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    using dt = memory::data_type;
+    const memory::dim N = 2, C0 = 16, C1 = 8, H = 3, W = 4;
+    auto dst_md = memory::desc({N, C0 + C1, H, W}, dt::f32, fmt::nChw8c);
+    memory dst(dst_md, eng);
+    fill_data<float>(dst_md.get_size() / sizeof(float), dst);
+
+    // the first input was produced directly in dst
+    auto src0_md = dst_md.submemory_desc({N, C0, H, W}, {0, 0, 0, 0});
+    memory src0(src0_md, eng, dst.get_data_handle());
+    auto src1_md = memory::desc({N, C1, H, W}, dt::f32, fmt::nchw);
+    memory src1(src1_md, eng);
+    fill_data<float>(N * C1 * H * W, src1);
+
+    const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.data);
+    const dnnl::impl::memory_desc_wrapper src1_mdw(src1_md.data);
+    std::vector<float> ref(N * (C0 + C1) * H * W);
+    {
+        auto dst_data = map_memory<const float>(dst);
+        auto src1_data = map_memory<const float>(src1);
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim c = 0; c < C0 + C1; c++)
+        for_(memory::dim h = 0; h < H; h++)
+        for (memory::dim w = 0; w < W; w++)
+            ref[((n * (C0 + C1) + c) * H + h) * W + w] = c < C0
+                    ? dst_data[dst_mdw.off(n, c, h, w)]
+                    : src1_data[src1_mdw.off(n, c - C0, h, w)];
+    }
+
+    auto concat_pd
+            = concat::primitive_desc(dst_md, 1, {src0_md, src1_md}, eng);
+    concat(concat_pd).execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, src0}, {DNNL_ARG_MULTIPLE_SRC + 1, src1},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto dst_data = map_memory<const float>(dst);
+    for_(memory::dim n = 0; n < N; n++)
+    for_(memory::dim c = 0; c < C0 + C1; c++)
+    for_(memory::dim h = 0; h < H; h++)
+    for (memory::dim w = 0; w < W; w++)
+        ASSERT_EQ(dst_data[dst_mdw.off(n, c, h, w)],
+                ref[((n * (C0 + C1) + c) * H + h) * W + w]);
+}
+
 } // namespace dnnl
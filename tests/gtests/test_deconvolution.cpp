@@ -490,4 +490,104 @@ GPU_INST_TEST_CASE(SimpleSmall_NCHW,
 
 );
 
+TEST(deconvolution_test_post_ops, TestBiasSumEltwise) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Deconvolution post-ops are tested on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    using dt = memory::data_type;
+    const memory::dim N = 2, IC = 32, IH = 5, IW = 7, KH = 3, KW = 3;
+    const memory::dim OH = 2 * (IH - 1) + KH - 2, OW = 2 * (IW - 1) + KW - 2;
+    const float alpha = 0.1f;
+
+    // oc == 20 leaves a partial channel block in dst and in the bias
+    for_(fmt tag : {fmt::nChw16c, fmt::nChw8c})
+    for (memory::dim OC : {32, 20}) {
+        auto src_md = memory::desc({N, IC, IH, IW}, dt::f32, tag);
+        auto wei_md = memory::desc({OC, IC, KH, KW}, dt::f32, fmt::any);
+        auto bia_md = memory::desc({OC}, dt::f32, fmt::x);
+        auto dst_md = memory::desc({N, OC, OH, OW}, dt::f32, tag);
+        auto deconv_desc = deconvolution_forward::desc(
+                prop_kind::forward_inference, algorithm::deconvolution_direct,
+                src_md, wei_md, bia_md, dst_md, {2, 2}, {1, 1}, {1, 1});
+
+        post_ops ops;
+        ops.append_sum(1.f);
+        ops.append_eltwise(1.f, algorithm::eltwise_relu, alpha, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        auto deconv_pd
+                = deconvolution_forward::primitive_desc(deconv_desc, attr, eng);
+
+        // the reference is the same deconvolution without bias and post-ops
+        auto ref_desc = deconvolution_forward::desc(
+                prop_kind::forward_inference, algorithm::deconvolution_direct,
+                src_md, deconv_pd.weights_desc(), dst_md, {2, 2}, {1, 1},
+                {1, 1});
+        auto ref_pd = deconvolution_forward::primitive_desc(ref_desc, eng);
+
+        memory src(src_md, eng), wei(deconv_pd.weights_desc(), eng),
+                bia(bia_md, eng), dst(dst_md, eng), ref_dst(dst_md, eng);
+        fill_data<float>(src_md.get_size() / sizeof(float), src);
+        fill_data<float>(wei.get_desc().get_size() / sizeof(float), wei);
+        fill_data<float>(OC, bia);
+        fill_data<float>(dst_md.get_size() / sizeof(float), dst);
+
+        const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.data);
+        const memory::dim nelems = N * OC * OH * OW;
+        std::vector<float> prev_dst(nelems);
+        {
+            auto dst_data = map_memory<const float>(dst);
+            for (memory::dim i = 0; i < nelems; i++)
+                prev_dst[i] = dst_data[dst_mdw.off_l(i, false)];
+        }
+
+        deconvolution_forward(deconv_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}});
+        deconvolution_forward(ref_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+
+        auto dst_data = map_memory<const float>(dst);
+        auto ref_data = map_memory<const float>(ref_dst);
+        auto bia_data = map_memory<const float>(bia);
+        for (memory::dim i = 0; i < nelems; i++) {
+            const memory::dim off = dst_mdw.off_l(i, false);
+            const memory::dim oc = i / (OH * OW) % OC;
+            float ref = ref_data[off] + bia_data[oc] + prev_dst[i];
+            ref = ref > 0 ? ref : alpha * ref;
+            ASSERT_NEAR(dst_data[off], ref, 1e-4f * (1.f + std::fabs(ref)));
+        }
+    }
+}
+
+TEST(deconvolution_test_post_ops, TestUnsupported) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Deconvolution post-ops are tested on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+
+    // none of the convolutions for plain layouts applies the post-ops
+    using dt = memory::data_type;
+    auto src_md = memory::desc({2, 16, 5, 5}, dt::f32, fmt::nchw);
+    auto wei_md = memory::desc({16, 16, 3, 3}, dt::f32, fmt::oihw);
+    auto dst_md = memory::desc({2, 16, 5, 5}, dt::f32, fmt::nchw);
+    auto deconv_desc = deconvolution_forward::desc(prop_kind::forward_inference,
+            algorithm::deconvolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+
+    post_ops ops;
+    ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+
+    dnnl_status_t status = dnnl_success;
+    try {
+        deconvolution_forward::primitive_desc(deconv_desc, attr, eng);
+    } catch (error &e) { status = e.status; }
+    ASSERT_EQ(status, dnnl_unimplemented);
+}
+
 } // namespace dnnl
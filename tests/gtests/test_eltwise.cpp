@@ -138,7 +138,7 @@ T logistic_fwd(T s) {
 
 template <typename T>
 T logistic_bwd(T dd, T s) {
-    float v = logistic_fwd<float>(s);
+    float v = logistic_fwd<float>(-std::abs((float)s));
     return (T)(dd * v * (1 - v));
 }
 
@@ -163,6 +163,45 @@ T swish_bwd(T dd, T s, A alpha) {
     return dd * (v + s * alpha * v * (1 - v));
 }
 
+template <typename T, typename A>
+inline T relu_bwd_use_dst(T dd, T d, A alpha) {
+    return d > 0 ? dd : static_cast<T>(dd * alpha);
+}
+
+template <typename T>
+T tanh_bwd_use_dst(T dd, T d) {
+    return static_cast<T>(dd * (1 - d) * (1 + d));
+}
+
+template <typename T, typename A>
+T elu_bwd_use_dst(T dd, T d, A alpha) {
+    return static_cast<T>(dd * (d > 0 ? 1 : d + alpha));
+}
+
+template <typename T>
+T sqrt_bwd_use_dst(T dd, T d) {
+    return d > 0 ? static_cast<T>(dd / (2 * d)) : T(0);
+}
+
+template <typename T>
+T logistic_bwd_use_dst(T dd, T d) {
+    return static_cast<T>(dd * d * (1 - d));
+}
+
+template <typename T>
+T exp_bwd_use_dst(T dd, T d) {
+    return static_cast<T>(dd * d);
+}
+
+bool is_use_dst_alg(algorithm alg) {
+    return alg == algorithm::eltwise_relu_use_dst_for_bwd
+            || alg == algorithm::eltwise_tanh_use_dst_for_bwd
+            || alg == algorithm::eltwise_elu_use_dst_for_bwd
+            || alg == algorithm::eltwise_sqrt_use_dst_for_bwd
+            || alg == algorithm::eltwise_logistic_use_dst_for_bwd
+            || alg == algorithm::eltwise_exp_use_dst_for_bwd;
+}
+
 struct eltwise_test_params {
     algorithm alg_kind;
     memory::format_tag data_format;
@@ -192,11 +231,15 @@ void check_eltwise_fwd(const eltwise_test_params &p, const memory::desc &md,
         data_t s = src_data[i];
         data_t ref_d = 0;
         switch (p.alg_kind) {
+            case algorithm::eltwise_relu_use_dst_for_bwd:
             case algorithm::eltwise_relu: ref_d = relu_fwd(s, p.alpha); break;
+            case algorithm::eltwise_tanh_use_dst_for_bwd:
             case algorithm::eltwise_tanh: ref_d = tanh_fwd(s); break;
+            case algorithm::eltwise_elu_use_dst_for_bwd:
             case algorithm::eltwise_elu: ref_d = elu_fwd(s, p.alpha); break;
             case algorithm::eltwise_square: ref_d = square_fwd(s); break;
             case algorithm::eltwise_abs: ref_d = abs_fwd(s); break;
+            case algorithm::eltwise_sqrt_use_dst_for_bwd:
             case algorithm::eltwise_sqrt: ref_d = sqrt_fwd(s); break;
             case algorithm::eltwise_linear:
                 ref_d = linear_fwd(s, p.alpha, p.beta);
@@ -205,7 +248,9 @@ void check_eltwise_fwd(const eltwise_test_params &p, const memory::desc &md,
                 ref_d = bounded_relu_fwd(s, p.alpha);
                 break;
             case algorithm::eltwise_soft_relu: ref_d = soft_relu_fwd(s); break;
+            case algorithm::eltwise_logistic_use_dst_for_bwd:
             case algorithm::eltwise_logistic: ref_d = logistic_fwd(s); break;
+            case algorithm::eltwise_exp_use_dst_for_bwd:
             case algorithm::eltwise_exp: ref_d = exp_fwd(s); break;
             case algorithm::eltwise_gelu: ref_d = gelu_fwd(s); break;
             case algorithm::eltwise_swish: ref_d = swish_fwd(s, p.alpha); break;
@@ -229,7 +274,10 @@ void compare_eltwise_fwd(const eltwise_test_params &p, const memory::desc &md,
                                 == memory::data_type::bf16)
                         ? 5e-2
                         : (p.alg_kind == algorithm::eltwise_elu
-                                  || p.alg_kind == algorithm::eltwise_gelu)
+                                  || p.alg_kind == algorithm::eltwise_gelu
+                                  || p.alg_kind
+                                          == algorithm::
+                                                  eltwise_elu_use_dst_for_bwd)
                                 ? 2e-5
                                 : p.alg_kind == algorithm::eltwise_soft_relu
                                         ? 2e-6
@@ -240,6 +288,7 @@ void compare_eltwise_fwd(const eltwise_test_params &p, const memory::desc &md,
 template <typename data_t>
 void check_eltwise_bwd(const eltwise_test_params &p, const memory::desc &md,
         const memory &src, const memory &diff_dst, const memory &diff_src) {
+    // for the *_use_dst_for_bwd algorithms `src` holds the forward dst
     auto src_data = map_memory<data_t>(src);
     auto diff_dst_data = map_memory<data_t>(diff_dst);
     auto diff_src_data = map_memory<data_t>(diff_src);
@@ -251,7 +300,8 @@ void check_eltwise_bwd(const eltwise_test_params &p, const memory::desc &md,
 
     const data_t eps = static_cast<data_t>(
             (p.alg_kind == algorithm::eltwise_soft_relu
-                    || p.alg_kind == algorithm::eltwise_tanh)
+                    || p.alg_kind == algorithm::eltwise_tanh
+                    || p.alg_kind == algorithm::eltwise_tanh_use_dst_for_bwd)
                     ? 2e-6f
                     : (p.alg_kind == algorithm::eltwise_gelu ? 1e-5f : 1e-6f));
 
@@ -296,6 +346,24 @@ void check_eltwise_bwd(const eltwise_test_params &p, const memory::desc &md,
             case algorithm::eltwise_swish:
                 ref_ds = swish_bwd(ref_dd, ref_s, p.alpha);
                 break;
+            case algorithm::eltwise_relu_use_dst_for_bwd:
+                ref_ds = relu_bwd_use_dst(ref_dd, ref_s, p.alpha);
+                break;
+            case algorithm::eltwise_tanh_use_dst_for_bwd:
+                ref_ds = tanh_bwd_use_dst(ref_dd, ref_s);
+                break;
+            case algorithm::eltwise_elu_use_dst_for_bwd:
+                ref_ds = elu_bwd_use_dst(ref_dd, ref_s, p.alpha);
+                break;
+            case algorithm::eltwise_sqrt_use_dst_for_bwd:
+                ref_ds = sqrt_bwd_use_dst(ref_dd, ref_s);
+                break;
+            case algorithm::eltwise_logistic_use_dst_for_bwd:
+                ref_ds = logistic_bwd_use_dst(ref_dd, ref_s);
+                break;
+            case algorithm::eltwise_exp_use_dst_for_bwd:
+                ref_ds = exp_bwd_use_dst(ref_dd, ref_s);
+                break;
             default: assert(!"unknown alg_kind");
         }
 
@@ -312,6 +380,7 @@ template <typename data_t>
 class eltwise_test : public ::testing::TestWithParam<eltwise_test_params> {
 private:
     memory src;
+    memory dst;
     std::shared_ptr<memory::desc> data_desc;
     eltwise_forward::primitive_desc eltwise_prim_desc;
     eltwise_test_params p;
@@ -353,13 +422,17 @@ protected:
     void Forward() {
         data_desc.reset(new memory::desc(p.dims, data_type, p.data_format));
         src = memory(*data_desc, eng);
-        memory dst(*data_desc, eng);
+        dst = memory(*data_desc, eng);
         memory ref_dst(*data_desc, eng);
 
+        const auto elu_use_dst = algorithm::eltwise_elu_use_dst_for_bwd;
+        const auto exp_use_dst = algorithm::eltwise_exp_use_dst_for_bwd;
         data_t data_median = data_t(0);
         data_t data_deviation = (p.alg_kind == algorithm::eltwise_elu
                                         || p.alg_kind == algorithm::eltwise_exp)
                         || (p.alg_kind == algorithm::eltwise_swish)
+                        || (p.alg_kind == elu_use_dst)
+                        || (p.alg_kind == exp_use_dst)
                 ? data_t(1.0)
                 : p.alg_kind == algorithm::eltwise_square ? data_t(6.0)
                                                           : data_t(100.0);
@@ -403,14 +476,18 @@ protected:
         eltwise_bwd_prim_desc
                 = eltwise_backward::primitive_desc(eltwise_bwd_prim_desc.get());
 
+        const bool use_dst = is_use_dst_alg(p.alg_kind);
+        const memory &data = use_dst ? dst : src;
+
         eltwise_backward(eltwise_bwd_prim_desc)
                 .execute(strm,
-                        {{DNNL_ARG_SRC, src}, {DNNL_ARG_DIFF_DST, diff_dst},
+                        {{use_dst ? DNNL_ARG_DST : DNNL_ARG_SRC, data},
+                                {DNNL_ARG_DIFF_DST, diff_dst},
                                 {DNNL_ARG_DIFF_SRC, diff_src}});
         strm.wait();
 
         check_zero_tail<data_t>(0, diff_src);
-        check_eltwise_bwd<data_t>(p, *data_desc, src, diff_dst, diff_src);
+        check_eltwise_bwd<data_t>(p, *data_desc, data, diff_dst, diff_src);
     }
 };
 
@@ -459,6 +536,14 @@ TEST_P(eltwise_test_s8, TestsEltwise) {}
             EXPAND(PARAMS(eltwise_bounded_relu, __VA_ARGS__)), \
             EXPAND(PARAMS(eltwise_logistic, __VA_ARGS__))
 
+#define PARAMS_ALL_ALG_USE_DST(...) \
+    EXPAND(PARAMS(eltwise_relu_use_dst_for_bwd, __VA_ARGS__)), \
+            EXPAND(PARAMS(eltwise_tanh_use_dst_for_bwd, __VA_ARGS__)), \
+            EXPAND(PARAMS(eltwise_elu_use_dst_for_bwd, __VA_ARGS__)), \
+            EXPAND(PARAMS(eltwise_sqrt_use_dst_for_bwd, __VA_ARGS__)), \
+            EXPAND(PARAMS(eltwise_logistic_use_dst_for_bwd, __VA_ARGS__)), \
+            EXPAND(PARAMS(eltwise_exp_use_dst_for_bwd, __VA_ARGS__))
+
 #define _CPU_INST_TEST_CASE(str, data_t, ...) \
     CPU_INSTANTIATE_TEST_SUITE_P(str##_##data_t, eltwise_test_##data_t, \
             ::testing::Values(__VA_ARGS__))
@@ -579,6 +664,12 @@ CPU_INST_TEST_CASE(Simple_SDPART,
         PARAMS_ALL_ALG_SDPART(nhwc, nchw, 0.1f, 0.f, 2, 16, 10, 8),
         PARAMS_ALL_ALG_SDPART(nchw, nhwc, 0.1f, 0.f, 10, 10, 10, 10));
 
+CPU_INST_TEST_CASE(Simple_UseDst,
+        PARAMS_ALL_ALG_USE_DST(nchw, nChw8c, 0.1f, 0.f, 2, 8, 4, 4),
+        PARAMS_ALL_ALG_USE_DST(nChw16c, nChw16c, 0.1f, 0.f, 2, 16, 16, 8),
+        PARAMS_ALL_ALG_USE_DST(nhwc, nchw, 0.1f, 0.f, 2, 16, 10, 8),
+        PARAMS_ALL_ALG_USE_DST(nchw, nchw, 0.1f, 0.f, 3, 5, 7, 11));
+
 INST_TEST_CASE(AlexNet_NCHW,
         PARAMS_ALL_ALG(nchw, nchw, 0.f, 0.f, 2, 96, 55, 55),
         PARAMS_ALL_ALG(nchw, nchw, 0.f, 0.f, 2, 256, 27, 27),
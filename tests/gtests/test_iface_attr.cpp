@@ -92,6 +92,166 @@ TEST_F(attr_test, TestIntOutputScales) {
     ASSERT_EQ(scales[2], 3.);
 }
 
+TEST_F(attr_test, TestRuntimeOutputScales) {
+    dnnl::primitive_attr attr;
+
+    // run-time scales must be passed as a single wildcard value
+    EXPECT_ANY_THROW(attr.set_output_scales(
+            1 << 1, {DNNL_RUNTIME_F32_VAL, DNNL_RUNTIME_F32_VAL}));
+    attr.set_output_scales(1 << 1, {DNNL_RUNTIME_F32_VAL});
+
+    if (get_test_engine_kind() != engine::kind::cpu) return;
+
+    engine eng(get_test_engine_kind(), 0);
+    stream s(eng);
+
+    const memory::dim N = 2, C = 3, W = 5;
+    memory::desc src_md(
+            {N, C, W}, memory::data_type::f32, memory::format_tag::ncw);
+    memory::desc dst_md(
+            {N, C, W}, memory::data_type::s32, memory::format_tag::nwc);
+
+    auto reorder_pd = reorder::primitive_desc(eng, src_md, eng, dst_md, attr);
+
+    memory src(src_md, eng), dst(dst_md, eng);
+    memory scales({{C}, memory::data_type::f32, memory::format_tag::x}, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < N * C * W; ++i)
+            src_ptr[i] = (float)(i % 7);
+        auto scales_ptr = map_memory<float>(scales);
+        for (memory::dim c = 0; c < C; ++c)
+            scales_ptr[c] = (float)(c + 1);
+    }
+
+    // the same primitive is reused with different scales
+    reorder r(reorder_pd);
+    for (float factor : {1.f, 2.f}) {
+        {
+            auto scales_ptr = map_memory<float>(scales);
+            for (memory::dim c = 0; c < C; ++c)
+                scales_ptr[c] = factor * (c + 1);
+        }
+        r.execute(s,
+                {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, dst},
+                        {DNNL_ARG_ATTR_OUTPUT_SCALES, scales}});
+        s.wait();
+
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<int32_t>(dst);
+        for_(memory::dim n = 0; n < N; ++n)
+        for_(memory::dim c = 0; c < C; ++c)
+        for (memory::dim w = 0; w < W; ++w) {
+            const float ref = factor * (c + 1) * src_ptr[(n * C + c) * W + w];
+            ASSERT_EQ(dst_ptr[(n * W + w) * C + c], (int32_t)ref);
+        }
+    }
+
+    // missing run-time scales are reported as an error
+    EXPECT_ANY_THROW(r.execute(s, {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, dst}}));
+}
+
+TEST_F(attr_test, TestRuntimeOutputScalesConvolution) {
+    if (get_test_engine_kind() != engine::kind::cpu) return;
+
+    engine eng(get_test_engine_kind(), 0);
+    stream s(eng);
+
+    const memory::dim N = 2, IC = 16, OC = 32, H = 6, W = 6;
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    memory::desc src_md({N, IC, H, W}, dt::u8, tag::nhwc);
+    memory::desc wei_md({OC, IC, 3, 3}, dt::s8, tag::any);
+    memory::desc dst_md({N, OC, H, W}, dt::f32, tag::nhwc);
+    auto conv_d = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+
+    std::vector<float> oscales(OC);
+    for (memory::dim oc = 0; oc < OC; ++oc)
+        oscales[oc] = 0.5f + oc % 5;
+
+    primitive_attr attr_ct, attr_rt;
+    attr_ct.set_output_scales(1 << 1, oscales);
+    attr_rt.set_output_scales(1 << 1, {DNNL_RUNTIME_F32_VAL});
+
+    convolution_forward::primitive_desc pd_ct, pd_rt;
+    try {
+        pd_ct = convolution_forward::primitive_desc(conv_d, attr_ct, eng);
+        pd_rt = convolution_forward::primitive_desc(conv_d, attr_rt, eng);
+    } catch (error &e) {
+        // no implementation on this ISA supports run-time scales
+        if (e.status == dnnl_unimplemented) return;
+        throw;
+    }
+
+    memory src(src_md, eng), dst_ct(dst_md, eng), dst_rt(dst_md, eng);
+    memory wei_plain({{OC, IC, 3, 3}, dt::s8, tag::oihw}, eng);
+    memory wei_ct(pd_ct.weights_desc(), eng), wei_rt(pd_rt.weights_desc(), eng);
+    memory scales({{OC}, dt::f32, tag::x}, eng);
+    {
+        auto src_ptr = map_memory<uint8_t>(src);
+        for (memory::dim i = 0; i < N * IC * H * W; ++i)
+            src_ptr[i] = (uint8_t)(i % 11);
+        auto wei_ptr = map_memory<int8_t>(wei_plain);
+        for (memory::dim i = 0; i < OC * IC * 3 * 3; ++i)
+            wei_ptr[i] = (int8_t)(i % 7 - 3);
+        auto scales_ptr = map_memory<float>(scales);
+        for (memory::dim oc = 0; oc < OC; ++oc)
+            scales_ptr[oc] = oscales[oc];
+    }
+    reorder(wei_plain, wei_ct).execute(s, wei_plain, wei_ct);
+    reorder(wei_plain, wei_rt).execute(s, wei_plain, wei_rt);
+
+    convolution_forward(pd_ct).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_ct},
+                    {DNNL_ARG_DST, dst_ct}});
+    convolution_forward(pd_rt).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_rt},
+                    {DNNL_ARG_DST, dst_rt},
+                    {DNNL_ARG_ATTR_OUTPUT_SCALES, scales}});
+    s.wait();
+
+    auto ct_ptr = map_memory<float>(dst_ct);
+    auto rt_ptr = map_memory<float>(dst_rt);
+    for (memory::dim i = 0; i < N * OC * H * W; ++i)
+        ASSERT_EQ(ct_ptr[i], rt_ptr[i]);
+}
+
+TEST_F(attr_test, TestZeroPoints) {
+    dnnl::primitive_attr attr;
+
+    int mask;
+    std::vector<int32_t> zero_points;
+
+    // default zero points
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) {
+        attr.get_zero_points(arg, mask, zero_points);
+        ASSERT_EQ(mask, 0);
+        ASSERT_EQ(zero_points.size(), 1U);
+        ASSERT_EQ(zero_points[0], 0);
+    }
+
+    attr.set_zero_points(DNNL_ARG_SRC, 0, {3});
+    attr.set_zero_points(DNNL_ARG_DST, 0, {DNNL_RUNTIME_S32_VAL});
+    attr.get_zero_points(DNNL_ARG_SRC, mask, zero_points);
+    ASSERT_EQ(zero_points[0], 3);
+    attr.get_zero_points(DNNL_ARG_DST, mask, zero_points);
+    ASSERT_EQ(zero_points[0], DNNL_RUNTIME_S32_VAL);
+
+    // only a common zero point of src, weights, or dst is supported
+    EXPECT_ANY_THROW(attr.set_zero_points(DNNL_ARG_SRC, 1 << 1, {1, 2}));
+    EXPECT_ANY_THROW(attr.set_zero_points(DNNL_ARG_BIAS, 0, {1}));
+
+    if (get_test_engine_kind() != engine::kind::cpu) return;
+
+    // primitives other than matmul do not support zero points
+    engine eng(get_test_engine_kind(), 0);
+    memory::desc md({2, 3}, memory::data_type::u8, memory::format_tag::ab);
+    EXPECT_ANY_THROW(reorder::primitive_desc(eng, md, eng, md, attr));
+}
+
 TEST_F(attr_test, TestPostOps) {
     dnnl::primitive_attr attr;
     dnnl::post_ops ops;
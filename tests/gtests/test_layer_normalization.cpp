@@ -19,6 +19,7 @@
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
+#include "cpu_isa_traits.hpp"
 #include "dnnl.hpp"
 
 #define CPU_INST_TEST_CASE(str, ...) \
@@ -43,7 +44,8 @@ void fill(const memory &m) {
     fill_data<T>(numElements, m);
 }
 
-class lnorm_test : public ::testing::TestWithParam<test_lnorm_params_t> {
+template <typename data_t>
+class lnorm_test_t : public ::testing::TestWithParam<test_lnorm_params_t> {
 private:
     std::shared_ptr<test_memory> src, dst, diff_src, diff_dst;
     memory weights, diff_weights, mean, variance;
@@ -59,9 +61,21 @@ private:
     engine eng;
     stream strm;
 
+    // eltwise relu and sum post-ops applied to the forward results
+    const float post_ops_alpha_ = 0.25f;
+    const float post_ops_sum_scale_ = 0.5f;
+    bool with_post_ops_ = false;
+    std::vector<float> prev_dst_;
+
+    static bool is_bf16() {
+        return data_traits<data_t>::data_type == memory::data_type::bf16;
+    }
+
 protected:
     virtual void SetUp() {
         p = ::testing::TestWithParam<decltype(p)>::GetParam();
+        SKIP_IF(is_bf16() && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "current ISA doesn't support bfloat16 data type");
         catch_expected_failures(
                 [=]() { Test(); }, p.expect_to_fail, p.expected_status);
     }
@@ -72,13 +86,12 @@ protected:
         eng = engine(get_test_engine_kind(), 0);
         strm = stream(eng);
 
-        data_d.reset(
-                new memory::desc(p.dims, memory::data_type::f32, p.data_tag));
+        const memory::data_type data_dt = data_traits<data_t>::data_type;
+        data_d.reset(new memory::desc(p.dims, data_dt, p.data_tag));
         memory::dims stat_dims(p.dims.begin(), p.dims.end() - 1);
         stat_d.reset(new memory::desc(
                 stat_dims, memory::data_type::f32, p.stat_tag));
-        diff_d.reset(
-                new memory::desc(p.dims, memory::data_type::f32, p.diff_tag));
+        diff_d.reset(new memory::desc(p.dims, data_dt, p.diff_tag));
 
         src.reset(new test_memory(*data_d, eng));
         dst.reset(new test_memory(*data_d, eng));
@@ -96,6 +109,8 @@ protected:
         Forward(inference);
         Forward(inference, flags::use_global_stats);
         Forward(inference, flags::use_scale_shift);
+        Forward(inference, flags::use_scale_shift, true);
+        Forward(training, flags::use_global_stats, true);
 
         Backward(prop_kind::backward_data);
         Backward(prop_kind::backward_data, flags::use_global_stats);
@@ -104,8 +119,9 @@ protected:
                 flags::use_scale_shift | flags::use_global_stats);
     }
 
-    void Forward(
-            prop_kind pk, normalization_flags flags = (normalization_flags)0u) {
+    void Forward(prop_kind pk,
+            normalization_flags flags = (normalization_flags)0u,
+            bool with_post_ops = false) {
         bool useScaleShift
                 = (bool)(flags & normalization_flags::use_scale_shift);
         bool useGlobalStats
@@ -115,8 +131,18 @@ protected:
         auto lnorm_fwd_d = layer_normalization_forward::desc(
                 pk, *data_d, *stat_d, p.epsilon, flags);
 
-        lnorm_fwd_pd
-                = layer_normalization_forward::primitive_desc(lnorm_fwd_d, eng);
+        primitive_attr attr;
+        if (with_post_ops) {
+            post_ops ops;
+            ops.append_eltwise(
+                    1.f, algorithm::eltwise_relu, post_ops_alpha_, 0.f);
+            ops.append_sum(post_ops_sum_scale_);
+            attr.set_post_ops(ops);
+        }
+        with_post_ops_ = with_post_ops;
+
+        lnorm_fwd_pd = layer_normalization_forward::primitive_desc(
+                lnorm_fwd_d, attr, eng);
         lnorm_fwd_pd = layer_normalization_forward::primitive_desc(
                 lnorm_fwd_pd.get()); // test construction from a C pd
 
@@ -126,14 +152,22 @@ protected:
             variance = memory(*stat_d, eng);
         }
 
-        fill<float>(src->get());
-        fill<float>(dst->get());
+        fill<data_t>(src->get());
+        fill<data_t>(dst->get());
         if (useScaleShift) fill<float>(weights);
         if (useGlobalStats) {
             fill<float>(mean);
             fill<float>(variance);
         }
 
+        if (with_post_ops) {
+            const size_t size = data_d->get_size() / sizeof(data_t);
+            auto dst_data = map_memory<const data_t>(dst->get());
+            prev_dst_.assign(size, 0.f);
+            for (size_t i = 0; i < size; ++i)
+                prev_dst_[i] = dst_data[i];
+        }
+
         execlnormFwd(isTraining, useGlobalStats, useScaleShift);
         check_lnorm_fwd(
                 p, src->get(), mean, variance, weights, dst->get(), flags, pk);
@@ -163,8 +197,8 @@ protected:
         variance = memory(*stat_d, eng);
 
         if (useScaleShift) fill<float>(weights);
-        fill<float>(diff_src->get());
-        fill<float>(diff_dst->get());
+        fill<data_t>(diff_src->get());
+        fill<data_t>(diff_dst->get());
         fill<float>(mean);
         fill<float>(variance);
 
@@ -223,8 +257,8 @@ protected:
                 = !(bool)(flags & normalization_flags::use_global_stats);
         const bool is_training = pk == prop_kind::forward_training;
 
-        auto src_data = map_memory<const float>(src);
-        auto dst_data = map_memory<const float>(dst);
+        auto src_data = map_memory<const data_t>(src);
+        auto dst_data = map_memory<const data_t>(dst);
         auto weights_data
                 = use_weights ? map_memory<const float>(weights) : nullptr;
         auto mean_data = (!calculate_stats || is_training)
@@ -251,6 +285,7 @@ protected:
         const auto C = src_mdw.dims()[ndims - 1];
 
         float eps = static_cast<float>(1.e-4 * nelems / C);
+        if (is_bf16()) eps = std::max(eps, 1e-2f);
         dnnl::impl::parallel_nd(nelems / C, [&](memory::dim n) {
             if (is_current_test_failed()) return;
             float ref_mean = float(0);
@@ -259,7 +294,7 @@ protected:
 
             if (calculate_stats) {
                 for (memory::dim c = 0; c < C; c++)
-                    ref_mean += src_data[src_mdw.off_l(n * C + c)];
+                    ref_mean += (float)src_data[src_mdw.off_l(n * C + c)];
                 ref_mean /= C;
 
                 if (is_training) {
@@ -309,7 +344,13 @@ protected:
                             * ref_rsqrt_variance;
                 }
 
-                float out = dst_data[dst_mdw.off_l(n * C + c)];
+                const auto dst_off = dst_mdw.off_l(n * C + c);
+                if (with_post_ops_) {
+                    if (ref_dst < 0) ref_dst *= post_ops_alpha_;
+                    ref_dst += post_ops_sum_scale_ * prev_dst_[dst_off];
+                }
+
+                float out = dst_data[dst_off];
                 float norm_max = std::max(std::abs(out), std::abs(ref_dst));
                 if (norm_max < 1e-2) norm_max = 1.;
                 ASSERT_NEAR((out - ref_dst) / norm_max, 0., eps);
@@ -330,13 +371,13 @@ protected:
         const bool calculate_diff_stats
                 = !(bool)(flags & normalization_flags::use_global_stats);
 
-        auto src_data = map_memory<const float>(src);
+        auto src_data = map_memory<const data_t>(src);
         auto weights_data
                 = use_weights ? map_memory<const float>(weights) : nullptr;
-        auto diff_dst_data = map_memory<const float>(diff_dst);
+        auto diff_dst_data = map_memory<const data_t>(diff_dst);
         auto mean_data = map_memory<const float>(mean);
         auto variance_data = map_memory<const float>(variance);
-        const auto diff_src_data = map_memory<float>(diff_src);
+        const auto diff_src_data = map_memory<data_t>(diff_src);
         const auto diff_weights_data = (pk == prop_kind::backward)
                 ? map_memory<float>(diff_weights)
                 : nullptr;
@@ -372,7 +413,8 @@ protected:
             return;
         }
 
-        const float eps = static_cast<float>(1.e-4 * nelems / C);
+        float eps = static_cast<float>(1.e-4 * nelems / C);
+        if (is_bf16()) eps = std::max(eps, 1e-2f);
 
         dnnl::impl::parallel_nd(C, [&](memory::dim c) {
             if (is_current_test_failed()) return;
@@ -432,7 +474,11 @@ protected:
     }
 };
 
+using lnorm_test = lnorm_test_t<float>;
+using lnorm_test_bf16 = lnorm_test_t<bfloat16_t>;
+
 TEST_P(lnorm_test, TestsLnormF32) {}
+TEST_P(lnorm_test_bf16, TestsLnormBf16) {}
 
 #include "layer_normalization.h"
 } // namespace dnnl
@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cfloat>
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu_isa_traits.hpp"
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using fmt = memory::format_tag;
+
+struct logsoftmax_test_params {
+    fmt data_format;
+    memory::dims dims;
+    int axis;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+float logsoftmax_eps() {
+    // bf16 results are rounded, so the threshold is relative
+    return data_traits<data_t>::data_type == memory::data_type::bf16
+            ? 0.0078125f
+            : 1e-5f;
+}
+
+template <typename data_t>
+void check_logsoftmax_fwd(const memory &src, const memory &dst, int axis) {
+    auto src_ptr = map_memory<data_t>(src);
+    auto dst_ptr = map_memory<data_t>(dst);
+
+    const memory::desc md = src.get_desc();
+    const dnnl::impl::memory_desc_wrapper mdw(md.data);
+    const float eps = logsoftmax_eps<data_t>();
+
+    memory::dim OU = 1, IN = 1;
+    for (int d = 0; d < axis; ++d)
+        OU *= md.data.dims[d];
+    for (int d = axis + 1; d < md.data.ndims; ++d)
+        IN *= md.data.dims[d];
+    const memory::dim C = md.data.dims[axis];
+
+    dnnl::impl::parallel_nd(OU, IN, [&](memory::dim ou, memory::dim in) {
+        if (is_current_test_failed()) return;
+
+        const memory::dim idx_start = ou * C * IN + in;
+
+        float max = -FLT_MAX;
+        for (memory::dim c = 0; c < C; ++c)
+            max = std::max(max, (float)src_ptr[mdw.off_l(idx_start + c * IN)]);
+
+        float sum = 0;
+        for (memory::dim c = 0; c < C; ++c)
+            sum += std::exp(src_ptr[mdw.off_l(idx_start + c * IN)] - max);
+
+        for (memory::dim c = 0; c < C; ++c) {
+            auto off = mdw.off_l(idx_start + c * IN);
+            float ref = src_ptr[off] - max - std::log(sum);
+            float tol = eps * std::max(1.f, std::fabs(ref));
+            ASSERT_NEAR(dst_ptr[off], ref, tol);
+        }
+    });
+}
+
+template <typename data_t>
+void check_logsoftmax_bwd(const memory &dst, const memory &diff_dst,
+        const memory &diff_src, int axis) {
+    auto dst_ptr = map_memory<data_t>(dst);
+    auto diff_dst_ptr = map_memory<data_t>(diff_dst);
+    auto diff_src_ptr = map_memory<data_t>(diff_src);
+
+    const memory::desc md = dst.get_desc();
+    const dnnl::impl::memory_desc_wrapper mdw(md.data);
+    const float eps = logsoftmax_eps<data_t>();
+
+    memory::dim OU = 1, IN = 1;
+    for (int d = 0; d < axis; ++d)
+        OU *= md.data.dims[d];
+    for (int d = axis + 1; d < md.data.ndims; ++d)
+        IN *= md.data.dims[d];
+    const memory::dim C = md.data.dims[axis];
+
+    dnnl::impl::parallel_nd(OU, IN, [&](memory::dim ou, memory::dim in) {
+        if (is_current_test_failed()) return;
+
+        const memory::dim idx_start = ou * C * IN + in;
+
+        float sum = 0;
+        for (memory::dim c = 0; c < C; ++c)
+            sum += diff_dst_ptr[mdw.off_l(idx_start + c * IN)];
+
+        for (memory::dim c = 0; c < C; ++c) {
+            auto off = mdw.off_l(idx_start + c * IN);
+            float ref = diff_dst_ptr[off] - std::exp((float)dst_ptr[off]) * sum;
+            float tol = eps * std::max(1.f, std::fabs(ref));
+            ASSERT_NEAR(diff_src_ptr[off], ref, tol);
+        }
+    });
+}
+
+template <typename data_t>
+class logsoftmax_test
+    : public ::testing::TestWithParam<logsoftmax_test_params> {
+    logsoftmax_test_params p;
+
+protected:
+    virtual void SetUp() {
+        p = ::testing::TestWithParam<logsoftmax_test_params>::GetParam();
+        // TODO: remove me
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU does not support logsoftmax yet.");
+        SKIP_IF(data_traits<data_t>::data_type == memory::data_type::bf16
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "current ISA doesn't support bfloat16 data type");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        memory::data_type prec = data_traits<data_t>::data_type;
+        auto md = memory::desc(p.dims, prec, p.data_format);
+
+        auto fwd_desc = logsoftmax_forward::desc(
+                prop_kind::forward_training, md, p.axis);
+        auto fwd_pd = logsoftmax_forward::primitive_desc(fwd_desc, eng);
+        fwd_pd = logsoftmax_forward::primitive_desc(
+                fwd_pd.get()); // test construction from C pd
+
+        auto bwd_desc = logsoftmax_backward::desc(md, md, p.axis);
+        auto bwd_pd
+                = logsoftmax_backward::primitive_desc(bwd_desc, eng, fwd_pd);
+        bwd_pd = logsoftmax_backward::primitive_desc(
+                bwd_pd.get()); // test construction from C pd
+
+        auto src = memory(md, eng);
+        auto dst = memory(md, eng);
+        auto diff_dst = memory(md, eng);
+        auto diff_src = memory(md, eng);
+
+        auto test_with_given_fill = [&](data_t mean, data_t var) {
+            const size_t nelems = md.get_size() / sizeof(data_t);
+            fill_data<data_t>(nelems, src, mean, var);
+            check_zero_tail<data_t>(1, src);
+            fill_data<data_t>(nelems, diff_dst, data_t(0), data_t(1));
+            check_zero_tail<data_t>(1, diff_dst);
+
+            logsoftmax_forward(fwd_pd).execute(
+                    strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+            logsoftmax_backward(bwd_pd).execute(strm,
+                    {{DNNL_ARG_DST, dst}, {DNNL_ARG_DIFF_DST, diff_dst},
+                            {DNNL_ARG_DIFF_SRC, diff_src}});
+            strm.wait();
+
+            check_logsoftmax_fwd<data_t>(src, dst, p.axis);
+            check_zero_tail<data_t>(0, dst);
+            check_logsoftmax_bwd<data_t>(dst, diff_dst, diff_src, p.axis);
+            check_zero_tail<data_t>(0, diff_src);
+        };
+
+        test_with_given_fill(-50, 50);
+        test_with_given_fill(-200, 1);
+        test_with_given_fill(0, 1);
+        test_with_given_fill(200, 1);
+    }
+};
+
+using logsoftmax_test_float = logsoftmax_test<float>;
+using logsoftmax_test_bfloat16 = logsoftmax_test<bfloat16_t>;
+
+#define EXPAND_CASES() \
+    ::testing::Values( \
+            logsoftmax_test_params {fmt::nchw, {2, 19, 16, 16}, 5, true, \
+                    dnnl_invalid_arguments}, \
+            logsoftmax_test_params {fmt::nchw, {2, 0, 5, 5}, 1}, \
+            logsoftmax_test_params {fmt::nc, {2, 1000}, 1}, \
+            logsoftmax_test_params {fmt::nc, {2, 1000}, 0}, \
+            logsoftmax_test_params {fmt::nc, {16, 30000}, 1}, \
+            logsoftmax_test_params {fmt::nc, {4, 13}, 1}, \
+            logsoftmax_test_params {fmt::ncw, {16, 257, 32}, 1}, \
+            logsoftmax_test_params {fmt::nchw, {2, 19, 16, 16}, 1}, \
+            logsoftmax_test_params {fmt::nchw, {2, 19, 16, 16}, 3}, \
+            logsoftmax_test_params {fmt::nhwc, {2, 19, 5, 7}, 1}, \
+            logsoftmax_test_params {fmt::nhwc, {2, 19, 5, 7}, 3}, \
+            logsoftmax_test_params {fmt::nChw16c, {2, 40, 5, 7}, 1}, \
+            logsoftmax_test_params {fmt::nChw16c, {2, 32, 5, 7}, 2}, \
+            logsoftmax_test_params {fmt::nChw16c, {2, 20, 5, 7}, 3}, \
+            logsoftmax_test_params {fmt::nChw8c, {2, 19, 5, 7}, 1})
+
+TEST_P(logsoftmax_test_float, TestsLogsoftmax) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestLogsoftmaxFloat, logsoftmax_test_float, EXPAND_CASES());
+
+TEST_P(logsoftmax_test_bfloat16, TestsLogsoftmax) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestLogsoftmaxBfloat16, logsoftmax_test_bfloat16, EXPAND_CASES());
+
+} // namespace dnnl
@@ -0,0 +1,281 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using fmt = memory::format_tag;
+using dt = memory::data_type;
+
+struct matmul_test_params {
+    memory::dims src_dims;
+    memory::dims weights_dims;
+    memory::dims bias_dims; // empty if no bias
+    memory::dims dst_dims;
+    fmt src_tag;
+    fmt weights_tag;
+    fmt dst_tag;
+    int oscale_mask;
+    int zero_point_src, zero_point_wei, zero_point_dst;
+    bool with_sum, with_relu;
+    bool runtime_attr;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t, typename wei_data_t, typename dst_data_t>
+class matmul_test : public ::testing::TestWithParam<matmul_test_params> {
+protected:
+    virtual void SetUp() {
+        auto p = ::testing::TestWithParam<matmul_test_params>::GetParam();
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU does not support matmul yet.");
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // returns the offset of the element (b, r, c) of a 2D or 3D matrix,
+    // with broadcast dimensions indexed with 0
+    static memory::dim off(const memory::desc &md, memory::dim b,
+            memory::dim r, memory::dim c) {
+        const auto &d = md.data;
+        const int nd = d.ndims;
+        const auto *s = d.format_desc.blocking.strides;
+        memory::dim o = d.offset0;
+        if (nd == 3) o += (d.dims[0] == 1 ? 0 : b) * s[0];
+        o += (d.dims[nd - 2] == 1 ? 0 : r) * s[nd - 2];
+        o += (d.dims[nd - 1] == 1 ? 0 : c) * s[nd - 1];
+        return o;
+    }
+
+    template <typename data_t>
+    static void fill(const memory &m, int shift, int mod, int base) {
+        auto ptr = map_memory<data_t>(m);
+        const size_t nelems = m.get_desc().get_size() / sizeof(data_t);
+        for (size_t i = 0; i < nelems; ++i)
+            ptr[i] = (data_t)(base + (int)((i * 7 + shift) % mod));
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<matmul_test_params>::GetParam();
+
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        const auto src_dt = data_traits<src_data_t>::data_type;
+        const auto wei_dt = data_traits<wei_data_t>::data_type;
+        const auto dst_dt = data_traits<dst_data_t>::data_type;
+        const bool with_bias = !p.bias_dims.empty();
+
+        auto src_md = memory::desc(p.src_dims, src_dt, p.src_tag);
+        auto weights_md = memory::desc(p.weights_dims, wei_dt, p.weights_tag);
+        auto dst_md = memory::desc(p.dst_dims, dst_dt, p.dst_tag);
+        auto bias_md = with_bias
+                ? memory::desc(p.bias_dims, dt::f32,
+                        p.bias_dims.size() == 3 ? fmt::abc : fmt::ab)
+                : memory::desc();
+
+        const memory::dim N = p.dst_dims.back();
+        const size_t n_scales = p.oscale_mask ? N : 1;
+        std::vector<float> scales(n_scales);
+        for (size_t i = 0; i < n_scales; ++i)
+            scales[i] = 0.5f + 0.25f * (i % 3);
+
+        primitive_attr attr;
+        attr.set_output_scales(p.oscale_mask,
+                p.runtime_attr ? std::vector<float> {DNNL_RUNTIME_F32_VAL}
+                               : scales);
+        const int zp_args[3] = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
+        const int zp_vals[3]
+                = {p.zero_point_src, p.zero_point_wei, p.zero_point_dst};
+        for (int i = 0; i < 3; ++i)
+            if (zp_vals[i] != 0)
+                attr.set_zero_points(zp_args[i], 0,
+                        {p.runtime_attr ? DNNL_RUNTIME_S32_VAL : zp_vals[i]});
+        post_ops ops;
+        if (p.with_sum) ops.append_sum(0.5f);
+        if (p.with_relu) ops.append_eltwise(1.f, algorithm::eltwise_relu, 0, 0);
+        attr.set_post_ops(ops);
+
+        auto matmul_d = with_bias
+                ? matmul::desc(src_md, weights_md, bias_md, dst_md)
+                : matmul::desc(src_md, weights_md, dst_md);
+        auto matmul_pd = matmul::primitive_desc(matmul_d, attr, eng);
+
+        auto src = memory(matmul_pd.src_desc(), eng);
+        auto weights = memory(matmul_pd.weights_desc(), eng);
+        auto bias = memory(matmul_pd.bias_desc(), eng);
+        auto dst = memory(matmul_pd.dst_desc(), eng);
+
+        // small integers keep the f32 results exact
+        const bool is_int8 = src_dt != dt::f32;
+        fill<src_data_t>(src, 1, 7, is_int8 ? 0 : -3);
+        fill<wei_data_t>(weights, 2, 5, -2);
+        if (with_bias) fill<float>(bias, 3, 9, -4);
+        fill<dst_data_t>(dst, 4, 5, 0);
+
+        const auto &dst_desc = matmul_pd.dst_desc();
+        const size_t dst_nelems = dst_desc.get_size() / sizeof(dst_data_t);
+        std::vector<float> ref_dst(dst_nelems);
+        {
+            auto dst_ptr = map_memory<dst_data_t>(dst);
+            for (size_t i = 0; i < dst_nelems; ++i)
+                ref_dst[i] = (float)dst_ptr[i];
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, weights}, {DNNL_ARG_DST, dst}};
+        if (with_bias) args.insert({DNNL_ARG_BIAS, bias});
+        if (p.runtime_attr) {
+            memory::desc scales_md({(memory::dim)n_scales}, dt::f32, fmt::a);
+            auto scales_mem = memory(scales_md, eng, scales.data());
+            args.insert({DNNL_ARG_ATTR_OUTPUT_SCALES, scales_mem});
+            for (int i = 0; i < 3; ++i) {
+                if (zp_vals[i] == 0) continue;
+                memory::desc zp_md({1}, dt::s32, fmt::a);
+                auto zp_mem = memory(zp_md, eng, (void *)&zp_vals[i]);
+                args.insert({DNNL_ARG_ATTR_ZERO_POINTS | zp_args[i], zp_mem});
+            }
+        }
+
+        matmul(matmul_pd).execute(strm, args);
+        strm.wait();
+
+        // reference
+        const auto &src_d = matmul_pd.src_desc();
+        const auto &wei_d = matmul_pd.weights_desc();
+        const auto &bia_d = matmul_pd.bias_desc();
+        const int nd = (int)p.dst_dims.size();
+        const memory::dim MB = nd == 3 ? p.dst_dims[0] : 1;
+        const memory::dim M = p.dst_dims[nd - 2];
+        const memory::dim K = p.src_dims[nd - 1];
+
+        auto src_ptr = map_memory<src_data_t>(src);
+        auto wei_ptr = map_memory<wei_data_t>(weights);
+        auto bia_ptr = map_memory<float>(bias);
+        auto dst_ptr = map_memory<dst_data_t>(dst);
+
+        for_(memory::dim mb = 0; mb < MB; ++mb)
+        for_(memory::dim m = 0; m < M; ++m)
+        for (memory::dim n = 0; n < N; ++n) {
+            float acc = 0;
+            for (memory::dim k = 0; k < K; ++k)
+                acc += ((float)src_ptr[off(src_d, mb, m, k)]
+                               - p.zero_point_src)
+                        * ((float)wei_ptr[off(wei_d, mb, k, n)]
+                                - p.zero_point_wei);
+            if (with_bias) acc += bia_ptr[off(bia_d, mb, m, n)];
+            acc *= scales[p.oscale_mask ? n : 0];
+            const auto d_off = off(dst_desc, mb, m, n);
+            if (p.with_sum) acc += 0.5f * ref_dst[d_off];
+            if (p.with_relu) acc = std::max(acc, 0.f);
+            acc += p.zero_point_dst;
+            if (dst_dt != dt::f32) {
+                acc = std::nearbyint(acc);
+                const float lo = dst_dt == dt::u8 ? 0.f
+                        : dst_dt == dt::s8          ? -128.f
+                                                    : -2147483648.f;
+                const float hi = dst_dt == dt::u8 ? 255.f
+                        : dst_dt == dt::s8          ? 127.f
+                                                    : 2147483520.f;
+                acc = std::min(std::max(acc, lo), hi);
+            }
+            ASSERT_NEAR((float)dst_ptr[d_off], acc, 1e-4f * std::fabs(acc))
+                    << "mb: " << mb << " m: " << m << " n: " << n;
+        }
+    }
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // inconsistent K
+            matmul_test_params {{4, 5}, {6, 3}, {}, {4, 3}, fmt::ab, fmt::ab,
+                    fmt::ab, 0, 0, 0, 0, false, false, false, true,
+                    dnnl_invalid_arguments},
+            // non-broadcastable batch
+            matmul_test_params {{2, 4, 5}, {3, 5, 3}, {}, {3, 4, 3}, fmt::abc,
+                    fmt::abc, fmt::abc, 0, 0, 0, 0, false, false, false, true,
+                    dnnl_invalid_arguments},
+            // non-broadcastable bias
+            matmul_test_params {{4, 5}, {5, 3}, {4, 2}, {4, 3}, fmt::ab,
+                    fmt::ab, fmt::ab, 0, 0, 0, 0, false, false, false, true,
+                    dnnl_invalid_arguments});
+};
+
+static auto f32_cases = []() {
+    return ::testing::Values(
+            matmul_test_params {{4, 5}, {5, 3}, {}, {4, 3}, fmt::ab, fmt::ab,
+                    fmt::ab, 0, 0, 0, 0, false, false, false},
+            matmul_test_params {{17, 33}, {33, 19}, {1, 19}, {17, 19},
+                    fmt::ba, fmt::ba, fmt::ab, 0, 0, 0, 0, false, true,
+                    false},
+            matmul_test_params {{3, 7, 9}, {3, 9, 5}, {1, 1, 5}, {3, 7, 5},
+                    fmt::abc, fmt::acb, fmt::abc, 1 << 2, 0, 0, 0, true,
+                    false, false},
+            // batch broadcast of the weights, full bias
+            matmul_test_params {{6, 7, 9}, {1, 9, 5}, {6, 7, 5}, {6, 7, 5},
+                    fmt::abc, fmt::abc, fmt::abc, 0, 0, 0, 0, true, true,
+                    false},
+            // batch broadcast of the source, non-plain dst
+            matmul_test_params {{1, 7, 9}, {4, 9, 5}, {1, 7, 1}, {4, 7, 5},
+                    fmt::acb, fmt::abc, fmt::bac, 0, 0, 0, 0, false, true,
+                    true},
+            matmul_test_params {{2, 16, 64}, {2, 64, 32}, {}, {2, 16, 32},
+                    fmt::abc, fmt::abc, fmt::abc, 1 << 2, 0, 0, 0, true, true,
+                    true});
+};
+
+static auto int8_cases = []() {
+    return ::testing::Values(
+            matmul_test_params {{4, 5}, {5, 3}, {}, {4, 3}, fmt::ab, fmt::ab,
+                    fmt::ab, 0, 0, 0, 0, false, false, false},
+            matmul_test_params {{17, 33}, {33, 19}, {1, 19}, {17, 19},
+                    fmt::ab, fmt::ba, fmt::ab, 1 << 1, 0, 0, 0, true, true,
+                    false},
+            matmul_test_params {{3, 7, 9}, {3, 9, 5}, {1, 1, 5}, {3, 7, 5},
+                    fmt::abc, fmt::abc, fmt::abc, 0, 2, 0, 0, false, false,
+                    false},
+            matmul_test_params {{3, 7, 9}, {1, 9, 5}, {1, 1, 5}, {3, 7, 5},
+                    fmt::acb, fmt::abc, fmt::abc, 1 << 2, 3, -1, 4, true,
+                    false, false},
+            matmul_test_params {{2, 16, 64}, {2, 64, 32}, {}, {2, 16, 32},
+                    fmt::abc, fmt::abc, fmt::abc, 0, 1, 1, -2, true, true,
+                    true});
+};
+
+using matmul_test_f32 = matmul_test<float, float, float>;
+using matmul_test_u8s8f32 = matmul_test<uint8_t, int8_t, float>;
+using matmul_test_s8s8s32 = matmul_test<int8_t, int8_t, int32_t>;
+using matmul_test_u8s8u8 = matmul_test<uint8_t, int8_t, uint8_t>;
+
+#define CPU_INST_TEST_CASE(test, cases) \
+    CPU_TEST_P(test, TestsMatmul) {} \
+    CPU_INSTANTIATE_TEST_SUITE_P(TestMatmulEF, test, expected_failures()); \
+    CPU_INSTANTIATE_TEST_SUITE_P(TestMatmul, test, cases());
+
+CPU_INST_TEST_CASE(matmul_test_f32, f32_cases)
+CPU_INST_TEST_CASE(matmul_test_u8s8f32, int8_cases)
+CPU_INST_TEST_CASE(matmul_test_s8s8s32, int8_cases)
+CPU_INST_TEST_CASE(matmul_test_u8s8u8, int8_cases)
+
+#undef CPU_INST_TEST_CASE
+} // namespace dnnl
@@ -0,0 +1,335 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu_isa_traits.hpp"
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using fmt = memory::format_tag;
+
+struct reduction_test_params {
+    fmt src_format;
+    fmt dst_format;
+    algorithm aalgorithm;
+    memory::dims src_dims;
+    memory::dims dst_dims;
+    float p;
+    float eps;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t, typename dst_data_t = src_data_t>
+class reduction_test : public ::testing::TestWithParam<reduction_test_params> {
+private:
+    memory::data_type src_data_type;
+    memory::data_type dst_data_type;
+
+    static bool is_norm(algorithm alg) {
+        return alg == algorithm::reduction_norm_lp_max
+                || alg == algorithm::reduction_norm_lp_sum
+                || alg == algorithm::reduction_norm_lp_power_p_max
+                || alg == algorithm::reduction_norm_lp_power_p_sum;
+    }
+
+    void fill_src(const memory &src) {
+        const memory::desc src_desc = src.get_desc();
+        const bool is_int8 = src_data_type == memory::data_type::s8
+                || src_data_type == memory::data_type::u8;
+        const float shift = src_data_type == memory::data_type::u8 ? 0 : 8;
+        const float scale = is_int8 ? 1.f : 0.25f;
+
+        // small values that are exact in every data type
+        auto src_data = map_memory<src_data_t>(src);
+        const auto nelems = src_desc.get_size() / sizeof(src_data_t);
+        for (size_t i = 0; i < nelems; ++i)
+            src_data[i] = src_data_t(((i * 13) % 17 - shift) * scale);
+        check_zero_tail<src_data_t>(1, src);
+    }
+
+    void check_data(const reduction_test_params &p, const memory &src,
+            const memory &dst) {
+        auto src_data = map_memory<const src_data_t>(src);
+        auto dst_data = map_memory<const dst_data_t>(dst);
+
+        const memory::desc src_desc = src.get_desc(),
+                           dst_desc = dst.get_desc();
+        const dnnl::impl::memory_desc_wrapper src_mdw(src_desc.data),
+                dst_mdw(dst_desc.data);
+        const int ndims = src_desc.data.ndims;
+        const auto &src_dims = src_desc.data.dims;
+        const auto &dst_dims = dst_desc.data.dims;
+
+        memory::dim reduce_size = 1;
+        dnnl::impl::dims_t reduce_dims;
+        for (int d = 0; d < ndims; ++d) {
+            reduce_dims[d] = dst_dims[d] == src_dims[d] ? 1 : src_dims[d];
+            reduce_size *= reduce_dims[d];
+        }
+
+        const float tol = dst_data_type == memory::data_type::bf16 ? 1e-2
+                                                                   : 1e-5;
+
+        const memory::dim dst_nelems = dst_mdw.nelems();
+        dnnl::impl::parallel_nd(dst_nelems, [&](memory::dim i) {
+            if (is_current_test_failed()) return;
+
+            dnnl::impl::dims_t dst_pos, src_pos;
+            memory::dim off = i;
+            for (int d = ndims - 1; d >= 0; --d) {
+                dst_pos[d] = off % dst_dims[d];
+                off /= dst_dims[d];
+            }
+
+            double acc = 0, abs_acc = 0;
+            if (p.aalgorithm == algorithm::reduction_max)
+                acc = -INFINITY;
+            else if (p.aalgorithm == algorithm::reduction_min)
+                acc = INFINITY;
+            else if (p.aalgorithm == algorithm::reduction_mul)
+                acc = 1;
+
+            for (memory::dim r = 0; r < reduce_size; ++r) {
+                off = r;
+                for (int d = ndims - 1; d >= 0; --d) {
+                    src_pos[d] = dst_pos[d] + off % reduce_dims[d];
+                    off /= reduce_dims[d];
+                }
+                const double x = src_data[src_mdw.off_v(src_pos)];
+                switch (p.aalgorithm) {
+                    case algorithm::reduction_max:
+                        acc = (std::max)(acc, x);
+                        break;
+                    case algorithm::reduction_min:
+                        acc = (std::min)(acc, x);
+                        break;
+                    case algorithm::reduction_mul: acc *= x; break;
+                    case algorithm::reduction_sum:
+                    case algorithm::reduction_mean: acc += x; break;
+                    default: acc += std::pow(std::fabs(x), p.p); break;
+                }
+                abs_acc += std::fabs(x);
+            }
+
+            switch (p.aalgorithm) {
+                case algorithm::reduction_mean: acc /= reduce_size; break;
+                case algorithm::reduction_norm_lp_max:
+                    acc = std::pow((std::max)(acc, (double)p.eps), 1. / p.p);
+                    break;
+                case algorithm::reduction_norm_lp_sum:
+                    acc = std::pow(acc + p.eps, 1. / p.p);
+                    break;
+                case algorithm::reduction_norm_lp_power_p_max:
+                    acc = (std::max)(acc, (double)p.eps);
+                    break;
+                case algorithm::reduction_norm_lp_power_p_sum:
+                    acc += p.eps;
+                    break;
+                default: break;
+            }
+
+            float ref = (float)acc;
+            const float got = dst_data[dst_mdw.off_v(dst_pos)];
+            if (dst_data_type == memory::data_type::u8
+                    || dst_data_type == memory::data_type::s8) {
+                const float lbound
+                        = dst_data_type == memory::data_type::u8 ? 0 : -128;
+                const float ubound
+                        = dst_data_type == memory::data_type::u8 ? 255 : 127;
+                ref = (std::min)((std::max)(nearbyintf(ref), lbound), ubound);
+                // rounding of a mean may differ in the last bit
+                ASSERT_NEAR(got, ref, 1.f);
+                return;
+            }
+
+            // the error of a sum is bounded by the sum of absolute values
+            float bound = fabsf(ref);
+            if (!is_norm(p.aalgorithm)
+                    && p.aalgorithm != algorithm::reduction_mul)
+                bound = (std::max)(bound,
+                        (float)abs_acc
+                                / (p.aalgorithm == algorithm::reduction_mean
+                                                ? reduce_size
+                                                : 1));
+            ASSERT_NEAR(got, ref, tol * (std::max)(1.f, bound));
+        });
+    }
+
+protected:
+    virtual void SetUp() {
+        src_data_type = data_traits<src_data_t>::data_type;
+        dst_data_type = data_traits<dst_data_t>::data_type;
+        reduction_test_params p
+                = ::testing::TestWithParam<reduction_test_params>::GetParam();
+        // TODO: remove me
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU does not support reduction yet.");
+        SKIP_IF((src_data_type == memory::data_type::bf16
+                        || dst_data_type == memory::data_type::bf16)
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "current ISA doesn't support bfloat16 data type");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        reduction_test_params p
+                = ::testing::TestWithParam<reduction_test_params>::GetParam();
+
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        auto src_desc = memory::desc(p.src_dims, src_data_type, p.src_format);
+        auto dst_desc = memory::desc(p.dst_dims, dst_data_type, p.dst_format);
+
+        auto reduction_desc = reduction::desc(
+                p.aalgorithm, src_desc, dst_desc, p.p, p.eps);
+        auto reduction_pd = reduction::primitive_desc(reduction_desc, eng);
+
+        dst_desc = reduction_pd.dst_desc();
+        auto src = memory(src_desc, eng);
+        auto dst = memory(dst_desc, eng);
+
+        fill_src(src);
+        fill_data<dst_data_t>(dst_desc.get_size() / sizeof(dst_data_t), dst);
+        check_zero_tail<dst_data_t>(1, dst);
+
+        reduction(reduction_pd)
+                .execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        check_data(p, src, dst);
+        check_zero_tail<dst_data_t>(0, dst);
+    }
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // dst dimension is neither kept nor reduced
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_sum, {2, 16, 5, 7}, {2, 8, 1, 1}, 0.f,
+                    0.f, true, dnnl_invalid_arguments},
+            // different number of dimensions
+            reduction_test_params {fmt::nchw, fmt::nc,
+                    algorithm::reduction_sum, {2, 16, 5, 7}, {2, 16}, 0.f, 0.f,
+                    true, dnnl_invalid_arguments},
+            // power is less than 1
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_norm_lp_sum, {2, 16, 5, 7},
+                    {2, 16, 1, 1}, 0.5f, 0.f, true, dnnl_invalid_arguments},
+            // negative epsilon
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_norm_lp_max, {2, 16, 5, 7},
+                    {2, 16, 1, 1}, 2.f, -1.f, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            // reduction of the innermost dimensions
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_sum, {2, 16, 5, 7}, {2, 16, 1, 1}},
+            reduction_test_params {fmt::nchw, fmt::any,
+                    algorithm::reduction_mean, {3, 5, 13, 11}, {3, 5, 1, 1}},
+            reduction_test_params {fmt::nhwc, fmt::nhwc,
+                    algorithm::reduction_max, {3, 19, 4, 5}, {3, 1, 4, 5}},
+            reduction_test_params {fmt::nhwc, fmt::any,
+                    algorithm::reduction_min, {2, 35, 3, 3}, {2, 1, 3, 3}},
+            // reduction of the outermost dimensions
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_sum, {7, 16, 5, 7}, {1, 16, 5, 7}},
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_max, {5, 3, 5, 7}, {1, 1, 5, 7}},
+            reduction_test_params {fmt::nChw16c, fmt::nChw16c,
+                    algorithm::reduction_mean, {9, 32, 3, 3}, {1, 32, 3, 3}},
+            // reduction of the middle dimensions
+            reduction_test_params {fmt::nChw16c, fmt::any,
+                    algorithm::reduction_sum, {2, 32, 5, 7}, {2, 32, 1, 1}},
+            reduction_test_params {fmt::nChw8c, fmt::nChw8c,
+                    algorithm::reduction_min, {2, 20, 6, 5}, {2, 20, 1, 1}},
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_mean, {2, 19, 6, 5}, {2, 1, 1, 5}},
+            // global reduction
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_sum, {2, 3, 4, 5}, {1, 1, 1, 1}},
+            reduction_test_params {fmt::nhwc, fmt::nchw,
+                    algorithm::reduction_max, {1, 1, 128, 99}, {1, 1, 1, 1}},
+            // non-contiguous reduced dimensions
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_sum, {4, 3, 8, 2}, {4, 1, 8, 1}},
+            reduction_test_params {fmt::nChw16c, fmt::nChw16c,
+                    algorithm::reduction_max, {2, 24, 3, 4}, {2, 1, 3, 4}},
+            // product of a few values
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_mul, {2, 3, 2, 2}, {2, 3, 1, 1}},
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_mul, {3, 20, 1, 3}, {1, 20, 1, 3}});
+};
+
+static auto norm_cases = []() {
+    return ::testing::Values(
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_norm_lp_sum, {2, 16, 5, 7},
+                    {2, 16, 1, 1}, 1.f, 0.f},
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_norm_lp_sum, {2, 16, 5, 7},
+                    {2, 16, 1, 1}, 2.f, 0.5f},
+            reduction_test_params {fmt::nhwc, fmt::nhwc,
+                    algorithm::reduction_norm_lp_max, {3, 19, 4, 5},
+                    {3, 1, 4, 5}, 2.f, 1000.f},
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_norm_lp_power_p_max, {7, 16, 5, 7},
+                    {1, 16, 5, 7}, 1.f, 0.25f},
+            reduction_test_params {fmt::nChw16c, fmt::nChw16c,
+                    algorithm::reduction_norm_lp_power_p_sum, {9, 32, 3, 3},
+                    {1, 32, 3, 3}, 2.f, 1.f},
+            reduction_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::reduction_norm_lp_sum, {2, 3, 4, 5},
+                    {1, 1, 1, 1}, 3.f, 0.f});
+};
+
+#define CPU_INST_TEST_CASE(test) \
+    CPU_TEST_P(test, TestsReduction) {} \
+    CPU_INSTANTIATE_TEST_SUITE_P( \
+            TestReductionEF, test, expected_failures()); \
+    CPU_INSTANTIATE_TEST_SUITE_P( \
+            TestReductionSimple, test, simple_cases()); \
+    CPU_INSTANTIATE_TEST_SUITE_P(TestReductionNorm, test, norm_cases());
+
+#define INST_TEST_CASE(test) CPU_INST_TEST_CASE(test)
+
+using reduction_test_float = reduction_test<float>;
+using reduction_test_bfloat16 = reduction_test<bfloat16_t>;
+using reduction_test_bfloat16_float = reduction_test<bfloat16_t, float>;
+using reduction_test_u8 = reduction_test<uint8_t>;
+using reduction_test_s8_float = reduction_test<int8_t, float>;
+using reduction_test_u8_float = reduction_test<uint8_t, float>;
+
+INST_TEST_CASE(reduction_test_float)
+INST_TEST_CASE(reduction_test_bfloat16)
+INST_TEST_CASE(reduction_test_bfloat16_float)
+INST_TEST_CASE(reduction_test_u8)
+INST_TEST_CASE(reduction_test_s8_float)
+INST_TEST_CASE(reduction_test_u8_float)
+
+#undef CPU_INST_TEST_CASE
+} // namespace dnnl
@@ -14,8 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
@@ -306,4 +310,169 @@ GPU_INSTANTIATE_TEST_SUITE_P(PaddedWeights, reorder_simple_test_f32_f32,
         ::testing::Values(cfg_f32 {fmt::oihw, fmt::IOhw16i16o, {17, 23, 2, 1}},
                 cfg_f32 {fmt::goihw, fmt::gOIhw16o16i, {2, 17, 23, 1, 2}}));
 
+// The cases below were left to the reference reorder before: a sum post-op
+// with a scale other than 0 and 1, a source with an offset, and more outer
+// dimensions than the fixed threading drivers cover.
+TEST(reorder_jit_test, TestBetaOffsetManyDims) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The JIT reorder is tested on CPU only");
+    using dt = memory::data_type;
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    const float scale = 2.f, beta = 0.5f;
+    primitive_attr attr;
+    attr.set_output_scales(0, {scale});
+    post_ops ops;
+    ops.append_sum(beta);
+    attr.set_post_ops(ops);
+
+    auto test = [&](const memory::desc &md_parent, const memory::desc &md_i,
+                        const memory::desc &md_o) {
+        // a view is passed as the memory it is a part of
+        memory src(md_parent, eng), dst(md_o, eng);
+
+        const size_t nelems_parent = md_parent.get_size() / sizeof(float);
+        const size_t dst_size = md_o.get_size();
+        std::vector<int8_t> prev_dst(dst_size);
+        {
+            auto src_data = map_memory<float>(src);
+            for (size_t i = 0; i < nelems_parent; ++i)
+                src_data[i] = 0.75f * ((int)(i % 13) - 6);
+            auto dst_data = map_memory<int8_t>(dst);
+            for (size_t i = 0; i < dst_size; ++i)
+                prev_dst[i] = dst_data[i] = (int8_t)(7 * ((int)(i % 11) - 5));
+        }
+
+        auto pd = reorder::primitive_desc(eng, md_i, eng, md_o, attr);
+        ASSERT_EQ(std::string(pd.impl_info_str()).find("jit:uni"), 0u);
+        reorder(pd).execute(strm, src, dst);
+        strm.wait();
+
+        const dnnl::impl::memory_desc_wrapper mdw_i(md_i.data);
+        const dnnl::impl::memory_desc_wrapper mdw_o(md_o.data);
+        auto src_data = map_memory<const float>(src);
+        auto dst_data = map_memory<const int8_t>(dst);
+        for (memory::dim i = 0; i < mdw_i.nelems(); ++i) {
+            const auto off_o = mdw_o.off_l(i, false);
+            float ref = scale * src_data[mdw_i.off_l(i, false)]
+                    + beta * prev_dst[off_o];
+            ref = std::max(-128.f, std::min(127.f, std::nearbyint(ref)));
+            ASSERT_EQ(dst_data[off_o], (int8_t)ref)
+                    << "mismatch at position " << i;
+        }
+    };
+
+    // arbitrary beta
+    {
+        memory::desc md_i({2, 19, 5, 7}, dt::f32, fmt::nchw);
+        memory::desc md_o({2, 19, 5, 7}, dt::s8, fmt::nhwc);
+        test(md_i, md_i, md_o);
+    }
+
+    // the source is a part of a bigger memory
+    {
+        memory::desc md_parent({4, 32, 5, 7}, dt::f32, fmt::nchw);
+        auto md_i = md_parent.submemory_desc({2, 32, 5, 7}, {1, 0, 0, 0});
+        memory::desc md_o({2, 32, 5, 7}, dt::s8, fmt::nChw16c);
+        test(md_parent, md_i, md_o);
+    }
+
+    // a full transposition of 9 dimensions, none of which can be merged:
+    // the kernel takes a few of them, the driver takes more than 4
+    {
+        const int ndims = 9;
+        memory::dims dims(ndims, 2), strides_i(ndims), strides_o(ndims);
+        dims[0] = 256;
+        memory::dim stride_i = 1, stride_o = 1;
+        for (int d = 0; d < ndims; ++d) {
+            strides_i[ndims - 1 - d] = stride_i;
+            stride_i *= dims[ndims - 1 - d];
+            strides_o[d] = stride_o;
+            stride_o *= dims[d];
+        }
+        memory::desc md_i(dims, dt::f32, strides_i);
+        memory::desc md_o(dims, dt::s8, strides_o);
+        test(md_i, md_i, md_o);
+    }
+}
+
+// With DNNL_WEIGHTS_CACHE set, the reorders below are served from the cache
+// when the source data was seen before. The result must not depend on
+// whether it was computed or copied, and a change of the data or of the
+// scales must not hit the entry of other data.
+TEST(reorder_weights_cache_test, TestConsistency) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The weights cache is implemented on CPU only");
+    using dt = memory::data_type;
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    const memory::dims dims = {64, 32, 3, 3};
+    const memory::desc md_i(dims, dt::f32, fmt::oihw);
+    const size_t nelems = md_i.get_size() / sizeof(float);
+
+    auto run = [&](const memory::desc &md_o, const std::vector<float> &data,
+                       float scale) {
+        primitive_attr attr;
+        attr.set_output_scales(1 << 0, std::vector<float>(dims[0], scale));
+        memory src(md_i, eng), dst(md_o, eng);
+        {
+            auto src_data = map_memory<float>(src);
+            std::copy(data.begin(), data.end(), &src_data[0]);
+            auto dst_data = map_memory<uint8_t>(dst);
+            for (size_t i = 0; i < md_o.get_size(); ++i)
+                dst_data[i] = (uint8_t)(i * 37);
+        }
+        reorder(reorder::primitive_desc(eng, md_i, eng, md_o, attr))
+                .execute(strm, src, dst);
+        strm.wait();
+
+        auto dst_data = map_memory<const uint8_t>(dst);
+        return std::vector<uint8_t>(
+                &dst_data[0], &dst_data[0] + md_o.get_size());
+    };
+
+    auto test = [&](const memory::desc &md_o) {
+        std::vector<float> data(nelems);
+        for (size_t i = 0; i < nelems; ++i)
+            data[i] = 0.25f * ((int)(i % 29) - 14);
+
+        const auto ref = run(md_o, data, 2.f);
+        ASSERT_EQ(run(md_o, data, 2.f), ref);
+        ASSERT_NE(run(md_o, data, 3.f), ref);
+
+        data[nelems / 2] += 1.f;
+        const auto ref_changed = run(md_o, data, 2.f);
+        ASSERT_NE(ref_changed, ref);
+        ASSERT_EQ(run(md_o, data, 2.f), ref_changed);
+    };
+
+    // int8 weights with the s8s8 compensation
+    {
+        memory::desc md_o(dims, dt::s8, fmt::OIhw4i16o4i);
+        md_o.data.extra.flags = dnnl_memory_extra_flag_compensation_conv_s8s8;
+        md_o.data.extra.compensation_mask = 1 << 0;
+        test(md_o);
+    }
+
+    // Winograd weights, if a Winograd convolution is available
+    {
+        memory::desc src_md({1, dims[1], 14, 14}, dt::f32, fmt::any);
+        memory::desc wei_md(dims, dt::f32, fmt::any);
+        memory::desc dst_md({1, dims[0], 14, 14}, dt::f32, fmt::any);
+        auto desc = convolution_forward::desc(prop_kind::forward_inference,
+                algorithm::convolution_winograd, src_md, wei_md, dst_md,
+                {1, 1}, {1, 1}, {1, 1});
+        memory::desc md_o;
+        try {
+            md_o = convolution_forward::primitive_desc(desc, eng)
+                           .weights_desc();
+        } catch (const error &e) {
+            ASSERT_EQ(e.status, dnnl_unimplemented);
+        }
+        if (md_o.data.format_kind == dnnl_format_kind_wino) test(md_o);
+    }
+}
+
 } // namespace dnnl
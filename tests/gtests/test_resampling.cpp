@@ -0,0 +1,330 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu_isa_traits.hpp"
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using fmt = memory::format_tag;
+
+struct resampling_test_params {
+    fmt src_format;
+    fmt dst_format;
+    algorithm aalgorithm;
+    memory::dims src_dims;
+    memory::dims dst_dims; // deduced from the factors if empty
+    std::vector<float> factors;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class resampling_test
+    : public ::testing::TestWithParam<resampling_test_params> {
+private:
+    memory::data_type data_type;
+    resampling_test_params p;
+    engine eng;
+    stream strm;
+    std::shared_ptr<resampling_forward::primitive_desc> fwd_pd;
+
+    // up to two input points and their weights for the output point o
+    int coeffs(memory::dim o, memory::dim O, memory::dim I, memory::dim *idx,
+            float *wei) const {
+        if (p.aalgorithm == algorithm::resampling_nearest) {
+            idx[0] = (std::min)((memory::dim)((o + 0.5f) * I / O), I - 1);
+            wei[0] = 1.f;
+            return 1;
+        }
+        const float x = (std::max)((o + 0.5f) * I / O - 0.5f, 0.f);
+        idx[0] = (std::min)((memory::dim)x, I - 1);
+        idx[1] = (std::min)(idx[0] + 1, I - 1);
+        wei[1] = (std::min)(x - idx[0], 1.f);
+        wei[0] = 1.f - wei[1];
+        return 2;
+    }
+
+    // calls f(src_pos, dst_pos, weight) for every pair of points
+    template <typename F>
+    void for_each_pair(const memory::desc &src_desc,
+            const memory::desc &dst_desc, const F &f) const {
+        const int ndims = src_desc.data.ndims;
+        const auto &sdims = src_desc.data.dims;
+        const auto &ddims = dst_desc.data.dims;
+
+        dnnl::impl::dims_t dpos, spos;
+        const memory::dim nelems
+                = dnnl::impl::memory_desc_wrapper(dst_desc.data).nelems();
+        for (memory::dim l = 0; l < nelems; ++l) {
+            memory::dim off = l;
+            for (int d = ndims - 1; d >= 0; --d) {
+                dpos[d] = off % ddims[d];
+                off /= ddims[d];
+            }
+
+            memory::dim idx[3][2];
+            float wei[3][2];
+            int n[3] = {1, 1, 1};
+            for (int d = 2; d < ndims; ++d)
+                n[d - 2] = coeffs(dpos[d], ddims[d], sdims[d], idx[d - 2],
+                        wei[d - 2]);
+
+            spos[0] = dpos[0];
+            spos[1] = dpos[1];
+            for_(int i = 0; i < n[0]; ++i)
+            for_(int j = 0; j < n[1]; ++j)
+            for (int k = 0; k < n[2]; ++k) {
+                const int ij[3] = {i, j, k};
+                float w = 1.f;
+                for (int d = 2; d < ndims; ++d) {
+                    spos[d] = idx[d - 2][ij[d - 2]];
+                    w *= wei[d - 2][ij[d - 2]];
+                }
+                f(spos, dpos, w);
+            }
+        }
+    }
+
+    // the offset of pos in the dense plain layout
+    static memory::dim plain_off(const dnnl::impl::memory_desc_wrapper &mdw,
+            const dnnl::impl::dims_t &pos) {
+        memory::dim off = 0;
+        for (int d = 0; d < mdw.ndims(); ++d)
+            off = off * mdw.dims()[d] + pos[d];
+        return off;
+    }
+
+    void check_fwd(const memory &src, const memory &dst) const {
+        auto src_data = map_memory<const data_t>(src);
+        auto dst_data = map_memory<const data_t>(dst);
+        const memory::desc src_desc = src.get_desc(),
+                           dst_desc = dst.get_desc();
+        const dnnl::impl::memory_desc_wrapper src_mdw(src_desc.data),
+                dst_mdw(dst_desc.data);
+
+        std::vector<float> ref(dst_mdw.nelems(), 0.f);
+        for_each_pair(src_desc, dst_desc,
+                [&](const dnnl::impl::dims_t &spos,
+                        const dnnl::impl::dims_t &dpos, float w) {
+                    ref[plain_off(dst_mdw, dpos)]
+                            += w * src_data[src_mdw.off_v(spos)];
+                });
+        compare(dst_mdw, dst_data, ref);
+    }
+
+    void check_bwd(const memory &diff_src, const memory &diff_dst) const {
+        auto diff_src_data = map_memory<const data_t>(diff_src);
+        auto diff_dst_data = map_memory<const data_t>(diff_dst);
+        const memory::desc diff_src_desc = diff_src.get_desc(),
+                           diff_dst_desc = diff_dst.get_desc();
+        const dnnl::impl::memory_desc_wrapper diff_src_mdw(diff_src_desc.data),
+                diff_dst_mdw(diff_dst_desc.data);
+
+        std::vector<float> ref(diff_src_mdw.nelems(), 0.f);
+        for_each_pair(diff_src_desc, diff_dst_desc,
+                [&](const dnnl::impl::dims_t &spos,
+                        const dnnl::impl::dims_t &dpos, float w) {
+                    ref[plain_off(diff_src_mdw, spos)]
+                            += w * diff_dst_data[diff_dst_mdw.off_v(dpos)];
+                });
+        compare(diff_src_mdw, diff_src_data, ref);
+    }
+
+    // ref is in the dense plain layout
+    void compare(const dnnl::impl::memory_desc_wrapper &mdw,
+            const data_t *data, const std::vector<float> &ref) const {
+        const float tol = data_type == memory::data_type::bf16 ? 1e-2 : 1e-5;
+        for (size_t l = 0; l < ref.size(); ++l) {
+            const float got = data[mdw.off_l(l)];
+            ASSERT_NEAR(got, ref[l], tol * (std::max)(1.f, fabsf(ref[l])));
+        }
+    }
+
+protected:
+    virtual void SetUp() {
+        data_type = data_traits<data_t>::data_type;
+        p = ::testing::TestWithParam<resampling_test_params>::GetParam();
+        // TODO: remove me
+        SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+                "GPU does not support resampling yet.");
+        SKIP_IF(data_type == memory::data_type::bf16
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "current ISA doesn't support bfloat16 data type");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        eng = engine(get_test_engine_kind(), 0);
+        strm = stream(eng);
+
+        Forward();
+        Backward();
+    }
+
+    void Forward() {
+        auto src_desc = memory::desc(p.src_dims, data_type, p.src_format);
+        auto fwd_desc = p.dst_dims.empty()
+                ? resampling_forward::desc(prop_kind::forward_training,
+                        p.aalgorithm, p.factors, src_desc)
+                : resampling_forward::desc(prop_kind::forward_training,
+                        p.aalgorithm, src_desc,
+                        memory::desc(p.dst_dims, data_type, p.dst_format));
+        fwd_pd.reset(new resampling_forward::primitive_desc(fwd_desc, eng));
+
+        auto src = memory(src_desc, eng);
+        auto dst = memory(fwd_pd->dst_desc(), eng);
+
+        fill_data<data_t>(src_desc.get_size() / sizeof(data_t), src);
+        fill_data<data_t>(
+                fwd_pd->dst_desc().get_size() / sizeof(data_t), dst);
+        check_zero_tail<data_t>(1, src);
+        check_zero_tail<data_t>(1, dst);
+
+        resampling_forward(*fwd_pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        check_zero_tail<data_t>(0, dst);
+        check_fwd(src, dst);
+    }
+
+    void Backward() {
+        auto diff_src_desc
+                = memory::desc(p.src_dims, data_type, p.src_format);
+        auto diff_dst_desc = fwd_pd->dst_desc();
+        auto bwd_desc = resampling_backward::desc(
+                p.aalgorithm, diff_src_desc, diff_dst_desc);
+        auto bwd_pd = resampling_backward::primitive_desc(
+                bwd_desc, eng, *fwd_pd);
+        bwd_pd = resampling_backward::primitive_desc(
+                bwd_pd.get()); // test construction from a C pd
+
+        auto diff_src = memory(diff_src_desc, eng);
+        auto diff_dst = memory(diff_dst_desc, eng);
+
+        fill_data<data_t>(
+                diff_dst_desc.get_size() / sizeof(data_t), diff_dst);
+        fill_data<data_t>(
+                diff_src_desc.get_size() / sizeof(data_t), diff_src);
+        check_zero_tail<data_t>(1, diff_dst);
+        check_zero_tail<data_t>(1, diff_src);
+
+        resampling_backward(bwd_pd).execute(strm,
+                {{DNNL_ARG_DIFF_DST, diff_dst},
+                        {DNNL_ARG_DIFF_SRC, diff_src}});
+        strm.wait();
+
+        check_zero_tail<data_t>(0, diff_src);
+        check_bwd(diff_src, diff_dst);
+    }
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // different number of channels
+            resampling_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::resampling_linear, {2, 16, 5, 7},
+                    {2, 8, 10, 14}, {}, true, dnnl_invalid_arguments},
+            // no spatial dimensions
+            resampling_test_params {fmt::nc, fmt::nc,
+                    algorithm::resampling_nearest, {2, 16}, {2, 16}, {}, true,
+                    dnnl_invalid_arguments},
+            // not a resampling algorithm
+            resampling_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::pooling_max, {2, 16, 5, 7}, {2, 16, 10, 14},
+                    {}, true, dnnl_invalid_arguments});
+};
+
+static auto cases_2d = []() {
+    return ::testing::Values(
+            resampling_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::resampling_nearest, {2, 3, 5, 7},
+                    {2, 3, 10, 14}},
+            resampling_test_params {fmt::nchw, fmt::nchw,
+                    algorithm::resampling_linear, {2, 3, 5, 7}, {2, 3, 9, 4}},
+            resampling_test_params {fmt::nChw16c, fmt::nChw16c,
+                    algorithm::resampling_linear, {2, 32, 5, 7},
+                    {2, 32, 10, 14}},
+            resampling_test_params {fmt::nChw16c, fmt::any,
+                    algorithm::resampling_nearest, {2, 19, 5, 7},
+                    {2, 19, 15, 3}},
+            resampling_test_params {fmt::nChw8c, fmt::nChw8c,
+                    algorithm::resampling_linear, {1, 20, 6, 5},
+                    {1, 20, 9, 13}},
+            resampling_test_params {fmt::nhwc, fmt::nhwc,
+                    algorithm::resampling_linear, {2, 19, 8, 9},
+                    {2, 19, 3, 4}},
+            resampling_test_params {fmt::nhwc, fmt::any,
+                    algorithm::resampling_nearest, {2, 35, 4, 4},
+                    {2, 35, 7, 9}},
+            resampling_test_params {fmt::nhwc, fmt::nhwc,
+                    algorithm::resampling_linear, {1, 200, 3, 3},
+                    {1, 200, 6, 6}},
+            resampling_test_params {fmt::nChw16c, fmt::any,
+                    algorithm::resampling_linear, {2, 16, 4, 6}, {},
+                    {2.f, 2.f}},
+            resampling_test_params {fmt::nhwc, fmt::any,
+                    algorithm::resampling_nearest, {2, 16, 9, 6}, {},
+                    {0.5f, 1.5f}});
+};
+
+static auto cases_1d_3d = []() {
+    return ::testing::Values(
+            resampling_test_params {fmt::ncw, fmt::ncw,
+                    algorithm::resampling_linear, {2, 5, 9}, {2, 5, 17}},
+            resampling_test_params {fmt::nCw16c, fmt::nCw16c,
+                    algorithm::resampling_linear, {2, 16, 9}, {2, 16, 17}},
+            resampling_test_params {fmt::nwc, fmt::nwc,
+                    algorithm::resampling_nearest, {2, 21, 9}, {2, 21, 4}},
+            resampling_test_params {fmt::ncdhw, fmt::ncdhw,
+                    algorithm::resampling_nearest, {1, 3, 3, 4, 5},
+                    {1, 3, 6, 8, 10}},
+            resampling_test_params {fmt::nCdhw16c, fmt::nCdhw16c,
+                    algorithm::resampling_linear, {1, 16, 3, 4, 5},
+                    {1, 16, 6, 8, 10}},
+            resampling_test_params {fmt::nCdhw8c, fmt::any,
+                    algorithm::resampling_linear, {1, 12, 5, 3, 2},
+                    {1, 12, 2, 7, 5}},
+            resampling_test_params {fmt::ndhwc, fmt::ndhwc,
+                    algorithm::resampling_nearest, {1, 7, 3, 3, 3},
+                    {1, 7, 5, 2, 6}});
+};
+
+#define CPU_INST_TEST_CASE(test) \
+    CPU_TEST_P(test, TestsResampling) {} \
+    CPU_INSTANTIATE_TEST_SUITE_P( \
+            TestResamplingEF, test, expected_failures()); \
+    CPU_INSTANTIATE_TEST_SUITE_P(TestResampling2D, test, cases_2d()); \
+    CPU_INSTANTIATE_TEST_SUITE_P(TestResampling1D3D, test, cases_1d_3d());
+
+#define INST_TEST_CASE(test) CPU_INST_TEST_CASE(test)
+
+using resampling_test_float = resampling_test<float>;
+using resampling_test_bfloat16 = resampling_test<bfloat16_t>;
+
+INST_TEST_CASE(resampling_test_float)
+INST_TEST_CASE(resampling_test_bfloat16)
+
+#undef CPU_INST_TEST_CASE
+} // namespace dnnl
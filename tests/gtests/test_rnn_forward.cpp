@@ -482,4 +482,365 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestRNN_failure, rnn_forward_test_f32,
                 //               L  D  T  MB  SLC  SIC  DLC  DIC
                 test_rnn_sizes_t(1, 1, 1, 1, 10, 5, 5, 5)}));
 
+// Runs a multi-layer LSTM with per-sample sequence lengths and compares each
+// sample to a run of the sequence truncated to its own length
+TEST(rnn_seq_lengths_test, TestLSTMFinalStates) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sequence lengths are supported on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    const memory::dim l = 2, d = 1, g = 4, t = 5, mb = 3, c = 8;
+
+    auto run = [&](memory::dim n_iter, memory::dim batch,
+                       const float *src_layer,
+                       const float *src_iter, const float *src_iter_c,
+                       const memory &weights_layer, const memory &weights_iter,
+                       const memory &bias, float *dst_layer, float *dst_iter,
+                       float *dst_iter_c, const int32_t *seq_lengths) {
+        auto src_layer_md
+                = memory::desc({n_iter, batch, c}, dt::f32, tag::tnc);
+        auto states_md = memory::desc({l, d, batch, c}, dt::f32, tag::ldnc);
+        auto ld = lstm_forward::desc(prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, src_layer_md,
+                states_md, states_md, weights_layer.get_desc(),
+                weights_iter.get_desc(), bias.get_desc(), src_layer_md,
+                states_md, states_md);
+        auto lpd = lstm_forward::primitive_desc(ld, eng);
+
+        auto mem = [&](const memory::desc &md, const float *data) {
+            memory m(md, eng);
+            auto ptr = map_memory<float>(m);
+            for (size_t i = 0; i < md.get_size() / sizeof(float); i++)
+                ptr[i] = data ? data[i] : 0.f;
+            return m;
+        };
+        auto src_layer_m = mem(src_layer_md, src_layer);
+        auto src_iter_m = mem(states_md, src_iter);
+        auto src_iter_c_m = mem(states_md, src_iter_c);
+        auto dst_layer_m = mem(src_layer_md, nullptr);
+        auto dst_iter_m = mem(states_md, nullptr);
+        auto dst_iter_c_m = mem(states_md, nullptr);
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC_LAYER, src_layer_m},
+                {DNNL_ARG_SRC_ITER, src_iter_m},
+                {DNNL_ARG_SRC_ITER_C, src_iter_c_m},
+                {DNNL_ARG_WEIGHTS_LAYER, weights_layer},
+                {DNNL_ARG_WEIGHTS_ITER, weights_iter},
+                {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst_layer_m},
+                {DNNL_ARG_DST_ITER, dst_iter_m},
+                {DNNL_ARG_DST_ITER_C, dst_iter_c_m}};
+        if (seq_lengths) {
+            memory seq_lengths_m({{batch}, dt::s32, tag::x}, eng);
+            auto ptr = map_memory<int32_t>(seq_lengths_m);
+            for (memory::dim b = 0; b < batch; b++)
+                ptr[b] = seq_lengths[b];
+            args.insert({DNNL_ARG_SEQ_LENGTHS, seq_lengths_m});
+        }
+        lstm_forward(lpd).execute(strm, args);
+        strm.wait();
+
+        auto copy_out = [](const memory &m, float *data) {
+            auto ptr = map_memory<float>(m);
+            for (size_t i = 0; i < m.get_desc().get_size() / sizeof(float);
+                    i++)
+                data[i] = ptr[i];
+        };
+        copy_out(dst_layer_m, dst_layer);
+        copy_out(dst_iter_m, dst_iter);
+        copy_out(dst_iter_c_m, dst_iter_c);
+    };
+
+    memory weights_layer({{l, d, c, g, c}, dt::f32, tag::ldigo}, eng);
+    memory weights_iter({{l, d, c, g, c}, dt::f32, tag::ldigo}, eng);
+    memory bias({{l, d, g, c}, dt::f32, tag::ldgo}, eng);
+    fill_data<float>(l * d * c * g * c, weights_layer, 0.f, 0.2f);
+    fill_data<float>(l * d * c * g * c, weights_iter, 0.f, 0.2f);
+    fill_data<float>(l * d * g * c, bias, 0.f, 0.2f);
+
+    std::vector<float> src_layer(t * mb * c), src_iter(l * mb * c),
+            src_iter_c(l * mb * c);
+    fill_data<float>(src_layer.size(), src_layer.data(), 0.f, 1.f);
+    fill_data<float>(src_iter.size(), src_iter.data(), 0.f, 1.f);
+    fill_data<float>(src_iter_c.size(), src_iter_c.data(), 0.5f, 1.f);
+
+    // sorted by decreasing length, then unsorted
+    const int32_t lengths[2][mb] = {{5, 3, 0}, {2, 5, 4}};
+    for (const auto &seq_lengths : lengths) {
+        std::vector<float> dst_layer(t * mb * c), dst_iter(l * mb * c),
+                dst_iter_c(l * mb * c);
+        run(t, mb, src_layer.data(), src_iter.data(), src_iter_c.data(),
+                weights_layer, weights_iter, bias, dst_layer.data(),
+                dst_iter.data(), dst_iter_c.data(), seq_lengths);
+
+        for (memory::dim b = 0; b < mb; b++) {
+            const memory::dim len = seq_lengths[b];
+            std::vector<float> src_layer_b(t * c), src_iter_b(l * c),
+                    src_iter_c_b(l * c), dst_layer_b(t * c),
+                    dst_iter_b(l * c), dst_iter_c_b(l * c);
+            for (memory::dim it = 0; it < t; it++)
+                for (memory::dim s = 0; s < c; s++)
+                    src_layer_b[it * c + s] = src_layer[(it * mb + b) * c + s];
+            for (memory::dim lay = 0; lay < l; lay++)
+                for (memory::dim s = 0; s < c; s++) {
+                    src_iter_b[lay * c + s] = src_iter[(lay * mb + b) * c + s];
+                    src_iter_c_b[lay * c + s]
+                            = src_iter_c[(lay * mb + b) * c + s];
+                }
+
+            if (len > 0) {
+                run(len, 1, src_layer_b.data(), src_iter_b.data(),
+                        src_iter_c_b.data(), weights_layer, weights_iter, bias,
+                        dst_layer_b.data(), dst_iter_b.data(),
+                        dst_iter_c_b.data(), nullptr);
+            } else {
+                dst_iter_b = src_iter_b;
+                dst_iter_c_b = src_iter_c_b;
+            }
+
+            for (memory::dim it = 0; it < t; it++)
+                for (memory::dim s = 0; s < c; s++) {
+                    const float ref = it < len ? dst_layer_b[it * c + s] : 0.f;
+                    ASSERT_NEAR(dst_layer[(it * mb + b) * c + s], ref, 1e-5);
+                }
+            for (memory::dim lay = 0; lay < l; lay++)
+                for (memory::dim s = 0; s < c; s++) {
+                    ASSERT_NEAR(dst_iter[(lay * mb + b) * c + s],
+                            dst_iter_b[lay * c + s], 1e-5);
+                    ASSERT_NEAR(dst_iter_c[(lay * mb + b) * c + s],
+                            dst_iter_c_b[lay * c + s], 1e-5);
+                }
+        }
+    }
+}
+
+
+// Runs an LSTM with peephole and projection and compares it to a direct
+// implementation of the cell
+TEST(lstm_peephole_projection_test, TestLSTMPeepholeProjection) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "LSTM peephole and projection are supported on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    const memory::dim g = 4, t = 3, mb = 2, slc = 6, dic = 5, dhc = 3;
+
+    auto src_layer_md = memory::desc({t, mb, slc}, dt::f32, tag::tnc);
+    auto src_iter_md = memory::desc({1, 1, mb, dhc}, dt::f32, tag::ldnc);
+    auto src_iter_c_md = memory::desc({1, 1, mb, dic}, dt::f32, tag::ldnc);
+    auto weights_layer_md
+            = memory::desc({1, 1, slc, g, dic}, dt::f32, tag::ldigo);
+    auto weights_iter_md
+            = memory::desc({1, 1, dhc, g, dic}, dt::f32, tag::ldigo);
+    auto weights_peephole_md
+            = memory::desc({1, 1, 3, dic}, dt::f32, tag::ldgo);
+    auto weights_projection_md
+            = memory::desc({1, 1, dic, dhc}, dt::f32, tag::ldio);
+    auto bias_md = memory::desc({1, 1, g, dic}, dt::f32, tag::ldgo);
+    auto dst_layer_md = memory::desc({t, mb, dhc}, dt::f32, tag::tnc);
+
+    auto ld = lstm_forward::desc(prop_kind::forward_inference,
+            rnn_direction::unidirectional_left2right, src_layer_md,
+            src_iter_md, src_iter_c_md, weights_layer_md, weights_iter_md,
+            weights_peephole_md, weights_projection_md, bias_md, dst_layer_md,
+            src_iter_md, src_iter_c_md);
+    auto lpd = lstm_forward::primitive_desc(ld, eng);
+    ASSERT_TRUE(lpd.weights_peephole_desc() == weights_peephole_md);
+    ASSERT_TRUE(lpd.weights_projection_desc() == weights_projection_md);
+
+    memory src_layer(src_layer_md, eng), src_iter(src_iter_md, eng),
+            src_iter_c(src_iter_c_md, eng),
+            weights_layer(weights_layer_md, eng),
+            weights_iter(weights_iter_md, eng),
+            weights_peephole(weights_peephole_md, eng),
+            weights_projection(weights_projection_md, eng),
+            bias(bias_md, eng), dst_layer(dst_layer_md, eng),
+            dst_iter(src_iter_md, eng), dst_iter_c(src_iter_c_md, eng);
+    fill_data<float>(t * mb * slc, src_layer, 0.f, 1.f);
+    fill_data<float>(mb * dhc, src_iter, 0.f, 1.f);
+    fill_data<float>(mb * dic, src_iter_c, 0.5f, 1.f);
+    fill_data<float>(slc * g * dic, weights_layer, 0.f, 0.2f);
+    fill_data<float>(dhc * g * dic, weights_iter, 0.f, 0.2f);
+    fill_data<float>(3 * dic, weights_peephole, 0.f, 0.5f);
+    fill_data<float>(dic * dhc, weights_projection, 0.f, 0.5f);
+    fill_data<float>(g * dic, bias, 0.f, 0.2f);
+
+    lstm_forward(lpd).execute(strm,
+            {{DNNL_ARG_SRC_LAYER, src_layer}, {DNNL_ARG_SRC_ITER, src_iter},
+                    {DNNL_ARG_SRC_ITER_C, src_iter_c},
+                    {DNNL_ARG_WEIGHTS_LAYER, weights_layer},
+                    {DNNL_ARG_WEIGHTS_ITER, weights_iter},
+                    {DNNL_ARG_WEIGHTS_PEEPHOLE, weights_peephole},
+                    {DNNL_ARG_WEIGHTS_PROJECTION, weights_projection},
+                    {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst_layer},
+                    {DNNL_ARG_DST_ITER, dst_iter},
+                    {DNNL_ARG_DST_ITER_C, dst_iter_c}});
+    strm.wait();
+
+    auto x = map_memory<float>(src_layer);
+    auto wl = map_memory<float>(weights_layer);
+    auto wi = map_memory<float>(weights_iter);
+    auto wp = map_memory<float>(weights_peephole);
+    auto wr = map_memory<float>(weights_projection);
+    auto b = map_memory<float>(bias);
+    auto h_dst = map_memory<float>(dst_layer);
+    auto h_last = map_memory<float>(dst_iter);
+    auto c_last = map_memory<float>(dst_iter_c);
+
+    auto sigmoid = [](float a) { return 1.f / (1.f + expf(-a)); };
+    std::vector<float> h(mb * dhc), c(mb * dic), ht(dic), gates(g * dic);
+    {
+        auto h0 = map_memory<float>(src_iter);
+        auto c0 = map_memory<float>(src_iter_c);
+        for (memory::dim i = 0; i < mb * dhc; i++)
+            h[i] = h0[i];
+        for (memory::dim i = 0; i < mb * dic; i++)
+            c[i] = c0[i];
+    }
+    for (memory::dim it = 0; it < t; it++)
+        for (memory::dim n = 0; n < mb; n++) {
+            for (memory::dim o = 0; o < g * dic; o++) {
+                float acc = b[o];
+                for (memory::dim s = 0; s < slc; s++)
+                    acc += x[(it * mb + n) * slc + s] * wl[s * g * dic + o];
+                for (memory::dim s = 0; s < dhc; s++)
+                    acc += h[n * dhc + s] * wi[s * g * dic + o];
+                gates[o] = acc;
+            }
+            for (memory::dim j = 0; j < dic; j++) {
+                float &ct = c[n * dic + j];
+                float gi = sigmoid(gates[j] + wp[j] * ct);
+                float gf = sigmoid(gates[dic + j] + wp[dic + j] * ct);
+                float gc = tanhf(gates[2 * dic + j]);
+                ct = gf * ct + gi * gc;
+                float go = sigmoid(gates[3 * dic + j] + wp[2 * dic + j] * ct);
+                ht[j] = go * tanhf(ct);
+            }
+            for (memory::dim k = 0; k < dhc; k++) {
+                float acc = 0.f;
+                for (memory::dim j = 0; j < dic; j++)
+                    acc += ht[j] * wr[j * dhc + k];
+                h[n * dhc + k] = acc;
+                ASSERT_NEAR(h_dst[(it * mb + n) * dhc + k], acc, 1e-5);
+            }
+        }
+    for (memory::dim i = 0; i < mb * dhc; i++)
+        ASSERT_NEAR(h_last[i], h[i], 1e-5);
+    for (memory::dim i = 0; i < mb * dic; i++)
+        ASSERT_NEAR(c_last[i], c[i], 1e-5);
+}
+
+// Feeds a multi-layer LSTM to a stateful primitive in chunks of time steps
+// and compares it to a single run over the whole sequence
+TEST(rnn_stateful_test, TestLSTMChunks) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Stateful execution is supported on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    const memory::dim l = 2, d = 1, g = 4, t = 6, chunk = 2, mb = 3, c = 8;
+
+    auto states_md = memory::desc({l, d, mb, c}, dt::f32, tag::ldnc);
+    memory weights_layer({{l, d, c, g, c}, dt::f32, tag::ldigo}, eng);
+    memory weights_iter({{l, d, c, g, c}, dt::f32, tag::ldigo}, eng);
+    memory bias({{l, d, g, c}, dt::f32, tag::ldgo}, eng);
+    fill_data<float>(l * d * c * g * c, weights_layer, 0.f, 0.2f);
+    fill_data<float>(l * d * c * g * c, weights_iter, 0.f, 0.2f);
+    fill_data<float>(l * d * g * c, bias, 0.f, 0.2f);
+
+    memory src_iter(states_md, eng), src_iter_c(states_md, eng),
+            dst_iter(states_md, eng), dst_iter_c(states_md, eng);
+    fill_data<float>(l * mb * c, src_iter, 0.f, 1.f);
+    fill_data<float>(l * mb * c, src_iter_c, 0.5f, 1.f);
+
+    auto lstm_pd = [&](memory::dim n_iter, rnn_flags flags) {
+        auto src_layer_md = memory::desc({n_iter, mb, c}, dt::f32, tag::tnc);
+        auto ld = lstm_forward::desc(prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, src_layer_md,
+                states_md, states_md, weights_layer.get_desc(),
+                weights_iter.get_desc(), bias.get_desc(), src_layer_md,
+                states_md, states_md, flags);
+        return lstm_forward::primitive_desc(ld, eng);
+    };
+
+    // reference: the whole sequence at once
+    auto ref_pd = lstm_pd(t, rnn_flags::undef);
+    memory src_layer(ref_pd.src_layer_desc(), eng),
+            ref_dst_layer(ref_pd.dst_layer_desc(), eng),
+            ref_dst_iter(states_md, eng), ref_dst_iter_c(states_md, eng);
+    fill_data<float>(t * mb * c, src_layer, 0.f, 1.f);
+    lstm_forward(ref_pd).execute(strm,
+            {{DNNL_ARG_SRC_LAYER, src_layer}, {DNNL_ARG_SRC_ITER, src_iter},
+                    {DNNL_ARG_SRC_ITER_C, src_iter_c},
+                    {DNNL_ARG_WEIGHTS_LAYER, weights_layer},
+                    {DNNL_ARG_WEIGHTS_ITER, weights_iter},
+                    {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, ref_dst_layer},
+                    {DNNL_ARG_DST_ITER, ref_dst_iter},
+                    {DNNL_ARG_DST_ITER_C, ref_dst_iter_c}});
+    strm.wait();
+
+    auto chunk_pd = lstm_pd(chunk, rnn_flags::stateful);
+    auto lstm = lstm_forward(chunk_pd);
+    memory chunk_src_layer(chunk_pd.src_layer_desc(), eng),
+            chunk_dst_layer(chunk_pd.dst_layer_desc(), eng);
+    auto x = map_memory<float>(src_layer);
+    auto ref_h = map_memory<float>(ref_dst_layer);
+    const memory::dim chunk_sz = chunk * mb * c;
+
+    // the sequence is fed twice, the states being reset by src_iter at the
+    // start of each pass
+    for (int pass = 0; pass < 2; pass++)
+        for (memory::dim it = 0; it < t; it += chunk) {
+            {
+                auto ptr = map_memory<float>(chunk_src_layer);
+                for (memory::dim i = 0; i < chunk_sz; i++)
+                    ptr[i] = x[it * mb * c + i];
+            }
+            std::unordered_map<int, memory> args
+                    = {{DNNL_ARG_SRC_LAYER, chunk_src_layer},
+                            {DNNL_ARG_WEIGHTS_LAYER, weights_layer},
+                            {DNNL_ARG_WEIGHTS_ITER, weights_iter},
+                            {DNNL_ARG_BIAS, bias},
+                            {DNNL_ARG_DST_LAYER, chunk_dst_layer}};
+            if (it == 0) {
+                args.insert({DNNL_ARG_SRC_ITER, src_iter});
+                args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+            }
+            if (it + chunk == t) {
+                args.insert({DNNL_ARG_DST_ITER, dst_iter});
+                args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+            }
+            lstm.execute(strm, args);
+            strm.wait();
+
+            auto h = map_memory<float>(chunk_dst_layer);
+            for (memory::dim i = 0; i < chunk_sz; i++)
+                ASSERT_NEAR(h[i], ref_h[it * mb * c + i], 1e-5);
+        }
+
+    auto h_last = map_memory<float>(dst_iter);
+    auto c_last = map_memory<float>(dst_iter_c);
+    auto ref_h_last = map_memory<float>(ref_dst_iter);
+    auto ref_c_last = map_memory<float>(ref_dst_iter_c);
+    for (memory::dim i = 0; i < l * mb * c; i++) {
+        ASSERT_NEAR(h_last[i], ref_h_last[i], 1e-5);
+        ASSERT_NEAR(c_last[i], ref_c_last[i], 1e-5);
+    }
+
+    // stateful execution is defined for forward inference only
+    auto src_layer_md = memory::desc({chunk, mb, c}, dt::f32, tag::tnc);
+    EXPECT_ANY_THROW(lstm_forward::desc(prop_kind::forward_training,
+            rnn_direction::unidirectional_left2right, src_layer_md, states_md,
+            states_md, weights_layer.get_desc(), weights_iter.get_desc(),
+            bias.get_desc(), src_layer_md, states_md, states_md,
+            rnn_flags::stateful));
+}
+
 } // namespace dnnl
@@ -261,6 +261,20 @@ using shuffle_test_u8 = shuffle_test<uint8_t>;
                             memory::format_tag::nChw8c, {1, 8, 1, 1}, 1, 4}, \
                     shuffle_test_params {prop_kind::forward_training, \
                             memory::format_tag::nChw8c, {1, 8, 1, 1}, 1, 2})); \
+\
+    INSTANTIATE_TEST_SUITE_P(TestShuffle_ShuffleNet, test, \
+            ::testing::Values( \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::nChw16c, {1, 116, 28, 28}, 1, \
+                            2}, \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::nChw8c, {1, 232, 14, 14}, 1, \
+                            2}, \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::nhwc, {3, 58, 7, 7}, 1, 2}, \
+                    shuffle_test_params {prop_kind::forward_training, \
+                            memory::format_tag::ndhwc, {2, 36, 2, 5, 5}, 1, \
+                            3})); \
 \
     INSTANTIATE_TEST_SUITE_P(TestShuffle_nCdhw16c, test, \
             ::testing::Values( \
@@ -17,7 +17,10 @@
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
+#include <cmath>
 #include <memory>
+
+#include "cpu_isa_traits.hpp"
 #include "dnnl.hpp"
 
 namespace dnnl {
@@ -35,11 +38,12 @@ void check_softmax_bwd(
     const dnnl::impl::memory_desc_wrapper dst_mdw(dst_pd.data);
     const dnnl::impl::memory_desc_wrapper diff_dst_mdw(diff_dst_pd.data);
 
-    ASSERT_EQ(diff_dst_mdw.data_type(),
-            memory::data_type::f32); // TODO: type assert
+    const bool is_bf16
+            = data_traits<data_t>::data_type == memory::data_type::bf16;
 
     auto ndims = diff_dst_pd.data.ndims;
-    const float eps = 1e-7; //TODO: What should be the threshold?
+    // bf16 results are rounded, so the threshold is relative
+    const float eps = is_bf16 ? 0.0078125f : 1e-7f;
 
     memory::dim OU = 1;
     for (int d = 0; d < axis; ++d)
@@ -58,14 +62,17 @@ void check_softmax_bwd(
         for (memory::dim c = 0; c < C; ++c) {
             auto off_d = dst_mdw.off_l(idx_start + c * IN);
             auto off_dd = diff_dst_mdw.off_l(idx_start + c * IN);
-            sbr += dst_ptr[off_d] * diff_dst_ptr[off_dd];
+            sbr += (float)dst_ptr[off_d] * diff_dst_ptr[off_dd];
         }
 
         for (memory::dim c = 0; c < C; ++c) {
             auto off_d = dst_mdw.off_l(idx_start + c * IN);
             auto off_dd = diff_dst_mdw.off_l(idx_start + c * IN);
-            data_t diff_src_ref = dst_ptr[off_d] * (diff_dst_ptr[off_dd] - sbr);
-            ASSERT_NEAR(diff_src_ptr[off_dd], diff_src_ref, eps);
+            float diff_src_ref
+                    = dst_ptr[off_d] * ((float)diff_dst_ptr[off_dd] - sbr);
+            float tol = is_bf16 ? eps * std::max(1.f, std::fabs(diff_src_ref))
+                                : eps;
+            ASSERT_NEAR(diff_src_ptr[off_dd], diff_src_ref, tol);
         }
     });
 }
@@ -88,6 +95,11 @@ class softmax_test
 protected:
     virtual void SetUp() {
         p = ::testing::TestWithParam<softmax_test_params<data_t>>::GetParam();
+        SKIP_IF(get_test_engine_kind() == engine::kind::cpu
+                        && data_traits<data_t>::data_type
+                                == memory::data_type::bf16
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "current ISA doesn't support bfloat16 data type");
         catch_expected_failures(
                 [=]() { Test(); }, p.expect_to_fail, p.expected_status);
     }
@@ -191,5 +203,33 @@ INSTANTIATE_TEST_SUITE_P(TestSoftmaxBackward, softmax_backward_test_float,
                 softmax_bwd_test_params_float {memory::format_tag::nChw8c,
                         memory::format_tag::nChw8c, {64, 1011, 1, 1}, 1},
                 softmax_bwd_test_params_float {memory::format_tag::nChw8c,
-                        memory::format_tag::nChw8c, {2, 1011, 32, 1}, 2}));
+                        memory::format_tag::nChw8c, {2, 1011, 32, 1}, 2},
+                softmax_bwd_test_params_float {memory::format_tag::nChw16c,
+                        memory::format_tag::nChw16c, {2, 40, 5, 7}, 1},
+                softmax_bwd_test_params_float {memory::format_tag::nChw16c,
+                        memory::format_tag::nChw16c, {2, 32, 5, 7}, 2},
+                softmax_bwd_test_params_float {memory::format_tag::nhwc,
+                        memory::format_tag::nhwc, {2, 19, 5, 7}, 3}));
+
+using softmax_backward_test_bfloat16 = softmax_test<bfloat16_t>;
+using softmax_bwd_test_params_bfloat16 = softmax_test_params<bfloat16_t>;
+
+TEST_P(softmax_backward_test_bfloat16, TestsSoftmax) {}
+INSTANTIATE_TEST_SUITE_P(TestSoftmaxBackwardBfloat16,
+        softmax_backward_test_bfloat16,
+        ::testing::Values(
+                softmax_bwd_test_params_bfloat16 {memory::format_tag::nchw,
+                        memory::format_tag::nchw, {2, 0, 5, 5}, 1},
+                softmax_bwd_test_params_bfloat16 {memory::format_tag::nchw,
+                        memory::format_tag::nchw, {2, 19, 16, 16}, 1},
+                softmax_bwd_test_params_bfloat16 {memory::format_tag::nchw,
+                        memory::format_tag::nchw, {2, 19, 16, 16}, 3},
+                softmax_bwd_test_params_bfloat16 {memory::format_tag::nc,
+                        memory::format_tag::nc, {16, 1000}, 1},
+                softmax_bwd_test_params_bfloat16 {memory::format_tag::nc,
+                        memory::format_tag::nc, {16, 1000}, 0},
+                softmax_bwd_test_params_bfloat16 {memory::format_tag::nChw16c,
+                        memory::format_tag::nChw16c, {2, 40, 5, 7}, 1},
+                softmax_bwd_test_params_bfloat16 {memory::format_tag::nChw16c,
+                        memory::format_tag::nChw16c, {2, 32, 5, 7}, 2}));
 } // namespace dnnl
@@ -17,6 +17,7 @@
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
+#include "cpu_isa_traits.hpp"
 #include "dnnl.hpp"
 
 namespace dnnl {
@@ -164,6 +165,11 @@ class softmax_test
 protected:
     virtual void SetUp() {
         p = ::testing::TestWithParam<softmax_test_params<data_t>>::GetParam();
+        SKIP_IF(get_test_engine_kind() == engine::kind::cpu
+                        && data_traits<data_t>::data_type
+                                == memory::data_type::bf16
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "current ISA doesn't support bfloat16 data type");
         catch_expected_failures(
                 [=]() { Test(); }, p.expect_to_fail, p.expected_status);
     }
@@ -264,10 +270,18 @@ INSTANTIATE_TEST_SUITE_P(TestSoftmaxForwardFloat, softmax_forward_test_float,
                 softmax_fwd_test_params_float {prop_kind::forward_scoring,
                         memory::format_tag::nChw8c, {64, 1011, 1, 1}, 1},
                 softmax_fwd_test_params_float {prop_kind::forward_scoring,
-                        memory::format_tag::nChw8c, {2, 1000, 32, 1}, 2}));
+                        memory::format_tag::nChw8c, {2, 1000, 32, 1}, 2},
+                softmax_fwd_test_params_float {prop_kind::forward_scoring,
+                        memory::format_tag::nChw16c, {2, 40, 5, 7}, 1},
+                softmax_fwd_test_params_float {prop_kind::forward_scoring,
+                        memory::format_tag::nChw16c, {2, 32, 5, 7}, 2},
+                softmax_fwd_test_params_float {prop_kind::forward_scoring,
+                        memory::format_tag::nhwc, {2, 19, 5, 7}, 1},
+                softmax_fwd_test_params_float {prop_kind::forward_scoring,
+                        memory::format_tag::nhwc, {2, 19, 5, 7}, 3}));
 
 TEST_P(softmax_forward_test_bfloat16, TestsSoftmax) {}
-GPU_INSTANTIATE_TEST_SUITE_P(TestSoftmaxForwardBfloat16,
+INSTANTIATE_TEST_SUITE_P(TestSoftmaxForwardBfloat16,
         softmax_forward_test_bfloat16,
         ::testing::Values(
                 softmax_fwd_test_params_bfloat16 {prop_kind::forward_scoring,
@@ -295,7 +309,13 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestSoftmaxForwardBfloat16,
                 softmax_fwd_test_params_bfloat16 {prop_kind::forward_scoring,
                         memory::format_tag::nc, {2, 1000}, 0},
                 softmax_fwd_test_params_bfloat16 {prop_kind::forward_scoring,
-                        memory::format_tag::nc, {2, 1000}, 1}));
+                        memory::format_tag::nc, {2, 1000}, 1},
+                softmax_fwd_test_params_bfloat16 {prop_kind::forward_scoring,
+                        memory::format_tag::nChw16c, {2, 40, 5, 7}, 1},
+                softmax_fwd_test_params_bfloat16 {prop_kind::forward_scoring,
+                        memory::format_tag::nChw16c, {2, 32, 5, 7}, 2},
+                softmax_fwd_test_params_bfloat16 {prop_kind::forward_scoring,
+                        memory::format_tag::nhwc, {2, 19, 5, 7}, 1}));
 
 TEST_P(softmax_forward_test_half, TestsSoftmax) {}
 GPU_INSTANTIATE_TEST_SUITE_P(TestSoftmaxForwardHalf, softmax_forward_test_half,
@@ -213,7 +213,18 @@ static auto simple_test_cases = [](bool omit_output) {
             sum_test_params {{fmt::nchw, fmt::nChw8c}, fmt::nchw,
                     {32, 32, 13, 14}, {2.0f, 3.0f}, omit_output},
             sum_test_params {{fmt::nChw16c, fmt::nChw8c}, fmt::nChw16c,
-                    {2, 16, 3, 3}, {2.0f, 3.0f}, omit_output});
+                    {2, 16, 3, 3}, {2.0f, 3.0f}, omit_output},
+            sum_test_params {{fmt::nChw16c, fmt::nChw16c}, fmt::nChw16c,
+                    {2, 19, 3, 5}, {2.0f, 3.0f}, omit_output},
+            sum_test_params {{fmt::nChw8c, fmt::nChw8c, fmt::nChw8c},
+                    fmt::nChw8c, {3, 13, 7, 7}, {2.0f, 1.0f, 3.0f},
+                    omit_output},
+            sum_test_params {std::vector<fmt>(17, fmt::nhwc), fmt::nhwc,
+                    {2, 5, 9, 7},
+                    {1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f,
+                            -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f,
+                            1.0f},
+                    omit_output});
 };
 
 static auto simple_test_cases_bf16 = [](bool omit_output) {
@@ -338,4 +349,47 @@ GPU_INST_TEST_CASE(sum_test_f16, 0)
 
 #undef CPU_INST_TEST_CASE
 #undef GPU_INST_TEST_CASE
+
+TEST(sum_test_mixed, TestMixedDataTypes) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Mixed data types are tested on CPU only");
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    using dt = memory::data_type;
+    const memory::dims dims = {2, 19, 3, 5};
+    std::vector<memory::desc> srcs_md
+            = {memory::desc(dims, dt::s8, fmt::nChw16c),
+                    memory::desc(dims, dt::u8, fmt::nChw16c)};
+    auto dst_md = memory::desc(dims, dt::u8, fmt::nChw16c);
+    const std::vector<float> scales = {0.5f, 0.25f};
+
+    memory src0(srcs_md[0], eng), src1(srcs_md[1], eng), dst(dst_md, eng);
+    fill_data<int8_t>(srcs_md[0].get_size(), src0);
+    fill_data<uint8_t>(srcs_md[1].get_size(), src1);
+    check_zero_tail<int8_t>(1, src0);
+    check_zero_tail<uint8_t>(1, src1);
+
+    auto sum_pd = sum::primitive_desc(dst_md, scales, srcs_md, eng);
+    sum(sum_pd).execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, src0}, {DNNL_ARG_MULTIPLE_SRC + 1, src1},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto src0_data = map_memory<const int8_t>(src0);
+    auto src1_data = map_memory<const uint8_t>(src1);
+    auto dst_data = map_memory<const uint8_t>(dst);
+    const dnnl::impl::memory_desc_wrapper mdw(dst_md.data);
+    for_(memory::dim n = 0; n < dims[0]; n++)
+    for_(memory::dim c = 0; c < dims[1]; c++)
+    for_(memory::dim h = 0; h < dims[2]; h++)
+    for (memory::dim w = 0; w < dims[3]; w++) {
+        const auto off = mdw.off(n, c, h, w);
+        const float acc
+                = scales[0] * src0_data[off] + scales[1] * src1_data[off];
+        const float ref = std::min(std::max(nearbyintf(acc), 0.f), 255.f);
+        ASSERT_EQ(dst_data[off], ref);
+    }
+}
+
 } // namespace dnnl